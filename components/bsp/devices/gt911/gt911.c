@@ -5,20 +5,71 @@
 
 #include "gt911.h"
 #include "esp_lcd_touch_gt911.h"
+#include <string.h>
 
 static const char *TAG = "GT911";
 
+// esp_lcd_touch_gt911 is used to set the controller up. Points are read
+// directly: the status comes with the first point in one transfer and the
+// other points are only read when reported.
+#define GT911_REG_CONFIG          (0x8047)
+#define GT911_REG_REFRESH_RATE    (0x8056)  // Bits 0-3: report period 5 + N ms
+#define GT911_REG_CONFIG_CHECKSUM (0x80ff)
+#define GT911_REG_STATUS          (0x814e)  // Bit 7: buffer ready, bits 0-3: point count
+#define GT911_CONFIG_SIZE         (GT911_REG_CONFIG_CHECKSUM - GT911_REG_CONFIG)
+#define GT911_POINT_SIZE          (8)
+#define GT911_POINT_MAX           (5)
+#define GT911_REPORT_RATE_MIN_HZ  (50)   // 20 ms period
+#define GT911_REPORT_RATE_MAX_HZ  (200)  // 5 ms period
+
 struct gt911_touch_state {
     esp_lcd_panel_io_handle_t io_handle;
     esp_lcd_touch_handle_t handle;
-    SemaphoreHandle_t interrupt_semaphore;
+    TaskHandle_t consumer;  // Last task that waited for the interrupt
+    esp_lcd_touch_point_data_t points[GT911_POINT_MAX];  // Last report, repeated while no new one is ready
+    uint8_t point_num;
+    bool config_read;     // config_sum and refresh_rate are known
+    uint8_t config_sum;   // Of the configuration without the refresh rate register
+    uint8_t refresh_rate; // Register value the controller runs with
 };
 
 static void gt911_touch_interrupt_callback(esp_lcd_touch_handle_t tp) {
     struct gt911_touch_state *state = tp->config.user_data;
-    BaseType_t pxHigherPriorityTaskWoken;
-    xSemaphoreGiveFromISR(state->interrupt_semaphore, &pxHigherPriorityTaskWoken);
-    portYIELD_FROM_ISR(pxHigherPriorityTaskWoken);
+    bsp_touch_notify_from_isr(state->consumer);
+}
+
+// Changes the report period register only. The checksum covers the whole
+// configuration, so the sum of the other bytes is read once and kept, then the
+// register, the checksum and the fresh flag after it are written.
+esp_err_t gt911_touch_set_report_rate(gt911_touch_t state, uint16_t rate_hz) {
+    if (rate_hz < GT911_REPORT_RATE_MIN_HZ || rate_hz > GT911_REPORT_RATE_MAX_HZ) return ESP_ERR_INVALID_ARG;
+    esp_err_t ret;
+    if (!state->config_read) {
+        uint8_t config[GT911_CONFIG_SIZE];
+        ret = esp_lcd_panel_io_rx_param(state->io_handle, GT911_REG_CONFIG, config, GT911_CONFIG_SIZE);
+        if (ret != ESP_OK) return ret;
+        int index = GT911_REG_REFRESH_RATE - GT911_REG_CONFIG;
+        state->refresh_rate = config[index];
+        state->config_sum = 0;
+        for (int i = 0; i < GT911_CONFIG_SIZE; i++) {
+            if (i != index) state->config_sum += config[i];
+        }
+        state->config_read = true;
+    }
+
+    int period = 1000 / rate_hz;
+    uint8_t refresh_rate = (state->refresh_rate & 0xf0) | (period - 5);
+    if (refresh_rate == state->refresh_rate) return ESP_OK;
+
+    ret = esp_lcd_panel_io_tx_param(state->io_handle, GT911_REG_REFRESH_RATE, &refresh_rate, 1);
+    if (ret != ESP_OK) return ret;
+    uint8_t checksum[2] = { ~(uint8_t)(state->config_sum + refresh_rate) + 1, 1 };
+    ret = esp_lcd_panel_io_tx_param(state->io_handle, GT911_REG_CONFIG_CHECKSUM, checksum, sizeof(checksum));
+    if (ret != ESP_OK) return ret;
+    state->refresh_rate = refresh_rate;
+
+    ESP_LOGI(TAG, "Report period %d ms", period);
+    return ESP_OK;
 }
 
 esp_err_t gt911_touch_init(const gt911_touch_config_t *config, gt911_touch_t *touch) {
@@ -62,15 +113,14 @@ esp_err_t gt911_touch_init(const gt911_touch_config_t *config, gt911_touch_t *to
         return ret;
     }
 
-    if (config->interrupt) {
-        state->interrupt_semaphore = xSemaphoreCreateBinary();
-        if (!state->interrupt_semaphore) {
-            esp_lcd_touch_del(state->handle);
-            esp_lcd_panel_io_del(state->io_handle);
-            free(state);
-            return ESP_ERR_NO_MEM;
+    if (config->report_rate_hz) {
+        ret = gt911_touch_set_report_rate(state, config->report_rate_hz);
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to set report rate: %s", esp_err_to_name(ret));  // Keeps working at the old rate
         }
+    }
 
+    if (config->interrupt) {
         ret = gpio_config(&(gpio_config_t){
             .mode = GPIO_MODE_INPUT,
             .pin_bit_mask = 1 << config->int_gpio,
@@ -105,19 +155,55 @@ esp_err_t gt911_touch_deinit(gt911_touch_t touch) {
 
 int gt911_touch_read(gt911_touch_t touch, esp_lcd_touch_point_data_t *points, uint8_t max_points) {
     if (max_points == 0) return 0;
-    if (max_points > 5) max_points = 5;
-
-    esp_err_t ret = esp_lcd_touch_read_data(touch->handle);
+    if (max_points > GT911_POINT_MAX) max_points = GT911_POINT_MAX;
+
+    // Status and the first point, most reports have one finger
+    uint8_t data[1 + GT911_POINT_SIZE * GT911_POINT_MAX];
+    esp_err_t ret = esp_lcd_panel_io_rx_param(touch->io_handle, GT911_REG_STATUS, data, 1 + GT911_POINT_SIZE);
+    if (ret == ESP_OK && (data[0] & 0x80)) {
+        int point_num = data[0] & 0x0f;
+        if (point_num > GT911_POINT_MAX) point_num = GT911_POINT_MAX;
+        if (point_num > 1) {
+            ret = esp_lcd_panel_io_rx_param(touch->io_handle, GT911_REG_STATUS + 1 + GT911_POINT_SIZE,
+                                            &data[1 + GT911_POINT_SIZE], (point_num - 1) * GT911_POINT_SIZE);
+        }
+        uint8_t clear = 0;
+        esp_lcd_panel_io_tx_param(touch->io_handle, GT911_REG_STATUS, &clear, 1);  // Lets the controller report again
+        if (ret == ESP_OK) {
+            for (int i = 0; i < point_num; i++) {
+                const uint8_t *point = &data[1 + GT911_POINT_SIZE * i];
+                touch->points[i] = (esp_lcd_touch_point_data_t){
+                    .track_id = point[0],
+                    .x = point[1] | point[2] << 8,
+                    .y = point[3] | point[4] << 8,
+                    .strength = point[5] | point[6] << 8,
+                };
+            }
+            touch->point_num = point_num;
+        }
+    }
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to read touch data: %s", esp_err_to_name(ret));
         return 0;
     }
 
-    uint8_t count = 0;
-    esp_lcd_touch_get_data(touch->handle, points, &count, max_points);
+    uint8_t count = touch->point_num < max_points ? touch->point_num : max_points;
+    memcpy(points, touch->points, count * sizeof(*points));
     return count;
 }
 
-void gt911_touch_wait_interrupt(gt911_touch_t touch) {
-    xSemaphoreTake(touch->interrupt_semaphore, portMAX_DELAY);
+int64_t gt911_touch_wait_interrupt(gt911_touch_t touch) {
+    touch->consumer = xTaskGetCurrentTaskHandle();
+    return bsp_touch_wait_notify();
 }
+
+// MARK: Driver
+static int gt911_touch_driver_read(void *touch, esp_lcd_touch_point_data_t *points, uint8_t max_points) { return gt911_touch_read(touch, points, max_points); }
+static int64_t gt911_touch_driver_wait_interrupt(void *touch) { return gt911_touch_wait_interrupt(touch); }
+static esp_err_t gt911_touch_driver_set_report_rate(void *touch, uint16_t rate_hz) { return gt911_touch_set_report_rate(touch, rate_hz); }
+
+const bsp_touch_driver_t gt911_touch_driver = {
+    .read = gt911_touch_driver_read,
+    .wait_interrupt = gt911_touch_driver_wait_interrupt,
+    .set_report_rate = gt911_touch_driver_set_report_rate,
+};
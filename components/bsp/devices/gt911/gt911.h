@@ -5,6 +5,7 @@
 
 #pragma once
 #include "bsp_private.h"
+#include "bsp_driver.h"
 #include "misc/bsp_display.h"
 #include "driver/i2c_master.h"
 #include "esp_lcd_touch.h"
@@ -16,6 +17,7 @@ typedef struct {
     gpio_num_t rst_gpio;
     uint32_t scl_speed_hz;
     bool interrupt;
+    uint16_t report_rate_hz;  // 50 to 200, 0 keeps the controller's configuration
 } gt911_touch_config_t;
 
 typedef struct gt911_touch_state *gt911_touch_t;
@@ -23,4 +25,7 @@ typedef struct gt911_touch_state *gt911_touch_t;
 BSP_NONNULL(1, 2) esp_err_t gt911_touch_init(const gt911_touch_config_t *config, gt911_touch_t *touch);
 BSP_NONNULL(1) esp_err_t gt911_touch_deinit(gt911_touch_t touch);
 BSP_NONNULL(1, 2) int gt911_touch_read(gt911_touch_t touch, esp_lcd_touch_point_data_t *points, uint8_t max_points);
-BSP_NONNULL(1) void gt911_touch_wait_interrupt(gt911_touch_t touch);
+BSP_NONNULL(1) int64_t gt911_touch_wait_interrupt(gt911_touch_t touch);  // Returns the esp_timer time of the interrupt
+BSP_NONNULL(1) esp_err_t gt911_touch_set_report_rate(gt911_touch_t touch, uint16_t rate_hz);  // 50 to 200, ESP_ERR_INVALID_ARG otherwise
+
+extern const bsp_touch_driver_t gt911_touch_driver;
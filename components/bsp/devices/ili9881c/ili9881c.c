@@ -12,6 +12,9 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_mipi_dsi.h"
 #include "esp_lcd_ili9881c.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "bsp_dsi.h"
 
 struct ili9881c_lcd_state {
     ledc_timer_config_t ledc_timer;
@@ -24,8 +27,33 @@ struct ili9881c_lcd_state {
     bsp_pixel_format_t pixel_format;
     uint8_t fb_num;
     void *frame_buffers[3];
+    SemaphoreHandle_t refresh_semaphore;
+    const bsp_dsi_timing_t *timing;
+    const bsp_dsi_timing_t *volatile pending_timing;  // Applied by the next refresh done callback
+    bsp_dsi_refresh_counter_t refresh;
 };
 
+// 75 MHz over 940 x 1324 is 60 Hz, the idle profile stretches the vertical
+// front porch to 30 Hz
+static const bsp_dsi_timing_t ili9881c_lcd_timings[BSP_DISPLAY_PROFILE_NUM] = {
+    [BSP_DISPLAY_PROFILE_ACTIVE] = { 75, 40, 140, 40, 4, 20, 20 },
+    [BSP_DISPLAY_PROFILE_IDLE] = { 75, 40, 140, 40, 4, 20, 1356 },
+};
+
+static bool ili9881c_lcd_refresh_done(esp_lcd_panel_handle_t panel, esp_lcd_dpi_panel_event_data_t *edata, void *user_ctx) {
+    struct ili9881c_lcd_state *state = user_ctx;
+    bsp_dsi_refresh_count(&state->refresh);
+    const bsp_dsi_timing_t *timing = state->pending_timing;
+    if (timing) {
+        bsp_dsi_apply_vertical_timing(0, timing, state->size);
+        state->timing = timing;
+        state->pending_timing = NULL;
+    }
+    BaseType_t task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(state->refresh_semaphore, &task_woken);
+    return task_woken == pdTRUE;
+}
+
 esp_err_t ili9881c_lcd_init(const ili9881c_lcd_config_t *config, ili9881c_lcd_t *lcd) {
     esp_err_t ret;
 
@@ -40,6 +68,7 @@ esp_err_t ili9881c_lcd_init(const ili9881c_lcd_config_t *config, ili9881c_lcd_t
     if (state->fb_num > 3) state->fb_num = 3;
 
     bool rgb888 = (config->pixel_format == BSP_PIXEL_FORMAT_RGB888);
+    state->timing = &ili9881c_lcd_timings[config->profile < BSP_DISPLAY_PROFILE_NUM ? config->profile : BSP_DISPLAY_PROFILE_ACTIVE];
 
     // Setup Backlight using LEDC
     state->ledc_timer = (ledc_timer_config_t){
@@ -94,18 +123,18 @@ esp_err_t ili9881c_lcd_init(const ili9881c_lcd_config_t *config, ili9881c_lcd_t
     esp_lcd_dpi_panel_config_t dpi_config = {
         .virtual_channel = 0,
         .dpi_clk_src = MIPI_DSI_DPI_CLK_SRC_DEFAULT,
-        .dpi_clock_freq_mhz = 75,
+        .dpi_clock_freq_mhz = state->timing->dpi_clock_freq_mhz,
         .pixel_format = rgb888 ? LCD_COLOR_PIXEL_FORMAT_RGB888 : LCD_COLOR_PIXEL_FORMAT_RGB565,
         .num_fbs = state->fb_num,
         .video_timing = {
             .h_size = config->size.width,
             .v_size = config->size.height,
-            .hsync_pulse_width = 40,
-            .hsync_back_porch = 140,
-            .hsync_front_porch = 40,
-            .vsync_pulse_width = 4,
-            .vsync_back_porch = 20,
-            .vsync_front_porch = 20,
+            .hsync_pulse_width = state->timing->hsync_pulse_width,
+            .hsync_back_porch = state->timing->hsync_back_porch,
+            .hsync_front_porch = state->timing->hsync_front_porch,
+            .vsync_pulse_width = state->timing->vsync_pulse_width,
+            .vsync_back_porch = state->timing->vsync_back_porch,
+            .vsync_front_porch = state->timing->vsync_front_porch,
         },
         .flags = {
             .use_dma2d = 1,
@@ -149,9 +178,22 @@ esp_err_t ili9881c_lcd_init(const ili9881c_lcd_config_t *config, ili9881c_lcd_t
     state->frame_buffers[1] = fb1;
     state->frame_buffers[2] = fb2;
 
+    // Refresh done event, lets callers know when a frame buffer swap took effect
+    state->refresh_semaphore = xSemaphoreCreateBinary();
+    if (state->refresh_semaphore == NULL) {
+        ret = ESP_ERR_NO_MEM;
+        goto err_panel;
+    }
+    ret = esp_lcd_dpi_panel_register_event_callbacks(state->panel, &(esp_lcd_dpi_panel_event_callbacks_t){
+        .on_refresh_done = ili9881c_lcd_refresh_done,
+    }, state);
+    if (ret != ESP_OK) goto err_semaphore;
+
     *lcd = state;
     return ESP_OK;
 
+err_semaphore:
+    vSemaphoreDelete(state->refresh_semaphore);
 err_panel:
     esp_lcd_panel_del(state->panel);
 err_io:
@@ -167,6 +209,7 @@ err_free:
 
 esp_err_t ili9881c_lcd_deinit(ili9881c_lcd_t lcd) {
     esp_lcd_panel_del(lcd->panel);
+    vSemaphoreDelete(lcd->refresh_semaphore);
     esp_lcd_panel_io_del(lcd->io);
     esp_lcd_del_dsi_bus(lcd->mipi_dsi_bus);
     esp_ldo_release_channel(lcd->phy_power_channel);
@@ -197,6 +240,42 @@ esp_err_t ili9881c_lcd_flush(ili9881c_lcd_t lcd, int fb_index) {
     return esp_lcd_panel_draw_bitmap(lcd->panel, 0, 0, lcd->size.width, lcd->size.height, lcd->frame_buffers[fb_index]);
 }
 
+esp_err_t ili9881c_lcd_wait_refresh(ili9881c_lcd_t lcd, uint32_t timeout_ms) {
+    xSemaphoreTake(lcd->refresh_semaphore, 0);  // Drop a refresh that completed before the call
+    return xSemaphoreTake(lcd->refresh_semaphore, pdMS_TO_TICKS(timeout_ms)) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
 void **ili9881c_lcd_get_frame_buffers(ili9881c_lcd_t lcd) {
     return lcd->frame_buffers;
 }
+
+esp_err_t ili9881c_lcd_set_profile(ili9881c_lcd_t lcd, bsp_display_profile_t profile) {
+    if (profile >= BSP_DISPLAY_PROFILE_NUM) return ESP_ERR_INVALID_ARG;
+    const bsp_dsi_timing_t *timing = &ili9881c_lcd_timings[profile];
+    if (!bsp_dsi_timing_switchable(lcd->timing, timing)) return ESP_ERR_NOT_SUPPORTED;
+    lcd->pending_timing = timing == lcd->timing ? NULL : timing;
+    return ESP_OK;
+}
+
+uint32_t ili9881c_lcd_get_refresh_rate(ili9881c_lcd_t lcd) {
+    return lcd->refresh.rate_mhz;
+}
+
+// MARK: Driver
+static esp_err_t ili9881c_lcd_driver_set_brightness(void *lcd, int brightness) { return ili9881c_lcd_set_brightness(lcd, brightness); }
+static esp_err_t ili9881c_lcd_driver_draw_bitmap(void *lcd, bsp_rect_t rect, const void *data) { return ili9881c_lcd_draw_bitmap(lcd, rect, data); }
+static esp_err_t ili9881c_lcd_driver_flush(void *lcd, int fb_index) { return ili9881c_lcd_flush(lcd, fb_index); }
+static esp_err_t ili9881c_lcd_driver_wait_refresh(void *lcd, uint32_t timeout_ms) { return ili9881c_lcd_wait_refresh(lcd, timeout_ms); }
+static void **ili9881c_lcd_driver_get_frame_buffers(void *lcd) { return ili9881c_lcd_get_frame_buffers(lcd); }
+static esp_err_t ili9881c_lcd_driver_set_profile(void *lcd, bsp_display_profile_t profile) { return ili9881c_lcd_set_profile(lcd, profile); }
+static uint32_t ili9881c_lcd_driver_get_refresh_rate(void *lcd) { return ili9881c_lcd_get_refresh_rate(lcd); }
+
+const bsp_display_driver_t ili9881c_lcd_driver = {
+    .set_brightness = ili9881c_lcd_driver_set_brightness,
+    .draw_bitmap = ili9881c_lcd_driver_draw_bitmap,
+    .flush = ili9881c_lcd_driver_flush,
+    .wait_refresh = ili9881c_lcd_driver_wait_refresh,
+    .get_frame_buffers = ili9881c_lcd_driver_get_frame_buffers,
+    .set_profile = ili9881c_lcd_driver_set_profile,
+    .get_refresh_rate = ili9881c_lcd_driver_get_refresh_rate,
+};
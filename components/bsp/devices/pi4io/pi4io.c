@@ -4,6 +4,7 @@
  */
 
 #include "pi4io.h"
+#include "bsp_i2c.h"
 #include "driver/i2c_master.h"
 
 static const char *TAG = "PI4IO";
@@ -23,18 +24,28 @@ typedef enum {
 
 struct pi4io_state {
     i2c_master_dev_handle_t device;
+    bsp_i2c_device_t bus;  // Low priority, the touch controller shares the bus
+    char name[12];
     uint8_t direction;
     uint8_t output;
+    uint8_t interrupt;  // Input pins with the interrupt unmasked
+    uint8_t input;      // IN_STA shadow, refreshed by pi4io_handle_interrupt
 };
 
 static esp_err_t pi4io_write_reg(pi4io_t pi4io, pi4io_reg_t reg, uint8_t value) {
     uint8_t data[2] = {reg, value};
-    return i2c_master_transmit(pi4io->device, data, 2, -1);
+    bsp_i2c_acquire(&pi4io->bus);
+    esp_err_t ret = i2c_master_transmit(pi4io->device, data, 2, BSP_I2C_TIMEOUT_MS);
+    bsp_i2c_release(&pi4io->bus);
+    return ret;
 }
 
 static esp_err_t pi4io_read_reg(pi4io_t pi4io, pi4io_reg_t reg, uint8_t *value) {
     uint8_t reg_addr = reg;
-    return i2c_master_transmit_receive(pi4io->device, &reg_addr, 1, value, 1, -1);
+    bsp_i2c_acquire(&pi4io->bus);
+    esp_err_t ret = i2c_master_transmit_receive(pi4io->device, &reg_addr, 1, value, 1, BSP_I2C_TIMEOUT_MS);
+    bsp_i2c_release(&pi4io->bus);
+    return ret;
 }
 
 esp_err_t pi4io_init(i2c_master_bus_handle_t i2c_bus, uint8_t address, pi4io_pin_config_t config[8], pi4io_t *pi4io) {
@@ -57,6 +68,8 @@ esp_err_t pi4io_init(i2c_master_bus_handle_t i2c_bus, uint8_t address, pi4io_pin
         free(state);
         return ret;
     }
+    snprintf(state->name, sizeof(state->name), "PI4IO 0x%02X", address);
+    bsp_i2c_register(&state->bus, state->name, BSP_I2C_PRIORITY_LOW);
 
     // Calculate register values from config (pin 0 = bit 0, pin 7 = bit 7)
     uint8_t io_dir = 0;
@@ -130,12 +143,20 @@ esp_err_t pi4io_init(i2c_master_bus_handle_t i2c_bus, uint8_t address, pi4io_pin
         if (ret != ESP_OK) goto err;
     }
 
+    // Shadow the inputs, reading IRQ_STA clears what the reset latched
+    ret = pi4io_read_reg(state, PI4IO_REG_IN_STA, &state->input);
+    if (ret != ESP_OK) goto err;
+    ret = pi4io_read_reg(state, PI4IO_REG_IRQ_STA, &dummy);
+    if (ret != ESP_OK) goto err;
+
     state->direction = io_dir;
     state->output = out_set;
+    state->interrupt = ~int_mask & ~io_dir;
     *pi4io = state;
     return ESP_OK;
 
 err:
+    bsp_i2c_unregister(&state->bus);
     i2c_master_bus_rm_device(state->device);
     free(state);
     return ret;
@@ -143,6 +164,7 @@ err:
 
 esp_err_t pi4io_deinit(pi4io_t pi4io) {
     if (pi4io == NULL) return ESP_ERR_INVALID_ARG;
+    bsp_i2c_unregister(&pi4io->bus);
     esp_err_t ret = i2c_master_bus_rm_device(pi4io->device);
     free(pi4io);
     return ret;
@@ -182,9 +204,13 @@ esp_err_t pi4io_get_input(pi4io_t pi4io, uint8_t pin, bool *value) {
         return ESP_OK;
     }
 
-    // For input pins, read from register
-    esp_err_t ret = pi4io_read_reg(pi4io, PI4IO_REG_IN_STA, &input);
-    if (ret != ESP_OK) return ret;
+    // Interrupt pins come from the shadow, others from the register
+    if (pi4io->interrupt & mask) {
+        input = pi4io->input;
+    } else {
+        esp_err_t ret = pi4io_read_reg(pi4io, PI4IO_REG_IN_STA, &input);
+        if (ret != ESP_OK) return ret;
+    }
 
     *value = (input & mask) != 0;
     return ESP_OK;
@@ -199,3 +225,20 @@ esp_err_t pi4io_get_irq_status(pi4io_t pi4io, uint8_t *status) {
     if (pi4io == NULL || status == NULL) return ESP_ERR_INVALID_ARG;
     return pi4io_read_reg(pi4io, PI4IO_REG_IRQ_STA, status);
 }
+
+esp_err_t pi4io_handle_interrupt(pi4io_t pi4io, uint8_t *changed) {
+    if (pi4io == NULL || changed == NULL) return ESP_ERR_INVALID_ARG;
+    *changed = 0;
+    if (!pi4io->interrupt) return ESP_OK;
+
+    // IN_STA is only read when an edge was latched
+    uint8_t status, input;
+    esp_err_t ret = pi4io_read_reg(pi4io, PI4IO_REG_IRQ_STA, &status);
+    if (ret != ESP_OK || !(status & pi4io->interrupt)) return ret;
+    ret = pi4io_read_reg(pi4io, PI4IO_REG_IN_STA, &input);
+    if (ret != ESP_OK) return ret;
+
+    *changed = (input ^ pi4io->input) & pi4io->interrupt;
+    pi4io->input = (pi4io->input & ~pi4io->interrupt) | (input & pi4io->interrupt);
+    return ESP_OK;
+}
@@ -31,6 +31,7 @@ typedef struct i2c_master_bus_t *i2c_master_bus_handle_t;
 esp_err_t pi4io_init(i2c_master_bus_handle_t i2c_bus, uint8_t address, pi4io_pin_config_t config[8], pi4io_t *pi4io);
 esp_err_t pi4io_deinit(pi4io_t pi4io);
 esp_err_t pi4io_set_output(pi4io_t pi4io, uint8_t pin, bool value);
-esp_err_t pi4io_get_input(pi4io_t pi4io, uint8_t pin, bool *value);
+esp_err_t pi4io_get_input(pi4io_t pi4io, uint8_t pin, bool *value);  // No I2C for output and interrupt pins
 esp_err_t pi4io_get_all_inputs(pi4io_t pi4io, uint8_t *value);
 esp_err_t pi4io_get_irq_status(pi4io_t pi4io, uint8_t *status);
+esp_err_t pi4io_handle_interrupt(pi4io_t pi4io, uint8_t *changed);  // Reads IRQ_STA, then IN_STA if an interrupt pin changed
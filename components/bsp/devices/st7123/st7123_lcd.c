@@ -12,6 +12,9 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_mipi_dsi.h"
 #include "esp_lcd_st7123.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "bsp_dsi.h"
 
 struct st7123_lcd_state {
     ledc_timer_config_t ledc_timer;
@@ -24,8 +27,33 @@ struct st7123_lcd_state {
     bsp_pixel_format_t pixel_format;
     uint8_t fb_num;
     void *frame_buffers[3];
+    SemaphoreHandle_t refresh_semaphore;
+    const bsp_dsi_timing_t *timing;
+    const bsp_dsi_timing_t *volatile pending_timing;  // Applied by the next refresh done callback
+    bsp_dsi_refresh_counter_t refresh;
 };
 
+// 75 MHz over 940 x 1510 is 52.8 Hz. The active profile keeps the long
+// vertical front porch the vendor timing has, idle stretches it to 30 Hz.
+static const bsp_dsi_timing_t st7123_lcd_timings[BSP_DISPLAY_PROFILE_NUM] = {
+    [BSP_DISPLAY_PROFILE_ACTIVE] = { 75, 40, 140, 40, 2, 8, 220 },
+    [BSP_DISPLAY_PROFILE_IDLE] = { 75, 40, 140, 40, 2, 8, 1370 },
+};
+
+static bool st7123_lcd_refresh_done(esp_lcd_panel_handle_t panel, esp_lcd_dpi_panel_event_data_t *edata, void *user_ctx) {
+    struct st7123_lcd_state *state = user_ctx;
+    bsp_dsi_refresh_count(&state->refresh);
+    const bsp_dsi_timing_t *timing = state->pending_timing;
+    if (timing) {
+        bsp_dsi_apply_vertical_timing(0, timing, state->size);
+        state->timing = timing;
+        state->pending_timing = NULL;
+    }
+    BaseType_t task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(state->refresh_semaphore, &task_woken);
+    return task_woken == pdTRUE;
+}
+
 esp_err_t st7123_lcd_init(const st7123_lcd_config_t *config, st7123_lcd_t *lcd) {
     esp_err_t ret;
 
@@ -40,6 +68,7 @@ esp_err_t st7123_lcd_init(const st7123_lcd_config_t *config, st7123_lcd_t *lcd)
     if (state->fb_num > 3) state->fb_num = 3;
 
     bool rgb888 = (config->pixel_format == BSP_PIXEL_FORMAT_RGB888);
+    state->timing = &st7123_lcd_timings[config->profile < BSP_DISPLAY_PROFILE_NUM ? config->profile : BSP_DISPLAY_PROFILE_ACTIVE];
 
     // Setup Backlight using LEDC
     state->ledc_timer = (ledc_timer_config_t){
@@ -94,18 +123,18 @@ esp_err_t st7123_lcd_init(const st7123_lcd_config_t *config, st7123_lcd_t *lcd)
     esp_lcd_dpi_panel_config_t dpi_config = {
         .virtual_channel = 0,
         .dpi_clk_src = MIPI_DSI_DPI_CLK_SRC_DEFAULT,
-        .dpi_clock_freq_mhz = 75,
+        .dpi_clock_freq_mhz = state->timing->dpi_clock_freq_mhz,
         .pixel_format = rgb888 ? LCD_COLOR_PIXEL_FORMAT_RGB888 : LCD_COLOR_PIXEL_FORMAT_RGB565,
         .num_fbs = state->fb_num,
         .video_timing = {
             .h_size = config->size.width,
             .v_size = config->size.height,
-            .hsync_pulse_width = 40,
-            .hsync_back_porch = 140,
-            .hsync_front_porch = 40,
-            .vsync_pulse_width = 2,
-            .vsync_back_porch = 8,
-            .vsync_front_porch = 220,
+            .hsync_pulse_width = state->timing->hsync_pulse_width,
+            .hsync_back_porch = state->timing->hsync_back_porch,
+            .hsync_front_porch = state->timing->hsync_front_porch,
+            .vsync_pulse_width = state->timing->vsync_pulse_width,
+            .vsync_back_porch = state->timing->vsync_back_porch,
+            .vsync_front_porch = state->timing->vsync_front_porch,
         },
         .flags = {
             .use_dma2d = 1,
@@ -148,9 +177,22 @@ esp_err_t st7123_lcd_init(const st7123_lcd_config_t *config, st7123_lcd_t *lcd)
     state->frame_buffers[1] = fb1;
     state->frame_buffers[2] = fb2;
 
+    // Refresh done event, lets callers know when a frame buffer swap took effect
+    state->refresh_semaphore = xSemaphoreCreateBinary();
+    if (state->refresh_semaphore == NULL) {
+        ret = ESP_ERR_NO_MEM;
+        goto err_panel;
+    }
+    ret = esp_lcd_dpi_panel_register_event_callbacks(state->panel, &(esp_lcd_dpi_panel_event_callbacks_t){
+        .on_refresh_done = st7123_lcd_refresh_done,
+    }, state);
+    if (ret != ESP_OK) goto err_semaphore;
+
     *lcd = state;
     return ESP_OK;
 
+err_semaphore:
+    vSemaphoreDelete(state->refresh_semaphore);
 err_panel:
     esp_lcd_panel_del(state->panel);
 err_io:
@@ -166,6 +208,7 @@ err_free:
 
 esp_err_t st7123_lcd_deinit(st7123_lcd_t lcd) {
     esp_lcd_panel_del(lcd->panel);
+    vSemaphoreDelete(lcd->refresh_semaphore);
     esp_lcd_panel_io_del(lcd->io);
     esp_lcd_del_dsi_bus(lcd->mipi_dsi_bus);
     esp_ldo_release_channel(lcd->phy_power_channel);
@@ -196,6 +239,42 @@ esp_err_t st7123_lcd_flush(st7123_lcd_t lcd, int fb_index) {
     return esp_lcd_panel_draw_bitmap(lcd->panel, 0, 0, lcd->size.width, lcd->size.height, lcd->frame_buffers[fb_index]);
 }
 
+esp_err_t st7123_lcd_wait_refresh(st7123_lcd_t lcd, uint32_t timeout_ms) {
+    xSemaphoreTake(lcd->refresh_semaphore, 0);  // Drop a refresh that completed before the call
+    return xSemaphoreTake(lcd->refresh_semaphore, pdMS_TO_TICKS(timeout_ms)) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
 void **st7123_lcd_get_frame_buffers(st7123_lcd_t lcd) {
     return lcd->frame_buffers;
 }
+
+esp_err_t st7123_lcd_set_profile(st7123_lcd_t lcd, bsp_display_profile_t profile) {
+    if (profile >= BSP_DISPLAY_PROFILE_NUM) return ESP_ERR_INVALID_ARG;
+    const bsp_dsi_timing_t *timing = &st7123_lcd_timings[profile];
+    if (!bsp_dsi_timing_switchable(lcd->timing, timing)) return ESP_ERR_NOT_SUPPORTED;
+    lcd->pending_timing = timing == lcd->timing ? NULL : timing;
+    return ESP_OK;
+}
+
+uint32_t st7123_lcd_get_refresh_rate(st7123_lcd_t lcd) {
+    return lcd->refresh.rate_mhz;
+}
+
+// MARK: Driver
+static esp_err_t st7123_lcd_driver_set_brightness(void *lcd, int brightness) { return st7123_lcd_set_brightness(lcd, brightness); }
+static esp_err_t st7123_lcd_driver_draw_bitmap(void *lcd, bsp_rect_t rect, const void *data) { return st7123_lcd_draw_bitmap(lcd, rect, data); }
+static esp_err_t st7123_lcd_driver_flush(void *lcd, int fb_index) { return st7123_lcd_flush(lcd, fb_index); }
+static esp_err_t st7123_lcd_driver_wait_refresh(void *lcd, uint32_t timeout_ms) { return st7123_lcd_wait_refresh(lcd, timeout_ms); }
+static void **st7123_lcd_driver_get_frame_buffers(void *lcd) { return st7123_lcd_get_frame_buffers(lcd); }
+static esp_err_t st7123_lcd_driver_set_profile(void *lcd, bsp_display_profile_t profile) { return st7123_lcd_set_profile(lcd, profile); }
+static uint32_t st7123_lcd_driver_get_refresh_rate(void *lcd) { return st7123_lcd_get_refresh_rate(lcd); }
+
+const bsp_display_driver_t st7123_lcd_driver = {
+    .set_brightness = st7123_lcd_driver_set_brightness,
+    .draw_bitmap = st7123_lcd_driver_draw_bitmap,
+    .flush = st7123_lcd_driver_flush,
+    .wait_refresh = st7123_lcd_driver_wait_refresh,
+    .get_frame_buffers = st7123_lcd_driver_get_frame_buffers,
+    .set_profile = st7123_lcd_driver_set_profile,
+    .get_refresh_rate = st7123_lcd_driver_get_refresh_rate,
+};
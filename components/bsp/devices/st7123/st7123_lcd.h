@@ -5,6 +5,7 @@
 
 #pragma once
 #include "bsp_private.h"
+#include "bsp_driver.h"
 #include "misc/bsp_display.h"
 
 typedef struct {
@@ -12,6 +13,7 @@ typedef struct {
     bsp_size_t size;
     bsp_pixel_format_t pixel_format;
     uint8_t fb_num;
+    bsp_display_profile_t profile;
 } st7123_lcd_config_t;
 
 typedef struct st7123_lcd_state *st7123_lcd_t;
@@ -21,4 +23,9 @@ BSP_NONNULL(1) esp_err_t st7123_lcd_deinit(st7123_lcd_t lcd);
 BSP_NONNULL(1) esp_err_t st7123_lcd_set_brightness(st7123_lcd_t lcd, int brightness);
 BSP_NONNULL(1, 3) esp_err_t st7123_lcd_draw_bitmap(st7123_lcd_t lcd, bsp_rect_t rect, const void *data);
 BSP_NONNULL(1) esp_err_t st7123_lcd_flush(st7123_lcd_t lcd, int fb_index);
+BSP_NONNULL(1) esp_err_t st7123_lcd_wait_refresh(st7123_lcd_t lcd, uint32_t timeout_ms);  // Blocks until the next refresh completes
 BSP_NONNULL(1) void **st7123_lcd_get_frame_buffers(st7123_lcd_t lcd);
+BSP_NONNULL(1) esp_err_t st7123_lcd_set_profile(st7123_lcd_t lcd, bsp_display_profile_t profile);  // Takes effect with the next frame
+BSP_NONNULL(1) uint32_t st7123_lcd_get_refresh_rate(st7123_lcd_t lcd);  // Measured, in mHz
+
+extern const bsp_display_driver_t st7123_lcd_driver;
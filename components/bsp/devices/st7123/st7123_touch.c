@@ -11,14 +11,12 @@ static const char *TAG = "ST7123_TP";
 struct st7123_touch_state {
     esp_lcd_panel_io_handle_t io_handle;
     esp_lcd_touch_handle_t handle;
-    SemaphoreHandle_t interrupt_semaphore;
+    TaskHandle_t consumer;  // Last task that waited for the interrupt
 };
 
 static void st7123_touch_interrupt_callback(esp_lcd_touch_handle_t tp) {
     struct st7123_touch_state *state = tp->config.user_data;
-    BaseType_t pxHigherPriorityTaskWoken;
-    xSemaphoreGiveFromISR(state->interrupt_semaphore, &pxHigherPriorityTaskWoken);
-    portYIELD_FROM_ISR(pxHigherPriorityTaskWoken);
+    bsp_touch_notify_from_isr(state->consumer);
 }
 
 esp_err_t st7123_touch_init(const st7123_touch_config_t *config, st7123_touch_t *touch) {
@@ -58,14 +56,6 @@ esp_err_t st7123_touch_init(const st7123_touch_config_t *config, st7123_touch_t
     }
 
     if (config->interrupt) {
-        state->interrupt_semaphore = xSemaphoreCreateBinary();
-        if (!state->interrupt_semaphore) {
-            esp_lcd_touch_del(state->handle);
-            esp_lcd_panel_io_del(state->io_handle);
-            free(state);
-            return ESP_ERR_NO_MEM;
-        }
-
         ret = gpio_config(&(gpio_config_t){
             .mode = GPIO_MODE_INPUT,
             .pin_bit_mask = 1 << config->int_gpio,
@@ -113,6 +103,16 @@ int st7123_touch_read(st7123_touch_t touch, esp_lcd_touch_point_data_t *points,
     return count;
 }
 
-void st7123_touch_wait_interrupt(st7123_touch_t touch) {
-    xSemaphoreTake(touch->interrupt_semaphore, portMAX_DELAY);
+int64_t st7123_touch_wait_interrupt(st7123_touch_t touch) {
+    touch->consumer = xTaskGetCurrentTaskHandle();
+    return bsp_touch_wait_notify();
 }
+
+// MARK: Driver
+static int st7123_touch_driver_read(void *touch, esp_lcd_touch_point_data_t *points, uint8_t max_points) { return st7123_touch_read(touch, points, max_points); }
+static int64_t st7123_touch_driver_wait_interrupt(void *touch) { return st7123_touch_wait_interrupt(touch); }
+
+const bsp_touch_driver_t st7123_touch_driver = {
+    .read = st7123_touch_driver_read,
+    .wait_interrupt = st7123_touch_driver_wait_interrupt,
+};
@@ -5,6 +5,7 @@
 
 #pragma once
 #include "bsp_private.h"
+#include "bsp_driver.h"
 #include "misc/bsp_display.h"
 #include "driver/i2c_master.h"
 #include "esp_lcd_touch.h"
@@ -23,4 +24,6 @@ typedef struct st7123_touch_state *st7123_touch_t;
 BSP_NONNULL(1, 2) esp_err_t st7123_touch_init(const st7123_touch_config_t *config, st7123_touch_t *touch);
 BSP_NONNULL(1) esp_err_t st7123_touch_deinit(st7123_touch_t touch);
 BSP_NONNULL(1, 2) int st7123_touch_read(st7123_touch_t touch, esp_lcd_touch_point_data_t *points, uint8_t max_points);
-BSP_NONNULL(1) void st7123_touch_wait_interrupt(st7123_touch_t touch);
+BSP_NONNULL(1) int64_t st7123_touch_wait_interrupt(st7123_touch_t touch);  // Returns the esp_timer time of the interrupt
+
+extern const bsp_touch_driver_t st7123_touch_driver;
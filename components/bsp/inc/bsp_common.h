@@ -6,3 +6,4 @@
 #pragma once
 #include "esp_err.h"
 #include "misc/bsp_display.h"
+#include "misc/bsp_touch.h"
@@ -10,9 +10,12 @@
 typedef struct {
     struct {
         uint8_t fb_num;
+        bsp_display_profile_t profile;  // Timing to start with
     } display;
     struct {
         bool interrupt;
+        uint16_t report_rate_hz;  // GT911 only, 0 keeps the controller's configuration
+        bsp_touch_transform_t transform;  // Applied to every point bsp_tab5_touch_read returns
     } touch;
     struct {
         bool enable;
@@ -20,11 +23,67 @@ typedef struct {
     struct {
         bool enable;
     } bluetooth;
+    struct {
+        uint32_t io_stack_size;     // BSPIO, 0 for the default
+        uint32_t radio_stack_size;  // BSPRadio, runs only during bsp_tab5_init, 0 for the default
+    } task;
 } bsp_tab5_config_t;
 
+// The touch interrupt notifies the task waiting in bsp_tab5_touch_wait_interrupt
+// on this notification index, and a task queued for the I2C bus is woken on the
+// next. CONFIG_FREERTOS_TASK_NOTIFICATION_ARRAY_ENTRIES must be larger, index 0
+// stays free for the task's own use.
+#define BSP_TOUCH_NOTIFY_INDEX (1)
+#define BSP_I2C_NOTIFY_INDEX   (2)
+
+typedef struct {
+    uint32_t wakeups;
+    uint64_t wake_latency_total_us;  // Touch interrupt to the waiting task running
+    uint32_t wake_latency_max_us;
+    uint32_t reads;
+    uint64_t read_time_total_us;  // I2C transfers of bsp_tab5_touch_read
+    uint32_t read_time_max_us;
+    uint32_t reads_per_sec;       // Touch samples, over the last window of at least a second
+} bsp_tab5_touch_stats_t;
+
+// Per device on the shared I2C bus, a transaction is one turn holding the bus
+typedef struct {
+    const char *name;
+    uint32_t transactions;
+    uint64_t wait_time_total_us;  // Queued behind other devices
+    uint32_t wait_time_max_us;
+    uint64_t bus_time_total_us;   // Holding the bus
+    uint32_t bus_time_max_us;
+} bsp_tab5_i2c_stats_t;
+
+// Inputs on the IO expanders, kept in a RAM shadow so reading them never
+// touches the I2C bus. The expanders latch input edges, the BSP polls the
+// latch and refreshes the shadow when one changed.
+typedef enum {
+    BSP_TAB5_INPUT_HEADPHONE,  // HP_DET
+    BSP_TAB5_INPUT_CHARGE,     // CHG_STAT
+    BSP_TAB5_INPUT_NUM,
+} bsp_tab5_input_t;
+
+typedef void (*bsp_tab5_input_callback_t)(bsp_tab5_input_t input, bool level, void *user_data);
+
 esp_err_t bsp_tab5_init(const bsp_tab5_config_t *config);
 void bsp_tab5_display_set_brightness(int brightness);
 void *bsp_tab5_display_get_frame_buffer(int fb_index);
 void bsp_tab5_display_flush(int fb_index);
-int bsp_tab5_touch_read(esp_lcd_touch_point_data_t *points, uint8_t max_points);
-void bsp_tab5_touch_wait_interrupt(void);
+void bsp_tab5_display_flush_rect(int fb_index, bsp_rect_t rect);  // rect: panel coordinates, pixels already in the frame buffer
+esp_err_t bsp_tab5_display_wait_refresh(uint32_t timeout_ms);  // Returns once the next refresh is done, a flushed frame buffer is on screen then
+esp_err_t bsp_tab5_display_set_profile(bsp_display_profile_t profile);  // Switches with the next frame, ESP_ERR_NOT_SUPPORTED when the panel needs a reinit for it
+uint32_t bsp_tab5_display_get_refresh_rate(void);  // Measured from refresh done events, in mHz
+int bsp_tab5_touch_read(esp_lcd_touch_point_data_t *points, uint8_t max_points);  // Points in the transformed space
+void bsp_tab5_touch_set_transform(bsp_touch_transform_t transform);
+int64_t bsp_tab5_touch_wait_interrupt(void);  // Returns the esp_timer time of the interrupt, one task waits
+void bsp_tab5_touch_get_stats(bsp_tab5_touch_stats_t *stats);
+esp_err_t bsp_tab5_touch_set_report_rate(uint16_t rate_hz);  // 50 to 200 Hz, the same rate again is not written. ESP_ERR_NOT_SUPPORTED on controllers with a fixed rate
+esp_err_t bsp_tab5_touch_set_wakeup(bool enable);  // Touch interrupt wakes from light sleep, needs CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+void bsp_tab5_touch_sleep_enter(void);  // From the light sleep callbacks, IRAM safe
+void bsp_tab5_touch_sleep_exit(void);
+size_t bsp_tab5_i2c_get_stats(bsp_tab5_i2c_stats_t *stats, size_t max_stats);  // Returns the number of devices filled
+bool bsp_tab5_input_get(bsp_tab5_input_t input);  // Pin level
+void bsp_tab5_input_set_callback(bsp_tab5_input_callback_t callback, void *user_data);  // Called from the IO task when a level changes
+void bsp_tab5_input_set_poll_period(uint32_t period_ms);  // 1 s by default, 0 stops polling until set again
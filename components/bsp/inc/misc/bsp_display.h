@@ -16,8 +16,34 @@ static inline int bsp_rect_min_x(bsp_rect_t rect) { return rect.origin.x; }
 static inline int bsp_rect_min_y(bsp_rect_t rect) { return rect.origin.y; }
 static inline int bsp_rect_max_x(bsp_rect_t rect) { return rect.origin.x + rect.size.width; }
 static inline int bsp_rect_max_y(bsp_rect_t rect) { return rect.origin.y + rect.size.height; }
+static inline int bsp_rect_area(bsp_rect_t rect) { return rect.size.width * rect.size.height; }
+static inline bsp_rect_t bsp_rect_from_bounds(int min_x, int min_y, int max_x, int max_y) {
+    return (bsp_rect_t){ { min_x, min_y }, { max_x - min_x, max_y - min_y } };
+}
+static inline bsp_rect_t bsp_rect_union(bsp_rect_t a, bsp_rect_t b) {
+    return bsp_rect_from_bounds(
+        a.origin.x < b.origin.x ? a.origin.x : b.origin.x,
+        a.origin.y < b.origin.y ? a.origin.y : b.origin.y,
+        bsp_rect_max_x(a) > bsp_rect_max_x(b) ? bsp_rect_max_x(a) : bsp_rect_max_x(b),
+        bsp_rect_max_y(a) > bsp_rect_max_y(b) ? bsp_rect_max_y(a) : bsp_rect_max_y(b));
+}
+// Size is zero along an edge the rects only touch, negative when they are apart
+static inline bsp_rect_t bsp_rect_intersection(bsp_rect_t a, bsp_rect_t b) {
+    return bsp_rect_from_bounds(
+        a.origin.x > b.origin.x ? a.origin.x : b.origin.x,
+        a.origin.y > b.origin.y ? a.origin.y : b.origin.y,
+        bsp_rect_max_x(a) < bsp_rect_max_x(b) ? bsp_rect_max_x(a) : bsp_rect_max_x(b),
+        bsp_rect_max_y(a) < bsp_rect_max_y(b) ? bsp_rect_max_y(a) : bsp_rect_max_y(b));
+}
 
 typedef enum {
     BSP_PIXEL_FORMAT_RGB565,
     BSP_PIXEL_FORMAT_RGB888,
 } bsp_pixel_format_t;
+
+// Panel timing profiles, the drivers hold the timings of each
+typedef enum {
+    BSP_DISPLAY_PROFILE_ACTIVE,  // Full refresh rate, the shortest wait for a swap while typing
+    BSP_DISPLAY_PROFILE_IDLE,    // Reduced refresh rate, same clocks with a longer vertical blank
+    BSP_DISPLAY_PROFILE_NUM,
+} bsp_display_profile_t;
@@ -0,0 +1,41 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stdint.h>
+#include "misc/bsp_display.h"
+
+// Clockwise rotation of the output space from the panel's portrait coordinates
+typedef enum {
+    BSP_TOUCH_ROTATION_0,
+    BSP_TOUCH_ROTATION_90,   // (x, y) -> (H - y, x), landscape with the panel top on the left
+    BSP_TOUCH_ROTATION_180,  // (x, y) -> (W - x, H - y)
+    BSP_TOUCH_ROTATION_270,  // (x, y) -> (y, W - x)
+} bsp_touch_rotation_t;
+
+#define BSP_TOUCH_SCALE_ONE (1 << 16)
+// Rounded up, so a point at an exact multiple of den lands on its pixel
+#define BSP_TOUCH_SCALE(num, den) ((uint32_t)((((uint64_t)(num) << 16) + (den) - 1) / (den)))
+
+typedef struct {
+    bsp_touch_rotation_t rotation;
+    uint32_t scale;  // Q16.16 applied after the rotation, 0 keeps the size
+} bsp_touch_transform_t;
+
+static inline bsp_point_t bsp_touch_transform_point(bsp_touch_transform_t transform, bsp_size_t panel, bsp_point_t point) {
+    bsp_point_t out;
+    switch (transform.rotation) {
+    default:
+    case BSP_TOUCH_ROTATION_0: out = point; break;
+    case BSP_TOUCH_ROTATION_90: out = (bsp_point_t){ panel.height - point.y, point.x }; break;
+    case BSP_TOUCH_ROTATION_180: out = (bsp_point_t){ panel.width - point.x, panel.height - point.y }; break;
+    case BSP_TOUCH_ROTATION_270: out = (bsp_point_t){ point.y, panel.width - point.x }; break;
+    }
+    if (transform.scale && transform.scale != BSP_TOUCH_SCALE_ONE) {
+        out.x = ((uint32_t)out.x * transform.scale) >> 16;
+        out.y = ((uint32_t)out.y * transform.scale) >> 16;
+    }
+    return out;
+}
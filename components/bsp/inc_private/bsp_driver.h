@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include "bsp_private.h"
+#include "bsp_tab5.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Driver interfaces selected once when bsp_tab5_init probes the panel. Every
+// function takes the handle of the device the driver was initialized with.
+typedef struct {
+    esp_err_t (*set_brightness)(void *lcd, int brightness);
+    esp_err_t (*draw_bitmap)(void *lcd, bsp_rect_t rect, const void *data);
+    esp_err_t (*flush)(void *lcd, int fb_index);
+    esp_err_t (*wait_refresh)(void *lcd, uint32_t timeout_ms);
+    void **(*get_frame_buffers)(void *lcd);
+    esp_err_t (*set_profile)(void *lcd, bsp_display_profile_t profile);
+    uint32_t (*get_refresh_rate)(void *lcd);  // mHz
+} bsp_display_driver_t;
+
+typedef struct {
+    int (*read)(void *touch, esp_lcd_touch_point_data_t *points, uint8_t max_points);
+    int64_t (*wait_interrupt)(void *touch);  // Returns the esp_timer time of the interrupt
+    esp_err_t (*set_report_rate)(void *touch, uint16_t rate_hz);  // NULL when the controller has a fixed rate
+} bsp_touch_driver_t;
+
+// Touch interrupts notify the waiting task directly, the notification value is
+// the low 32 bits of esp_timer at the interrupt. While one is not taken, later
+// interrupts keep its time.
+static inline void bsp_touch_notify_from_isr(TaskHandle_t consumer) {
+    if (!consumer) return;  // Nobody waited yet
+    BaseType_t task_woken = pdFALSE;
+    xTaskNotifyIndexedFromISR(consumer, BSP_TOUCH_NOTIFY_INDEX, (uint32_t)esp_timer_get_time(), eSetValueWithoutOverwrite, &task_woken);
+    portYIELD_FROM_ISR(task_woken);
+}
+
+static inline int64_t bsp_touch_wait_notify(void) {
+    uint32_t irq_time;
+    xTaskNotifyWaitIndexed(BSP_TOUCH_NOTIFY_INDEX, 0, 0, &irq_time, portMAX_DELAY);
+    int64_t now = esp_timer_get_time();
+    return now - (uint32_t)((uint32_t)now - irq_time);
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include "bsp_private.h"
+#include "misc/bsp_display.h"
+#include "esp_timer.h"
+#include "hal/mipi_dsi_ll.h"
+
+// DPI timing of one profile. The DSI lane rate belongs to the bus and is the
+// same for every profile.
+typedef struct {
+    uint32_t dpi_clock_freq_mhz;
+    uint16_t hsync_pulse_width, hsync_back_porch, hsync_front_porch;
+    uint16_t vsync_pulse_width, vsync_back_porch, vsync_front_porch;
+} bsp_dsi_timing_t;
+
+static inline uint32_t bsp_dsi_timing_refresh_mhz(const bsp_dsi_timing_t *timing, bsp_size_t size) {
+    uint32_t h_total = size.width + timing->hsync_pulse_width + timing->hsync_back_porch + timing->hsync_front_porch;
+    uint32_t v_total = size.height + timing->vsync_pulse_width + timing->vsync_back_porch + timing->vsync_front_porch;
+    return (uint64_t)timing->dpi_clock_freq_mhz * 1000000000ULL / (h_total * v_total);
+}
+
+// Profiles that only differ in vertical timing switch in place, others need
+// the DPI panel created again
+static inline bool bsp_dsi_timing_switchable(const bsp_dsi_timing_t *from, const bsp_dsi_timing_t *to) {
+    return from->dpi_clock_freq_mhz == to->dpi_clock_freq_mhz &&
+        from->hsync_pulse_width == to->hsync_pulse_width &&
+        from->hsync_back_porch == to->hsync_back_porch &&
+        from->hsync_front_porch == to->hsync_front_porch;
+}
+
+// Called from the refresh done callback, the new blanking starts with the next frame
+static inline void bsp_dsi_apply_vertical_timing(int bus_id, const bsp_dsi_timing_t *timing, bsp_size_t size) {
+    mipi_dsi_brg_ll_set_vertical_timing(MIPI_DSI_LL_GET_BRG(bus_id), timing->vsync_pulse_width, timing->vsync_back_porch,
+                                        size.height, timing->vsync_front_porch);
+    mipi_dsi_brg_ll_update_dpi_config(MIPI_DSI_LL_GET_BRG(bus_id));
+    mipi_dsi_host_ll_dpi_set_vertical_timing(MIPI_DSI_LL_GET_HOST(bus_id), timing->vsync_pulse_width, timing->vsync_back_porch,
+                                             size.height, timing->vsync_front_porch);
+}
+
+// Refresh rate measured from refresh done callbacks, over windows of at least a second
+typedef struct {
+    int64_t start;
+    uint32_t count;
+    uint32_t rate_mhz;
+} bsp_dsi_refresh_counter_t;
+
+static inline void bsp_dsi_refresh_count(bsp_dsi_refresh_counter_t *counter) {
+    int64_t now = esp_timer_get_time();
+    if (!counter->start) {
+        counter->start = now;
+        return;
+    }
+    counter->count++;
+    if (now - counter->start >= 1000 * 1000) {
+        counter->rate_mhz = (uint64_t)counter->count * 1000000000ULL / (now - counter->start);
+        counter->start = now;
+        counter->count = 0;
+    }
+}
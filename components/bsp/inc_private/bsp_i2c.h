@@ -0,0 +1,32 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include "bsp_private.h"
+#include "bsp_tab5.h"
+
+// Devices on the shared I2C bus take turns through bsp_i2c_acquire. A
+// transfer in flight always completes, after it the bus goes to the oldest
+// waiter of the highest priority, so touch reads skip queued expander traffic.
+typedef enum {
+    BSP_I2C_PRIORITY_HIGH,
+    BSP_I2C_PRIORITY_LOW,
+    BSP_I2C_PRIORITY_NUM,
+} bsp_i2c_priority_t;
+
+typedef struct {
+    bsp_i2c_priority_t priority;
+    bsp_tab5_i2c_stats_t stats;
+    int64_t acquired;
+} bsp_i2c_device_t;
+
+#define BSP_I2C_TIMEOUT_MS (50)  // For transfers on the shared bus, instead of waiting forever
+#define BSP_I2C_DEVICES_MAX (8)
+
+void bsp_i2c_register(bsp_i2c_device_t *device, const char *name, bsp_i2c_priority_t priority);  // Once per device, before it uses the bus
+void bsp_i2c_unregister(bsp_i2c_device_t *device);
+void bsp_i2c_acquire(bsp_i2c_device_t *device);
+void bsp_i2c_release(bsp_i2c_device_t *device);
+size_t bsp_i2c_get_stats(bsp_tab5_i2c_stats_t *stats, size_t max_stats);
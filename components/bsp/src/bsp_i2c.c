@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "bsp_i2c.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+#define WAITERS_MAX (4)  // Per priority, one per task using a device of it
+
+static portMUX_TYPE bus_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool busy;
+static struct {
+    TaskHandle_t tasks[WAITERS_MAX];
+    uint8_t head, count;
+} waiters[BSP_I2C_PRIORITY_NUM];
+static bsp_i2c_device_t *devices[BSP_I2C_DEVICES_MAX];
+static size_t device_num;
+
+void bsp_i2c_register(bsp_i2c_device_t *device, const char *name, bsp_i2c_priority_t priority) {
+    device->priority = priority;
+    device->stats = (bsp_tab5_i2c_stats_t){ .name = name };
+    portENTER_CRITICAL(&bus_lock);
+    if (device_num < BSP_I2C_DEVICES_MAX) devices[device_num++] = device;
+    portEXIT_CRITICAL(&bus_lock);
+}
+
+void bsp_i2c_unregister(bsp_i2c_device_t *device) {
+    portENTER_CRITICAL(&bus_lock);
+    for (size_t i = 0; i < device_num; i++) {
+        if (devices[i] != device) continue;
+        devices[i] = devices[--device_num];
+        break;
+    }
+    portEXIT_CRITICAL(&bus_lock);
+}
+
+void bsp_i2c_acquire(bsp_i2c_device_t *device) {
+    int64_t start = esp_timer_get_time();
+    bool wait = false;
+    portENTER_CRITICAL(&bus_lock);
+    if (busy) {
+        typeof(waiters[0]) *queue = &waiters[device->priority];
+        assert(queue->count < WAITERS_MAX);
+        queue->tasks[(queue->head + queue->count++) % WAITERS_MAX] = xTaskGetCurrentTaskHandle();
+        wait = true;
+    } else {
+        busy = true;
+    }
+    portEXIT_CRITICAL(&bus_lock);
+
+    // The bus is handed over on release, it stays busy in between
+    if (wait) ulTaskNotifyTakeIndexed(BSP_I2C_NOTIFY_INDEX, pdTRUE, portMAX_DELAY);
+
+    device->acquired = esp_timer_get_time();
+    uint32_t wait_time = device->acquired - start;
+    device->stats.transactions++;
+    device->stats.wait_time_total_us += wait_time;
+    if (wait_time > device->stats.wait_time_max_us) device->stats.wait_time_max_us = wait_time;
+}
+
+void bsp_i2c_release(bsp_i2c_device_t *device) {
+    uint32_t bus_time = esp_timer_get_time() - device->acquired;
+    device->stats.bus_time_total_us += bus_time;
+    if (bus_time > device->stats.bus_time_max_us) device->stats.bus_time_max_us = bus_time;
+
+    TaskHandle_t next = NULL;
+    portENTER_CRITICAL(&bus_lock);
+    for (int i = 0; i < BSP_I2C_PRIORITY_NUM && !next; i++) {
+        if (!waiters[i].count) continue;
+        next = waiters[i].tasks[waiters[i].head];
+        waiters[i].head = (waiters[i].head + 1) % WAITERS_MAX;
+        waiters[i].count--;
+    }
+    if (!next) busy = false;
+    portEXIT_CRITICAL(&bus_lock);
+    if (next) xTaskNotifyGiveIndexed(next, BSP_I2C_NOTIFY_INDEX);
+}
+
+size_t bsp_i2c_get_stats(bsp_tab5_i2c_stats_t *stats, size_t max_stats) {
+    portENTER_CRITICAL(&bus_lock);
+    size_t num = device_num < max_stats ? device_num : max_stats;
+    for (size_t i = 0; i < num; i++) stats[i] = devices[i]->stats;
+    portEXIT_CRITICAL(&bus_lock);
+    return num;
+}
@@ -4,9 +4,13 @@
  */
 
 #include "bsp_private.h"
+#include "bsp_driver.h"
+#include "bsp_i2c.h"
 #include "bsp_tab5.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
+#include <inttypes.h>
 #include "driver/gpio.h"
 #include "driver/i2c_master.h"
 #include "misc/bsp_display.h"
@@ -16,6 +20,9 @@
 #include "st7123/st7123_lcd.h"
 #include "st7123/st7123_touch.h"
 #include "nvs_flash.h"
+#include "esp_sleep.h"
+#include "esp_attr.h"
+#include "hal/gpio_ll.h"
 #include "esp_hosted.h"
 #ifdef CONFIG_BT_BLUEDROID_ENABLED
 #include "esp_hosted_bt.h"
@@ -26,184 +33,447 @@
 
 static const char *TAG = "BSP_TAB5";
 
+#define TOUCH_PANEL_SIZE ((bsp_size_t){ 720, 1280 })
+
+static_assert(configTASK_NOTIFICATION_ARRAY_ENTRIES > BSP_TOUCH_NOTIFY_INDEX, "Touch notification index out of range");
+static_assert(configTASK_NOTIFICATION_ARRAY_ENTRIES > BSP_I2C_NOTIFY_INDEX, "I2C notification index out of range");
+
+// Selected when the panel is probed
+static const bsp_display_driver_t *display_driver;
+static void *display;
+static const bsp_touch_driver_t *touch_driver;
+static void *touch;
+static bsp_i2c_device_t touch_i2c;  // High priority on the shared bus
+static bsp_touch_transform_t touch_transform;  // Set by the task switching modes, copied once per read
+static void **frame_buffers;
+static bsp_tab5_touch_stats_t touch_stats;
+static bsp_tab5_input_callback_t input_callback;
+static void *input_callback_data;
+static struct {
+    int64_t start;
+    uint32_t reads;
+} touch_stats_window;
+
 #define I2C0_PORT_NUM (0)
+#define TOUCH_SCL_SPEED_HZ (400000)  // Fast mode, every device on I2C0 supports it
+#define TOUCH_INT_GPIO (GPIO_NUM_23)
+#define PANEL_RESET_PULSE_MS (10)      // ILI9881C needs 10 us low, GT911 100 us
+#define PANEL_READY_MIN_MS (5)         // ILI9881C takes commands 5 ms after the reset is released
+#define PANEL_READY_TIMEOUT_MS (200)
+#define PANEL_PROBE_INTERVAL_MS (2)
+#define IO_TASK_STACK_SIZE (3072)
+#define RADIO_TASK_STACK_SIZE (6144)
+#define IO_POLL_PERIOD_MS (1000)  // Default, see bsp_tab5_input_set_poll_period
 static i2c_master_bus_handle_t i2c0;
 static pi4io_t pi4ioe1, pi4ioe2;
+static TaskHandle_t io_task;
+static volatile uint32_t io_poll_period_ms = IO_POLL_PERIOD_MS;
+static TaskHandle_t radio_waiter;
+static esp_err_t radio_err;
 
-static void **frame_buffers;
-static ili9881c_lcd_t ili9881c;
-static gt911_touch_t gt911;
-static st7123_lcd_t st7123_lcd;
-static st7123_touch_t st7123_touch;
+// MARK: Boot Timing
+// Logs the time since *start and since power on, then starts the next step
+static void bsp_tab5_boot_step(const char *step, int64_t *start) {
+    int64_t now = esp_timer_get_time();
+    ESP_LOGI(TAG, "Boot %s: %"PRIu32" us (at %"PRIu32" ms)", step, (uint32_t)(now - *start), (uint32_t)(now / 1000));
+    *start = now;
+}
 
-esp_err_t bsp_tab5_init(const bsp_tab5_config_t *config) {
+// MARK: IO Expander
+static pi4io_t *const io_expanders[] = { &pi4ioe1, &pi4ioe2 };
+static const struct {
+    pi4io_t *expander;
+    uint8_t pin;
+} input_pins[BSP_TAB5_INPUT_NUM] = {
+    [BSP_TAB5_INPUT_HEADPHONE] = { &pi4ioe1, 7 },
+    [BSP_TAB5_INPUT_CHARGE] = { &pi4ioe2, 6 },
+};
+
+// The expanders' INT output does not reach a P4 GPIO on the Tab5, so their
+// latched IRQ_STA is polled. This task is the only place the expander inputs
+// are read after init, IN_STA only after a latched edge.
+static void bsp_tab5_io_task(void *param) {
+    while (true) {
+        uint32_t period_ms = io_poll_period_ms;
+        ulTaskNotifyTake(pdTRUE, period_ms ? pdMS_TO_TICKS(period_ms) : portMAX_DELAY);
+        for (int i = 0; i < BSP_ARRAY_SIZE(io_expanders); i++) {
+            uint8_t changed;
+            if (pi4io_handle_interrupt(*io_expanders[i], &changed) != ESP_OK || !changed) continue;
+            for (int input = 0; input < BSP_TAB5_INPUT_NUM; input++) {
+                if (input_pins[input].expander != io_expanders[i] || !(changed & (1 << input_pins[input].pin))) continue;
+                bool level = bsp_tab5_input_get(input);
+                ESP_LOGI(TAG, "Input %d: %d", input, level);
+                bsp_tab5_input_callback_t callback = input_callback;
+                if (callback) callback(input, level, input_callback_data);
+            }
+        }
+    }
+}
+
+static esp_err_t bsp_tab5_io_start(uint32_t stack_size) {
+    if (xTaskCreate(bsp_tab5_io_task, "BSPIO", stack_size ? stack_size : IO_TASK_STACK_SIZE, NULL, 5, &io_task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void bsp_tab5_input_set_poll_period(uint32_t period_ms) {
+    io_poll_period_ms = period_ms;
+    if (io_task) xTaskNotifyGive(io_task);  // Polls once now, then with the new period
+}
+
+// Light sleep wakes on a level, but a level interrupt would fire for as long
+// as a finger rests. The level is only armed around each light sleep, by the
+// callbacks below, and the ISR sees the falling edge as usual in between.
+static volatile bool touch_wakeup;
+
+esp_err_t bsp_tab5_touch_set_wakeup(bool enable) {
+#if CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+    touch_wakeup = enable;
+    return enable ? esp_sleep_enable_gpio_wakeup() : ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;  // Nothing would arm the level before a sleep
+#endif
+}
+
+// Called with interrupts off, the gpio_ll calls are inline
+void IRAM_ATTR bsp_tab5_touch_sleep_enter(void) {
+    if (!touch_wakeup) return;
+    gpio_dev_t *hw = GPIO_LL_GET_HW(GPIO_PORT_0);
+    gpio_ll_set_intr_type(hw, TOUCH_INT_GPIO, GPIO_INTR_LOW_LEVEL);
+    gpio_ll_wakeup_enable(hw, TOUCH_INT_GPIO);
+}
+
+void IRAM_ATTR bsp_tab5_touch_sleep_exit(void) {
+    if (!touch_wakeup) return;
+    gpio_dev_t *hw = GPIO_LL_GET_HW(GPIO_PORT_0);
+    gpio_ll_wakeup_disable(hw, TOUCH_INT_GPIO);
+    gpio_ll_set_intr_type(hw, TOUCH_INT_GPIO, GPIO_INTR_NEGEDGE);
+}
+
+bool bsp_tab5_input_get(bsp_tab5_input_t input) {
+    bool level = false;
+    pi4io_get_input(*input_pins[input].expander, input_pins[input].pin, &level);
+    return level;
+}
+
+// MARK: Radio
+// NVS and the ESP-Hosted link to the C6 only need WLAN_PWR_EN, they come up
+// in their own task while the panel initializes
+static esp_err_t bsp_tab5_radio_init(const bsp_tab5_config_t *config) {
     esp_err_t err;
+    int64_t start = esp_timer_get_time();
 
-    // Check config values
-    bsp_tab5_config_t tmp_config = *config;
-    if (!tmp_config.display.fb_num) tmp_config.display.fb_num = 1;
-    config = &tmp_config;
+    // NVS (for WiFi & Bluetooth)
+    err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        if ((err = nvs_flash_erase()) == ESP_OK) {
+            err = nvs_flash_init();
+        }
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize NVS flash");
+        return err;
+    }
+    bsp_tab5_boot_step("NVS", &start);
 
-    // Initialize I2C0 bus
-    err = i2c_new_master_bus(&(i2c_master_bus_config_t){
-        .i2c_port = I2C0_PORT_NUM,
-        .sda_io_num = GPIO_NUM_31,
-        .scl_io_num = GPIO_NUM_32,
-        .clk_source = I2C_CLK_SRC_DEFAULT,
-        .flags.enable_internal_pullup = true,
-    }, &i2c0);
-    BSP_RETURN_ERR(err);
+    // WiFi
+    if (config->wifi.enable) {
+        ESP_LOGE(TAG, "WiFi initialization not implemented yet!");
+        assert(0);
+        // ESP_ERROR_CHECK(esp_netif_init());
+        // ESP_ERROR_CHECK(esp_event_loop_create_default());
+        // esp_netif_create_default_wifi_ap();
+        // wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+        // ESP_ERROR_CHECK(esp_wifi_init(&cfg));
+    }
 
-    // Initialize PI4IOE1 (address 0x43)
-    err = pi4io_init(i2c0, 0x43, (pi4io_pin_config_t[8]){
-        [0] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // RF_INT_EXT_SWITCH
-        [1] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // SPK_EN
-        [2] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // EXT5V_EN
-        [4] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // LCD_RST
-        [5] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // TP_RST
-        [6] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // CAM_RST
-        [7] = { PI4IO_PIN_MODE_INPUT },                           // HP_DET
-    }, &pi4ioe1);
-    BSP_RETURN_ERR(err);
+    // Bluetooth
+    if (config->bluetooth.enable) {
+#if defined(CONFIG_BT_BLUEDROID_ENABLED)
+        /* initialize TRANSPORT first */
+        hosted_hci_bluedroid_open();
 
-    // Initialize PI4IOE2 (address 0x44)
-    err = pi4io_init(i2c0, 0x44, (pi4io_pin_config_t[8]){
-        [0] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // WLAN_PWR_EN
-        [3] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // USB5V_EN
-        [4] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // PWROFF_PLUSE
-        [5] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // nCHG_QC_EN
-        [6] = { PI4IO_PIN_MODE_INPUT },                           // CHG_STAT
-        [7] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // CHG_EN
-    }, &pi4ioe2);
-    BSP_RETURN_ERR(err);
+        /* get HCI driver operations */
+        esp_bluedroid_hci_driver_operations_t operations = {
+            .send = hosted_hci_bluedroid_send,
+            .check_send_available = hosted_hci_bluedroid_check_send_available,
+            .register_host_callback = hosted_hci_bluedroid_register_host_callback,
+        };
+        esp_bluedroid_attach_hci_driver(&operations);
+#elif defined(CONFIG_BT_NIMBLE_ENABLED)
+        err = nimble_port_init();
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to initialize NimBLE");
+            return err;
+        }
+#else
+        ESP_LOGE(TAG, "Bluetooth Stack is not Enabled.");
+#endif
+        bsp_tab5_boot_step("Bluetooth", &start);
+    }
+    return ESP_OK;
+}
+
+static void bsp_tab5_radio_task(void *param) {
+    radio_err = bsp_tab5_radio_init(param);
+    xTaskNotifyGive(radio_waiter);
+    vTaskDelete(NULL);
+}
+
+// MARK: Panel
+// Both touch controllers answer on I2C once they are out of reset, which
+// also tells the panel variant apart
+static esp_err_t bsp_tab5_panel_wait_ready(uint16_t *address) {
+    int64_t released = esp_timer_get_time();
+    vTaskDelay(pdMS_TO_TICKS(PANEL_READY_MIN_MS));
+    while (true) {
+        if (i2c_master_probe(i2c0, 0x55, 10) == ESP_OK) {
+            *address = 0x55;
+            return ESP_OK;
+        }
+        if (i2c_master_probe(i2c0, 0x14, 10) == ESP_OK) {
+            *address = 0x14;
+            return ESP_OK;
+        }
+        if (esp_timer_get_time() - released >= PANEL_READY_TIMEOUT_MS * 1000) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        vTaskDelay(pdMS_TO_TICKS(PANEL_PROBE_INTERVAL_MS));
+    }
+}
+
+static esp_err_t bsp_tab5_panel_init(const bsp_tab5_config_t *config) {
+    esp_err_t err;
+    int64_t start = esp_timer_get_time();
 
     // Reset Touch Panel and LCD
-    gpio_reset_pin(GPIO_NUM_23);
+    gpio_reset_pin(TOUCH_INT_GPIO);
     pi4io_set_output(pi4ioe1, 4, false);  // LCD_RST = Low
     pi4io_set_output(pi4ioe1, 5, false);  // TP_RST = Low
-    vTaskDelay(pdMS_TO_TICKS(100));
+    vTaskDelay(pdMS_TO_TICKS(PANEL_RESET_PULSE_MS));
     pi4io_set_output(pi4ioe1, 4, true);   // LCD_RST = High
     pi4io_set_output(pi4ioe1, 5, true);   // TP_RST = High
-    vTaskDelay(pdMS_TO_TICKS(100));
+    uint16_t address;
+    err = bsp_tab5_panel_wait_ready(&address);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "No touch controller answered after reset");
+        return err;
+    }
+    bsp_tab5_boot_step("Panel reset", &start);
 
-    if (i2c_master_probe(i2c0, 0x55, 10) == ESP_OK) {
+    if (address == 0x55) {
         // Initialize ST7123 LCD
+        st7123_lcd_t st7123_lcd;
         err = st7123_lcd_init(&(st7123_lcd_config_t){
             .backlight_gpio = GPIO_NUM_22,
             .size = (bsp_size_t){ 720, 1280 },
             .pixel_format = BSP_PIXEL_FORMAT_RGB565,
             .fb_num = config->display.fb_num,
+            .profile = config->display.profile,
         }, &st7123_lcd);
         BSP_RETURN_ERR(err);
-        frame_buffers = st7123_lcd_get_frame_buffers(st7123_lcd);
+        display_driver = &st7123_lcd_driver;
+        display = st7123_lcd;
+        bsp_tab5_boot_step("LCD", &start);
 
         // Initialize ST7123 Touch Panel
+        st7123_touch_t st7123_touch;
         err = st7123_touch_init(&(st7123_touch_config_t){
             .i2c_bus = i2c0,
-            .size = (bsp_size_t){ 720, 1280 },
-            .int_gpio = GPIO_NUM_23,
+            .size = TOUCH_PANEL_SIZE,
+            .int_gpio = TOUCH_INT_GPIO,
             .rst_gpio = GPIO_NUM_NC,
-            .scl_speed_hz = 100000,
+            .scl_speed_hz = TOUCH_SCL_SPEED_HZ,
             .interrupt = config->touch.interrupt,
         }, &st7123_touch);
         BSP_RETURN_ERR(err);
-    } else if (i2c_master_probe(i2c0, 0x14, 10) == ESP_OK) {
+        touch_driver = &st7123_touch_driver;
+        touch = st7123_touch;
+    } else {
         // Initialize ILI9881C LCD
+        ili9881c_lcd_t ili9881c;
         err = ili9881c_lcd_init(&(ili9881c_lcd_config_t){
             .backlight_gpio = GPIO_NUM_22,
             .size = (bsp_size_t){ 720, 1280 },
             .pixel_format = BSP_PIXEL_FORMAT_RGB565,
             .fb_num = config->display.fb_num,
+            .profile = config->display.profile,
         }, &ili9881c);
         BSP_RETURN_ERR(err);
-        frame_buffers = ili9881c_lcd_get_frame_buffers(ili9881c);
+        display_driver = &ili9881c_lcd_driver;
+        display = ili9881c;
+        bsp_tab5_boot_step("LCD", &start);
 
         // Initialize GT911 Touch Panel
+        gt911_touch_t gt911;
         err = gt911_touch_init(&(gt911_touch_config_t){
             .i2c_bus = i2c0,
-            .size = (bsp_size_t){ 720, 1280 },
-            .int_gpio = GPIO_NUM_23,
+            .size = TOUCH_PANEL_SIZE,
+            .int_gpio = TOUCH_INT_GPIO,
             .rst_gpio = GPIO_NUM_NC,
-            .scl_speed_hz = 100000,
+            .scl_speed_hz = TOUCH_SCL_SPEED_HZ,
             .interrupt = config->touch.interrupt,
+            .report_rate_hz = config->touch.report_rate_hz,
         }, &gt911);
         BSP_RETURN_ERR(err);
-    } else {
-        return ESP_ERR_NOT_FOUND;
+        touch_driver = &gt911_touch_driver;
+        touch = gt911;
     }
+    frame_buffers = display_driver->get_frame_buffers(display);
+    touch_transform = config->touch.transform;
+    bsp_i2c_register(&touch_i2c, "Touch", BSP_I2C_PRIORITY_HIGH);
+    bsp_tab5_boot_step("Touch", &start);
+    return ESP_OK;
+}
 
-    if (config->wifi.enable || config->bluetooth.enable) {
-        // NVS (for WiFi & Bluetooth)
-        err = nvs_flash_init();
-        if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-            if ((err = nvs_flash_erase()) == ESP_OK) {
-                err = nvs_flash_init();
-            }
-        }
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to initialize NVS flash");
-            return err;
-        }
-    }
+esp_err_t bsp_tab5_init(const bsp_tab5_config_t *config) {
+    esp_err_t err;
+    int64_t start = esp_timer_get_time(), init_start = start;
 
-    // WiFi
-    if (config->wifi.enable) {
-        ESP_LOGE(TAG, "WiFi initialization not implemented yet!");
-        assert(0);
-        // ESP_ERROR_CHECK(esp_netif_init());
-        // ESP_ERROR_CHECK(esp_event_loop_create_default());
-        // esp_netif_create_default_wifi_ap();
-        // wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-        // ESP_ERROR_CHECK(esp_wifi_init(&cfg));
-    }
+    // Check config values
+    bsp_tab5_config_t tmp_config = *config;
+    if (!tmp_config.display.fb_num) tmp_config.display.fb_num = 1;
+    config = &tmp_config;
 
-    // Bluetooth
-    if (config->bluetooth.enable) {
-#if defined(CONFIG_BT_BLUEDROID_ENABLED)
-        /* initialize TRANSPORT first */
-        hosted_hci_bluedroid_open();
+    // Initialize I2C0 bus
+    err = i2c_new_master_bus(&(i2c_master_bus_config_t){
+        .i2c_port = I2C0_PORT_NUM,
+        .sda_io_num = GPIO_NUM_31,
+        .scl_io_num = GPIO_NUM_32,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .flags.enable_internal_pullup = true,
+    }, &i2c0);
+    BSP_RETURN_ERR(err);
 
-        /* get HCI driver operations */
-        esp_bluedroid_hci_driver_operations_t operations = {
-            .send = hosted_hci_bluedroid_send,
-            .check_send_available = hosted_hci_bluedroid_check_send_available,
-            .register_host_callback = hosted_hci_bluedroid_register_host_callback,
-        };
-        esp_bluedroid_attach_hci_driver(&operations);
-#elif defined(CONFIG_BT_NIMBLE_ENABLED)
-        err = nimble_port_init();
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to initialize NimBLE");
-            return err;
+    // Initialize PI4IOE1 (address 0x43)
+    err = pi4io_init(i2c0, 0x43, (pi4io_pin_config_t[8]){
+        [0] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // RF_INT_EXT_SWITCH
+        [1] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // SPK_EN
+        [2] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // EXT5V_EN
+        [4] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // LCD_RST
+        [5] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // TP_RST
+        [6] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // CAM_RST
+        [7] = { PI4IO_PIN_MODE_INPUT, .interrupt = true },        // HP_DET
+    }, &pi4ioe1);
+    BSP_RETURN_ERR(err);
+
+    // Initialize PI4IOE2 (address 0x44)
+    err = pi4io_init(i2c0, 0x44, (pi4io_pin_config_t[8]){
+        [0] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = true },   // WLAN_PWR_EN
+        [3] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // USB5V_EN
+        [4] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // PWROFF_PLUSE
+        [5] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // nCHG_QC_EN
+        [6] = { PI4IO_PIN_MODE_INPUT, .interrupt = true },        // CHG_STAT
+        [7] = { PI4IO_PIN_MODE_OUTPUT, .initial_value = false },  // CHG_EN
+    }, &pi4ioe2);
+    BSP_RETURN_ERR(err);
+    bsp_tab5_boot_step("IO expanders", &start);
+
+    // The C6 is powered now, bring up the radio alongside the panel
+    bool radio = config->wifi.enable || config->bluetooth.enable;
+    if (radio) {
+        radio_waiter = xTaskGetCurrentTaskHandle();
+        uint32_t stack_size = config->task.radio_stack_size ? config->task.radio_stack_size : RADIO_TASK_STACK_SIZE;
+        if (xTaskCreate(bsp_tab5_radio_task, "BSPRadio", stack_size, (void *)config, uxTaskPriorityGet(NULL), NULL) != pdPASS) {
+            return ESP_ERR_NO_MEM;
         }
-#else
-        ESP_LOGE(TAG, "Bluetooth Stack is not Enabled.");
-#endif
     }
 
-    return ESP_OK;
+    err = bsp_tab5_panel_init(config);
+    if (err == ESP_OK) err = bsp_tab5_io_start(config->task.io_stack_size);
+
+    // The radio task reads config from this stack frame, wait for it even when the panel failed
+    if (radio) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (err == ESP_OK) err = radio_err;
+    }
+    bsp_tab5_boot_step(err == ESP_OK ? "BSP ready" : "BSP failed", &init_start);
+    return err;
 }
 
 // MARK: Display
 void bsp_tab5_display_set_brightness(int brightness) {
-    if (ili9881c) ili9881c_lcd_set_brightness(ili9881c, brightness);
-    if (st7123_lcd) st7123_lcd_set_brightness(st7123_lcd, brightness);
+    display_driver->set_brightness(display, brightness);
 }
 void *bsp_tab5_display_get_frame_buffer(int fb_index) {
     return frame_buffers[fb_index];
 }
 void bsp_tab5_display_flush(int fb_index) {
-    if (ili9881c) ili9881c_lcd_flush(ili9881c, fb_index);
-    if (st7123_lcd) st7123_lcd_flush(st7123_lcd, fb_index);
+    display_driver->flush(display, fb_index);
+}
+void bsp_tab5_display_flush_rect(int fb_index, bsp_rect_t rect) {
+    display_driver->draw_bitmap(display, rect, frame_buffers[fb_index]);
+}
+esp_err_t bsp_tab5_display_wait_refresh(uint32_t timeout_ms) {
+    return display_driver->wait_refresh(display, timeout_ms);
+}
+esp_err_t bsp_tab5_display_set_profile(bsp_display_profile_t profile) {
+    return display_driver->set_profile(display, profile);
+}
+uint32_t bsp_tab5_display_get_refresh_rate(void) {
+    return display_driver->get_refresh_rate(display);
 }
 
 // MARK: Touch Panel
 int bsp_tab5_touch_read(esp_lcd_touch_point_data_t *points, uint8_t max_points) {
-    if (gt911) return gt911_touch_read(gt911, points, max_points);
-    if (st7123_touch) return st7123_touch_read(st7123_touch, points, max_points);
-    return 0;
+    bsp_i2c_acquire(&touch_i2c);
+    int64_t start = esp_timer_get_time();
+    int count = touch_driver->read(touch, points, max_points);
+    int64_t end = esp_timer_get_time();
+    bsp_i2c_release(&touch_i2c);
+
+    bsp_touch_transform_t transform = touch_transform;
+    for (int i = 0; i < count; i++) {
+        bsp_point_t point = bsp_touch_transform_point(transform, TOUCH_PANEL_SIZE, (bsp_point_t){ points[i].x, points[i].y });
+        points[i].x = point.x;
+        points[i].y = point.y;
+    }
+
+    uint32_t read_time = end - start;
+    touch_stats.reads++;
+    touch_stats.read_time_total_us += read_time;
+    if (read_time > touch_stats.read_time_max_us) touch_stats.read_time_max_us = read_time;
+
+    // Rate over windows of at least a second
+    if (!touch_stats_window.start) touch_stats_window.start = start;
+    touch_stats_window.reads++;
+    if (end - touch_stats_window.start >= 1000 * 1000) {
+        touch_stats.reads_per_sec = touch_stats_window.reads * 1000000LL / (end - touch_stats_window.start);
+        touch_stats_window.start = end;
+        touch_stats_window.reads = 0;
+    }
+    return count;
+}
+int64_t bsp_tab5_touch_wait_interrupt(void) {
+    int64_t irq_time = touch_driver->wait_interrupt(touch);
+    uint32_t latency = esp_timer_get_time() - irq_time;
+    touch_stats.wakeups++;
+    touch_stats.wake_latency_total_us += latency;
+    if (latency > touch_stats.wake_latency_max_us) touch_stats.wake_latency_max_us = latency;
+    return irq_time;
 }
-void bsp_tab5_touch_wait_interrupt(void) {
-    if (gt911) gt911_touch_wait_interrupt(gt911);
-    if (st7123_touch) st7123_touch_wait_interrupt(st7123_touch);
+esp_err_t bsp_tab5_touch_set_report_rate(uint16_t rate_hz) {
+    if (!touch_driver->set_report_rate) return ESP_ERR_NOT_SUPPORTED;
+    bsp_i2c_acquire(&touch_i2c);
+    esp_err_t err = touch_driver->set_report_rate(touch, rate_hz);
+    bsp_i2c_release(&touch_i2c);
+    return err;
+}
+void bsp_tab5_touch_set_transform(bsp_touch_transform_t transform) {
+    touch_transform = transform;
+}
+void bsp_tab5_touch_get_stats(bsp_tab5_touch_stats_t *stats) {
+    *stats = touch_stats;
+}
+
+// MARK: I2C
+size_t bsp_tab5_i2c_get_stats(bsp_tab5_i2c_stats_t *stats, size_t max_stats) {
+    return bsp_i2c_get_stats(stats, max_stats);
+}
+
+// MARK: Inputs
+void bsp_tab5_input_set_callback(bsp_tab5_input_callback_t callback, void *user_data) {
+    input_callback_data = user_data;
+    input_callback = callback;
 }
@@ -0,0 +1,55 @@
+# Compares the palette RLE codec against JPEG for the layout images in out/.
+# The device decoder (main/layouts/layout_rle.c) is built for the host with cc,
+# JPEG is decoded by Pillow. Host timings only show the relative cost, on the
+# device JPEG is decoded by hardware and RLE by the CPU.
+#
+#   uv run bench.py [iterations]
+import ctypes
+import glob
+import subprocess
+import sys
+import tempfile
+import time
+from PIL import Image
+from renderer import rle
+
+def build_decoder() -> ctypes.CDLL:
+    library = tempfile.NamedTemporaryFile(suffix='.so', delete=False).name
+    subprocess.run(['cc', '-O2', '-shared', '-fPIC', '-o', library, '../main/layouts/layout_rle.c'], check=True)
+    decoder = ctypes.CDLL(library)
+    decoder.layout_rle_decode.restype = ctypes.c_size_t
+    decoder.layout_rle_decode.argtypes = [ctypes.c_char_p, ctypes.c_size_t, ctypes.c_void_p, ctypes.c_size_t]
+    return decoder
+
+def measure(function, iterations: int) -> float:
+    start = time.perf_counter()
+    for _ in range(iterations):
+        function()
+    return (time.perf_counter() - start) / iterations * 1000
+
+def main():
+    iterations = int(sys.argv[1]) if len(sys.argv) > 1 else 20
+    decoder = build_decoder()
+    print(f'{"image":<32} {"jpeg":>9} {"rle":>9} {"ratio":>6} {"jpeg ms":>8} {"rle ms":>8}  exact')
+    for path in sorted(glob.glob('out/*.jpg')):
+        with open(path, 'rb') as f:
+            jpeg = f.read()
+        image = Image.open(path)
+        data = rle.encode(image)
+        pixels = image.width * image.height
+        out = (ctypes.c_uint16 * pixels)()
+
+        def decode_jpeg():
+            Image.open(path).load()
+
+        def decode_rle():
+            assert decoder.layout_rle_decode(data, len(data), out, pixels) == pixels
+
+        jpeg_ms = measure(decode_jpeg, iterations)
+        rle_ms = measure(decode_rle, iterations)
+        rgb = image.convert('RGB').tobytes()
+        expected = [rle._rgb565(*rgb[i:i + 3]) for i in range(0, len(rgb), 3)]
+        print(f'{path:<32} {len(jpeg):>9} {len(data):>9} {len(data) / len(jpeg):>6.2f} {jpeg_ms:>8.2f} {rle_ms:>8.2f}  {list(out) == expected}')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,57 @@
+from typing import Any, Type
+
+# Drawn on the device by keycap_renderer, only geometry and labels are shipped
+STYLE = {
+    'background': (0, 0, 0),
+    'key': (0.2, 0.2, 0.2),
+    'key_pressed': (0.6, 0.6, 0.6),
+    'border': (0.4, 0.4, 0.4),
+    'text': (1.0, 1.0, 1.0),
+    'inset': 2,
+}
+
+# Pressed keys are tinted instead of drawing a second surface
+HIGHLIGHT = {
+    'color': (1.0, 1.0, 1.0),
+    'alpha': 0.4,
+    'fade_frames': 3,
+}
+
+KEY_WIDTH = 160
+KEY_HEIGHT = 144
+
+# item, label, column, row, columns, rows
+KEYPAD_LAYOUT = [
+    ('NUM_LOCK'   , 'Num'  , 0, 0, 1, 1),
+    ('KP_SLASH'   , '/'    , 1, 0, 1, 1),
+    ('KP_ASTERISK', '*'    , 2, 0, 1, 1),
+    ('KP_MINUS'   , '-'    , 3, 0, 1, 1),
+    ('KP_7'       , '7'    , 0, 1, 1, 1),
+    ('KP_8'       , '8'    , 1, 1, 1, 1),
+    ('KP_9'       , '9'    , 2, 1, 1, 1),
+    ('KP_PLUS'    , '+'    , 3, 1, 1, 2),
+    ('KP_4'       , '4'    , 0, 2, 1, 1),
+    ('KP_5'       , '5'    , 1, 2, 1, 1),
+    ('KP_6'       , '6'    , 2, 2, 1, 1),
+    ('KP_1'       , '1'    , 0, 3, 1, 1),
+    ('KP_2'       , '2'    , 1, 3, 1, 1),
+    ('KP_3'       , '3'    , 2, 3, 1, 1),
+    ('KP_ENTER'   , 'Enter', 3, 3, 1, 2),
+    ('KP_0'       , '0'    , 0, 4, 2, 1),
+    ('KP_DOT'     , '.'    , 2, 4, 1, 1),
+]
+
+def render(renderer: Any) -> Any:
+    for item, label, column, row, columns, rows in KEYPAD_LAYOUT:
+        renderer.key(item=item, label=label, x=column * KEY_WIDTH, y=row * KEY_HEIGHT, width=columns * KEY_WIDTH, height=rows * KEY_HEIGHT)
+    renderer.trackpad(x=680, y=20, width=580, height=540)
+    renderer.trackpad_buttons_lr(x=680, y=580, width=580, height=120)
+    return renderer
+
+def build(renderer_class: Type, codegen_class: Type):
+    render(codegen_class(
+        ident = 'numpad',
+        title = '2. Numpad',
+        style = STYLE,
+        highlight = HIGHLIGHT,
+    )).write()
@@ -139,5 +139,7 @@ def build(renderer_class: Type, codegen_class: Type):
     render(codegen_class(
         ident = 'us',
         title = '1. US',
-        images = ['normal', 'active'],
+        base_image = 'normal',
+        active_image = 'active',
+        image_format = 'rle',
     )).write()
@@ -1,11 +1,15 @@
 import renderer.default as default_renderer
 import renderer.codegen as codegen
+import renderer.keycap as keycap
 import layout.us as us_layout
+import layout.numpad as numpad_layout
 
 def main():
     renderer_class = default_renderer.DefaultRenderer
     codegen_class = codegen.Codegen
     us_layout.build(renderer_class, codegen_class)
+    numpad_layout.build(renderer_class, codegen_class)
+    keycap.build()
 
 if __name__ == "__main__":
     main()
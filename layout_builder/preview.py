@@ -0,0 +1,93 @@
+# Renders a procedural layout with the software reference backend of
+# main/keycap, built for the host with cc. Writes the normal and pressed
+# surfaces to out/ and compares them pixel by pixel against the PNGs of the
+# same name in reference/. Exits non-zero when a pixel differs or a reference
+# is missing; --update rewrites the references after an intended change.
+#
+#   uv run preview.py [--update]
+import ctypes
+import os
+import subprocess
+import sys
+import tempfile
+from PIL import Image, ImageChops
+import renderer.codegen as codegen
+import layout.numpad as numpad_layout
+
+WIDTH = 1280
+HEIGHT = 720
+REFERENCE_DIR = 'reference'
+
+class Rect(ctypes.Structure):
+    _fields_ = [('x', ctypes.c_int16), ('y', ctypes.c_int16), ('width', ctypes.c_int16), ('height', ctypes.c_int16)]
+
+class Style(ctypes.Structure):
+    _fields_ = [
+        ('background', ctypes.c_uint32), ('key', ctypes.c_uint32), ('key_pressed', ctypes.c_uint32),
+        ('border', ctypes.c_uint32), ('text', ctypes.c_uint32), ('inset', ctypes.c_uint8),
+    ]
+
+class Target(ctypes.Structure):
+    _fields_ = [
+        ('backend', ctypes.c_void_p), ('ctx', ctypes.c_void_p), ('atlas', ctypes.c_void_p),
+        ('width', ctypes.c_uint16), ('height', ctypes.c_uint16),
+    ]
+
+class Soft(ctypes.Structure):
+    _fields_ = [('pixels', ctypes.c_void_p), ('width', ctypes.c_uint16), ('height', ctypes.c_uint16), ('atlas', ctypes.c_void_p)]
+
+def build_renderer() -> ctypes.CDLL:
+    library = tempfile.NamedTemporaryFile(suffix='.so', delete=False).name
+    sources = [f'../main/keycap/{name}.c' for name in ('keycap_renderer', 'keycap_soft', 'keycap_atlas')]
+    subprocess.run(['cc', '-O2', '-shared', '-fPIC', '-I../main', '-o', library, *sources], check=True)
+    return ctypes.CDLL(library)
+
+def collect(layout) -> codegen.Codegen:
+    # Only the geometry is needed, the codegen is not written
+    return layout.render(codegen.Codegen(ident='preview', title='', style=layout.STYLE))
+
+def render(keycap: ctypes.CDLL, layout: codegen.Codegen, pressed: bool) -> Image.Image:
+    pixels = (ctypes.c_uint16 * (WIDTH * HEIGHT))()
+    atlas = ctypes.addressof(ctypes.c_char.in_dll(keycap, 'keycap_atlas'))
+    soft = Soft(ctypes.addressof(pixels), WIDTH, HEIGHT, atlas)
+    target = Target(ctypes.addressof(ctypes.c_char.in_dll(keycap, 'keycap_soft_backend')), ctypes.addressof(soft), atlas, WIDTH, HEIGHT)
+    style = Style(**{name: int(layout._style_color(name), 16) for name in ('background', 'key', 'key_pressed', 'border', 'text')}, inset=layout.style['inset'])
+    keycap.keycap_render_background(ctypes.byref(target), ctypes.byref(style))
+    for input in layout.inputs:
+        label = input.attr.get('label')
+        keycap.keycap_render_key(ctypes.byref(target), ctypes.byref(style), Rect(input.x, input.y, input.width, input.height),
+                                 label.encode() if label else None, ctypes.c_bool(pressed))
+    # Stored rotated like the frame buffers, undo it to view in layout coordinates
+    image = Image.frombytes('RGB', (HEIGHT, WIDTH), bytes(pixels), 'raw', 'BGR;16')
+    return image.transpose(Image.Transpose.ROTATE_270)
+
+def main():
+    update = '--update' in sys.argv[1:]
+    keycap = build_renderer()
+    layout = collect(numpad_layout)
+    matched = True
+    for pressed in (False, True):
+        name = f'layout_numpad.{"active" if pressed else "normal"}.preview.png'
+        image = render(keycap, layout, pressed)
+        image.save(f'out/{name}')
+        reference = f'{REFERENCE_DIR}/{name}'
+        if update:
+            os.makedirs(REFERENCE_DIR, exist_ok=True)
+            image.save(reference)
+            print(f'{name}: reference written')
+        elif os.path.exists(reference):
+            expected = Image.open(reference).convert('RGB')
+            if expected.size == image.size:
+                masks = [band.point(lambda v: 255 if v else 0) for band in ImageChops.difference(image, expected).split()]
+                diff = ImageChops.lighter(ImageChops.lighter(masks[0], masks[1]), masks[2]).histogram()[255]
+            else:
+                diff = WIDTH * HEIGHT  # ImageChops.difference only covers where the sizes overlap
+            matched &= diff == 0
+            print(f'{name}: {diff} pixels differ')
+        else:
+            matched = False
+            print(f'{name}: no reference, run with --update')
+    sys.exit(0 if matched else 1)
+
+if __name__ == '__main__':
+    main()
@@ -1,4 +1,12 @@
+import json
 from typing import Any
+from PIL import Image, ImageChops
+from . import rle
+
+ATLAS_WIDTH = 1280
+ATLAS_ALIGN = 16  # JPEG decoder output is MCU aligned
+SPRITE_TOLERANCE = 12  # Max channel difference for sprites to be considered identical (JPEG noise)
+SPRITE_THRESHOLD = 32  # Min difference from the base image for a pixel to belong to a sprite
 
 class Input:
     type: str
@@ -7,6 +15,7 @@ class Input:
     width: int
     height: int
     attr: dict[str, Any]
+    sprite: tuple[int, int, int, int, int, int] | None  # x, y, width, height, atlas x, atlas y
 
     def __init__(self, type: str, x: int, y: int, width: int, height: int, **kwargs):
         self.type = type
@@ -15,42 +24,59 @@ class Input:
         self.width = width
         self.height = height
         self.attr = kwargs
+        self.sprite = None
+
+    def highlighted(self) -> bool:
+        return self.type in ('KEY', 'MOUSE_BUTTON')
 
     def generate(self) -> str:
         generated = f'.type = LAYOUT_INPUT_TYPE_{self.type}, .region = {{ {self.x}, {self.y}, {self.width}, {self.height} }}'
+        if self.sprite:
+            generated += f', .sprite = {{ {", ".join(map(str, self.sprite))} }}'
         if self.type == 'KEY':
             generated += f', .key = HID_DEVICE_KEY_{self.attr['item']}'
         if self.type == 'MOUSE_BUTTON':
             generated += f', .mouse_button = HID_DEVICE_MOUSE_BUTTON_{self.attr['item']}'
+        if self.attr.get('label'):
+            generated += f', .label = {json.dumps(self.attr['label'], ensure_ascii=False)}'
         return f'{{ {generated} }},'
 
 class Codegen:
     inputs: list[Input]
     ident: str
     title: str
-    images: list[str]
+    base_image: str | None
+    active_image: str | None
+    image_format: str  # 'jpeg' or 'rle'
+    style: dict[str, Any] | None  # Procedural layout drawn by keycap_renderer, no images
+    highlight: dict[str, Any] | None  # Pressed inputs tinted on the device, no active image
 
-    def __init__(self, ident: str, title: str, images: list[str]):
+    def __init__(self, ident: str, title: str, base_image: str | None = None, active_image: str | None = None, image_format: str = 'jpeg',
+                 style: dict[str, Any] | None = None, highlight: dict[str, Any] | None = None):
         self.inputs = []
         self.ident = ident
         self.title = title
-        self.images = images
+        self.base_image = base_image
+        self.active_image = active_image
+        self.image_format = image_format
+        self.style = style
+        self.highlight = highlight
 
     def fill(self, color: tuple[float, float, float]):
         pass
 
-    def key(self, item: str, x: int, y: int, width: int, height: int, **kwargs):
-        self.inputs.append(Input('KEY', item=item, x=x, y=y, width=width, height=height))
+    def key(self, item: str, x: int, y: int, width: int, height: int, label: str | None = None, **kwargs):
+        self.inputs.append(Input('KEY', item=item, label=label, x=x, y=y, width=width, height=height))
 
     def arrows(self, x: int, y: int, width: int, height: int):
         lr_key_width = width // 3
         ud_key_width = width - (lr_key_width * 2)
         lr_key_height = height // 2
         keys = [
-            { 'item': 'LEFT' , 'x': x                       , 'y': y + lr_key_height    , 'width': lr_key_width, 'height': lr_key_height + 1 },
-            { 'item': 'RIGHT', 'x': x + width - lr_key_width, 'y': y + lr_key_height    , 'width': lr_key_width, 'height': lr_key_height + 1 },
-            { 'item': 'UP'   , 'x': x + lr_key_width        , 'y': y                    , 'width': ud_key_width, 'height': lr_key_height     },
-            { 'item': 'DOWN' , 'x': x + lr_key_width        , 'y': y + lr_key_height + 1, 'width': ud_key_width, 'height': lr_key_height     },
+            { 'item': 'LEFT' , 'label': '◀', 'x': x                       , 'y': y + lr_key_height    , 'width': lr_key_width, 'height': lr_key_height + 1 },
+            { 'item': 'RIGHT', 'label': '▶', 'x': x + width - lr_key_width, 'y': y + lr_key_height    , 'width': lr_key_width, 'height': lr_key_height + 1 },
+            { 'item': 'UP'   , 'label': '▲', 'x': x + lr_key_width        , 'y': y                    , 'width': ud_key_width, 'height': lr_key_height     },
+            { 'item': 'DOWN' , 'label': '▼', 'x': x + lr_key_width        , 'y': y + lr_key_height + 1, 'width': ud_key_width, 'height': lr_key_height     },
         ]
         for k in keys: self.inputs.append(Input('KEY', **k))
 
@@ -61,12 +87,63 @@ class Codegen:
         self.inputs.append(Input('MOUSE_BUTTON', item='LEFT' , x=x             , y=y, width=width // 2, height=height))
         self.inputs.append(Input('MOUSE_BUTTON', item='RIGHT', x=x + width // 2, y=y, width=width // 2, height=height))
 
-    def _write_image_file(self, image_name: str):
+    def _load_image(self, image_name: str) -> Image.Image:
+        # Images are stored rotated for the panel, undo it to work in layout coordinates
+        image = Image.open(f'out/layout_{self.ident}.{image_name}.jpg')
+        return image.transpose(Image.Transpose.ROTATE_270)
+
+    def _build_atlas(self, image_name: str) -> tuple[int, int]:
+        # Crop the part of every highlighted input that differs from the base
+        # image and share identical sprites
+        source = self._load_image(image_name)
+        base = self._load_image(self.base_image)
+        sprites: list[tuple[Image.Image, list[tuple[Input, tuple[int, int, int, int]]]]] = []
+        for input in filter(Input.highlighted, self.inputs):
+            region = (input.x, input.y, input.x + input.width, input.y + input.height)
+            diff = ImageChops.difference(source.crop(region), base.crop(region)).convert('L')
+            bbox = diff.point(lambda v: 255 if v > SPRITE_THRESHOLD else 0).getbbox()
+            if not bbox: continue
+            rect = (input.x + bbox[0], input.y + bbox[1], input.x + bbox[2], input.y + bbox[3])
+            crop = source.crop(rect)
+            for sprite, users in sprites:
+                if sprite.size == crop.size and max(high for _, high in ImageChops.difference(sprite, crop).getextrema()) <= SPRITE_TOLERANCE:
+                    users.append((input, rect))
+                    break
+            else:
+                sprites.append((crop, [(input, rect)]))
+
+        # First fit decreasing height shelf packing
+        sprites.sort(key=lambda s: (s[0].height, s[0].width), reverse=True)
+        shelves: list[list[int]] = []  # [y, height, used width]
+        positions: list[tuple[int, int]] = []
+        for sprite, users in sprites:
+            shelf = next((s for s in shelves if s[1] >= sprite.height and s[2] + sprite.width <= ATLAS_WIDTH), None)
+            if not shelf:
+                shelf = [sum(s[1] for s in shelves), sprite.height, 0]
+                shelves.append(shelf)
+            positions.append((shelf[2], shelf[0]))
+            for input, rect in users:
+                input.sprite = (rect[0], rect[1], rect[2] - rect[0], rect[3] - rect[1], shelf[2], shelf[0])
+            shelf[2] += sprite.width
+        height = -(-sum(s[1] for s in shelves) // ATLAS_ALIGN) * ATLAS_ALIGN
+
+        atlas = Image.new('RGB', (ATLAS_WIDTH, height))
+        for (sprite, users), position in zip(sprites, positions):
+            atlas.paste(sprite, position)
+        print(f'{self.ident}: {len(sprites)} sprites for {sum(len(u) for _, u in sprites)} inputs, atlas {ATLAS_WIDTH}x{height}')
+        atlas.transpose(Image.Transpose.ROTATE_90).save(f'out/layout_{self.ident}.{image_name}.atlas.jpg', 'JPEG', quality=100)
+        return atlas.size
+
+    def _write_image_file(self, image_name: str, size: tuple[int, int]):
         jpg_path = f'out/layout_{self.ident}.{image_name}.jpg'
-        output_path = f'../main/layouts/image/layout_{self.ident}_{image_name}.c'
+        var_name = f'layout_{self.ident}_{image_name.replace(".", "_")}'
+        output_path = f'../main/layouts/image/{var_name}.c'
 
-        with open(jpg_path, 'rb') as f:
-            data = f.read()
+        if self.image_format == 'rle':
+            data = rle.encode(Image.open(jpg_path))
+        else:
+            with open(jpg_path, 'rb') as f:
+                data = f.read()
 
         # バイト配列を16バイトごとに整形
         hex_lines = []
@@ -75,8 +152,6 @@ class Codegen:
             hex_str = ', '.join(f'0x{b:02x}' for b in chunk)
             hex_lines.append(f'    {hex_str},')
 
-        var_name = f'layout_{self.ident}_{image_name}'
-
         with open(output_path, 'w') as f:
             f.write('\n'.join([
                 '#include "layouts/layout.h"',
@@ -88,21 +163,72 @@ class Codegen:
                 f'const layout_image_t {var_name} = ' + '{',
                 '    .data = data,',
                 '    .size = sizeof(data),',
+                f'    .width = {size[0]},',
+                f'    .height = {size[1]},',
+                f'    .format = LAYOUT_IMAGE_FORMAT_{self.image_format.upper()},',
                 '};',
                 '',
             ]))
 
+    def _set_procedural_sprites(self):
+        # The pressed surface is drawn at full size, sprites are the keycaps at the same position.
+        # Tinted highlights cover the keycap, or the whole region of an image layout.
+        inset = self.style['inset'] if self.style else 0
+        for input in filter(Input.highlighted, self.inputs):
+            x, y = input.x + inset, input.y + inset
+            input.sprite = (x, y, input.width - inset * 2, input.height - inset * 2, x, y)
+
+    @staticmethod
+    def _color(color: tuple[float, float, float]) -> str:
+        r, g, b = (round(c * 255) for c in color)
+        return f'0x{r:02x}{g:02x}{b:02x}'
+
+    def _style_color(self, name: str) -> str:
+        return self._color(self.style[name])
+
     def _write_impl(self):
         inputs_array = '\n'.join([
             'static const layout_input_t layout_inputs[] = {',
             *(f'    {input.generate()}' for input in self.inputs),
             '};',
         ])
+        if self.style:
+            images = []
+            style_def = '\n'.join([
+                'static const keycap_style_t layout_style = {',
+                *(f'    .{name} = {self._style_color(name)},' for name in ('background', 'key', 'key_pressed', 'border', 'text')),
+                f'    .inset = {self.style["inset"]},',
+                '};',
+                '',
+            ])
+            sources = ['    .style = &layout_style,']
+        else:
+            images = [
+                f'extern const layout_image_t layout_{self.ident}_{self.base_image};',
+                f'extern const layout_image_t layout_{self.ident}_{self.active_image}_atlas;',
+                '',
+            ]
+            style_def = ''
+            sources = [
+                f'    .base_image = &layout_{self.ident}_{self.base_image},',
+                f'    .active_atlas = &layout_{self.ident}_{self.active_image}_atlas,',
+            ]
+            if self.highlight:
+                del images[1], sources[1]
+        if self.highlight:
+            style_def += '\n'.join([
+                'static const layout_highlight_t layout_highlight = {',
+                f'    .color = {self._color(self.highlight["color"])},',
+                f'    .alpha = {round(self.highlight["alpha"] * 255)},',
+                f'    .fade_frames = {self.highlight.get("fade_frames", 0)},',
+                '};',
+                '',
+            ])
+            sources.append('    .highlight = &layout_highlight,')
         layout_def = '\n'.join([
-            f'static const layout_config_t layout_config = ' + '{',
+            style_def + f'static const layout_config_t layout_config = ' + '{',
             f'    .title = "{self.title}",',
-            f'    .base_image = &layout_{self.ident}_normal,',
-            f'    .active_image = &layout_{self.ident}_active,',
+            *sources,
             f'    .inputs = layout_inputs,',
             f'    .count = {len(self.inputs)},',
             '};',
@@ -115,14 +241,20 @@ class Codegen:
                 '#include "hid_device_key.h"',
                 '#include "layout.h"',
                 '',
-                *(f'extern const layout_image_t layout_{self.ident}_{img};' for img in self.images),
-                '',
+                *images,
                 inputs_array,
                 layout_def,
                 '',
             ]))
 
     def write(self):
-        for image_name in self.images:
-            self._write_image_file(image_name)
+        if self.style:
+            self._set_procedural_sprites()
+            self._write_impl()
+            return
+        self._write_image_file(self.base_image, self._load_image(self.base_image).size)
+        if self.highlight:
+            self._set_procedural_sprites()
+        else:
+            self._write_image_file(f'{self.active_image}.atlas', self._build_atlas(self.active_image))
         self._write_impl()
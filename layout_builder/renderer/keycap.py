@@ -0,0 +1,106 @@
+from PIL import Image, ImageDraw, ImageFont
+
+# Shared glyph atlas for keycap_renderer (main/keycap), A8 masks of the label
+# glyphs and of the rounded corners, stored rotated like the layout images.
+FONT = 'DejaVuSans.ttf'
+FONT_SIZE = 24
+CORNER_RADIUS = 6
+BORDER_WIDTH = 1
+CHARSET = ''.join(chr(c) for c in range(0x20, 0x7f)) + '◀▶▲▼'
+ATLAS_WIDTH = 512
+CORNER_SUPERSAMPLE = 8
+CORNER_OUTER = 0xe000  # Top left, top right, bottom right, bottom left
+CORNER_INNER = 0xe004
+
+class Glyph:
+    def __init__(self, codepoint: int, image: Image.Image, offset: tuple[int, int], advance: int):
+        self.codepoint = codepoint
+        self.image = image
+        self.offset = offset
+        self.advance = advance
+        self.position = (0, 0)
+
+def _corners(radius: int) -> list[Image.Image]:
+    # Coverage of the top left quarter circle, mirrored for the other corners
+    s = CORNER_SUPERSAMPLE
+    image = Image.new('L', (radius, radius))
+    for y in range(radius):
+        for x in range(radius):
+            inside = sum(
+                1
+                for sy in range(s) for sx in range(s)
+                if (x + (sx + 0.5) / s - radius) ** 2 + (y + (sy + 0.5) / s - radius) ** 2 <= radius ** 2
+            )
+            image.putpixel((x, y), round(inside * 255 / (s * s)))
+    return [
+        image,
+        image.transpose(Image.Transpose.FLIP_LEFT_RIGHT),
+        image.transpose(Image.Transpose.ROTATE_180),
+        image.transpose(Image.Transpose.FLIP_TOP_BOTTOM),
+    ]
+
+def _glyph(font: ImageFont.FreeTypeFont, char: str) -> Glyph:
+    left, top, right, bottom = font.getbbox(char, anchor='ls')
+    image = Image.new('L', (right - left, bottom - top))
+    ImageDraw.Draw(image).text((-left, -top), char, font=font, fill=255, anchor='ls')
+    return Glyph(ord(char), image, (left, top), round(font.getlength(char)))
+
+def _pack(glyphs: list[Glyph]) -> tuple[int, int]:
+    # Shelf packing, tallest first
+    x = y = shelf_height = 0
+    for glyph in sorted(glyphs, key=lambda g: g.image.height, reverse=True):
+        if x + glyph.image.width > ATLAS_WIDTH:
+            x, y, shelf_height = 0, y + shelf_height, 0
+        glyph.position = (x, y)
+        x += glyph.image.width
+        shelf_height = max(shelf_height, glyph.image.height)
+    return ATLAS_WIDTH, y + shelf_height
+
+def build(output_path: str = '../main/keycap/keycap_atlas.c'):
+    font = ImageFont.truetype(FONT, FONT_SIZE)
+    glyphs = [_glyph(font, char) for char in CHARSET]
+    for i, corner in enumerate(_corners(CORNER_RADIUS)):
+        glyphs.append(Glyph(CORNER_OUTER + i, corner, (0, 0), 0))
+    for i, corner in enumerate(_corners(CORNER_RADIUS - BORDER_WIDTH)):
+        glyphs.append(Glyph(CORNER_INNER + i, corner, (0, 0), 0))
+    width, height = _pack(glyphs)
+
+    atlas = Image.new('L', (width, height))
+    for glyph in glyphs:
+        atlas.paste(glyph.image, glyph.position)
+    data = atlas.transpose(Image.Transpose.ROTATE_90).tobytes()
+    ascent, descent = font.getmetrics()
+    print(f'keycap atlas: {len(glyphs)} glyphs, {width}x{height}')
+
+    hex_lines = []
+    for i in range(0, len(data), 16):
+        hex_lines.append('    ' + ', '.join(f'0x{b:02x}' for b in data[i:i + 16]) + ',')
+    glyph_lines = [
+        f'    {{ 0x{g.codepoint:04x}, {g.position[0]}, {g.position[1]}, {g.image.width}, {g.image.height}, {g.offset[0]}, {g.offset[1]}, {g.advance} }},'
+        for g in sorted(glyphs, key=lambda g: g.codepoint)
+    ]
+    with open(output_path, 'w') as f:
+        f.write('\n'.join([
+            '#include "keycap/keycap_renderer.h"',
+            '',
+            'static const uint8_t data[] = {',
+            *hex_lines,
+            '};',
+            '',
+            'static const keycap_glyph_t glyphs[] = {',
+            *glyph_lines,
+            '};',
+            '',
+            'const keycap_atlas_t keycap_atlas = {',
+            '    .data = data,',
+            f'    .width = {width},',
+            f'    .height = {height},',
+            '    .glyphs = glyphs,',
+            '    .glyph_num = sizeof(glyphs) / sizeof(glyphs[0]),',
+            f'    .ascent = {ascent},',
+            f'    .descent = {descent},',
+            f'    .corner_radius = {CORNER_RADIUS},',
+            f'    .border_width = {BORDER_WIDTH},',
+            '};',
+            '',
+        ]))
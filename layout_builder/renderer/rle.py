@@ -0,0 +1,42 @@
+import itertools
+import struct
+from PIL import Image
+
+# Palette RLE image encoder, see main/layouts/layout_rle.h for the format
+MAX_COLORS = 256
+MAX_SPAN = 128
+MIN_REPEAT = 3  # Shorter repeats are cheaper inside a literal span
+
+def _rgb565(r: int, g: int, b: int) -> int:
+    return (r >> 3) << 11 | (g >> 2) << 5 | b >> 3
+
+def _packbits(indices: bytes) -> bytes:
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        for i in range(0, len(literal), MAX_SPAN):
+            chunk = literal[i:i + MAX_SPAN]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literal.clear()
+
+    for value, group in itertools.groupby(indices):
+        count = sum(1 for _ in group)
+        if count < MIN_REPEAT:
+            literal.extend([value] * count)
+            continue
+        flush_literal()
+        for i in range(0, count, MAX_SPAN):
+            out.extend((0x80 | (min(MAX_SPAN, count - i) - 1), value))
+    flush_literal()
+    return bytes(out)
+
+def encode(image: Image.Image) -> bytes:
+    # Artwork with up to 256 colors is lossless, anything else is quantized without dithering
+    image = image.convert('RGB')
+    indexed = image.quantize(colors=MAX_COLORS, method=Image.Quantize.MEDIANCUT, dither=Image.Dither.NONE)
+    indices = indexed.tobytes()
+    palette = indexed.getpalette()[:(max(indices) + 1) * 3]
+    colors = [_rgb565(*palette[i:i + 3]) for i in range(0, len(palette), 3)]
+    return struct.pack(f'<H{len(colors)}H', len(colors), *colors) + _packbits(indices)
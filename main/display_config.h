@@ -0,0 +1,25 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+
+// Sizes of the display mux buffers, kept free of dependencies so the memory
+// plan can use them without pulling in LVGL
+#define GUI_WIDTH  (640)
+#define GUI_HEIGHT (360)
+#define GUI_FB_NUM (2)
+#define GUI_BUFFER_SIZE (GUI_WIDTH * GUI_HEIGHT * 2)
+#define GUI_LVGL_HEAP_SIZE (256 * 1024)  // LVGL objects, styles and draw tasks, see lvgl_heap.c
+
+#define KEYCAP_ATLAS_SIZE_MAX (64 * 1024)  // PSRAM copy of the generated A8 atlas, checked at setup
+
+#ifndef LAYOUT_CACHE_BUDGET
+#define LAYOUT_CACHE_BUDGET (8 * 1024 * 1024)  // Bytes of PSRAM for decoded layouts
+#endif
+#ifndef LAYOUT_CACHE_KEEP_BASE
+#define LAYOUT_CACHE_KEEP_BASE (0)  // 1 caches JPEG base images too, 1.8 MB each out of the budget
+#endif
+#define LAYOUT_RESTORE_BUDGET (1024 * 1024)  // Bytes of saved pixels under pressed keys
+#define LAYOUT_TINT_TILE (256)  // Side of the A8 tile highlights are tinted with
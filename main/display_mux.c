@@ -8,18 +8,144 @@
 #include "driver/jpeg_types.h"
 #include "driver/ppa.h"
 #include "driver/jpeg_decode.h"
+#include "esp_cache.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "esp_lvgl_port.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "layouts/layout.h"
+#include "layouts/layout_dirty.h"
+#include "layouts/layout_rle.h"
+#include "memory_plan.h"
+#include "power_manager.h"
 #include "screens/layout_screen.h"
+#include <string.h>
+#include <sys/param.h>
+#include <inttypes.h>
 
 static const char *TAG = "DisplayMux";
 static display_mux_mode_t display_mux_mode;
 
+// MARK: PPA
+// PPA operations are submitted non-blocking and grouped into batches. Every
+// transaction holds a reference on its batch; once the last one completed and
+// the batch was committed, the batch's done callback runs on the PPADone task.
+// A batch longer than its client's queue reserves a slot before each submit
+// and is waited on whenever the queue is full.
+#define PPA_DONE_QUEUE_SIZE (8)
+
+typedef void (*display_mux_ppa_done_cb_t)(void *arg);
+
+typedef struct {
+    uint32_t refs;
+    uint32_t reserved;  // Submits since begin, see display_mux_ppa_reserve
+    display_mux_ppa_done_cb_t done;
+    void *arg;
+} display_mux_ppa_batch_t;
+
+static QueueHandle_t ppa_done_queue;
+
+static bool IRAM_ATTR display_mux_ppa_trans_done(ppa_client_handle_t client, ppa_event_data_t *edata, void *user_data) {
+    display_mux_ppa_batch_t *batch = user_data;
+    BaseType_t task_woken = pdFALSE;
+    if (__atomic_sub_fetch(&batch->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        xQueueSendFromISR(ppa_done_queue, &batch, &task_woken);
+    }
+    return task_woken == pdTRUE;
+}
+
+static void display_mux_ppa_register_client(ppa_operation_t oper_type, uint32_t max_pending, ppa_client_handle_t *client) {
+    esp_err_t err = ppa_register_client(&(ppa_client_config_t){
+        .oper_type = oper_type,
+        .max_pending_trans_num = max_pending,
+    }, client);
+    ESP_ERROR_CHECK(err);
+    err = ppa_client_register_event_callbacks(*client, &(ppa_event_callbacks_t){
+        .on_trans_done = display_mux_ppa_trans_done,
+    });
+    ESP_ERROR_CHECK(err);
+}
+
+static void display_mux_ppa_begin(display_mux_ppa_batch_t *batch) {
+    batch->refs = 1;  // Held until commit
+    batch->reserved = 0;
+}
+
+static esp_err_t display_mux_ppa_srm(display_mux_ppa_batch_t *batch, ppa_client_handle_t client, ppa_srm_oper_config_t *config) {
+    config->mode = PPA_TRANS_MODE_NON_BLOCKING;
+    config->user_data = batch;
+    __atomic_add_fetch(&batch->refs, 1, __ATOMIC_ACQ_REL);
+    esp_err_t err = ppa_do_scale_rotate_mirror(client, config);
+    if (err != ESP_OK) __atomic_sub_fetch(&batch->refs, 1, __ATOMIC_ACQ_REL);
+    return err;
+}
+
+static esp_err_t display_mux_ppa_blend(display_mux_ppa_batch_t *batch, ppa_client_handle_t client, ppa_blend_oper_config_t *config) {
+    config->mode = PPA_TRANS_MODE_NON_BLOCKING;
+    config->user_data = batch;
+    __atomic_add_fetch(&batch->refs, 1, __ATOMIC_ACQ_REL);
+    esp_err_t err = ppa_do_blend(client, config);
+    if (err != ESP_OK) __atomic_sub_fetch(&batch->refs, 1, __ATOMIC_ACQ_REL);
+    return err;
+}
+
+static esp_err_t display_mux_ppa_fill(display_mux_ppa_batch_t *batch, ppa_client_handle_t client, ppa_fill_oper_config_t *config) {
+    config->mode = PPA_TRANS_MODE_NON_BLOCKING;
+    config->user_data = batch;
+    __atomic_add_fetch(&batch->refs, 1, __ATOMIC_ACQ_REL);
+    esp_err_t err = ppa_do_fill(client, config);
+    if (err != ESP_OK) __atomic_sub_fetch(&batch->refs, 1, __ATOMIC_ACQ_REL);
+    return err;
+}
+
+// done may be NULL, the batch must not be reused before it completed
+static void display_mux_ppa_commit(display_mux_ppa_batch_t *batch, display_mux_ppa_done_cb_t done, void *arg) {
+    batch->done = done;
+    batch->arg = arg;
+    if (__atomic_sub_fetch(&batch->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        xQueueSend(ppa_done_queue, &batch, portMAX_DELAY);
+    }
+}
+
+static void display_mux_ppa_notify_task(void *arg) {
+    xTaskNotifyGive(arg);
+}
+
+// Commits and blocks the calling task until the batch completed
+static void display_mux_ppa_wait(display_mux_ppa_batch_t *batch) {
+    display_mux_ppa_commit(batch, display_mux_ppa_notify_task, xTaskGetCurrentTaskHandle());
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+// Before each submit to a client allowing max_pending transactions. Once that
+// many are in flight, waits for them and begins the batch again.
+static void display_mux_ppa_reserve(display_mux_ppa_batch_t *batch, uint32_t max_pending) {
+    if (batch->reserved == max_pending) {
+        display_mux_ppa_wait(batch);
+        display_mux_ppa_begin(batch);
+    }
+    batch->reserved++;
+}
+
+static void display_mux_ppa_done_task(void *param) {
+    display_mux_ppa_batch_t *batch;
+    while (true) {
+        xQueueReceive(ppa_done_queue, &batch, portMAX_DELAY);
+        if (batch->done) batch->done(batch->arg);
+    }
+}
+
+static void display_mux_ppa_setup(void) {
+    ppa_done_queue = xQueueCreate(PPA_DONE_QUEUE_SIZE, sizeof(display_mux_ppa_batch_t *));
+    assert(ppa_done_queue);
+    xTaskCreatePinnedToCore(display_mux_ppa_done_task, "PPADone", MEMORY_PLAN_SIZE_STACK_PPA_DONE, NULL, 7, NULL, 1);
+}
+
 // MARK: LVGL GUI
 #define GUI_SCALE_X       (720.0 / GUI_HEIGHT)
 #define GUI_SCALE_Y       (1280.0 / GUI_WIDTH)
-#define GUI_BUFFER_SIZE   (GUI_WIDTH * GUI_HEIGHT * 2)
 
 static lv_obj_t *current_lv_screen;
 static ppa_client_handle_t gui_ppa;
@@ -27,21 +153,54 @@ static void *gui_buffer;
 static uint8_t const gui_fb_num = 2;
 static uint8_t gui_fb_index = 0;
 static lv_indev_t *gui_indev;
+static display_mux_ppa_batch_t gui_ppa_batch;
+static SemaphoreHandle_t gui_flush_semaphore;
 
-static void display_mux_gui_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
-    if (display_mux_mode != DISPLAY_MUX_MODE_GUI) {
-        lv_display_flush_ready(disp);
+// gui_buffer always holds the complete LVGL frame, but each panel frame buffer
+// only received the areas flushed while it was the current one. Areas of the
+// previous frame are therefore rotated into the current frame buffer again.
+// The last flush of a frame submits its own area and all of these in one
+// batch, the client queue holds them all.
+#define GUI_SYNC_AREA_MAX (8)
+#define GUI_PPA_PENDING_MAX (1 + GUI_SYNC_AREA_MAX)
+
+typedef struct {
+    lv_area_t areas[GUI_SYNC_AREA_MAX];
+    int num;
+} gui_damage_t;
+
+static gui_damage_t gui_damage[2];  // This frame, previous frame
+
+static struct {
+    int64_t window_start;
+    uint64_t window_pixels;
+    uint32_t pixels_per_sec;  // Over the last window of at least a second, updated on flush
+} gui_stats;
+
+static void display_mux_gui_damage_add(gui_damage_t *damage, const lv_area_t *area) {
+    if (damage->num < GUI_SYNC_AREA_MAX) {
+        damage->areas[damage->num++] = *area;
         return;
     }
-    esp_err_t err = ppa_do_scale_rotate_mirror(gui_ppa, &(ppa_srm_oper_config_t){
+    lv_area_t *last = &damage->areas[GUI_SYNC_AREA_MAX - 1];
+    last->x1 = MIN(last->x1, area->x1);
+    last->y1 = MIN(last->y1, area->y1);
+    last->x2 = MAX(last->x2, area->x2);
+    last->y2 = MAX(last->y2, area->y2);
+}
+
+// The GUI is rotated 90 degrees: GUI x runs bottom to top on the panel, GUI y left to right
+static void display_mux_gui_rotate_area(const lv_area_t *area) {
+    int32_t width = lv_area_get_width(area), height = lv_area_get_height(area);
+    esp_err_t err = display_mux_ppa_srm(&gui_ppa_batch, gui_ppa, &(ppa_srm_oper_config_t){
         .in = {
             .buffer = gui_buffer,
             .pic_w = GUI_WIDTH,
             .pic_h = GUI_HEIGHT,
-            .block_w = GUI_WIDTH,
-            .block_h = GUI_HEIGHT,
-            .block_offset_x = 0,
-            .block_offset_y = 0,
+            .block_w = width,
+            .block_h = height,
+            .block_offset_x = area->x1,
+            .block_offset_y = area->y1,
             .srm_cm = PPA_SRM_COLOR_MODE_RGB565,
         },
         .out = {
@@ -49,8 +208,8 @@ static void display_mux_gui_flush(lv_display_t *disp, const lv_area_t *area, uin
             .buffer_size = 720 * 1280 * 2,
             .pic_w = 720,
             .pic_h = 1280,
-            .block_offset_x = 0,
-            .block_offset_y = 0,
+            .block_offset_x = area->y1 * GUI_SCALE_X,
+            .block_offset_y = 1280 - (area->x2 + 1) * GUI_SCALE_Y,
             .srm_cm = PPA_SRM_COLOR_MODE_RGB565,
         },
         .rotation_angle = PPA_SRM_ROTATION_ANGLE_90,
@@ -58,12 +217,55 @@ static void display_mux_gui_flush(lv_display_t *disp, const lv_area_t *area, uin
         .scale_y = GUI_SCALE_Y,
     });
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to rotate GUI buffer: %s", esp_err_to_name(err));
+        ESP_LOGE(TAG, "Failed to rotate GUI area: %s", esp_err_to_name(err));
+        return;
+    }
+
+    gui_stats.window_pixels += (uint32_t)(width * GUI_SCALE_Y) * (uint32_t)(height * GUI_SCALE_X);
+    int64_t now = esp_timer_get_time();
+    if (now - gui_stats.window_start >= 1000 * 1000) {
+        gui_stats.pixels_per_sec = gui_stats.window_pixels * 1000 * 1000 / (now - gui_stats.window_start);
+        ESP_LOGD(TAG, "GUI rotation %"PRIu32" pixels/s", gui_stats.pixels_per_sec);
+        gui_stats.window_pixels = 0;
+        gui_stats.window_start = now;
+    }
+}
+
+static void display_mux_gui_flush_done(void *arg) {
+    bool last = (uintptr_t)arg;
+    if (last) {
+        bsp_tab5_display_flush(gui_fb_index);
+        gui_fb_index = (gui_fb_index + 1) % gui_fb_num;
+    }
+    xSemaphoreGive(gui_flush_semaphore);
+}
+
+// LVGL calls this before touching the buffer again, so it can work on other
+// things while the PPA rotates. Flushes are completed here instead of by
+// lv_display_flush_ready().
+static void display_mux_gui_flush_wait(lv_display_t *disp) {
+    xSemaphoreTake(gui_flush_semaphore, portMAX_DELAY);
+}
+
+// Direct mode: called once per invalidated area, px_map is the whole gui_buffer
+static void display_mux_gui_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    if (display_mux_mode != DISPLAY_MUX_MODE_GUI) {
+        lv_display_flush_ready(disp);
+        return;
     }
+    bool last = lv_display_flush_is_last(disp);
 
-    bsp_tab5_display_flush(gui_fb_index);
-    gui_fb_index = (gui_fb_index + 1) % gui_fb_num;
-    lv_display_flush_ready(disp);
+    display_mux_ppa_begin(&gui_ppa_batch);
+    display_mux_gui_rotate_area(area);
+    display_mux_gui_damage_add(&gui_damage[0], area);
+    if (last) {
+        for (int i = 0; i < gui_damage[1].num; i++) {
+            display_mux_gui_rotate_area(&gui_damage[1].areas[i]);
+        }
+        gui_damage[1] = gui_damage[0];
+        gui_damage[0].num = 0;
+    }
+    display_mux_ppa_commit(&gui_ppa_batch, display_mux_gui_flush_done, (void *)(uintptr_t)last);
 }
 
 static void display_mux_gui_input_read(lv_indev_t *indev, lv_indev_data_t *data) {
@@ -71,8 +273,8 @@ static void display_mux_gui_input_read(lv_indev_t *indev, lv_indev_data_t *data)
     int gui_touch_num = bsp_tab5_touch_read(&point, 1);
     if (gui_touch_num > 0) {
         data->state = LV_INDEV_STATE_PRESSED;
-        data->point.x = (1280 - point.y) / GUI_SCALE_X;
-        data->point.y = point.x / GUI_SCALE_Y;
+        data->point.x = point.x;
+        data->point.y = point.y;
         return;
     }
     data->state = LV_INDEV_STATE_RELEASED;
@@ -81,7 +283,7 @@ static void display_mux_gui_input_read(lv_indev_t *indev, lv_indev_data_t *data)
 static void lvgl_setup() {
     lvgl_port_cfg_t config = {
         .task_priority = 4,
-        .task_stack = 7168,
+        .task_stack = MEMORY_PLAN_SIZE_STACK_LVGL,
         .task_affinity = 0,
         .task_max_sleep_ms = 500,
         .task_stack_caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_DEFAULT,
@@ -96,14 +298,14 @@ static void lvgl_setup() {
 
 static void display_mux_gui_setup(void) {
     lvgl_setup();
-    esp_err_t err = ppa_register_client(&(ppa_client_config_t){
-        .oper_type = PPA_OPERATION_SRM,
-    }, &gui_ppa);
-    ESP_ERROR_CHECK(err);
-    gui_buffer = heap_caps_malloc(GUI_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+    display_mux_ppa_register_client(PPA_OPERATION_SRM, GUI_PPA_PENDING_MAX, &gui_ppa);
+    gui_flush_semaphore = xSemaphoreCreateBinary();
+    assert(gui_flush_semaphore);
+    gui_buffer = memory_plan_buffer(MEMORY_PLAN_GUI_BUFFER);
     lv_display_t *disp = lv_display_create(GUI_WIDTH, GUI_HEIGHT);
     lv_display_set_buffers(disp, gui_buffer, NULL, GUI_BUFFER_SIZE, LV_DISPLAY_RENDER_MODE_DIRECT);
     lv_display_set_flush_cb(disp, display_mux_gui_flush);
+    lv_display_set_flush_wait_cb(disp, display_mux_gui_flush_wait);
     bsp_tab5_display_set_brightness(80);
 
     gui_indev = lv_indev_create();
@@ -126,54 +328,114 @@ void display_mux_gui_screen_load(lv_obj_t *screen) {
 }
 
 // MARK: Layout
-#define LAYOUT_BUFFER_SIZE (720 * 1280 * 2)
-void *display_mux_layout_base_image, *display_mux_layout_active_image;
+// Pressed keys are drawn from an atlas of sprites instead of a second full
+// screen image, see layout_builder. Layouts with a highlight have no atlas,
+// their pressed keys are the base image tinted by a PPA blend.
+typedef struct display_mux_layout_bitmap {
+    void *buffer;
+    size_t buffer_size;
+    uint16_t width, height;  // Layout orientation, the buffer holds it rotated
+} display_mux_layout_bitmap_t;
+
 static jpeg_decoder_handle_t jpeg_decoder;
-static ppa_client_handle_t layout_ppa;
+// Per client. A frame submits up to the base, a save per region and a blit
+// per dirty rect, 41 copies, larger frames wait for the first part mid-batch.
+#define LAYOUT_PPA_PENDING_MAX (32)
+static ppa_client_handle_t layout_ppa, layout_blend_ppa;
+static uint8_t *layout_tint_tile;  // Its contents are never used, the alpha is fixed
 
-static void *display_mux_layout_load_image(const layout_image_t *image, void *buffer) {
-    if (!buffer) {
-        size_t allocated_size;
-        buffer = jpeg_alloc_decoder_mem(LAYOUT_BUFFER_SIZE, &(jpeg_decode_memory_alloc_cfg_t){
-            .buffer_direction = JPEG_DEC_ALLOC_OUTPUT_BUFFER,
-        }, &allocated_size);
-        assert(buffer);
-    }
+static const jpeg_decode_cfg_t layout_decode_cfg = {
+    .output_format = JPEG_DECODE_OUT_FORMAT_RGB565,
+    .rgb_order = JPEG_DEC_RGB_ELEMENT_ORDER_BGR,
+    .conv_std = JPEG_YUV_RGB_CONV_STD_BT601,
+};
+
+static struct {
+    uint32_t frames;
+    uint32_t ppa_ops;
+    uint32_t flushes;
+    uint64_t copy_bytes_total;
+    uint32_t copy_bytes_max;
+    uint64_t swap_time_total;
+    uint32_t swap_time_max;
+    uint32_t cache_bytes;
+    uint32_t cache_hits;
+    uint32_t cache_misses;
+    uint32_t load_time;
+    uint32_t base_decode_time;
+    int64_t switch_start;
+    uint32_t switch_time;
+    uint32_t restore_bytes;
+    uint32_t restore_bytes_max;
+} layout_stats;
 
+// JPEG images go through the hardware decoder, RLE images are decoded by the
+// CPU and written back from the cache for PPA and the panel.
+static esp_err_t display_mux_layout_decode(const layout_image_t *image, void *buffer, size_t buffer_size) {
+    if (image->format == LAYOUT_IMAGE_FORMAT_RLE) {
+        size_t pixels = layout_rle_decode(image->data, image->size, buffer, buffer_size / 2);
+        if (pixels != image->width * image->height) return ESP_ERR_INVALID_SIZE;
+        return esp_cache_msync(buffer, pixels * 2, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+    }
     uint32_t out_size;
-    jpeg_decoder_process(jpeg_decoder, &(jpeg_decode_cfg_t){
-        .output_format = JPEG_DECODE_OUT_FORMAT_RGB565,
-        .rgb_order = JPEG_DEC_RGB_ELEMENT_ORDER_BGR,
-        .conv_std = JPEG_YUV_RGB_CONV_STD_BT601,
-    }, image->data, image->size, buffer, LAYOUT_BUFFER_SIZE, &out_size);
+    return jpeg_decoder_process(jpeg_decoder, &layout_decode_cfg, image->data, image->size, buffer, buffer_size, &out_size);
+}
 
-    return buffer;
+// Also suitable as PPA output, the decoder needs the same cache line alignment
+static void display_mux_layout_bitmap_alloc(display_mux_layout_bitmap_t *bitmap, uint16_t width, uint16_t height) {
+    size_t size = width * height * 2;
+    if (bitmap->buffer_size < size) {
+        free(bitmap->buffer);
+        bitmap->buffer = jpeg_alloc_decoder_mem(size, &(jpeg_decode_memory_alloc_cfg_t){
+            .buffer_direction = JPEG_DEC_ALLOC_OUTPUT_BUFFER,
+        }, &bitmap->buffer_size);
+        assert(bitmap->buffer);
+    }
+    bitmap->width = width;
+    bitmap->height = height;
 }
 
-void display_mux_layout_load_images(const layout_image_t *base, const layout_image_t *active) {
-    display_mux_layout_base_image = display_mux_layout_load_image(base, display_mux_layout_base_image);
-    display_mux_layout_active_image = display_mux_layout_load_image(active, display_mux_layout_active_image);
+static void display_mux_layout_load_image(const layout_image_t *image, display_mux_layout_bitmap_t *bitmap) {
+    display_mux_layout_bitmap_alloc(bitmap, image->width, image->height);
+    esp_err_t err = display_mux_layout_decode(image, bitmap->buffer, bitmap->buffer_size);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to decode layout image: %s", esp_err_to_name(err));
+    }
 }
 
-void display_mux_layout_draw_region(const void *image_buffer, uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
-    esp_err_t err = ppa_do_scale_rotate_mirror(layout_ppa, &(ppa_srm_oper_config_t){
+static display_mux_layout_bitmap_t display_mux_layout_frame_buffer(int fb_index) {
+    return (display_mux_layout_bitmap_t){
+        .buffer = bsp_tab5_display_get_frame_buffer(fb_index),
+        .buffer_size = 720 * 1280 * 2,
+        .width = 1280,
+        .height = 720,
+    };
+}
+
+// Copies rect.size pixels from source in image to rect in target, returns the
+// number of bytes copied. The batch is waited on when the client is full.
+static uint32_t display_mux_layout_blit(display_mux_ppa_batch_t *batch, const display_mux_layout_bitmap_t *image, bsp_point_t source, const display_mux_layout_bitmap_t *target, bsp_rect_t rect) {
+    bsp_rect_t source_rect = layout_dirty_panel_rect((bsp_rect_t){ source, rect.size }, image->width);
+    bsp_rect_t target_rect = layout_dirty_panel_rect(rect, target->width);
+    display_mux_ppa_reserve(batch, LAYOUT_PPA_PENDING_MAX);
+    esp_err_t err = display_mux_ppa_srm(batch, layout_ppa, &(ppa_srm_oper_config_t){
         .in = {
-            .buffer = image_buffer,
-            .pic_w = 720,
-            .pic_h = 1280,
-            .block_w = height,
-            .block_h = width,
-            .block_offset_x = y,
-            .block_offset_y = 1280 - (x + width),
+            .buffer = image->buffer,
+            .pic_w = image->height,
+            .pic_h = image->width,
+            .block_w = source_rect.size.width,
+            .block_h = source_rect.size.height,
+            .block_offset_x = source_rect.origin.x,
+            .block_offset_y = source_rect.origin.y,
             .srm_cm = PPA_SRM_COLOR_MODE_RGB565,
         },
         .out = {
-            .buffer = bsp_tab5_display_get_frame_buffer(0),
-            .buffer_size = 720 * 1280 * 2,
-            .pic_w = 720,
-            .pic_h = 1280,
-            .block_offset_x = y,
-            .block_offset_y = 1280 - (x + width),
+            .buffer = target->buffer,
+            .buffer_size = target->buffer_size,
+            .pic_w = target->height,
+            .pic_h = target->width,
+            .block_offset_x = target_rect.origin.x,
+            .block_offset_y = target_rect.origin.y,
             .srm_cm = PPA_SRM_COLOR_MODE_RGB565,
         },
         .rotation_angle = PPA_SRM_ROTATION_ANGLE_0,
@@ -181,13 +443,660 @@ void display_mux_layout_draw_region(const void *image_buffer, uint16_t x, uint16
         .scale_y = 1,
     });
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to draw base image: %s", esp_err_to_name(err));
+        ESP_LOGE(TAG, "Failed to draw layout image: %s", esp_err_to_name(err));
+        return 0;
+    }
+    layout_stats.ppa_ops++;
+    return bsp_rect_area(rect) * 2;
+}
+
+// Number of blend operations display_mux_layout_tint takes for rect
+static int display_mux_layout_tint_ops(bsp_rect_t rect) {
+    return ((rect.size.width + LAYOUT_TINT_TILE - 1) / LAYOUT_TINT_TILE) * ((rect.size.height + LAYOUT_TINT_TILE - 1) / LAYOUT_TINT_TILE);
+}
+
+// Like display_mux_layout_blit with color blended over the pixels. The
+// foreground is an A8 tile with its alpha replaced by a fixed value, larger
+// rects take one operation per tile and a full screen one 15.
+static uint32_t display_mux_layout_tint(display_mux_ppa_batch_t *batch, const display_mux_layout_bitmap_t *image, bsp_point_t source, const display_mux_layout_bitmap_t *target, bsp_rect_t rect, uint32_t color, uint8_t alpha) {
+    bsp_rect_t source_rect = layout_dirty_panel_rect((bsp_rect_t){ source, rect.size }, image->width);
+    bsp_rect_t target_rect = layout_dirty_panel_rect(rect, target->width);
+    uint32_t copy_bytes = 0;
+    for (int y = 0; y < target_rect.size.height; y += LAYOUT_TINT_TILE) {
+        for (int x = 0; x < target_rect.size.width; x += LAYOUT_TINT_TILE) {
+            uint32_t block_w = MIN(LAYOUT_TINT_TILE, target_rect.size.width - x), block_h = MIN(LAYOUT_TINT_TILE, target_rect.size.height - y);
+            display_mux_ppa_reserve(batch, LAYOUT_PPA_PENDING_MAX);
+            esp_err_t err = display_mux_ppa_blend(batch, layout_blend_ppa, &(ppa_blend_oper_config_t){
+                .in_bg = {
+                    .buffer = image->buffer,
+                    .pic_w = image->height,
+                    .pic_h = image->width,
+                    .block_w = block_w,
+                    .block_h = block_h,
+                    .block_offset_x = source_rect.origin.x + x,
+                    .block_offset_y = source_rect.origin.y + y,
+                    .blend_cm = PPA_BLEND_COLOR_MODE_RGB565,
+                },
+                .in_fg = {
+                    .buffer = layout_tint_tile,
+                    .pic_w = LAYOUT_TINT_TILE,
+                    .pic_h = LAYOUT_TINT_TILE,
+                    .block_w = block_w,
+                    .block_h = block_h,
+                    .blend_cm = PPA_BLEND_COLOR_MODE_A8,
+                },
+                .out = {
+                    .buffer = target->buffer,
+                    .buffer_size = target->buffer_size,
+                    .pic_w = target->height,
+                    .pic_h = target->width,
+                    .block_offset_x = target_rect.origin.x + x,
+                    .block_offset_y = target_rect.origin.y + y,
+                    .blend_cm = PPA_BLEND_COLOR_MODE_RGB565,
+                },
+                .bg_alpha_update_mode = PPA_ALPHA_NO_CHANGE,
+                .fg_alpha_update_mode = PPA_ALPHA_FIX_VALUE,
+                .fg_alpha_fix_val = alpha,
+                .fg_fix_rgb_val = { .r = color >> 16, .g = color >> 8, .b = color },
+            });
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to tint layout image: %s", esp_err_to_name(err));
+                continue;
+            }
+            layout_stats.ppa_ops++;
+            copy_bytes += block_w * block_h * 2;
+        }
+    }
+    return copy_bytes;
+}
+
+// MARK: Keycap
+// keycap_renderer backend on the PPA, drawing procedural layouts into cache
+// buffers. A layout is hundreds of small fills and blends, more than a client
+// queue holds, so the batch is committed and waited on whenever it is full.
+// Rendering blocks the caller like a decode does.
+#define KEYCAP_PPA_PENDING_MAX (32)
+
+typedef struct {
+    const display_mux_layout_bitmap_t *target;
+    display_mux_ppa_batch_t batch;
+} display_mux_keycap_ctx_t;
+
+static ppa_client_handle_t keycap_fill_ppa, keycap_blend_ppa;
+static uint8_t *keycap_atlas_data;  // Copy of keycap_atlas the PPA can read
+static size_t keycap_atlas_size;
+
+static void display_mux_keycap_fill(void *arg, keycap_rect_t rect, uint32_t color) {
+    display_mux_keycap_ctx_t *ctx = arg;
+    display_mux_ppa_reserve(&ctx->batch, KEYCAP_PPA_PENDING_MAX);
+    esp_err_t err = display_mux_ppa_fill(&ctx->batch, keycap_fill_ppa, &(ppa_fill_oper_config_t){
+        .out = {
+            .buffer = ctx->target->buffer,
+            .buffer_size = ctx->target->buffer_size,
+            .pic_w = ctx->target->height,
+            .pic_h = ctx->target->width,
+            .block_offset_x = rect.x,
+            .block_offset_y = rect.y,
+            .fill_cm = PPA_FILL_COLOR_MODE_RGB565,
+        },
+        .fill_block_w = rect.width,
+        .fill_block_h = rect.height,
+        .fill_argb_color = { .val = 0xff000000 | color },
+    });
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to fill keycap: %s", esp_err_to_name(err));
+    }
+}
+
+static void display_mux_keycap_blend(void *arg, keycap_rect_t rect, uint16_t mask_x, uint16_t mask_y, uint32_t color) {
+    display_mux_keycap_ctx_t *ctx = arg;
+    display_mux_ppa_reserve(&ctx->batch, KEYCAP_PPA_PENDING_MAX);
+    esp_err_t err = display_mux_ppa_blend(&ctx->batch, keycap_blend_ppa, &(ppa_blend_oper_config_t){
+        .in_bg = {
+            .buffer = ctx->target->buffer,
+            .pic_w = ctx->target->height,
+            .pic_h = ctx->target->width,
+            .block_w = rect.width,
+            .block_h = rect.height,
+            .block_offset_x = rect.x,
+            .block_offset_y = rect.y,
+            .blend_cm = PPA_BLEND_COLOR_MODE_RGB565,
+        },
+        .in_fg = {
+            .buffer = keycap_atlas_data,
+            .pic_w = keycap_atlas.height,
+            .pic_h = keycap_atlas.width,
+            .block_w = rect.width,
+            .block_h = rect.height,
+            .block_offset_x = mask_x,
+            .block_offset_y = mask_y,
+            .blend_cm = PPA_BLEND_COLOR_MODE_A8,
+        },
+        .out = {
+            .buffer = ctx->target->buffer,
+            .buffer_size = ctx->target->buffer_size,
+            .pic_w = ctx->target->height,
+            .pic_h = ctx->target->width,
+            .block_offset_x = rect.x,
+            .block_offset_y = rect.y,
+            .blend_cm = PPA_BLEND_COLOR_MODE_RGB565,
+        },
+        .bg_alpha_update_mode = PPA_ALPHA_NO_CHANGE,
+        .fg_alpha_update_mode = PPA_ALPHA_NO_CHANGE,
+        .fg_fix_rgb_val = { .r = color >> 16, .g = color >> 8, .b = color },
+    });
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to blend keycap: %s", esp_err_to_name(err));
+    }
+}
+
+static const keycap_backend_t display_mux_keycap_backend = {
+    .fill = display_mux_keycap_fill,
+    .blend = display_mux_keycap_blend,
+};
+
+static void display_mux_keycap_render(const layout_config_t *config, display_mux_layout_bitmap_t *bitmap, bool pressed) {
+    display_mux_layout_bitmap_alloc(bitmap, 1280, 720);
+    display_mux_keycap_ctx_t ctx = { .target = bitmap };
+    keycap_target_t target = {
+        .backend = &display_mux_keycap_backend,
+        .ctx = &ctx,
+        .atlas = &keycap_atlas,
+        .width = bitmap->width,
+        .height = bitmap->height,
+    };
+    display_mux_ppa_begin(&ctx.batch);
+    keycap_render_background(&target, config->style);
+    for (int i = 0; i < config->count; i++) {
+        const layout_input_t *input = &config->inputs[i];
+        keycap_rect_t region = { input->region.x, input->region.y, input->region.width, input->region.height };
+        keycap_render_key(&target, config->style, region, input->label, pressed);
+    }
+    display_mux_ppa_wait(&ctx.batch);
+}
+
+static void display_mux_keycap_setup(void) {
+    display_mux_ppa_register_client(PPA_OPERATION_FILL, KEYCAP_PPA_PENDING_MAX, &keycap_fill_ppa);
+    display_mux_ppa_register_client(PPA_OPERATION_BLEND, KEYCAP_PPA_PENDING_MAX, &keycap_blend_ppa);
+
+    // The atlas is in flash, which the PPA can't read
+    size_t alignment;
+    ESP_ERROR_CHECK(esp_cache_get_alignment(MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, &alignment));
+    size_t size = (keycap_atlas.width * keycap_atlas.height + alignment - 1) & ~(alignment - 1);
+    assert(size <= MEMORY_PLAN_SIZE_KEYCAP_ATLAS);  // A regenerated atlas outgrew the memory plan
+    keycap_atlas_size = size;
+    keycap_atlas_data = heap_caps_aligned_calloc(alignment, 1, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA);
+    assert(keycap_atlas_data);
+    memcpy(keycap_atlas_data, keycap_atlas.data, keycap_atlas.width * keycap_atlas.height);
+    ESP_ERROR_CHECK(esp_cache_msync(keycap_atlas_data, size, ESP_CACHE_MSYNC_FLAG_DIR_C2M));
+}
+
+// MARK: Layout Cache
+// Decoded layouts are kept in PSRAM up to LAYOUT_CACHE_BUDGET bytes and the
+// least recently used one is evicted first, so switching back to a recent
+// layout is a blit instead of two JPEG decodes. The layout on screen and the
+// one being switched to are never evicted. JPEG base images are decoded
+// straight into the frame buffers on every redraw and only the atlas is kept,
+// unless LAYOUT_CACHE_KEEP_BASE and the budget allow the base as well.
+//
+// Loads and prefetches are decoded by the prefetch task, so the touch task
+// never waits for a decode or for the cache mutex. A load is served before the
+// queued prefetches, only the latest one is shown, and layout mode redraws once
+// it is decoded.
+#define LAYOUT_CACHE_SLOT_MAX      (4)
+#define LAYOUT_PREFETCH_QUEUE_SIZE (4)
+
+typedef struct {
+    const layout_config_t *config;  // NULL when the slot is free
+    display_mux_layout_bitmap_t base;  // Empty when not cached
+    display_mux_layout_bitmap_t atlas;
+    uint32_t last_used;
+} display_mux_layout_surface_t;
+
+static display_mux_layout_surface_t layout_cache[LAYOUT_CACHE_SLOT_MAX];
+static SemaphoreHandle_t layout_cache_mutex;
+static uint32_t layout_cache_clock;
+static display_mux_layout_surface_t *layout_surface;       // Drawn by the render task
+static display_mux_layout_surface_t *layout_surface_next;  // Taken over by the render task on redraw
+static QueueHandle_t layout_prefetch_queue;  // NULL entries only wake the task for a load
+static portMUX_TYPE layout_load_lock = portMUX_INITIALIZER_UNLOCKED;
+static const layout_config_t *layout_load_request;  // Guarded by layout_load_lock, NULL once decoded
+
+static void display_mux_layout_redraw(void);
+
+static void display_mux_layout_surface_free(display_mux_layout_surface_t *surface) {
+    layout_stats.cache_bytes -= surface->base.buffer_size + surface->atlas.buffer_size;
+    free(surface->base.buffer);
+    free(surface->atlas.buffer);
+    *surface = (display_mux_layout_surface_t){ 0 };
+}
+
+// Frees the least recently used surface nobody draws, returns false if there is none
+static bool display_mux_layout_cache_evict(void) {
+    display_mux_layout_surface_t *victim = NULL;
+    for (int i = 0; i < LAYOUT_CACHE_SLOT_MAX; i++) {
+        display_mux_layout_surface_t *surface = &layout_cache[i];
+        if (!surface->config || surface == layout_surface || surface == layout_surface_next) continue;
+        if (!victim || (int32_t)(surface->last_used - victim->last_used) < 0) victim = surface;
+    }
+    if (!victim) return false;
+    ESP_LOGI(TAG, "Layout evicted: %s", victim->config->title);
+    display_mux_layout_surface_free(victim);
+    return true;
+}
+
+// NULL finds a free slot
+static display_mux_layout_surface_t *display_mux_layout_cache_find(const layout_config_t *config) {
+    for (int i = 0; i < LAYOUT_CACHE_SLOT_MAX; i++) {
+        if (layout_cache[i].config == config) return &layout_cache[i];
+    }
+    return NULL;
+}
+
+// Called with layout_cache_mutex held, decodes on a miss
+static display_mux_layout_surface_t *display_mux_layout_cache_get(const layout_config_t *config) {
+    display_mux_layout_surface_t *surface = display_mux_layout_cache_find(config);
+    if (surface) {
+        surface->last_used = ++layout_cache_clock;
+        return surface;
+    }
+
+    // Procedural layouts render a full size pressed surface as their atlas and
+    // always keep the base, there is nothing to decode it from. Highlighted
+    // layouts have no atlas.
+    const layout_image_t *base = config->base_image, *atlas = config->active_atlas;
+    assert(config->style || (base->width == 1280 && base->height == 720));  // Same as the frame buffers
+    size_t base_size = 1280 * 720 * 2, atlas_size = 0;
+    if (!config->highlight) atlas_size = config->style ? base_size : atlas->width * atlas->height * 2;
+    if (!config->style && !LAYOUT_CACHE_KEEP_BASE) base_size = 0;
+    while (layout_stats.cache_bytes + base_size + atlas_size > LAYOUT_CACHE_BUDGET && display_mux_layout_cache_evict());
+    bool with_base = config->style || (base_size && layout_stats.cache_bytes + base_size + atlas_size <= LAYOUT_CACHE_BUDGET);
+
+    surface = display_mux_layout_cache_find(NULL);
+    if (!surface && display_mux_layout_cache_evict()) surface = display_mux_layout_cache_find(NULL);
+    assert(surface);  // The render task pins at most two slots
+
+    int64_t start = esp_timer_get_time();
+    if (config->style) {
+        display_mux_keycap_render(config, &surface->base, false);
+        if (!config->highlight) display_mux_keycap_render(config, &surface->atlas, true);
+    } else {
+        if (with_base) display_mux_layout_load_image(base, &surface->base);
+        if (!config->highlight) display_mux_layout_load_image(atlas, &surface->atlas);
+    }
+    surface->config = config;
+    surface->last_used = ++layout_cache_clock;
+    layout_stats.cache_bytes += surface->base.buffer_size + surface->atlas.buffer_size;
+    layout_stats.load_time = esp_timer_get_time() - start;
+    ESP_LOGI(TAG, "Layout loaded: %s%s in %"PRIu32" us, cache %"PRIu32" bytes", config->title, with_base ? "" : " (atlas only)",
+             layout_stats.load_time, layout_stats.cache_bytes);
+    return surface;
+}
+
+void display_mux_layout_load(const layout_config_t *config) {
+    layout_stats.switch_start = esp_timer_get_time();
+    portENTER_CRITICAL(&layout_load_lock);
+    layout_load_request = config;
+    portEXIT_CRITICAL(&layout_load_lock);
+    // With the queue full the task is awake anyway and sees the request first
+    const layout_config_t *wake = NULL;
+    xQueueSendToFront(layout_prefetch_queue, &wake, 0);
+}
+
+bool display_mux_layout_ready(void) {
+    portENTER_CRITICAL(&layout_load_lock);
+    bool ready = !layout_load_request && layout_surface == layout_surface_next;
+    portEXIT_CRITICAL(&layout_load_lock);
+    return ready;
+}
+
+void display_mux_layout_prefetch(const layout_config_t *config) {
+    if (xQueueSend(layout_prefetch_queue, &config, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Prefetch queue full, %s skipped", config->title);
+    }
+}
+
+static void display_mux_layout_prefetch_task(void *param) {
+    const layout_config_t *config;
+    while (true) {
+        xQueueReceive(layout_prefetch_queue, &config, portMAX_DELAY);
+
+        portENTER_CRITICAL(&layout_load_lock);
+        const layout_config_t *load = layout_load_request;
+        portEXIT_CRITICAL(&layout_load_lock);
+        if (load) {
+            xSemaphoreTake(layout_cache_mutex, portMAX_DELAY);
+            if (display_mux_layout_cache_find(load)) {
+                layout_stats.cache_hits++;
+            } else {
+                layout_stats.cache_misses++;
+            }
+            display_mux_layout_surface_t *surface = display_mux_layout_cache_get(load);
+            // A newer load queued its own wake up and replaces this one
+            portENTER_CRITICAL(&layout_load_lock);
+            bool latest = layout_load_request == load;
+            if (latest) {
+                layout_surface_next = surface;
+                layout_load_request = NULL;
+            }
+            portEXIT_CRITICAL(&layout_load_lock);
+            xSemaphoreGive(layout_cache_mutex);
+            if (latest && display_mux_mode == DISPLAY_MUX_MODE_LAYOUT) display_mux_layout_redraw();
+        }
+
+        if (config) {
+            xSemaphoreTake(layout_cache_mutex, portMAX_DELAY);
+            display_mux_layout_cache_get(config);
+            xSemaphoreGive(layout_cache_mutex);
+        }
+    }
+}
+
+// MARK: Layout Render
+// Key highlights are drawn by a dedicated task so the touch task only has to
+// queue a command after submitting the HID report. Commands arriving within
+// one frame are merged per input; a press and release inside the same frame
+// cancel out and draw nothing. The remaining changes become a dirty-rect list,
+// neighbours sharing a source image are blitted as one PPA operation, and the
+// frame is submitted to the panel with a single flush.
+//
+// Layout mode is double buffered on the first two panel frame buffers. A frame
+// is drawn into the back buffer and flushed, and once the panel reports the
+// next refresh done the old front buffer is free. It becomes the new back
+// buffer after the frame's damage is replayed onto it, so only dirty regions
+// are ever copied.
+//
+// Before a key is highlighted, the pixels under its sprite are saved from the
+// back buffer into a restore slot, and releasing the key draws them back. Only
+// keys currently pressed take memory.
+//
+// A tinted highlight is blended from the restore slot, so drawing it again with
+// another alpha does not accumulate. With fade_frames it is redrawn on the
+// following frames up to the layout's alpha. Presses are always drawn at once,
+// fade steps only up to LAYOUT_RENDER_FADE_OPS_MAX blends per frame, the rest
+// waits for the next frame.
+#define LAYOUT_RENDER_QUEUE_SIZE   (32)
+#define LAYOUT_RENDER_FRAME_PERIOD (16 * 1000)
+#define LAYOUT_RENDER_REGION_MAX   (16)
+#define LAYOUT_RENDER_SWAP_TIMEOUT (50)
+#define LAYOUT_RESTORE_MAX         (8)
+#define LAYOUT_RENDER_FADE_OPS_MAX (8)
+
+typedef struct {
+    const layout_input_t *input;  // NULL redraws the whole base image
+    bool active;
+} layout_render_cmd_t;
+
+typedef struct {
+    const layout_input_t *input;  // NULL when the slot is free
+    bsp_rect_t rect;
+    display_mux_layout_bitmap_t bitmap;
+    bool released;
+    uint8_t fade_step;  // Highlight frames drawn so far
+} layout_restore_t;
+
+static QueueHandle_t layout_render_queue;
+static int layout_back_fb_index = 1;
+static display_mux_ppa_batch_t layout_draw_batch, layout_replay_batch;
+static layout_restore_t layout_restore[LAYOUT_RESTORE_MAX];
+static size_t layout_restore_alignment;
+
+static layout_restore_t *display_mux_layout_restore_find(const layout_input_t *input) {
+    for (int i = 0; i < LAYOUT_RESTORE_MAX; i++) {
+        if (layout_restore[i].input == input) return &layout_restore[i];
+    }
+    return NULL;
+}
+
+static layout_restore_t *display_mux_layout_restore_alloc(const layout_input_t *input, bsp_rect_t rect) {
+    layout_restore_t *restore = display_mux_layout_restore_find(NULL);
+    if (!restore) return NULL;
+
+    // PPA output buffers must be cache line aligned, address and size
+    size_t size = (bsp_rect_area(rect) * 2 + layout_restore_alignment - 1) & ~(layout_restore_alignment - 1);
+    if (layout_stats.restore_bytes + size > MEMORY_PLAN_SIZE_LAYOUT_RESTORE) return NULL;
+    void *buffer = heap_caps_aligned_calloc(layout_restore_alignment, 1, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA);
+    if (!buffer) return NULL;
+
+    *restore = (layout_restore_t){
+        .input = input,
+        .rect = rect,
+        .bitmap = { buffer, size, rect.size.width, rect.size.height },
+    };
+    layout_stats.restore_bytes += size;
+    if (layout_stats.restore_bytes > layout_stats.restore_bytes_max) layout_stats.restore_bytes_max = layout_stats.restore_bytes;
+    return restore;
+}
+
+static void display_mux_layout_restore_free(layout_restore_t *restore) {
+    heap_caps_free(restore->bitmap.buffer);
+    layout_stats.restore_bytes -= restore->bitmap.buffer_size;
+    *restore = (layout_restore_t){ 0 };
+}
+
+// Draws the whole base image into target, returns the number of bytes copied.
+// Without a cached base image it is decoded into target right away.
+static uint32_t display_mux_layout_draw_base(display_mux_ppa_batch_t *batch, const display_mux_layout_bitmap_t *target) {
+    if (layout_surface->base.buffer) {
+        return display_mux_layout_blit(batch, &layout_surface->base, (bsp_point_t){ 0, 0 }, target, (bsp_rect_t){ { 0, 0 }, { 1280, 720 } });
+    }
+
+    const layout_image_t *image = layout_surface->config->base_image;
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = display_mux_layout_decode(image, target->buffer, target->buffer_size);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to decode layout base image: %s", esp_err_to_name(err));
     }
-    bsp_tab5_display_flush(0);
+    layout_stats.base_decode_time = esp_timer_get_time() - start;
+    return 0;
 }
 
-static void display_mux_layout_draw_base_image(void) {
-    display_mux_layout_draw_region(display_mux_layout_base_image, 0, 0, 1280, 720);
+// Blends the tinted dirty rects into target and waits for them. The blend
+// client runs independently of the SRM one, so tints go after the copies of
+// the frame completed, they read restore slots those may have just saved.
+static uint32_t display_mux_layout_draw_tints(display_mux_ppa_batch_t *batch, const display_mux_layout_bitmap_t *target, const layout_dirty_t *dirty, int dirty_num) {
+    int i = 0;
+    while (i < dirty_num && !dirty[i].alpha) i++;
+    if (i == dirty_num) return 0;
+
+    const layout_highlight_t *highlight = layout_surface->config->highlight;
+    uint32_t copy_bytes = 0;
+    display_mux_ppa_begin(batch);
+    for (; i < dirty_num; i++) {
+        if (!dirty[i].alpha) continue;
+        copy_bytes += display_mux_layout_tint(batch, dirty[i].image, dirty[i].source, target, dirty[i].rect, highlight->color, dirty[i].alpha);
+    }
+    display_mux_ppa_wait(batch);
+    return copy_bytes;
+}
+
+static void display_mux_layout_render_frame(bool redraw, layout_restore_t *const *saves, int save_num, const layout_dirty_t *dirty, int dirty_num) {
+    uint32_t copy_bytes = 0;
+    bsp_rect_t bounds = redraw ? (bsp_rect_t){ { 0, 0 }, { 1280, 720 } } : dirty[0].rect;
+    display_mux_layout_bitmap_t back = display_mux_layout_frame_buffer(layout_back_fb_index);
+    display_mux_ppa_begin(&layout_draw_batch);
+    if (redraw) copy_bytes += display_mux_layout_draw_base(&layout_draw_batch, &back);
+    for (int i = 0; i < save_num; i++) {
+        bsp_rect_t rect = saves[i]->rect;
+        copy_bytes += display_mux_layout_blit(&layout_draw_batch, &back, rect.origin, &saves[i]->bitmap, (bsp_rect_t){ { 0, 0 }, rect.size });
+    }
+    for (int i = 0; i < dirty_num; i++) {
+        if (!dirty[i].alpha) copy_bytes += display_mux_layout_blit(&layout_draw_batch, dirty[i].image, dirty[i].source, &back, dirty[i].rect);
+        bounds = bsp_rect_union(bounds, dirty[i].rect);
+    }
+    display_mux_ppa_wait(&layout_draw_batch);
+    copy_bytes += display_mux_layout_draw_tints(&layout_draw_batch, &back, dirty, dirty_num);
+
+    // Present the back buffer, the panel switches to it at the next refresh
+    int64_t swap_start = esp_timer_get_time();
+    bsp_tab5_display_flush_rect(layout_back_fb_index, layout_dirty_panel_rect(bounds, 1280));
+    esp_err_t err = bsp_tab5_display_wait_refresh(LAYOUT_RENDER_SWAP_TIMEOUT);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "No refresh after swap: %s", esp_err_to_name(err));
+    }
+    uint32_t swap_time = esp_timer_get_time() - swap_start;
+
+    // Bring the old front buffer up to date, it is the next back buffer. Wait
+    // for it, released restore slots are freed afterwards.
+    layout_back_fb_index ^= 1;
+    back = display_mux_layout_frame_buffer(layout_back_fb_index);
+    display_mux_ppa_begin(&layout_replay_batch);
+    if (redraw) copy_bytes += display_mux_layout_draw_base(&layout_replay_batch, &back);
+    for (int i = 0; i < dirty_num; i++) {
+        if (!dirty[i].alpha) copy_bytes += display_mux_layout_blit(&layout_replay_batch, dirty[i].image, dirty[i].source, &back, dirty[i].rect);
+    }
+    display_mux_ppa_wait(&layout_replay_batch);
+    copy_bytes += display_mux_layout_draw_tints(&layout_replay_batch, &back, dirty, dirty_num);
+
+    layout_stats.frames++;
+    layout_stats.flushes++;
+    layout_stats.copy_bytes_total += copy_bytes;
+    if (copy_bytes > layout_stats.copy_bytes_max) layout_stats.copy_bytes_max = copy_bytes;
+    layout_stats.swap_time_total += swap_time;
+    if (swap_time > layout_stats.swap_time_max) layout_stats.swap_time_max = swap_time;
+}
+
+// Highlight alpha for a fade step, steps start at 1
+static uint8_t display_mux_layout_fade_alpha(const layout_highlight_t *highlight, int step) {
+    if (step >= highlight->fade_frames) return highlight->alpha;
+    return MAX(1, highlight->alpha * step / highlight->fade_frames);
+}
+
+static bool display_mux_layout_fading(void) {
+    if (display_mux_mode != DISPLAY_MUX_MODE_LAYOUT || !layout_surface || !layout_surface->config->highlight) return false;
+    for (int i = 0; i < LAYOUT_RESTORE_MAX; i++) {
+        const layout_restore_t *restore = &layout_restore[i];
+        if (restore->input && !restore->released && restore->fade_step < layout_surface->config->highlight->fade_frames) return true;
+    }
+    return false;
+}
+
+static void display_mux_layout_render_task(void *param) {
+    struct {
+        const layout_input_t *input;
+        bool drawn, active;
+    } regions[LAYOUT_RENDER_REGION_MAX];
+    int64_t last_frame = 0;
+    layout_render_cmd_t cmd;
+    bool carried = false;
+
+    while (true) {
+        // A fade keeps frames coming without commands
+        TickType_t idle_wait = portMAX_DELAY;
+        if (display_mux_layout_fading()) {
+            int64_t wait = last_frame + LAYOUT_RENDER_FRAME_PERIOD - esp_timer_get_time();
+            idle_wait = wait > 0 ? pdMS_TO_TICKS(wait / 1000) : 0;
+        }
+        bool received = carried || xQueueReceive(layout_render_queue, &cmd, idle_wait);
+        carried = false;
+
+        bool redraw = false;
+        int region_num = 0;
+        while (received) {
+            if (!cmd.input) {
+                redraw = true;
+                region_num = 0;  // Every region is back to the base image
+            } else {
+                int i = 0;
+                while (i < region_num && regions[i].input != cmd.input) i++;
+                if (i == region_num) {
+                    if (region_num == LAYOUT_RENDER_REGION_MAX) {
+                        carried = true;  // Draw what we have, this command starts the next frame
+                        break;
+                    }
+                    regions[i].input = cmd.input;
+                    regions[i].drawn = !cmd.active;
+                    region_num++;
+                }
+                regions[i].active = cmd.active;
+            }
+
+            // Keep merging until the next frame is due
+            int64_t wait = last_frame + LAYOUT_RENDER_FRAME_PERIOD - esp_timer_get_time();
+            received = xQueueReceive(layout_render_queue, &cmd, wait > 0 ? pdMS_TO_TICKS(wait / 1000) : 0);
+        }
+
+        if (display_mux_mode != DISPLAY_MUX_MODE_LAYOUT) continue;
+        if (redraw) {
+            xSemaphoreTake(layout_cache_mutex, portMAX_DELAY);
+            layout_surface = layout_surface_next;
+            xSemaphoreGive(layout_cache_mutex);
+            for (int i = 0; i < LAYOUT_RESTORE_MAX; i++) {
+                if (layout_restore[i].input) display_mux_layout_restore_free(&layout_restore[i]);
+            }
+        }
+
+        const layout_highlight_t *highlight = layout_surface->config->highlight;
+        layout_restore_t *saves[LAYOUT_RENDER_REGION_MAX];
+        layout_dirty_t dirty[LAYOUT_RENDER_REGION_MAX + LAYOUT_RESTORE_MAX];
+        int save_num = 0, dirty_num = 0;
+        for (int i = 0; i < region_num; i++) {
+            if (regions[i].active == regions[i].drawn) continue;
+            const layout_input_t *input = regions[i].input;
+            bsp_rect_t rect = { { input->sprite.x, input->sprite.y }, { input->sprite.width, input->sprite.height } };
+            layout_restore_t *restore = display_mux_layout_restore_find(input);
+            if (regions[i].active) {
+                if (restore) continue;  // Already drawn pressed
+                restore = display_mux_layout_restore_alloc(input, rect);
+                if (!restore) {
+                    ESP_LOGW(TAG, "No restore slot or budget, highlight dropped");
+                    continue;
+                }
+                saves[save_num++] = restore;
+                if (highlight) {
+                    restore->fade_step = 1;
+                    dirty[dirty_num++] = (layout_dirty_t){ &restore->bitmap, { 0, 0 }, rect, display_mux_layout_fade_alpha(highlight, 1) };
+                } else {
+                    dirty[dirty_num++] = (layout_dirty_t){ &layout_surface->atlas, { input->sprite.atlas_x, input->sprite.atlas_y }, rect };
+                }
+            } else {
+                if (!restore) continue;  // Never drawn pressed
+                restore->released = true;
+                dirty[dirty_num++] = (layout_dirty_t){ &restore->bitmap, { 0, 0 }, rect };
+            }
+        }
+        // Step the fades of keys held since earlier frames, within the budget
+        int fade_ops = 0;
+        for (int i = 0; highlight && i < LAYOUT_RESTORE_MAX; i++) {
+            layout_restore_t *restore = &layout_restore[i];
+            if (!restore->input || restore->released || restore->fade_step >= highlight->fade_frames) continue;
+            bool pressed_now = false;
+            for (int j = 0; j < save_num; j++) pressed_now |= saves[j] == restore;
+            if (pressed_now) continue;
+            int ops = display_mux_layout_tint_ops(restore->rect);
+            if (fade_ops > 0 && fade_ops + ops > LAYOUT_RENDER_FADE_OPS_MAX) break;
+            fade_ops += ops;
+            restore->fade_step++;
+            dirty[dirty_num++] = (layout_dirty_t){ &restore->bitmap, { 0, 0 }, restore->rect, display_mux_layout_fade_alpha(highlight, restore->fade_step) };
+        }
+
+        if (!redraw && dirty_num == 0) continue;
+        dirty_num = layout_dirty_compact(dirty, dirty_num);
+        display_mux_layout_render_frame(redraw, saves, save_num, dirty, dirty_num);
+        last_frame = esp_timer_get_time();
+        if (redraw && layout_stats.switch_start) {
+            layout_stats.switch_time = last_frame - layout_stats.switch_start;
+            layout_stats.switch_start = 0;
+            ESP_LOGI(TAG, "Layout on screen %"PRIu32" us after load", layout_stats.switch_time);
+        }
+
+        for (int i = 0; i < LAYOUT_RESTORE_MAX; i++) {
+            if (layout_restore[i].released) display_mux_layout_restore_free(&layout_restore[i]);
+        }
+    }
+}
+
+static void display_mux_layout_redraw(void) {
+    layout_render_cmd_t cmd = { NULL, false };
+    xQueueSend(layout_render_queue, &cmd, portMAX_DELAY);
+}
+
+void display_mux_layout_highlight(const layout_input_t *input, bool active) {
+    if (input->sprite.width == 0) return;  // Looks the same when pressed
+    layout_render_cmd_t cmd = { input, active };
+    if (xQueueSend(layout_render_queue, &cmd, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Render queue full, highlight dropped");
+    }
 }
 
 static void display_mux_layout_setup(void) {
@@ -198,46 +1107,122 @@ static void display_mux_layout_setup(void) {
     }, &jpeg_decoder);
     ESP_ERROR_CHECK(err);
 
-    err = ppa_register_client(&(ppa_client_config_t){
-        .oper_type = PPA_OPERATION_SRM,
-    }, &layout_ppa);
+    err = esp_cache_get_alignment(MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, &layout_restore_alignment);
     ESP_ERROR_CHECK(err);
+    display_mux_keycap_setup();
+    display_mux_ppa_register_client(PPA_OPERATION_SRM, LAYOUT_PPA_PENDING_MAX, &layout_ppa);
+    display_mux_ppa_register_client(PPA_OPERATION_BLEND, LAYOUT_PPA_PENDING_MAX, &layout_blend_ppa);
+    layout_tint_tile = memory_plan_buffer(MEMORY_PLAN_LAYOUT_TINT_TILE);
+
+    layout_cache_mutex = xSemaphoreCreateMutex();
+    assert(layout_cache_mutex);
+    layout_prefetch_queue = xQueueCreate(LAYOUT_PREFETCH_QUEUE_SIZE, sizeof(const layout_config_t *));
+    assert(layout_prefetch_queue);
+    xTaskCreatePinnedToCore(display_mux_layout_prefetch_task, "LayoutPrefetch", MEMORY_PLAN_SIZE_STACK_LAYOUT_PREFETCH, NULL, 2, NULL, 1);
+
+    layout_render_queue = xQueueCreate(LAYOUT_RENDER_QUEUE_SIZE, sizeof(layout_render_cmd_t));
+    assert(layout_render_queue);
+    xTaskCreatePinnedToCore(display_mux_layout_render_task, "LayoutRender", MEMORY_PLAN_SIZE_STACK_LAYOUT_RENDER, NULL, 6, NULL, 1);
 }
 
 // MARK: Common
+// Touch points arrive in the coordinates of the active mode, landscape and
+// scaled down to the LVGL resolution in GUI mode
+static void display_mux_set_touch_transform(display_mux_mode_t mode) {
+    bsp_tab5_touch_set_transform((bsp_touch_transform_t){
+        .rotation = BSP_TOUCH_ROTATION_90,
+        .scale = mode == DISPLAY_MUX_MODE_GUI ? BSP_TOUCH_SCALE(GUI_WIDTH, 1280) : BSP_TOUCH_SCALE_ONE,
+    });
+}
+
 void display_mux_switch_mode(display_mux_mode_t mode) {
     display_mux_mode = mode;
+    display_mux_set_touch_transform(mode);
     if (mode == DISPLAY_MUX_MODE_LAYOUT) {
-        display_mux_layout_draw_base_image();
+        // A load still decoding redraws once it is done
+        portENTER_CRITICAL(&layout_load_lock);
+        bool loading = layout_load_request != NULL;
+        portEXIT_CRITICAL(&layout_load_lock);
+        if (!loading) display_mux_layout_redraw();
+    } else {
+        // Both frame buffers hold the layout, start over with a full frame
+        lv_lock();
+        lv_obj_invalidate(lv_screen_active());
+        lv_unlock();
     }
 }
 
 static void trigger_gui_indev_read(void *arg) {
     lv_indev_read(gui_indev);
 }
+static struct {
+    uint32_t frames;
+    uint64_t latency_total;
+    uint32_t latency_max;
+} touch_stats;
+
 static void display_mux_touch_task(void *param) {
+    bool wake_touch = false;  // Started while the screen was dark, dropped through its release
     while (true) {
-        bsp_tab5_touch_wait_interrupt();
-        if (display_mux_mode == DISPLAY_MUX_MODE_GUI) {
+        int64_t irq_time = bsp_tab5_touch_wait_interrupt();
+        if (wake_touch || !power_manager_is_awake()) {
+            esp_lcd_touch_point_data_t points[5];
+            wake_touch = bsp_tab5_touch_read(points, 5) > 0;
+        } else if (display_mux_mode == DISPLAY_MUX_MODE_GUI) {
             lv_lock();
             lv_async_call(trigger_gui_indev_read, NULL);
             lv_unlock();
         } else {
             esp_lcd_touch_point_data_t points[5];
             int touch_num = bsp_tab5_touch_read(points, 5);
-            for (int i = 0; i < touch_num; i++) {
-                uint16_t x = points[i].x, y = points[i].y;
-                points[i].x = 1280 - y;
-                points[i].y = x;
-            }
-            layout_screen_on_touch(touch_num, points);
+            layout_screen_on_touch(touch_num, points, irq_time);
+
+            uint32_t latency = esp_timer_get_time() - irq_time;
+            touch_stats.frames++;
+            touch_stats.latency_total += latency;
+            if (latency > touch_stats.latency_max) touch_stats.latency_max = latency;
         }
+        power_manager_on_input(irq_time);
     }
 }
 
+void display_mux_get_stats(display_mux_stats_t *stats) {
+    bsp_tab5_touch_stats_t bsp_touch_stats;
+    bsp_tab5_touch_get_stats(&bsp_touch_stats);
+    *stats = (display_mux_stats_t){
+        .touch_frames = touch_stats.frames,
+        .touch_latency_avg_us = touch_stats.frames ? touch_stats.latency_total / touch_stats.frames : 0,
+        .touch_latency_max_us = touch_stats.latency_max,
+        .touch_wake_latency_avg_us = bsp_touch_stats.wakeups ? bsp_touch_stats.wake_latency_total_us / bsp_touch_stats.wakeups : 0,
+        .touch_wake_latency_max_us = bsp_touch_stats.wake_latency_max_us,
+        .touch_samples_per_sec = bsp_touch_stats.reads_per_sec,
+        .touch_read_time_avg_us = bsp_touch_stats.reads ? bsp_touch_stats.read_time_total_us / bsp_touch_stats.reads : 0,
+        .touch_read_time_max_us = bsp_touch_stats.read_time_max_us,
+        .layout_frames = layout_stats.frames,
+        .layout_ppa_ops = layout_stats.ppa_ops,
+        .layout_flushes = layout_stats.flushes,
+        .gui_ppa_pixels_per_sec = gui_stats.pixels_per_sec,
+        .layout_cache_bytes = layout_stats.cache_bytes,
+        .layout_cache_hits = layout_stats.cache_hits,
+        .layout_cache_misses = layout_stats.cache_misses,
+        .layout_load_time_us = layout_stats.load_time,
+        .layout_switch_time_us = layout_stats.switch_time,
+        .layout_base_decode_time_us = layout_stats.base_decode_time,
+        .layout_restore_bytes = layout_stats.restore_bytes,
+        .layout_restore_bytes_max = layout_stats.restore_bytes_max,
+        .keycap_atlas_bytes = keycap_atlas_size,
+        .layout_copy_bytes_avg = layout_stats.frames ? layout_stats.copy_bytes_total / layout_stats.frames : 0,
+        .layout_copy_bytes_max = layout_stats.copy_bytes_max,
+        .layout_swap_time_avg_us = layout_stats.frames ? layout_stats.swap_time_total / layout_stats.frames : 0,
+        .layout_swap_time_max_us = layout_stats.swap_time_max,
+    };
+}
+
 void display_mux_setup(void) {
     display_mux_mode = DISPLAY_MUX_MODE_GUI;
+    display_mux_set_touch_transform(display_mux_mode);
+    display_mux_ppa_setup();
     display_mux_gui_setup();
     display_mux_layout_setup();
-    xTaskCreatePinnedToCore(display_mux_touch_task, "Touch", 8192, NULL, 20, NULL, 0);
+    xTaskCreatePinnedToCore(display_mux_touch_task, "Touch", MEMORY_PLAN_SIZE_STACK_TOUCH, NULL, 20, NULL, 0);
 }
@@ -5,6 +5,7 @@
 
 #pragma once
 #include "lvgl.h"
+#include "display_config.h"
 #include "layouts/layout.h"
 
 typedef enum {
@@ -13,16 +14,43 @@ typedef enum {
 } display_mux_mode_t;
 
 // MARK: LVGL GUI
-#define GUI_WIDTH  (640)
-#define GUI_HEIGHT (360)
-#define GUI_FB_NUM (2)
 void display_mux_gui_screen_load(lv_obj_t *screen);
 
 // MARK: Layout
-extern void *display_mux_layout_base_image, *display_mux_layout_active_image;
-void display_mux_layout_load_images(const layout_image_t *base, const layout_image_t *active);
-void display_mux_layout_draw_region(const void *image_buffer, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void display_mux_layout_load(const layout_config_t *config);      // Decodes in the background unless cached, shown once decoded in layout mode, never blocks
+void display_mux_layout_prefetch(const layout_config_t *config);  // Decodes in the background, never blocks
+bool display_mux_layout_ready(void);  // The last loaded layout is on screen
+void display_mux_layout_highlight(const layout_input_t *input, bool active);  // Never blocks
 
 // MARK: Common
+typedef struct {
+    uint32_t touch_frames;
+    uint32_t touch_latency_avg_us;  // Touch interrupt to input handling done (HID reports queued)
+    uint32_t touch_latency_max_us;
+    uint32_t touch_wake_latency_avg_us;  // Touch interrupt to the touch task running, see bsp_tab5_touch_get_stats
+    uint32_t touch_wake_latency_max_us;
+    uint32_t touch_samples_per_sec;      // Touch controller reads, bounds trackpad smoothness
+    uint32_t touch_read_time_avg_us;     // I2C time of one read
+    uint32_t touch_read_time_max_us;
+    uint32_t layout_frames;   // Highlight frames submitted by the render task
+    uint32_t layout_ppa_ops;  // Blits after dirty-rect merging and restore saves
+    uint32_t layout_flushes;  // Panel flushes, at most one per frame
+    uint32_t layout_copy_bytes_avg;    // Per frame, drawing and damage replay together
+    uint32_t layout_copy_bytes_max;
+    uint32_t layout_swap_time_avg_us;  // Flush to refresh done, the back buffer is free after it
+    uint32_t layout_swap_time_max_us;
+    uint32_t gui_ppa_pixels_per_sec;   // Panel pixels written by GUI rotation
+    uint32_t layout_cache_bytes;       // Decoded layouts held in PSRAM, see LAYOUT_CACHE_BUDGET
+    uint32_t layout_cache_hits;        // Layout loads served without decoding
+    uint32_t layout_cache_misses;
+    uint32_t layout_load_time_us;      // Last decode into the cache
+    uint32_t layout_switch_time_us;    // Last layout load to its first frame on screen, connect to usable keyboard on ACTIVE
+    uint32_t layout_base_decode_time_us;  // Into one frame buffer when the base image is not cached
+    uint32_t layout_restore_bytes;        // Saved pixels under pressed keys, see LAYOUT_RESTORE_BUDGET
+    uint32_t layout_restore_bytes_max;
+    uint32_t keycap_atlas_bytes;          // PSRAM copy the PPA blends from
+} display_mux_stats_t;
+
 void display_mux_switch_mode(display_mux_mode_t mode);
+void display_mux_get_stats(display_mux_stats_t *stats);
 void display_mux_setup(void);
@@ -120,6 +120,8 @@ static bool get_bonded_device(esp_bd_addr_t addr) {
 
 // MARK: GAP
 static esp_bd_addr_t current_peer_addr;  // Store peer address for passkey/confirm reply
+static uint16_t connection_interval;     // Current connection interval (1.25ms units, 0 = unknown)
+static esp_bd_addr_t connected_addr;     // Peer of the authenticated connection
 
 static esp_ble_adv_params_t adv_params = {
     .adv_int_min        = 0x20,
@@ -180,11 +182,22 @@ static void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param
         });
         break;
 
+    case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+        ESP_LOGI(TAG, "Connection params updated: interval=%d, latency=%d, timeout=%d",
+                 param->update_conn_params.conn_int,
+                 param->update_conn_params.latency,
+                 param->update_conn_params.timeout);
+        if (param->update_conn_params.status == ESP_BT_STATUS_SUCCESS) {
+            connection_interval = param->update_conn_params.conn_int;
+        }
+        break;
+
     case ESP_GAP_BLE_AUTH_CMPL_EVT:
         if (param->ble_security.auth_cmpl.success) {
             ESP_LOGI(TAG, "Authentication complete, addr_type=%d, auth_mode=%d",
                      param->ble_security.auth_cmpl.addr_type,
                      param->ble_security.auth_cmpl.auth_mode);
+            memcpy(connected_addr, param->ble_security.auth_cmpl.bd_addr, sizeof(esp_bd_addr_t));
             hid_device_push_event_msg(&(hid_device_msg_t){ HID_DEVICE_MSG_CONNECT });
         } else {
             ESP_LOGE(TAG, "Authentication failed: 0x%x", param->ble_security.auth_cmpl.fail_reason);
@@ -366,6 +379,10 @@ static void hidd_event_callback(void *handler_args, esp_event_base_t base, int32
     case ESP_HIDD_CONTROL_EVENT:
         ESP_LOGI(TAG, "Control: %s",
                  param->control.control ? "EXIT_SUSPEND" : "SUSPEND");
+        hid_device_notify(&(hid_device_notify_t){
+            .type = HID_DEVICE_NOTIFY_SUSPEND,
+            .suspend.suspended = !param->control.control,
+        });
         break;
 
     case ESP_HIDD_OUTPUT_EVENT:
@@ -381,6 +398,7 @@ static void hidd_event_callback(void *handler_args, esp_event_base_t base, int32
 
     case ESP_HIDD_DISCONNECT_EVENT:
         ESP_LOGI(TAG, "HID device disconnected, reason: %d", param->disconnect.reason);
+        connection_interval = 0;
         hid_device_push_event_msg(&(hid_device_msg_t){
             .type = HID_DEVICE_MSG_DISCONNECT,
             .disconnect.reason = param->disconnect.reason,
@@ -453,7 +471,7 @@ static esp_err_t init_bluetooth(void) {
     return ESP_OK;
 }
 
-esp_err_t hid_device_init(const hid_device_profile_t *profile) {
+esp_err_t hid_device_init(const hid_device_profile_t *profile, uint32_t task_stack_size) {
     esp_err_t ret;
 
     // Create hid_device event queue
@@ -484,7 +502,7 @@ esp_err_t hid_device_init(const hid_device_profile_t *profile) {
     // Start HID Device Control
     hid_device_keyboard_init();
     hid_device_mouse_init();
-    xTaskCreate(hid_device_task, "hid_device", 8192, NULL, 5, NULL);
+    xTaskCreate(hid_device_task, "hid_device", task_stack_size, NULL, 5, NULL);
 
     ESP_LOGI(TAG, "HID device initialized (Bluedroid)");
     return ESP_OK;
@@ -515,6 +533,26 @@ hid_device_state_t hid_device_state(void) {
 bool hid_device_is_connected(void) {
     return current_state == HID_DEVICE_STATE_ACTIVE;
 }
+uint32_t hid_device_connection_interval_us(void) {
+    return connection_interval * 1250;
+}
+void hid_device_set_link(hid_device_link_t link) {
+    // Intervals in 1.25 ms units, timeout in 10 ms units
+    static const struct { uint16_t min_int, max_int, latency, timeout; } params[] = {
+        [HID_DEVICE_LINK_FAST ] = { 6, 12, 0, 400 },
+        [HID_DEVICE_LINK_IDLE ] = { 12, 24, 4, 400 },
+        [HID_DEVICE_LINK_SLEEP] = { 24, 36, 10, 400 },
+    };
+    if (!hid_device_is_connected()) return;
+    esp_ble_conn_update_params_t conn_params = {
+        .min_int = params[link].min_int,
+        .max_int = params[link].max_int,
+        .latency = params[link].latency,
+        .timeout = params[link].timeout,
+    };
+    memcpy(conn_params.bda, connected_addr, sizeof(esp_bd_addr_t));
+    esp_ble_gap_update_conn_params(&conn_params);
+}
 void hid_device_start_pairing(void) {
     hid_device_push_event_msg(&(hid_device_msg_t){ HID_DEVICE_MSG_START_PAIRING });
 }
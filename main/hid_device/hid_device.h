@@ -46,6 +46,7 @@ typedef struct {
         HID_DEVICE_NOTIFY_PASSKEY_DISPLAY,
         HID_DEVICE_NOTIFY_PASSKEY_INPUT,
         HID_DEVICE_NOTIFY_PASSKEY_CONFIRM,
+        HID_DEVICE_NOTIFY_SUSPEND,
     } type;
     union {
         struct {
@@ -55,15 +56,28 @@ typedef struct {
         struct {
             uint32_t passkey;
         } passkey;
+        struct {
+            bool suspended;  // The host suspended the HID link, or exited the suspend
+        } suspend;
     };
 } hid_device_notify_t;
+
+// Connection parameters asked from the host, it may keep its own
+typedef enum {
+    HID_DEVICE_LINK_FAST,   // Shortest interval, no peripheral latency
+    HID_DEVICE_LINK_IDLE,   // Twice the interval, a few connection events skipped while there is nothing to send
+    HID_DEVICE_LINK_SLEEP,  // Longest interval and latency
+} hid_device_link_t;
+
 typedef void (*hid_device_notify_callback_t)(hid_device_notify_t *notify, void *user_data);
 
-esp_err_t hid_device_init(const hid_device_profile_t *profile);
+esp_err_t hid_device_init(const hid_device_profile_t *profile, uint32_t task_stack_size);
 void hid_device_add_notify_callback(hid_device_notify_callback_t callback, void *user_data);
 void hid_device_remove_notify_callback(hid_device_notify_callback_t callback, void *user_data);
 hid_device_state_t hid_device_state(void);
 bool hid_device_is_connected(void);
+uint32_t hid_device_connection_interval_us(void);  // 0 if not known yet
+void hid_device_set_link(hid_device_link_t link);
 void hid_device_start_pairing(void);
 void hid_device_stop_pairing(void);
 void hid_device_passkey_input(uint32_t passkey);
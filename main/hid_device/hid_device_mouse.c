@@ -7,20 +7,27 @@
 #include "hid_device.h"
 
 #define MOUSE_REPORT_ID 2
+#define MOUSE_REPORT_SIZE 5
 
 static uint8_t pressed_buttons = 0;
 
 static uint8_t button_mask(hid_device_mouse_button_t button) {
-    return (button == HID_DEVICE_MOUSE_BUTTON_LEFT) ? 0x01 : 0x02;
+    const uint8_t table[] = {
+        [HID_DEVICE_MOUSE_BUTTON_LEFT  ] = 0x01,
+        [HID_DEVICE_MOUSE_BUTTON_RIGHT ] = 0x02,
+        [HID_DEVICE_MOUSE_BUTTON_MIDDLE] = 0x04,
+    };
+    return table[button];
 }
 
-static void send_report(uint8_t buttons, int8_t dx, int8_t dy, int8_t wheel) {
-    uint8_t *report = malloc(4);
+static void send_report(uint8_t buttons, int8_t dx, int8_t dy, int8_t wheel, int8_t pan) {
+    uint8_t *report = malloc(MOUSE_REPORT_SIZE);
     report[0] = buttons;
     report[1] = dx;
     report[2] = dy;
     report[3] = wheel;
-    hid_device_send_report(MOUSE_REPORT_ID, report, sizeof(report), true);
+    report[4] = pan;
+    hid_device_send_report(MOUSE_REPORT_ID, report, MOUSE_REPORT_SIZE, true);
 }
 
 void hid_device_mouse_init(void) {
@@ -28,7 +35,11 @@ void hid_device_mouse_init(void) {
 }
 
 void hid_device_mouse_move(int8_t dx, int8_t dy) {
-    send_report(pressed_buttons, dx, dy, 0);
+    send_report(pressed_buttons, dx, dy, 0, 0);
+}
+
+void hid_device_mouse_scroll(int8_t wheel, int8_t pan) {
+    send_report(pressed_buttons, 0, 0, wheel, pan);
 }
 
 void hid_device_mouse_click(hid_device_mouse_button_t button) {
@@ -37,8 +48,8 @@ void hid_device_mouse_click(hid_device_mouse_button_t button) {
         return;  // Button already pressed, ignore click
     }
 
-    send_report(pressed_buttons | mask, 0, 0, 0);  // Press
-    send_report(pressed_buttons, 0, 0, 0);          // Release
+    send_report(pressed_buttons | mask, 0, 0, 0, 0);  // Press
+    send_report(pressed_buttons, 0, 0, 0, 0);          // Release
 }
 
 void hid_device_mouse_press_button(hid_device_mouse_button_t button) {
@@ -47,7 +58,7 @@ void hid_device_mouse_press_button(hid_device_mouse_button_t button) {
         return;  // Already pressed
     }
     pressed_buttons |= mask;
-    send_report(pressed_buttons, 0, 0, 0);
+    send_report(pressed_buttons, 0, 0, 0, 0);
 }
 
 void hid_device_mouse_release_button(hid_device_mouse_button_t button) {
@@ -56,5 +67,5 @@ void hid_device_mouse_release_button(hid_device_mouse_button_t button) {
         return;  // Not pressed
     }
     pressed_buttons &= ~mask;
-    send_report(pressed_buttons, 0, 0, 0);
+    send_report(pressed_buttons, 0, 0, 0, 0);
 }
@@ -2,7 +2,7 @@
 
 // Standard HID keyboard + mouse report descriptor
 // Keyboard Report ID 1: [modifier, reserved, key1, key2, key3, key4, key5, key6]
-// Mouse Report ID 2: [buttons, x, y, wheel]
+// Mouse Report ID 2: [buttons, x, y, wheel, pan]
 static const uint8_t keyboard_report_map[] = {
     // Keyboard Collection
     0x05, 0x01,        // Usage Page (Generic Desktop)
@@ -71,6 +71,13 @@ static const uint8_t keyboard_report_map[] = {
     0x75, 0x08,        //     Report Size (8)
     0x95, 0x01,        //     Report Count (1)
     0x81, 0x06,        //     Input (Data, Variable, Relative) - Wheel
+    0x05, 0x0C,        //     Usage Page (Consumer)
+    0x0A, 0x38, 0x02,  //     Usage (AC Pan)
+    0x15, 0x81,        //     Logical Minimum (-127)
+    0x25, 0x7F,        //     Logical Maximum (127)
+    0x75, 0x08,        //     Report Size (8)
+    0x95, 0x01,        //     Report Count (1)
+    0x81, 0x06,        //     Input (Data, Variable, Relative) - Pan
     0xC0,              //   End Collection (Physical)
     0xC0,              // End Collection (Application)
 };
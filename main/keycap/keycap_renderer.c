@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "keycap_renderer.h"
+
+#define KEYCAP_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define KEYCAP_MAX(a, b) ((a) > (b) ? (a) : (b))
+
+// MARK: Target
+// Same mapping as the layout images: landscape rect to the rotated target.
+// width is the landscape width of the surface the rect is in.
+static keycap_rect_t keycap_target_rect(keycap_rect_t rect, uint16_t width) {
+    return (keycap_rect_t){ rect.y, width - (rect.x + rect.width), rect.height, rect.width };
+}
+
+static keycap_rect_t keycap_clip(const keycap_target_t *t, keycap_rect_t rect) {
+    int x0 = KEYCAP_MAX(rect.x, 0), y0 = KEYCAP_MAX(rect.y, 0);
+    int x1 = KEYCAP_MIN(rect.x + rect.width, t->width), y1 = KEYCAP_MIN(rect.y + rect.height, t->height);
+    return (keycap_rect_t){ x0, y0, x1 - x0, y1 - y0 };
+}
+
+static void keycap_fill(const keycap_target_t *t, keycap_rect_t rect, uint32_t color) {
+    rect = keycap_clip(t, rect);
+    if (rect.width <= 0 || rect.height <= 0) return;
+    t->backend->fill(t->ctx, keycap_target_rect(rect, t->width), color);
+}
+
+// MARK: Glyph
+static const keycap_glyph_t *keycap_glyph_find(const keycap_atlas_t *atlas, uint32_t codepoint) {
+    size_t low = 0, high = atlas->glyph_num;
+    while (low < high) {
+        size_t mid = (low + high) / 2;
+        if (atlas->glyphs[mid].codepoint < codepoint) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low < atlas->glyph_num && atlas->glyphs[low].codepoint == codepoint ? &atlas->glyphs[low] : NULL;
+}
+
+// Blends color through the glyph's bitmap placed with its top left at (x, y)
+static void keycap_blend_glyph(const keycap_target_t *t, const keycap_glyph_t *glyph, int x, int y, uint32_t color) {
+    keycap_rect_t rect = keycap_clip(t, (keycap_rect_t){ x, y, glyph->width, glyph->height });
+    if (rect.width <= 0 || rect.height <= 0) return;
+    keycap_rect_t mask = { glyph->x + rect.x - x, glyph->y + rect.y - y, rect.width, rect.height };
+    mask = keycap_target_rect(mask, t->atlas->width);
+    t->backend->blend(t->ctx, keycap_target_rect(rect, t->width), mask.x, mask.y, color);
+}
+
+static uint32_t keycap_utf8_next(const char **text) {
+    const uint8_t *p = (const uint8_t *)*text;
+    uint32_t c = *p++;
+    int extra = c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : c >= 0xc0 ? 1 : 0;
+    if (extra) c &= 0x3f >> extra;
+    while (extra-- > 0 && (*p & 0xc0) == 0x80) c = c << 6 | (*p++ & 0x3f);
+    *text = (const char *)p;
+    return c;
+}
+
+static void keycap_label(const keycap_target_t *t, keycap_rect_t rect, const char *label, uint32_t color) {
+    int width = 0;
+    for (const char *p = label; *p;) {
+        const keycap_glyph_t *glyph = keycap_glyph_find(t->atlas, keycap_utf8_next(&p));
+        if (glyph) width += glyph->advance;
+    }
+
+    int pen = rect.x + (rect.width - width) / 2;
+    int baseline = rect.y + (rect.height - t->atlas->ascent - t->atlas->descent) / 2 + t->atlas->ascent;
+    for (const char *p = label; *p;) {
+        const keycap_glyph_t *glyph = keycap_glyph_find(t->atlas, keycap_utf8_next(&p));
+        if (!glyph) continue;
+        keycap_blend_glyph(t, glyph, pen + glyph->offset_x, baseline + glyph->offset_y, color);
+        pen += glyph->advance;
+    }
+}
+
+// MARK: Shape
+// A cross of fills with the corners blended through the atlas corner masks,
+// which are radius pixels square.
+static void keycap_round_rect(const keycap_target_t *t, keycap_rect_t rect, int radius, uint32_t corner, uint32_t color) {
+    keycap_fill(t, (keycap_rect_t){ rect.x + radius, rect.y, rect.width - radius * 2, rect.height }, color);
+    keycap_fill(t, (keycap_rect_t){ rect.x, rect.y + radius, radius, rect.height - radius * 2 }, color);
+    keycap_fill(t, (keycap_rect_t){ rect.x + rect.width - radius, rect.y + radius, radius, rect.height - radius * 2 }, color);
+    if (radius == 0) return;
+
+    const struct {
+        int x, y;
+    } origins[4] = {
+        { rect.x, rect.y },
+        { rect.x + rect.width - radius, rect.y },
+        { rect.x + rect.width - radius, rect.y + rect.height - radius },
+        { rect.x, rect.y + rect.height - radius },
+    };
+    for (int i = 0; i < 4; i++) {
+        const keycap_glyph_t *glyph = keycap_glyph_find(t->atlas, corner + i);
+        if (glyph) keycap_blend_glyph(t, glyph, origins[i].x, origins[i].y, color);
+    }
+}
+
+// MARK: Public
+void keycap_render_background(const keycap_target_t *target, const keycap_style_t *style) {
+    keycap_fill(target, (keycap_rect_t){ 0, 0, target->width, target->height }, style->background);
+}
+
+void keycap_render_key(const keycap_target_t *target, const keycap_style_t *style, keycap_rect_t region, const char *label, bool pressed) {
+    const keycap_atlas_t *atlas = target->atlas;
+    int radius = atlas->corner_radius, border = atlas->border_width;
+    keycap_rect_t rect = { region.x + style->inset, region.y + style->inset, region.width - style->inset * 2, region.height - style->inset * 2 };
+    if (rect.width < radius * 2 || rect.height < radius * 2) return;
+
+    keycap_round_rect(target, rect, radius, KEYCAP_GLYPH_CORNER_OUTER, style->border);
+    rect = (keycap_rect_t){ rect.x + border, rect.y + border, rect.width - border * 2, rect.height - border * 2 };
+    keycap_round_rect(target, rect, radius - border, KEYCAP_GLYPH_CORNER_INNER, pressed ? style->key_pressed : style->key);
+    if (label) keycap_label(target, rect, label, style->text);
+}
@@ -0,0 +1,69 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Procedural keycap renderer. Layouts that ship only geometry and labels are
+// drawn as rounded rects with a border and a centered label, using nothing
+// but solid fills and blends of a color through an A8 mask. The masks (glyphs
+// and rounded corners) come from a shared prerasterized atlas generated by
+// layout_builder.
+//
+// Coordinates passed in are landscape layout space. Backends receive target
+// space, the rotated orientation images are stored in for the panel, so the
+// same operations map 1:1 onto PPA fill and blend.
+
+typedef struct {
+    int16_t x, y, width, height;
+} keycap_rect_t;
+
+typedef struct {
+    uint32_t background;  // 0xRRGGBB
+    uint32_t key, key_pressed;
+    uint32_t border;
+    uint32_t text;
+    uint8_t inset;  // Gap between the input region and the keycap
+} keycap_style_t;
+
+typedef struct {
+    uint32_t codepoint;
+    uint16_t x, y, width, height;  // In the atlas
+    int16_t offset_x, offset_y;    // Of the bitmap from the pen position on the baseline
+    uint16_t advance;
+} keycap_glyph_t;
+
+// The corner masks are glyphs in the private use area, top left first and clockwise
+#define KEYCAP_GLYPH_CORNER_OUTER (0xe000)
+#define KEYCAP_GLYPH_CORNER_INNER (0xe004)
+
+typedef struct {
+    const uint8_t *data;     // A8, stored rotated like layout images
+    uint16_t width, height;  // Layout orientation
+    const keycap_glyph_t *glyphs;  // Sorted by codepoint
+    size_t glyph_num;
+    uint8_t ascent, descent;
+    uint8_t corner_radius, border_width;
+} keycap_atlas_t;
+
+extern const keycap_atlas_t keycap_atlas;  // Generated by layout_builder
+
+typedef struct {
+    void (*fill)(void *ctx, keycap_rect_t rect, uint32_t color);
+    // Blends color into rect through the atlas mask block at (mask_x, mask_y), both in target space
+    void (*blend)(void *ctx, keycap_rect_t rect, uint16_t mask_x, uint16_t mask_y, uint32_t color);
+} keycap_backend_t;
+
+typedef struct {
+    const keycap_backend_t *backend;
+    void *ctx;
+    const keycap_atlas_t *atlas;
+    uint16_t width, height;  // Target size in layout orientation
+} keycap_target_t;
+
+void keycap_render_background(const keycap_target_t *target, const keycap_style_t *style);
+void keycap_render_key(const keycap_target_t *target, const keycap_style_t *style, keycap_rect_t region, const char *label, bool pressed);
@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "keycap_soft.h"
+
+static uint16_t keycap_soft_rgb565(uint32_t color) {
+    return ((color >> 19) & 0x1f) << 11 | ((color >> 10) & 0x3f) << 5 | ((color >> 3) & 0x1f);
+}
+
+static void keycap_soft_fill(void *ctx, keycap_rect_t rect, uint32_t color) {
+    keycap_soft_t *soft = ctx;
+    uint16_t value = keycap_soft_rgb565(color);
+    for (int y = 0; y < rect.height; y++) {
+        uint16_t *row = soft->pixels + (rect.y + y) * soft->height + rect.x;
+        for (int x = 0; x < rect.width; x++) row[x] = value;
+    }
+}
+
+// Blends in RGB888 like the PPA: RGB565 channels are expanded by repeating their high bits
+static uint8_t keycap_soft_mix(uint8_t fg, uint8_t bg, uint8_t alpha) {
+    return (fg * alpha + bg * (255 - alpha) + 127) / 255;
+}
+
+static void keycap_soft_blend(void *ctx, keycap_rect_t rect, uint16_t mask_x, uint16_t mask_y, uint32_t color) {
+    keycap_soft_t *soft = ctx;
+    uint8_t r = color >> 16, g = color >> 8, b = color;
+    for (int y = 0; y < rect.height; y++) {
+        uint16_t *row = soft->pixels + (rect.y + y) * soft->height + rect.x;
+        const uint8_t *mask = soft->atlas->data + (mask_y + y) * soft->atlas->height + mask_x;
+        for (int x = 0; x < rect.width; x++) {
+            uint8_t alpha = mask[x];
+            if (alpha == 0) continue;
+            uint16_t p = row[x];
+            uint8_t pr = (p >> 11) << 3 | (p >> 13), pg = ((p >> 5) & 0x3f) << 2 | ((p >> 9) & 0x3), pb = (p & 0x1f) << 3 | ((p >> 2) & 0x7);
+            uint32_t mixed = keycap_soft_mix(r, pr, alpha) << 16 | keycap_soft_mix(g, pg, alpha) << 8 | keycap_soft_mix(b, pb, alpha);
+            row[x] = keycap_soft_rgb565(mixed);
+        }
+    }
+}
+
+const keycap_backend_t keycap_soft_backend = {
+    .fill = keycap_soft_fill,
+    .blend = keycap_soft_blend,
+};
@@ -0,0 +1,18 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include "keycap_renderer.h"
+
+// Software reference backend drawing into an RGB565 buffer in target space
+// (rotated, rows of `height` pixels). It has no platform dependencies, so
+// renders can be produced and compared on a host.
+typedef struct {
+    uint16_t *pixels;
+    uint16_t width, height;  // Layout orientation
+    const keycap_atlas_t *atlas;
+} keycap_soft_t;
+
+extern const keycap_backend_t keycap_soft_backend;
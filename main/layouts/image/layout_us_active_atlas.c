@@ -0,0 +1,3513 @@
+#include "layouts/layout.h"
+
+static const uint8_t data[] = {
+    0x89, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0x9e, 0xf7, 0x9e, 0xf7, 0x9e, 0xf7,
+    0x9e, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
+    0x5d, 0xef, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7,
+    0x1c, 0xe7, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde,
+    0xdb, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6,
+    0x9a, 0xd6, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce,
+    0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
+    0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd,
+    0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5,
+    0x96, 0xb5, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0x55, 0xad, 0x55, 0xad, 0x55, 0xad,
+    0x55, 0xad, 0x34, 0xa5, 0x34, 0xa5, 0x34, 0xa5, 0x34, 0xa5, 0x14, 0xa5, 0x14, 0xa5, 0x14, 0xa5,
+    0x14, 0xa5, 0xf3, 0x9c, 0xf3, 0x9c, 0xf3, 0x9c, 0xf3, 0x9c, 0xd3, 0x9c, 0xd3, 0x9c, 0xd3, 0x9c,
+    0xd3, 0x9c, 0xb2, 0x94, 0xb2, 0x94, 0xb2, 0x94, 0xb2, 0x94, 0x71, 0x8c, 0x71, 0x8c, 0x71, 0x8c,
+    0x71, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xef, 0x7b,
+    0xef, 0x7b, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0xae, 0x73, 0x8e, 0x73, 0x6d, 0x6b, 0x4d, 0x6b,
+    0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x2c, 0x63, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xa2, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88,
+    0xe7, 0x88, 0x07, 0x84, 0x7f, 0x79, 0x70, 0x69, 0x66, 0x66, 0x65, 0xa8, 0x66, 0x04, 0x69, 0x70,
+    0x7b, 0x7f, 0x84, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0x01, 0x7f, 0x74, 0xb1, 0x66,
+    0x01, 0x75, 0x7f, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0x00, 0x7b, 0x83, 0x66, 0x00,
+    0x67, 0xa9, 0x66, 0x05, 0x64, 0x66, 0x66, 0x67, 0x66, 0x7a, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88,
+    0xa9, 0x88, 0x02, 0x6f, 0x66, 0x65, 0xb0, 0x66, 0x01, 0x67, 0x6f, 0xff, 0x88, 0xff, 0x88, 0xff,
+    0x88, 0xa9, 0x88, 0x00, 0x69, 0x84, 0x66, 0x00, 0x67, 0xaa, 0x66, 0x03, 0x67, 0x66, 0x66, 0x68,
+    0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0xaf, 0x66, 0x05, 0x65, 0x67, 0x66, 0x65, 0x66,
+    0x66, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0xb5, 0x66, 0x00, 0x87, 0xff, 0x88, 0xff,
+    0x88, 0xff, 0x88, 0xa8, 0x88, 0xb5, 0x66, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0xb5,
+    0x66, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0xb5, 0x66, 0xff, 0x88, 0xff, 0x88, 0xff,
+    0x88, 0xa9, 0x88, 0xb5, 0x66, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0xb5, 0x66, 0xff,
+    0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0xb5, 0x66, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9,
+    0x88, 0xb5, 0x66, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0xb5, 0x66, 0xff, 0x88, 0xff,
+    0x88, 0xff, 0x88, 0xa9, 0x88, 0xa5, 0x66, 0x00, 0x65, 0x8e, 0x66, 0xa2, 0x88, 0x01, 0x87, 0x87,
+    0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0x84, 0x88, 0x98, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x8e, 0x66, 0xa5, 0x88, 0x00, 0x87, 0xff, 0x88, 0xff,
+    0x88, 0xff, 0x88, 0x82, 0x88, 0x91, 0x66, 0x00, 0x65, 0x86, 0x66, 0x00, 0x67, 0x9a, 0x66, 0xe9,
+    0x88, 0x00, 0x87, 0xff, 0x88, 0xff, 0x88, 0xbe, 0x88, 0x9b, 0x66, 0x01, 0x67, 0x67, 0x97, 0x66,
+    0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0xa9, 0x88, 0x91, 0x66, 0x00, 0x65, 0x8e, 0x66, 0x00, 0x67,
+    0x92, 0x66, 0xa1, 0x88, 0x01, 0x87, 0x87, 0xff, 0x88, 0xff, 0x88, 0xff, 0x88, 0x85, 0x88, 0x94,
+    0x66, 0x04, 0x65, 0x66, 0x66, 0x65, 0x65, 0x82, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0x91,
+    0x66, 0xa1, 0x88, 0x06, 0x84, 0x7f, 0x7a, 0x70, 0x68, 0x66, 0x65, 0xba, 0x66, 0x07, 0x65, 0x66,
+    0x66, 0x68, 0x72, 0x79, 0x7f, 0x84, 0xff, 0x88, 0xff, 0x88, 0xbd, 0x88, 0x8f, 0x66, 0x00, 0x67,
+    0x83, 0x66, 0x01, 0x5a, 0x60, 0x89, 0x66, 0x02, 0x5d, 0x38, 0x39, 0x91, 0x66, 0xa1, 0x88, 0x04,
+    0x7f, 0x75, 0x66, 0x66, 0x67, 0xc2, 0x66, 0x04, 0x75, 0x7f, 0x88, 0x88, 0x87, 0xff, 0x88, 0xff,
+    0x88, 0xba, 0x88, 0x87, 0x66, 0x00, 0x65, 0x85, 0x66, 0x09, 0x67, 0x66, 0x66, 0x67, 0x2e, 0x0d,
+    0x00, 0x00, 0x10, 0x47, 0x82, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x67, 0x4f, 0x00, 0x05, 0x91,
+    0x66, 0xa1, 0x88, 0x07, 0x7b, 0x66, 0x66, 0x64, 0x66, 0x66, 0x67, 0x65, 0xbf, 0x66, 0x01, 0x67,
+    0x7a, 0xff, 0x88, 0xff, 0x88, 0xbd, 0x88, 0x91, 0x66, 0x00, 0x26, 0x85, 0x00, 0x02, 0x2e, 0x66,
+    0x67, 0x82, 0x66, 0x04, 0x67, 0x66, 0x55, 0x00, 0x0b, 0x91, 0x66, 0xa1, 0x88, 0x00, 0x70, 0xc6,
+    0x66, 0x01, 0x67, 0x71, 0xff, 0x88, 0xff, 0x88, 0xbd, 0x88, 0x90, 0x66, 0x12, 0x43, 0x00, 0x00,
+    0x2f, 0x55, 0x4f, 0x1e, 0x00, 0x00, 0x38, 0x66, 0x65, 0x66, 0x66, 0x67, 0x67, 0x58, 0x00, 0x0e,
+    0x91, 0x66, 0xa1, 0x88, 0x01, 0x6a, 0x67, 0x82, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x00, 0x67, 0xff,
+    0x88, 0xff, 0x88, 0xbd, 0x88, 0x90, 0x66, 0x02, 0x1e, 0x00, 0x2c, 0x83, 0x66, 0x04, 0x28, 0x00,
+    0x02, 0x51, 0x67, 0x83, 0x66, 0x02, 0x59, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0x02, 0x66, 0x65,
+    0x67, 0xc6, 0x66, 0xff, 0x88, 0xff, 0x88, 0xbd, 0x88, 0x8f, 0x66, 0x03, 0x65, 0x0b, 0x00, 0x58,
+    0x83, 0x66, 0x0c, 0x64, 0x16, 0x00, 0x11, 0x63, 0x66, 0x66, 0x65, 0x66, 0x59, 0x00, 0x0e, 0x65,
+    0x90, 0x66, 0xa1, 0x88, 0x00, 0x67, 0xc8, 0x66, 0xff, 0x88, 0xff, 0x88, 0xbd, 0x88, 0x90, 0x66,
+    0x02, 0x01, 0x02, 0x65, 0x84, 0x66, 0x04, 0x5a, 0x07, 0x00, 0x2e, 0x65, 0x82, 0x66, 0x02, 0x59,
+    0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xc7, 0x66, 0x01, 0x67, 0x66, 0xff, 0x88, 0xff, 0x88, 0xbd,
+    0x88, 0x90, 0x66, 0x02, 0x06, 0x00, 0x60, 0x85, 0x66, 0x03, 0x40, 0x01, 0x01, 0x4c, 0x82, 0x66,
+    0x02, 0x59, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0xff, 0x88, 0xff, 0x88, 0xbd, 0x88,
+    0x90, 0x66, 0x12, 0x16, 0x00, 0x4d, 0x66, 0x64, 0x66, 0x66, 0x65, 0x66, 0x66, 0x20, 0x00, 0x09,
+    0x57, 0x66, 0x66, 0x5a, 0x00, 0x0f, 0x91, 0x66, 0xa1, 0x88, 0x00, 0x65, 0xc7, 0x66, 0x00, 0x65,
+    0x82, 0x88, 0x00, 0x87, 0xff, 0x88, 0xff, 0x88, 0xb9, 0x88, 0x8f, 0x66, 0x05, 0x65, 0x28, 0x00,
+    0x13, 0x62, 0x67, 0x84, 0x66, 0x08, 0x60, 0x0e, 0x00, 0x08, 0x53, 0x66, 0x59, 0x00, 0x0e, 0x91,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0xff, 0x88, 0xb4, 0x88, 0x00, 0x87, 0xc5, 0x88, 0x00, 0x87, 0xc0,
+    0x88, 0x90, 0x66, 0x12, 0x57, 0x03, 0x00, 0x18, 0x4d, 0x63, 0x66, 0x66, 0x67, 0x66, 0x66, 0x5a,
+    0x0e, 0x00, 0x03, 0x31, 0x4f, 0x00, 0x0e, 0x82, 0x66, 0x00, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0xff, 0x88, 0xff, 0x88, 0xbd, 0x88, 0x91, 0x66, 0x04, 0x3b, 0x01, 0x00, 0x00, 0x10, 0x84,
+    0x66, 0x02, 0x67, 0x5b, 0x12, 0x83, 0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0xe2,
+    0x88, 0x00, 0x87, 0xcb, 0x88, 0x00, 0x87, 0xff, 0x88, 0x8c, 0x88, 0x90, 0x66, 0x05, 0x65, 0x66,
+    0x46, 0x0d, 0x00, 0x1e, 0x84, 0x66, 0x07, 0x65, 0x66, 0x65, 0x39, 0x06, 0x00, 0x00, 0x0b, 0x91,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0xdf, 0x88, 0x04, 0x84, 0x7f, 0x79, 0x70, 0x68, 0xb8, 0x66, 0x00,
+    0x65, 0x86, 0x66, 0x08, 0x71, 0x79, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x70, 0x69, 0xbf, 0x66, 0x0a,
+    0x68, 0x70, 0x7a, 0x7f, 0x84, 0x84, 0x7f, 0x7b, 0x70, 0x69, 0x65, 0xbc, 0x66, 0x06, 0x65, 0x66,
+    0x69, 0x70, 0x7b, 0x7e, 0x84, 0x94, 0x66, 0x03, 0x57, 0x50, 0x66, 0x65, 0x83, 0x66, 0x06, 0x67,
+    0x66, 0x66, 0x61, 0x44, 0x2e, 0x26, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0xdf, 0x88, 0x04, 0x7f,
+    0x74, 0x66, 0x66, 0x67, 0xc2, 0x66, 0x05, 0x75, 0x7f, 0x80, 0x74, 0x66, 0x65, 0x82, 0x66, 0x02,
+    0x68, 0x66, 0x65, 0xbd, 0x66, 0x07, 0x75, 0x7f, 0x7f, 0x74, 0x67, 0x65, 0x66, 0x67, 0xbd, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x01, 0x75, 0x80, 0x8f, 0x66, 0x02, 0x65, 0x66, 0x67, 0x86, 0x66, 0x00,
+    0x65, 0x86, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x8f, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0xdf, 0x88,
+    0x03, 0x7a, 0x67, 0x66, 0x65, 0xc1, 0x66, 0x04, 0x65, 0x66, 0x67, 0x7a, 0x7a, 0x87, 0x66, 0x00,
+    0x65, 0xbb, 0x66, 0x04, 0x67, 0x66, 0x66, 0x7a, 0x7a, 0x84, 0x66, 0x00, 0x67, 0xbc, 0x66, 0x05,
+    0x64, 0x66, 0x66, 0x67, 0x66, 0x7a, 0x97, 0x66, 0x06, 0x67, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65,
+    0x83, 0x66, 0x02, 0x65, 0x66, 0x67, 0x8f, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0xde, 0x88, 0x01, 0x87,
+    0x70, 0xc7, 0x66, 0x01, 0x71, 0x6f, 0x82, 0x66, 0x82, 0x65, 0xbf, 0x66, 0x03, 0x65, 0x66, 0x70,
+    0x6f, 0x82, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0xb9, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x70,
+    0x8f, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0x86, 0x66, 0x02, 0x67, 0x66, 0x65, 0x85, 0x66,
+    0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0xdf, 0x88, 0x00, 0x69, 0xc4, 0x66, 0x04, 0x65,
+    0x66, 0x65, 0x68, 0x6a, 0x83, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x00, 0x65,
+    0x83, 0x66, 0x05, 0x69, 0x69, 0x66, 0x67, 0x66, 0x64, 0x82, 0x66, 0x00, 0x65, 0xb8, 0x66, 0x01,
+    0x67, 0x67, 0x84, 0x66, 0x00, 0x68, 0x96, 0x66, 0x00, 0x65, 0x83, 0x66, 0x03, 0x67, 0x66, 0x66,
+    0x65, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0xd6, 0x88, 0x01, 0x87, 0x87, 0x86, 0x88, 0x03, 0x66,
+    0x66, 0x67, 0x67, 0xff, 0x66, 0xd3, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xb7, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x00, 0x87, 0xc7, 0x88, 0x01, 0x87, 0x67, 0xff, 0x66, 0xed, 0x66, 0x00,
+    0x67, 0x90, 0x66, 0x00, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0xda, 0x88, 0x00, 0x87, 0x83,
+    0x88, 0xff, 0x66, 0xfe, 0x66, 0x01, 0x67, 0x67, 0x92, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0x04, 0x84, 0x7e, 0x7a, 0x71, 0x69, 0xbd, 0x66, 0x06, 0x65, 0x66, 0x68, 0x70, 0x7b, 0x7f, 0x84,
+    0xff, 0x66, 0xd7, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x92, 0x66, 0x04, 0x43, 0x39, 0x3e, 0x44,
+    0x48, 0x89, 0x49, 0x03, 0x48, 0x46, 0x42, 0x3e, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0x02, 0x7f, 0x74, 0x67, 0x82, 0x66, 0x00, 0x67, 0xbb, 0x66, 0x00, 0x67, 0x83, 0x66, 0x05, 0x75,
+    0x7f, 0x64, 0x66, 0x66, 0x65, 0xff, 0x66, 0xea, 0x66, 0x00, 0x1c, 0x84, 0x00, 0x00, 0x01, 0x8a,
+    0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x04, 0x78, 0x67, 0x66, 0x66,
+    0x67, 0xbc, 0x66, 0x00, 0x67, 0x84, 0x66, 0x01, 0x67, 0x7a, 0xff, 0x66, 0xee, 0x66, 0x02, 0x21,
+    0x00, 0x07, 0x8c, 0x0b, 0x03, 0x08, 0x03, 0x10, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x00, 0x6f, 0x85, 0x66, 0x00, 0x65, 0xbf, 0x66, 0x01, 0x67, 0x70, 0xff, 0x66, 0xee, 0x66,
+    0x02, 0x22, 0x00, 0x4c, 0x8e, 0x66, 0x01, 0x64, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x01, 0x69, 0x67, 0xc1, 0x66, 0x01, 0x65, 0x65, 0x82, 0x66, 0x02, 0x68, 0x66, 0x65, 0xff,
+    0x66, 0xec, 0x66, 0x02, 0x21, 0x00, 0x49, 0x8d, 0x66, 0x00, 0x65, 0x92, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x06, 0x1c, 0x00, 0x42, 0x67, 0x66, 0x66,
+    0x65, 0x82, 0x66, 0x00, 0x65, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xb8, 0x66, 0x02, 0x52, 0x4a, 0x5d, 0x83, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x64, 0x95,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb9, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x02, 0x68, 0x65, 0x67, 0x97, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xbb, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x9d, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x01, 0x67, 0x67, 0xa2, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03, 0x2c, 0x1a, 0x42, 0x67,
+    0xa0, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x03, 0x67,
+    0x1b, 0x00, 0x3f, 0x83, 0x66, 0x03, 0x67, 0x3e, 0x3a, 0x5a, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03, 0x20, 0x00, 0x43, 0x65, 0x83, 0x66, 0x02,
+    0x0d, 0x00, 0x48, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8,
+    0x66, 0x02, 0x22, 0x00, 0x45, 0x84, 0x66, 0x05, 0x15, 0x00, 0x51, 0x66, 0x66, 0x67, 0x96, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x22, 0x00, 0x46,
+    0x84, 0x66, 0x02, 0x17, 0x00, 0x51, 0x85, 0x66, 0x00, 0x65, 0x92, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x22, 0x00, 0x46, 0x84, 0x66, 0x03, 0x18,
+    0x00, 0x53, 0x67, 0x98, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8,
+    0x66, 0x04, 0x22, 0x00, 0x46, 0x66, 0x67, 0x82, 0x66, 0x07, 0x18, 0x01, 0x52, 0x66, 0x66, 0x65,
+    0x66, 0x65, 0x94, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66,
+    0x03, 0x22, 0x00, 0x46, 0x67, 0x83, 0x66, 0x09, 0x17, 0x00, 0x52, 0x66, 0x65, 0x66, 0x65, 0x66,
+    0x66, 0x67, 0x92, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66,
+    0x03, 0x67, 0x22, 0x00, 0x46, 0x82, 0x66, 0x04, 0x65, 0x66, 0x18, 0x00, 0x52, 0x88, 0x66, 0x00,
+    0x65, 0x8f, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02,
+    0x22, 0x00, 0x3e, 0x83, 0x5e, 0x03, 0x5f, 0x16, 0x00, 0x4c, 0x84, 0x5e, 0x02, 0x5d, 0x58, 0x52,
+    0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb8, 0x66, 0x00, 0x21, 0x90, 0x00, 0x00, 0x0d, 0x91, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x00, 0x65,
+    0xa8, 0x66, 0x95, 0x88, 0xdf, 0x66, 0x00, 0x65, 0x8f, 0x66, 0x00, 0x67, 0xcf, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x01, 0x67, 0x65, 0xef, 0x66, 0x01, 0x67, 0x1d, 0x90, 0x00, 0x00, 0x0e, 0x91, 0x66,
+    0xa1, 0x88, 0x9a, 0x66, 0x00, 0x67, 0x83, 0x66, 0x01, 0x5c, 0x39, 0x82, 0x66, 0x07, 0x62, 0x29,
+    0x0a, 0x06, 0x1f, 0x58, 0x66, 0x67, 0x9c, 0x66, 0x95, 0x88, 0xe0, 0x66, 0x02, 0x65, 0x66, 0x65,
+    0xff, 0x66, 0xd4, 0x66, 0x06, 0x55, 0x4f, 0x56, 0x5c, 0x5b, 0x5c, 0x5d, 0x88, 0x5c, 0x02, 0x5a,
+    0x54, 0x53, 0x91, 0x66, 0xa1, 0x88, 0x9e, 0x66, 0x06, 0x4a, 0x05, 0x00, 0x5a, 0x66, 0x66, 0x1f,
+    0x83, 0x00, 0x01, 0x08, 0x5a, 0x9d, 0x66, 0x95, 0x88, 0xe4, 0x66, 0x00, 0x65, 0x85, 0x66, 0x03,
+    0x67, 0x66, 0x66, 0x67, 0xc0, 0x66, 0x00, 0x65, 0x84, 0x66, 0x02, 0x65, 0x66, 0x65, 0x83, 0x66,
+    0x00, 0x67, 0xfc, 0x66, 0x00, 0x65, 0xa0, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x16, 0x65, 0x66, 0x65,
+    0x66, 0x66, 0x67, 0x61, 0x09, 0x00, 0x0c, 0x56, 0x66, 0x4f, 0x00, 0x03, 0x2f, 0x4a, 0x13, 0x00,
+    0x2c, 0x66, 0x67, 0x65, 0x9a, 0x66, 0x95, 0x88, 0xe9, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67,
+    0xd1, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xf4, 0x66, 0x00, 0x65, 0x8e, 0x66, 0x02, 0x65, 0x66,
+    0x65, 0x90, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x12, 0x67, 0x66, 0x3f, 0x00, 0x14, 0x62, 0x66, 0x66,
+    0x2e, 0x00, 0x2f, 0x66, 0x66, 0x54, 0x00, 0x09, 0x65, 0x66, 0x65, 0x9a, 0x66, 0x95, 0x88, 0xf5,
+    0x66, 0x00, 0x65, 0xb8, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0x82, 0x66, 0x02, 0x67, 0x65, 0x65,
+    0x89, 0x66, 0x01, 0x67, 0x65, 0xf5, 0x66, 0x00, 0x65, 0xa0, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x00,
+    0x65, 0x82, 0x66, 0x02, 0x2b, 0x00, 0x49, 0x82, 0x66, 0x02, 0x15, 0x00, 0x50, 0x82, 0x66, 0x02,
+    0x08, 0x00, 0x64, 0x9c, 0x66, 0x95, 0x88, 0xef, 0x66, 0x00, 0x65, 0xbe, 0x66, 0x13, 0x65, 0x66,
+    0x55, 0x33, 0x66, 0x66, 0x65, 0x66, 0x3d, 0x2d, 0x34, 0x35, 0x35, 0x34, 0x31, 0x28, 0x50, 0x66,
+    0x66, 0x65, 0xff, 0x66, 0x99, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x08, 0x22, 0x00, 0x56, 0x66, 0x66,
+    0x62, 0x01, 0x02, 0x64, 0x82, 0x66, 0x02, 0x1a, 0x00, 0x5b, 0x9c, 0x66, 0x95, 0x88, 0xe4, 0x66,
+    0x03, 0x5c, 0x56, 0x5f, 0x67, 0x8a, 0x66, 0x03, 0x67, 0x5d, 0x44, 0x44, 0xb7, 0x66, 0x04, 0x65,
+    0x2e, 0x00, 0x00, 0x59, 0x82, 0x66, 0x00, 0x27, 0x86, 0x00, 0x00, 0x14, 0xf7, 0x66, 0x01, 0x65,
+    0x67, 0x8f, 0x66, 0x01, 0x65, 0x65, 0x90, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x02, 0x65, 0x66, 0x65,
+    0x82, 0x66, 0x07, 0x2c, 0x00, 0x42, 0x66, 0x66, 0x47, 0x00, 0x18, 0x83, 0x66, 0x05, 0x11, 0x00,
+    0x62, 0x65, 0x66, 0x65, 0x99, 0x66, 0x95, 0x88, 0xe1, 0x66, 0x05, 0x67, 0x66, 0x66, 0x14, 0x00,
+    0x3b, 0x82, 0x66, 0x0c, 0x67, 0x66, 0x61, 0x5e, 0x64, 0x66, 0x66, 0x65, 0x66, 0x66, 0x51, 0x00,
+    0x03, 0xb7, 0x66, 0x0a, 0x32, 0x00, 0x00, 0x09, 0x52, 0x66, 0x67, 0x66, 0x29, 0x00, 0x1b, 0x82,
+    0x29, 0x03, 0x28, 0x00, 0x00, 0x4b, 0xff, 0x66, 0x8a, 0x66, 0x00, 0x67, 0x8f, 0x66, 0xa1, 0x88,
+    0x99, 0x66, 0x00, 0x65, 0x82, 0x66, 0x07, 0x3c, 0x00, 0x1f, 0x67, 0x66, 0x1e, 0x00, 0x33, 0x82,
+    0x66, 0x02, 0x50, 0x00, 0x0a, 0x9d, 0x66, 0x95, 0x88, 0xe4, 0x66, 0x04, 0x1a, 0x00, 0x43, 0x66,
+    0x67, 0x82, 0x66, 0x03, 0x04, 0x00, 0x4c, 0x67, 0x82, 0x66, 0x03, 0x67, 0x58, 0x00, 0x0c, 0xb6,
+    0x66, 0x05, 0x5a, 0x03, 0x00, 0x25, 0x62, 0x67, 0x82, 0x66, 0x0b, 0x2a, 0x00, 0x43, 0x67, 0x66,
+    0x66, 0x67, 0x1e, 0x00, 0x28, 0x66, 0x65, 0xbb, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x67, 0x66,
+    0x67, 0xd5, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x10, 0x67, 0x66, 0x66, 0x5e, 0x06, 0x01, 0x18, 0x1b,
+    0x00, 0x03, 0x5b, 0x66, 0x62, 0x43, 0x0c, 0x00, 0x2c, 0x9d, 0x66, 0x95, 0x88, 0xe1, 0x66, 0x15,
+    0x65, 0x66, 0x66, 0x20, 0x00, 0x47, 0x66, 0x66, 0x65, 0x66, 0x66, 0x0c, 0x00, 0x56, 0x66, 0x66,
+    0x65, 0x66, 0x66, 0x5b, 0x00, 0x0e, 0xb4, 0x66, 0x14, 0x65, 0x66, 0x2a, 0x00, 0x1b, 0x65, 0x66,
+    0x66, 0x67, 0x66, 0x67, 0x27, 0x00, 0x42, 0x65, 0x65, 0x66, 0x66, 0x4b, 0x00, 0x10, 0xc2, 0x66,
+    0x00, 0x65, 0xd7, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x00, 0x67, 0x82, 0x66, 0x03, 0x67, 0x66, 0x41,
+    0x02, 0x82, 0x00, 0x07, 0x3b, 0x66, 0x66, 0x52, 0x00, 0x00, 0x0b, 0x5b, 0x9d, 0x66, 0x95, 0x88,
+    0xe1, 0x66, 0x05, 0x65, 0x66, 0x66, 0x23, 0x00, 0x48, 0x82, 0x66, 0x05, 0x65, 0x66, 0x0f, 0x00,
+    0x59, 0x65, 0x83, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0xb5, 0x66, 0x03, 0x67, 0x16, 0x00, 0x4c, 0x84,
+    0x66, 0x03, 0x65, 0x23, 0x00, 0x3c, 0x83, 0x66, 0x03, 0x64, 0x01, 0x01, 0x65, 0x82, 0x66, 0x00,
+    0x67, 0xff, 0x66, 0x96, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x0a, 0x54, 0x36, 0x36, 0x50, 0x65, 0x67,
+    0x66, 0x62, 0x00, 0x19, 0x55, 0x9e, 0x66, 0x95, 0x88, 0xe2, 0x66, 0x14, 0x67, 0x66, 0x22, 0x00,
+    0x48, 0x67, 0x66, 0x65, 0x66, 0x66, 0x0f, 0x00, 0x5a, 0x66, 0x67, 0x67, 0x66, 0x66, 0x5c, 0x00,
+    0x0e, 0xb6, 0x66, 0x02, 0x07, 0x00, 0x62, 0x85, 0x66, 0x04, 0x42, 0x35, 0x52, 0x66, 0x65, 0x82,
+    0x66, 0x02, 0x0c, 0x01, 0x5e, 0xbd, 0x66, 0x02, 0x56, 0x52, 0x55, 0xd9, 0x66, 0xa1, 0x88, 0xa8,
+    0x66, 0x00, 0x67, 0x9f, 0x66, 0x95, 0x88, 0xe2, 0x66, 0x04, 0x67, 0x66, 0x22, 0x00, 0x48, 0x84,
+    0x66, 0x02, 0x10, 0x00, 0x5a, 0x84, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0xb2, 0x66, 0x06, 0x67, 0x66,
+    0x66, 0x67, 0x00, 0x02, 0x65, 0x88, 0x66, 0x07, 0x67, 0x66, 0x67, 0x66, 0x65, 0x11, 0x00, 0x5c,
+    0xbd, 0x66, 0x02, 0x14, 0x00, 0x0d, 0x82, 0x66, 0x00, 0x65, 0xd5, 0x66, 0xa1, 0x88, 0x98, 0x66,
+    0x82, 0x65, 0x02, 0x66, 0x66, 0x65, 0x82, 0x66, 0x01, 0x65, 0x67, 0x82, 0x66, 0x02, 0x67, 0x66,
+    0x65, 0x9f, 0x66, 0x95, 0x88, 0xe4, 0x66, 0x04, 0x22, 0x00, 0x48, 0x66, 0x65, 0x82, 0x66, 0x03,
+    0x10, 0x00, 0x5a, 0x65, 0x82, 0x66, 0x03, 0x67, 0x5c, 0x00, 0x0e, 0xb2, 0x66, 0x06, 0x67, 0x65,
+    0x65, 0x66, 0x0e, 0x00, 0x56, 0x83, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02,
+    0x63, 0x02, 0x03, 0xbe, 0x66, 0x03, 0x13, 0x00, 0x0d, 0x67, 0xd8, 0x66, 0xa1, 0x88, 0x97, 0x66,
+    0x05, 0x65, 0x66, 0x65, 0x66, 0x66, 0x65, 0x83, 0x66, 0x09, 0x57, 0x45, 0x37, 0x32, 0x40, 0x50,
+    0x63, 0x66, 0x67, 0x65, 0x9d, 0x66, 0x95, 0x88, 0xe4, 0x66, 0x02, 0x22, 0x00, 0x48, 0x84, 0x66,
+    0x0a, 0x10, 0x00, 0x5a, 0x66, 0x67, 0x65, 0x66, 0x66, 0x5c, 0x00, 0x0e, 0xb6, 0x66, 0x03, 0x22,
+    0x00, 0x41, 0x67, 0x87, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x53, 0x00, 0x11, 0x83, 0x66, 0x00,
+    0x65, 0xb9, 0x66, 0x02, 0x42, 0x37, 0x3e, 0xd9, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x07, 0x67, 0x66,
+    0x66, 0x65, 0x66, 0x66, 0x54, 0x1f, 0x85, 0x00, 0x01, 0x0c, 0x41, 0x83, 0x66, 0x00, 0x65, 0x9a,
+    0x66, 0x95, 0x88, 0xe0, 0x66, 0x06, 0x65, 0x66, 0x67, 0x66, 0x23, 0x00, 0x49, 0x82, 0x66, 0x04,
+    0x65, 0x66, 0x10, 0x00, 0x5a, 0x84, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0xaf, 0x66, 0x02, 0x67, 0x66,
+    0x65, 0x83, 0x66, 0x05, 0x36, 0x00, 0x10, 0x62, 0x66, 0x67, 0x84, 0x66, 0x0d, 0x65, 0x66, 0x66,
+    0x65, 0x66, 0x1b, 0x00, 0x24, 0x66, 0x66, 0x65, 0x66, 0x66, 0x67, 0xff, 0x66, 0x95, 0x66, 0xa1,
+    0x88, 0x9e, 0x66, 0x0b, 0x55, 0x05, 0x00, 0x00, 0x0e, 0x1c, 0x21, 0x14, 0x04, 0x00, 0x00, 0x2c,
+    0x9e, 0x66, 0x95, 0x88, 0xa6, 0x66, 0x00, 0x65, 0xbc, 0x66, 0x02, 0x22, 0x00, 0x41, 0x84, 0x5e,
+    0x02, 0x0f, 0x00, 0x52, 0x84, 0x5e, 0x02, 0x56, 0x00, 0x0e, 0xb3, 0x66, 0x06, 0x67, 0x65, 0x66,
+    0x5b, 0x07, 0x01, 0x23, 0x82, 0x66, 0x00, 0x65, 0x83, 0x66, 0x09, 0x65, 0x66, 0x66, 0x35, 0x00,
+    0x01, 0x56, 0x66, 0x66, 0x65, 0xe6, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xa9, 0x66, 0x03, 0x67,
+    0x66, 0x66, 0x67, 0xa1, 0x88, 0x99, 0x66, 0x00, 0x65, 0x82, 0x66, 0x04, 0x65, 0x0e, 0x00, 0x13,
+    0x4c, 0x82, 0x66, 0x05, 0x65, 0x5e, 0x2e, 0x00, 0x00, 0x48, 0x9d, 0x66, 0x95, 0x88, 0xe2, 0x66,
+    0x02, 0x65, 0x66, 0x21, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x0d, 0x66, 0x65, 0x65, 0x83,
+    0x66, 0x00, 0x67, 0xaf, 0x66, 0x04, 0x48, 0x00, 0x00, 0x15, 0x49, 0x84, 0x66, 0x0a, 0x65, 0x66,
+    0x4f, 0x16, 0x00, 0x01, 0x2a, 0x66, 0x66, 0x67, 0x65, 0xe2, 0x66, 0x02, 0x69, 0x66, 0x64, 0xaf,
+    0x66, 0x02, 0x65, 0x66, 0x68, 0xa1, 0x88, 0x9b, 0x66, 0x05, 0x67, 0x66, 0x4f, 0x00, 0x0a, 0x5d,
+    0x84, 0x66, 0x04, 0x67, 0x66, 0x2f, 0x00, 0x1d, 0x9d, 0x66, 0x95, 0x88, 0xa3, 0x66, 0x02, 0x62,
+    0x18, 0x31, 0xbd, 0x66, 0x00, 0x1d, 0x90, 0x00, 0x00, 0x0b, 0xb3, 0x66, 0x00, 0x65, 0x83, 0x66,
+    0x0f, 0x32, 0x00, 0x00, 0x01, 0x11, 0x25, 0x31, 0x3c, 0x31, 0x21, 0x13, 0x00, 0x01, 0x00, 0x21,
+    0x63, 0x82, 0x66, 0x00, 0x67, 0xe2, 0x66, 0x00, 0x6e, 0xb2, 0x66, 0x01, 0x67, 0x70, 0xa1, 0x88,
+    0x9d, 0x66, 0x05, 0x32, 0x00, 0x33, 0x65, 0x66, 0x67, 0x84, 0x66, 0x02, 0x63, 0x01, 0x0a, 0x82,
+    0x66, 0x00, 0x65, 0x99, 0x66, 0x95, 0x88, 0xa2, 0x66, 0x04, 0x62, 0x19, 0x00, 0x49, 0x65, 0xb7,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x03, 0x55, 0x53, 0x5a, 0x5d, 0x86, 0x5c, 0x0a, 0x5d, 0x5c, 0x5d,
+    0x5c, 0x5c, 0x59, 0x55, 0x51, 0x66, 0x67, 0x67, 0xb2, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x53,
+    0x1a, 0x87, 0x00, 0x02, 0x01, 0x0c, 0x3e, 0xe8, 0x66, 0x01, 0x7a, 0x65, 0xb2, 0x66, 0x00, 0x79,
+    0xa1, 0x88, 0x9d, 0x66, 0x04, 0x2a, 0x00, 0x45, 0x66, 0x65, 0x82, 0x66, 0x06, 0x65, 0x66, 0x65,
+    0x66, 0x10, 0x00, 0x62, 0x9c, 0x66, 0x95, 0x88, 0xa1, 0x66, 0x05, 0x62, 0x1a, 0x00, 0x24, 0x66,
+    0x65, 0xbe, 0x66, 0x00, 0x65, 0xcb, 0x66, 0x12, 0x4c, 0x38, 0x28, 0x19, 0x0d, 0x12, 0x1b, 0x2d,
+    0x49, 0x63, 0x66, 0x66, 0x65, 0x65, 0x66, 0x66, 0x65, 0x66, 0x65, 0xe0, 0x66, 0x07, 0x7f, 0x75,
+    0x67, 0x64, 0x66, 0x66, 0x67, 0x67, 0xab, 0x66, 0x01, 0x74, 0x7e, 0xa1, 0x88, 0x97, 0x66, 0x09,
+    0x67, 0x66, 0x66, 0x65, 0x66, 0x68, 0x3c, 0x00, 0x39, 0x67, 0x85, 0x66, 0x03, 0x65, 0x65, 0x06,
+    0x0c, 0x82, 0x66, 0x00, 0x67, 0x99, 0x66, 0x95, 0x88, 0xa1, 0x66, 0x03, 0x1b, 0x01, 0x07, 0x5d,
+    0xc1, 0x66, 0x02, 0x65, 0x66, 0x67, 0x87, 0x66, 0x00, 0x67, 0xc4, 0x66, 0x03, 0x67, 0x66, 0x66,
+    0x65, 0xea, 0x66, 0x04, 0x84, 0x7f, 0x7a, 0x6e, 0x68, 0xab, 0x66, 0x04, 0x68, 0x6e, 0x7a, 0x7f,
+    0x84, 0xa1, 0x88, 0x9d, 0x66, 0x02, 0x54, 0x00, 0x1e, 0x87, 0x66, 0x04, 0x4f, 0x00, 0x24, 0x66,
+    0x65, 0x9b, 0x66, 0x95, 0x88, 0xa1, 0x66, 0x02, 0x23, 0x00, 0x3f, 0xff, 0x66, 0x86, 0x66, 0x01,
+    0x67, 0x65, 0x87, 0x66, 0x00, 0x65, 0x84, 0x66, 0x02, 0x67, 0x66, 0x65, 0x84, 0x66, 0x00, 0x65,
+    0xe2, 0x66, 0x05, 0x84, 0x7f, 0x79, 0x70, 0x69, 0x65, 0xaa, 0x66, 0x04, 0x68, 0x70, 0x7a, 0x7f,
+    0x84, 0xa1, 0x88, 0x9d, 0x66, 0x06, 0x65, 0x0d, 0x00, 0x40, 0x66, 0x67, 0x65, 0x82, 0x66, 0x03,
+    0x62, 0x12, 0x00, 0x44, 0x9d, 0x66, 0x95, 0x88, 0xa1, 0x66, 0x01, 0x65, 0x3e, 0xbd, 0x66, 0x00,
+    0x65, 0x86, 0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x65, 0xba, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x02,
+    0x67, 0x65, 0x65, 0xe6, 0x66, 0x03, 0x7f, 0x74, 0x66, 0x65, 0xaf, 0x66, 0x01, 0x74, 0x7e, 0xa1,
+    0x88, 0x9e, 0x66, 0x0d, 0x57, 0x0a, 0x01, 0x28, 0x59, 0x66, 0x67, 0x61, 0x47, 0x0d, 0x00, 0x32,
+    0x66, 0x65, 0x85, 0x66, 0x00, 0x65, 0x95, 0x66, 0x95, 0x88, 0xff, 0x66, 0xa8, 0x66, 0x00, 0x67,
+    0x83, 0x66, 0x00, 0x65, 0xf8, 0x66, 0x04, 0x7b, 0x66, 0x65, 0x67, 0x67, 0xaf, 0x66, 0x00, 0x7a,
+    0xa1, 0x88, 0x98, 0x66, 0x01, 0x64, 0x67, 0x82, 0x66, 0x02, 0x4a, 0x18, 0x0a, 0x82, 0x00, 0x01,
+    0x05, 0x0b, 0x83, 0x00, 0x83, 0x16, 0x02, 0x14, 0x10, 0x11, 0x98, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xa7, 0x66, 0x00, 0x6f, 0xb3, 0x66, 0x00, 0x70, 0xa1, 0x88, 0x9b, 0x66, 0x02, 0x65,
+    0x66, 0x42, 0x8a, 0x00, 0x01, 0x01, 0x01, 0x83, 0x00, 0x00, 0x0a, 0x98, 0x66, 0x95, 0x88, 0xff,
+    0x66, 0xa8, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0xf8, 0x66, 0x04, 0x69, 0x66, 0x65, 0x65,
+    0x67, 0xaf, 0x66, 0x00, 0x68, 0xa1, 0x88, 0x9d, 0x66, 0x02, 0x5a, 0x40, 0x48, 0x84, 0x4b, 0x00,
+    0x4a, 0x84, 0x4b, 0x04, 0x4c, 0x4b, 0x47, 0x40, 0x42, 0x98, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xac, 0x66, 0x02, 0x65, 0x66, 0x65, 0xad, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x04, 0x65, 0x65,
+    0x66, 0x67, 0x65, 0x85, 0x66, 0x00, 0x65, 0x84, 0x66, 0x04, 0x67, 0x67, 0x66, 0x66, 0x65, 0x98,
+    0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xda, 0x66, 0x02, 0x65, 0x66, 0x66, 0xa1, 0x88, 0xa1,
+    0x66, 0x0d, 0x65, 0x67, 0x67, 0x66, 0x66, 0x65, 0x67, 0x67, 0x66, 0x65, 0x66, 0x66, 0x65, 0x65,
+    0x82, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0x91, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xa9, 0x66, 0x00, 0x67, 0xb2, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x00, 0x65, 0x82, 0x66, 0x86, 0x58,
+    0x02, 0x56, 0x51, 0x4b, 0x9d, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa8, 0x66, 0x00, 0x65,
+    0xb2, 0x66, 0x00, 0x64, 0xa1, 0x88, 0x9d, 0x66, 0x09, 0x67, 0x56, 0x27, 0x07, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x0d, 0x83, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0x93,
+    0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x03, 0x65, 0x67, 0x66, 0x67, 0xac, 0x66,
+    0x00, 0x67, 0x83, 0x66, 0x00, 0x87, 0xa0, 0x88, 0x97, 0x66, 0x02, 0x67, 0x66, 0x65, 0x82, 0x66,
+    0x0d, 0x67, 0x16, 0x00, 0x00, 0x07, 0x07, 0x00, 0x05, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x1a, 0x82,
+    0x66, 0x00, 0x68, 0x99, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9d,
+    0x66, 0x0f, 0x43, 0x01, 0x10, 0x47, 0x65, 0x40, 0x00, 0x44, 0x66, 0x62, 0x2b, 0x00, 0x12, 0x62,
+    0x66, 0x67, 0x9b, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9d, 0x66,
+    0x07, 0x26, 0x00, 0x3d, 0x66, 0x67, 0x44, 0x00, 0x3f, 0x82, 0x66, 0x02, 0x1b, 0x00, 0x38, 0x9d,
+    0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x0d, 0x1c, 0x00,
+    0x57, 0x66, 0x66, 0x4b, 0x00, 0x36, 0x66, 0x66, 0x65, 0x5a, 0x00, 0x1a, 0x9d, 0x66, 0x95, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x0f, 0x22, 0x00, 0x57, 0x66, 0x66,
+    0x57, 0x00, 0x24, 0x66, 0x66, 0x67, 0x67, 0x0e, 0x06, 0x66, 0x65, 0x9b, 0x66, 0x95, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x10, 0x31, 0x00, 0x3e, 0x66, 0x65, 0x67,
+    0x06, 0x0a, 0x66, 0x66, 0x67, 0x66, 0x17, 0x00, 0x60, 0x66, 0x67, 0x9a, 0x66, 0x95, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x12, 0x67, 0x66, 0x48, 0x00, 0x08, 0x58,
+    0x66, 0x66, 0x1d, 0x00, 0x3b, 0x67, 0x67, 0x5e, 0x02, 0x06, 0x66, 0x66, 0x65, 0x9a, 0x66, 0x95,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9e, 0x66, 0x0c, 0x1a, 0x00, 0x04, 0x46,
+    0x66, 0x49, 0x00, 0x02, 0x2c, 0x3a, 0x11, 0x00, 0x1b, 0x9d, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9e, 0x66, 0x06, 0x5a, 0x10, 0x00, 0x4c, 0x66, 0x67, 0x2a, 0x82,
+    0x00, 0x02, 0x01, 0x06, 0x57, 0x9d, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbb, 0x66, 0x00,
+    0x67, 0x87, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0x91, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x08,
+    0x67, 0x66, 0x66, 0x65, 0x66, 0x66, 0x64, 0x40, 0x61, 0x82, 0x66, 0x04, 0x3f, 0x21, 0x14, 0x2e,
+    0x52, 0x9e, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xc6, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1,
+    0x88, 0x99, 0x66, 0x01, 0x65, 0x68, 0x82, 0x66, 0x01, 0x67, 0x64, 0x83, 0x66, 0x02, 0x67, 0x66,
+    0x67, 0xa1, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbe, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x00, 0x67, 0x91, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00,
+    0x65, 0x8e, 0x66, 0x00, 0x67, 0x99, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbc, 0x66, 0x0f,
+    0x62, 0x4a, 0x31, 0x26, 0x1e, 0x18, 0x1f, 0x2a, 0x36, 0x40, 0x5c, 0x66, 0x66, 0x65, 0x66, 0x67,
+    0x90, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x04, 0x65, 0x66, 0x54, 0x24, 0x45, 0x86, 0x66, 0x03, 0x0d,
+    0x17, 0x42, 0x67, 0x83, 0x66, 0x00, 0x65, 0x9a, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xba,
+    0x66, 0x05, 0x61, 0x29, 0x02, 0x00, 0x00, 0x01, 0x84, 0x00, 0x04, 0x01, 0x00, 0x1b, 0x51, 0x67,
+    0x82, 0x66, 0x00, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x03, 0x38, 0x01, 0x00, 0x24, 0x85,
+    0x66, 0x00, 0x5b, 0x82, 0x00, 0x06, 0x25, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x99, 0x66, 0x95,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xb9, 0x66, 0x0b, 0x50, 0x0b, 0x00, 0x00, 0x04, 0x19, 0x25, 0x2f,
+    0x36, 0x2a, 0x1b, 0x0b, 0x82, 0x00, 0x03, 0x02, 0x4d, 0x66, 0x65, 0x90, 0x66, 0xa1, 0x88, 0x99,
+    0x66, 0x04, 0x41, 0x00, 0x00, 0x0c, 0x3e, 0x85, 0x66, 0x05, 0x62, 0x42, 0x1b, 0x00, 0x00, 0x38,
+    0x9e, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x05, 0x62, 0x0e, 0x00, 0x08, 0x41,
+    0x64, 0x85, 0x66, 0x06, 0x65, 0x61, 0x46, 0x0e, 0x00, 0x07, 0x56, 0x91, 0x66, 0xa1, 0x88, 0x98,
+    0x66, 0x04, 0x5f, 0x07, 0x00, 0x1f, 0x62, 0x83, 0x66, 0x00, 0x67, 0x84, 0x66, 0x03, 0x31, 0x00,
+    0x00, 0x4e, 0x9d, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03, 0x32, 0x00, 0x0a,
+    0x55, 0x82, 0x66, 0x04, 0x67, 0x66, 0x65, 0x66, 0x65, 0x82, 0x66, 0x06, 0x63, 0x1c, 0x00, 0x21,
+    0x66, 0x65, 0x67, 0x8e, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x03, 0x32, 0x00, 0x0d, 0x61, 0x8a, 0x66,
+    0x03, 0x65, 0x1d, 0x00, 0x27, 0x82, 0x66, 0x00, 0x67, 0x99, 0x66, 0x95, 0x88, 0xc8, 0x66, 0x02,
+    0x67, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xbd, 0x66, 0x01, 0x65, 0x64, 0x87, 0x66, 0x03, 0x65,
+    0x66, 0x66, 0x65, 0xbf, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xc5, 0x66, 0x00, 0x65, 0x8f,
+    0x66, 0x03, 0x67, 0x1b, 0x00, 0x3f, 0x88, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x5a, 0x01, 0x0a,
+    0x91, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x02, 0x1f, 0x00, 0x41, 0x85, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x04, 0x64, 0x66, 0x50, 0x00, 0x13, 0x9d, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x03, 0x69, 0x66, 0x66,
+    0x67, 0xc2, 0x66, 0x03, 0x67, 0x66, 0x69, 0x69, 0xc1, 0x66, 0x00, 0x67, 0x84, 0x66, 0x01, 0x68,
+    0x69, 0x85, 0x66, 0x00, 0x67, 0xbb, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x68, 0x90, 0x66, 0x05,
+    0x08, 0x00, 0x59, 0x66, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x85, 0x66, 0x05, 0x10, 0x00, 0x5b,
+    0x66, 0x66, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x02, 0x0e, 0x00, 0x56, 0x85, 0x66, 0x01,
+    0x67, 0x67, 0x84, 0x66, 0x04, 0x63, 0x02, 0x02, 0x63, 0x67, 0x9b, 0x66, 0x95, 0x88, 0xc9, 0x66,
+    0x00, 0x6e, 0xc1, 0x66, 0x00, 0x67, 0x84, 0x66, 0x01, 0x70, 0x6e, 0xc7, 0x66, 0x01, 0x71, 0x6f,
+    0x83, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x00, 0x6e, 0x90, 0x66, 0x05, 0x07, 0x00, 0x62, 0x66, 0x66,
+    0x67, 0x83, 0x66, 0x01, 0x65, 0x68, 0x84, 0x66, 0x05, 0x0f, 0x00, 0x57, 0x66, 0x66, 0x65, 0x8d,
+    0x66, 0xa1, 0x88, 0x98, 0x66, 0x0a, 0x02, 0x00, 0x62, 0x66, 0x66, 0x65, 0x66, 0x67, 0x66, 0x66,
+    0x67, 0x85, 0x66, 0x02, 0x0c, 0x00, 0x55, 0x9c, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x00, 0x79, 0xc3,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x05, 0x7a, 0x79, 0x67, 0x66, 0x66, 0x65, 0xb7, 0x66, 0x00, 0x65,
+    0x83, 0x66, 0x00, 0x67, 0x84, 0x66, 0x02, 0x65, 0x79, 0x79, 0xc5, 0x66, 0x02, 0x67, 0x66, 0x79,
+    0x90, 0x66, 0x02, 0x1e, 0x00, 0x4e, 0x87, 0x66, 0x00, 0x65, 0x82, 0x66, 0x04, 0x65, 0x5d, 0x00,
+    0x02, 0x65, 0x90, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x08, 0x0e, 0x00, 0x52, 0x66, 0x67, 0x66, 0x66,
+    0x65, 0x65, 0x86, 0x66, 0x03, 0x62, 0x01, 0x00, 0x60, 0x9c, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x03,
+    0x7e, 0x75, 0x66, 0x67, 0xbc, 0x66, 0x0a, 0x65, 0x66, 0x68, 0x66, 0x65, 0x66, 0x65, 0x74, 0x7f,
+    0x7e, 0x75, 0x84, 0x66, 0x00, 0x65, 0xb4, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0x84, 0x66,
+    0x03, 0x75, 0x7f, 0x7e, 0x75, 0x84, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x82, 0x65, 0x82, 0x66, 0x01,
+    0x74, 0x7e, 0x90, 0x66, 0x03, 0x37, 0x00, 0x14, 0x64, 0x86, 0x66, 0x00, 0x67, 0x82, 0x66, 0x04,
+    0x67, 0x27, 0x00, 0x14, 0x67, 0x90, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x04, 0x20, 0x00, 0x3d, 0x66,
+    0x65, 0x88, 0x66, 0x06, 0x64, 0x66, 0x4d, 0x00, 0x0b, 0x66, 0x67, 0x9b, 0x66, 0x95, 0x88, 0xc9,
+    0x66, 0x04, 0x84, 0x7e, 0x79, 0x6e, 0x67, 0xbf, 0x66, 0x0b, 0x68, 0x6e, 0x7a, 0x7f, 0x85, 0x84,
+    0x7f, 0x79, 0x6e, 0x69, 0x67, 0x65, 0xbd, 0x66, 0x09, 0x6a, 0x6d, 0x7a, 0x7f, 0x84, 0x84, 0x7f,
+    0x7a, 0x6e, 0x68, 0xbf, 0x66, 0x04, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x90, 0x66, 0x0a, 0x57, 0x06,
+    0x00, 0x15, 0x52, 0x66, 0x66, 0x67, 0x66, 0x65, 0x66, 0x82, 0x67, 0x04, 0x60, 0x26, 0x01, 0x00,
+    0x4a, 0x91, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x03, 0x32, 0x01, 0x0e, 0x60, 0x8a, 0x66, 0x03, 0x65,
+    0x1a, 0x00, 0x1e, 0x9d, 0x66, 0x95, 0x88, 0xc8, 0x66, 0x05, 0x65, 0x85, 0x7f, 0x79, 0x70, 0x68,
+    0xbf, 0x66, 0x09, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0x83, 0x7f, 0x79, 0x70, 0x68, 0xbd, 0x66, 0x0b,
+    0x65, 0x66, 0x68, 0x70, 0x79, 0x7f, 0x84, 0x84, 0x7f, 0x7a, 0x70, 0x6a, 0xbf, 0x66, 0x04, 0x68,
+    0x70, 0x7a, 0x7f, 0x84, 0x91, 0x66, 0x12, 0x51, 0x06, 0x00, 0x01, 0x0f, 0x20, 0x30, 0x3f, 0x4d,
+    0x49, 0x3f, 0x34, 0x1e, 0x04, 0x00, 0x00, 0x2c, 0x66, 0x67, 0x90, 0x66, 0xa1, 0x88, 0x98, 0x66,
+    0x03, 0x5e, 0x08, 0x00, 0x20, 0x82, 0x66, 0x00, 0x65, 0x86, 0x66, 0x03, 0x2d, 0x00, 0x00, 0x4e,
+    0x9d, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x01, 0x7e, 0x75, 0xbe, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65,
+    0x82, 0x66, 0x03, 0x74, 0x7d, 0x7f, 0x75, 0xc1, 0x66, 0x00, 0x67, 0x82, 0x66, 0x09, 0x76, 0x7f,
+    0x7f, 0x74, 0x67, 0x65, 0x65, 0x66, 0x66, 0x67, 0xbf, 0x66, 0x01, 0x75, 0x7f, 0x92, 0x66, 0x01,
+    0x50, 0x0d, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x06, 0x02, 0x01, 0x0a, 0x47, 0x66, 0x66, 0x67,
+    0x90, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x04, 0x41, 0x00, 0x00, 0x14, 0x49, 0x86, 0x66, 0x05, 0x50,
+    0x1b, 0x00, 0x00, 0x2a, 0x67, 0x9d, 0x66, 0x95, 0x88, 0x01, 0x66, 0x67, 0xc5, 0x66, 0x02, 0x65,
+    0x66, 0x7a, 0xc7, 0x66, 0x01, 0x7a, 0x7a, 0xc2, 0x66, 0x06, 0x65, 0x67, 0x65, 0x66, 0x66, 0x7a,
+    0x7a, 0x84, 0x66, 0x00, 0x67, 0xba, 0x66, 0x00, 0x67, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x7a,
+    0x94, 0x66, 0x0b, 0x4b, 0x2e, 0x1f, 0x13, 0x09, 0x00, 0x05, 0x0d, 0x16, 0x2d, 0x47, 0x60, 0x94,
+    0x66, 0xa1, 0x88, 0x9a, 0x66, 0x0a, 0x38, 0x02, 0x00, 0x00, 0x12, 0x25, 0x33, 0x3e, 0x35, 0x27,
+    0x16, 0x82, 0x00, 0x03, 0x22, 0x60, 0x66, 0x65, 0x9c, 0x66, 0x95, 0x88, 0x00, 0x69, 0xbf, 0x66,
+    0x01, 0x67, 0x65, 0x83, 0x66, 0x03, 0x65, 0x66, 0x68, 0x6f, 0xc7, 0x66, 0x03, 0x70, 0x6f, 0x66,
+    0x67, 0xc5, 0x66, 0x01, 0x70, 0x6f, 0x82, 0x66, 0x02, 0x65, 0x66, 0x64, 0xbb, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x02, 0x65, 0x66, 0x70, 0x93, 0x66, 0x00, 0x65, 0x84, 0x66, 0x03, 0x67, 0x66, 0x66,
+    0x67, 0x82, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x90, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x01, 0x5a,
+    0x1d, 0x88, 0x00, 0x01, 0x0f, 0x4c, 0x83, 0x66, 0x00, 0x67, 0x9b, 0x66, 0x95, 0x88, 0x03, 0x6e,
+    0x66, 0x66, 0x67, 0x82, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x01, 0x67, 0x67, 0x84, 0x66, 0x01, 0x70,
+    0x69, 0xc7, 0x66, 0x03, 0x68, 0x69, 0x66, 0x65, 0xc2, 0x66, 0x04, 0x65, 0x67, 0x66, 0x68, 0x6a,
+    0x83, 0x66, 0x00, 0x65, 0xbd, 0x66, 0x05, 0x64, 0x66, 0x66, 0x65, 0x66, 0x69, 0x8f, 0x66, 0x00,
+    0x67, 0x84, 0x66, 0x00, 0x67, 0x9e, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x0a, 0x52, 0x3e, 0x2c, 0x1a,
+    0x0c, 0x17, 0x27, 0x38, 0x48, 0x64, 0x67, 0xa0, 0x66, 0x95, 0x88, 0x00, 0x7a, 0xc2, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x03, 0x79, 0x66, 0x66, 0x65, 0xff, 0x66, 0x92, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x02, 0x67, 0x66, 0x65, 0xb9, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0x9b, 0x66, 0x05, 0x67,
+    0x65, 0x65, 0x66, 0x65, 0x65, 0x83, 0x66, 0x00, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0x9e, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x01, 0x65, 0x65, 0x84, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x68, 0x99, 0x66,
+    0x95, 0x88, 0x01, 0x80, 0x75, 0xc3, 0x66, 0x03, 0x65, 0x66, 0x74, 0x7f, 0x83, 0x66, 0x00, 0x65,
+    0xc3, 0x66, 0x00, 0x67, 0xc4, 0x66, 0x00, 0x67, 0xdf, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67,
+    0x84, 0x66, 0x01, 0x65, 0x67, 0x96, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x01, 0x65, 0x65, 0x84, 0x66,
+    0x0a, 0x65, 0x66, 0x66, 0x67, 0x64, 0x65, 0x66, 0x66, 0x65, 0x66, 0x65, 0x82, 0x66, 0x00, 0x67,
+    0x99, 0x66, 0x95, 0x88, 0x05, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x67, 0xbe, 0x66, 0x06, 0x69, 0x6d,
+    0x7a, 0x7f, 0x84, 0x67, 0x67, 0xff, 0x66, 0x91, 0x66, 0x00, 0x65, 0x82, 0x66, 0x04, 0x65, 0x65,
+    0x66, 0x66, 0x65, 0xd1, 0x66, 0x02, 0x67, 0x66, 0x65, 0xa1, 0x66, 0xa1, 0x88, 0xa1, 0x66, 0x00,
+    0x68, 0x8a, 0x66, 0x00, 0x67, 0x9a, 0x66, 0x95, 0x88, 0x07, 0x84, 0x7f, 0x79, 0x70, 0x69, 0x66,
+    0x66, 0x65, 0xb7, 0x66, 0x00, 0x65, 0x83, 0x66, 0x04, 0x69, 0x70, 0x7c, 0x7f, 0x84, 0xc8, 0x66,
+    0x00, 0x65, 0xc9, 0x66, 0x00, 0x67, 0xe2, 0x66, 0x00, 0x65, 0x86, 0x66, 0x00, 0x65, 0x83, 0x66,
+    0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x00, 0x67, 0x9e, 0x66,
+    0x95, 0x88, 0x02, 0x7f, 0x74, 0x65, 0xc4, 0x66, 0x01, 0x76, 0x7f, 0xff, 0x66, 0x8f, 0x66, 0x00,
+    0x65, 0x82, 0x66, 0x00, 0x65, 0xc1, 0x66, 0x02, 0x67, 0x66, 0x67, 0x93, 0x66, 0x00, 0x67, 0x95,
+    0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x03, 0x7b, 0x66, 0x66, 0x65,
+    0x82, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x01, 0x67, 0x7a, 0x84, 0x66, 0x00, 0x67, 0xff, 0x66, 0xe8,
+    0x66, 0x03, 0x43, 0x39, 0x3e, 0x45, 0x8b, 0x49, 0x02, 0x47, 0x42, 0x3e, 0x91, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x01, 0x6f, 0x65, 0xc5, 0x66, 0x01, 0x67, 0x70, 0xff, 0x66, 0xee, 0x66,
+    0x00, 0x1d, 0x90, 0x00, 0x03, 0x0e, 0x66, 0x66, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x05, 0x69, 0x66, 0x65, 0x66, 0x66, 0x65, 0xc2, 0x66, 0x00, 0x68, 0xff, 0x66, 0xee, 0x66,
+    0x02, 0x22, 0x00, 0x06, 0x8c, 0x0b, 0x04, 0x09, 0x03, 0x10, 0x66, 0x65, 0x8f, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xcd, 0x66, 0x00, 0x65, 0xff, 0x66, 0xe8, 0x66, 0x03, 0x67, 0x22, 0x00,
+    0x4d, 0x82, 0x66, 0x00, 0x67, 0x88, 0x66, 0x05, 0x67, 0x66, 0x63, 0x66, 0x66, 0x65, 0x8e, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x03, 0x65, 0x21, 0x00,
+    0x49, 0x8b, 0x66, 0x00, 0x65, 0x94, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x00, 0x65, 0xff,
+    0x66, 0xff, 0x66, 0xb7, 0x66, 0x02, 0x1c, 0x00, 0x42, 0x8e, 0x66, 0x00, 0x67, 0x91, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x82, 0x66, 0x00, 0x65, 0xc3, 0x66, 0x00, 0x67, 0xff, 0x66, 0xee,
+    0x66, 0x06, 0x65, 0x52, 0x4a, 0x5d, 0x66, 0x66, 0x67, 0x88, 0x66, 0x00, 0x67, 0x94, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0x92, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xba, 0x66, 0x01, 0x67, 0x67, 0x84, 0x66,
+    0x01, 0x67, 0x65, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7,
+    0x66, 0x02, 0x65, 0x66, 0x67, 0x8a, 0x66, 0x00, 0x67, 0x96, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x2c, 0x1a, 0x42, 0x84, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0x98, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb4, 0x66,
+    0x83, 0x67, 0x0a, 0x1b, 0x00, 0x3f, 0x66, 0x66, 0x67, 0x66, 0x66, 0x3e, 0x3a, 0x5a, 0x99, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb4, 0x66, 0x82, 0x65, 0x0e, 0x66,
+    0x20, 0x00, 0x42, 0x66, 0x66, 0x67, 0x66, 0x67, 0x0d, 0x00, 0x49, 0x66, 0x66, 0x67, 0x96, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x22, 0x00, 0x44,
+    0x84, 0x66, 0x02, 0x15, 0x00, 0x50, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xb7, 0x66, 0x04, 0x67, 0x22, 0x00, 0x46, 0x65, 0x83, 0x66, 0x02, 0x17, 0x00, 0x52,
+    0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x22,
+    0x00, 0x46, 0x83, 0x66, 0x03, 0x65, 0x18, 0x00, 0x52, 0x82, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xe8, 0x66, 0x00, 0x67, 0x8b, 0x66, 0x00, 0x67, 0xff, 0x66, 0xc1,
+    0x66, 0x02, 0x22, 0x00, 0x46, 0x84, 0x66, 0x02, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0x95, 0x88, 0xe3, 0x66, 0x00, 0x67, 0x87, 0x66, 0x05, 0x65, 0x66, 0x65, 0x66, 0x65, 0x67,
+    0xff, 0x66, 0xc5, 0x66, 0x0e, 0x22, 0x00, 0x46, 0x66, 0x65, 0x66, 0x65, 0x66, 0x18, 0x00, 0x52,
+    0x66, 0x66, 0x65, 0x67, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xe0, 0x66, 0x00, 0x65,
+    0x86, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xff, 0x66, 0xca, 0x66, 0x02, 0x22, 0x00, 0x45,
+    0x83, 0x66, 0x03, 0x67, 0x17, 0x00, 0x53, 0x84, 0x66, 0x04, 0x67, 0x64, 0x66, 0x66, 0x67, 0x8f,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xdf, 0x66, 0x00, 0x67, 0x86, 0x66, 0x01, 0x67, 0x65,
+    0x86, 0x66, 0x01, 0x67, 0x65, 0xff, 0x66, 0xc5, 0x66, 0x12, 0x22, 0x00, 0x3e, 0x5f, 0x5e, 0x5d,
+    0x5e, 0x5e, 0x16, 0x00, 0x4c, 0x5e, 0x5f, 0x5e, 0x5e, 0x5f, 0x5d, 0x58, 0x50, 0x91, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xe2, 0x66, 0x07, 0x65, 0x66, 0x2b, 0x26, 0x48, 0x63, 0x66, 0x67,
+    0x88, 0x66, 0x00, 0x67, 0xff, 0x66, 0xc3, 0x66, 0x00, 0x21, 0x90, 0x00, 0x02, 0x0e, 0x66, 0x67,
+    0x8f, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xe3, 0x66, 0x07, 0x67, 0x22, 0x00, 0x00, 0x05,
+    0x1e, 0x3c, 0x59, 0xff, 0x66, 0xcc, 0x66, 0x00, 0x1d, 0x84, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00,
+    0x01, 0x84, 0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xe2, 0x66, 0x03,
+    0x67, 0x67, 0x32, 0x08, 0x84, 0x00, 0x03, 0x11, 0x2f, 0x4d, 0x64, 0xff, 0x66, 0xc8, 0x66, 0x03,
+    0x55, 0x4f, 0x56, 0x5b, 0x83, 0x5c, 0x00, 0x5d, 0x86, 0x5c, 0x02, 0x5a, 0x55, 0x53, 0x91, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xe0, 0x66, 0x00, 0x65, 0x84, 0x66, 0x03, 0x5c, 0x44, 0x27,
+    0x0b, 0x83, 0x00, 0x04, 0x05, 0x22, 0x40, 0x5e, 0x65, 0xff, 0x66, 0xc6, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0x88, 0x66, 0x00, 0x67, 0x94, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xe4, 0x66,
+    0x02, 0x67, 0x66, 0x67, 0x82, 0x66, 0x0e, 0x55, 0x39, 0x1d, 0x04, 0x00, 0x01, 0x00, 0x00, 0x15,
+    0x32, 0x50, 0x65, 0x66, 0x66, 0x65, 0xb5, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x00, 0x65, 0xa0, 0x66, 0x00, 0x67, 0x9d, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x00, 0x67, 0xd5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xed, 0x66, 0x03, 0x64, 0x4c, 0x30,
+    0x14, 0x83, 0x00, 0x04, 0x08, 0x2b, 0x66, 0x66, 0x67, 0xb2, 0x66, 0x00, 0x65, 0x85, 0x66, 0x03,
+    0x67, 0x66, 0x66, 0x65, 0xc0, 0x66, 0x01, 0x65, 0x67, 0x86, 0x66, 0x00, 0x67, 0xd9, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xe4, 0x66, 0x03, 0x67, 0x66, 0x67, 0x65, 0x87, 0x66, 0x02, 0x67,
+    0x5c, 0x2d, 0x82, 0x00, 0x01, 0x0f, 0x65, 0xae, 0x66, 0x00, 0x65, 0x85, 0x66, 0x02, 0x2b, 0x1a,
+    0x42, 0x84, 0x66, 0x00, 0x67, 0xff, 0x66, 0xa5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xe9,
+    0x66, 0x01, 0x67, 0x65, 0x82, 0x66, 0x03, 0x5d, 0x3e, 0x1f, 0x05, 0x82, 0x00, 0x01, 0x09, 0x2c,
+    0xb6, 0x66, 0x0a, 0x1a, 0x00, 0x40, 0x66, 0x67, 0x66, 0x67, 0x66, 0x3e, 0x3a, 0x5a, 0x84, 0x66,
+    0x00, 0x67, 0x9c, 0x66, 0x00, 0x65, 0xa2, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0xd7, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xe6, 0x66, 0x00, 0x67, 0x82, 0x66, 0x03, 0x67, 0x56, 0x33,
+    0x16, 0x83, 0x00, 0x02, 0x14, 0x32, 0x52, 0xb2, 0x66, 0x00, 0x65, 0x83, 0x66, 0x0e, 0x65, 0x21,
+    0x00, 0x43, 0x66, 0x66, 0x65, 0x66, 0x66, 0x0d, 0x00, 0x48, 0x66, 0x67, 0x65, 0x9f, 0x66, 0x00,
+    0x65, 0x99, 0x66, 0x00, 0x65, 0xe4, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xac, 0x66, 0x00,
+    0x65, 0xb4, 0x66, 0x00, 0x65, 0x83, 0x66, 0x03, 0x64, 0x4c, 0x2d, 0x0e, 0x82, 0x00, 0x03, 0x02,
+    0x1c, 0x3d, 0x59, 0x84, 0x66, 0x00, 0x65, 0xb2, 0x66, 0x05, 0x65, 0x66, 0x66, 0x22, 0x00, 0x45,
+    0x82, 0x66, 0x06, 0x65, 0x66, 0x15, 0x00, 0x50, 0x65, 0x65, 0xbe, 0x66, 0x01, 0x65, 0x65, 0x85,
+    0x66, 0x00, 0x65, 0xd9, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa9, 0x66, 0x00, 0x67, 0xb8,
+    0x66, 0x04, 0x67, 0x58, 0x3c, 0x22, 0x08, 0x82, 0x00, 0x03, 0x07, 0x25, 0x44, 0x61, 0x82, 0x66,
+    0x02, 0x67, 0x66, 0x65, 0x83, 0x66, 0x00, 0x67, 0xb3, 0x66, 0x04, 0x22, 0x00, 0x46, 0x66, 0x68,
+    0x82, 0x66, 0x05, 0x17, 0x00, 0x52, 0x66, 0x66, 0x67, 0xc1, 0x66, 0x04, 0x54, 0x50, 0x50, 0x57,
+    0x62, 0xd9, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xab, 0x66, 0x00, 0x67, 0xb5, 0x66, 0x02,
+    0x65, 0x66, 0x21, 0x82, 0x00, 0x08, 0x15, 0x31, 0x4d, 0x65, 0x66, 0x66, 0x65, 0x66, 0x65, 0x82,
+    0x66, 0x04, 0x65, 0x67, 0x66, 0x66, 0x65, 0xb2, 0x66, 0x06, 0x67, 0x66, 0x22, 0x01, 0x46, 0x66,
+    0x65, 0x82, 0x66, 0x03, 0x18, 0x00, 0x52, 0x67, 0x83, 0x66, 0x00, 0x65, 0x9c, 0x66, 0x00, 0x67,
+    0xa0, 0x66, 0x00, 0x14, 0x82, 0x00, 0x02, 0x05, 0x46, 0x65, 0xd7, 0x66, 0xa1, 0x88, 0x01, 0x66,
+    0x67, 0xc7, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x00, 0x65, 0xc2, 0x66, 0x01, 0x67, 0x22, 0x82, 0x00,
+    0x0b, 0x05, 0x1e, 0x3b, 0x5a, 0x65, 0x66, 0x66, 0x65, 0x66, 0x66, 0x67, 0x67, 0xb5, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x03, 0x22, 0x00, 0x46, 0x65, 0x83, 0x66, 0x02, 0x18, 0x00, 0x52, 0x88, 0x66,
+    0x00, 0x67, 0xba, 0x66, 0x06, 0x13, 0x00, 0x0d, 0x58, 0x1e, 0x14, 0x67, 0xa1, 0x66, 0x05, 0x65,
+    0x66, 0x67, 0x66, 0x66, 0x65, 0xaa, 0x66, 0x04, 0x67, 0x66, 0x65, 0x66, 0x66, 0xa1, 0x88, 0x00,
+    0x69, 0xbf, 0x66, 0x01, 0x67, 0x65, 0x83, 0x66, 0x02, 0x65, 0x66, 0x68, 0x84, 0x88, 0x00, 0x87,
+    0x8f, 0x88, 0x9c, 0x66, 0x00, 0x65, 0x8e, 0x66, 0x00, 0x65, 0xb6, 0x66, 0x04, 0x64, 0x52, 0x36,
+    0x19, 0x01, 0x82, 0x00, 0x04, 0x13, 0x32, 0x51, 0x67, 0x67, 0x83, 0x66, 0x00, 0x67, 0xb3, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x0a, 0x22, 0x00, 0x46, 0x66, 0x66, 0x68, 0x66, 0x66, 0x18, 0x00, 0x52,
+    0x84, 0x66, 0x02, 0x65, 0x66, 0x65, 0xb6, 0x66, 0x00, 0x67, 0x83, 0x66, 0x06, 0x65, 0x44, 0x37,
+    0x3e, 0x66, 0x62, 0x61, 0xa5, 0x66, 0x01, 0x67, 0x65, 0xaf, 0x66, 0x00, 0x65, 0xa1, 0x88, 0x03,
+    0x6e, 0x66, 0x66, 0x67, 0x82, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x01, 0x67, 0x67, 0x84, 0x66, 0x00,
+    0x70, 0x83, 0x88, 0x00, 0x87, 0x90, 0x88, 0x9e, 0x66, 0x02, 0x65, 0x66, 0x67, 0x82, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x03, 0x64, 0x66, 0x61, 0x58, 0xb3, 0x66, 0x00, 0x67, 0x85, 0x66, 0x03, 0x5e,
+    0x41, 0x22, 0x05, 0x82, 0x00, 0x06, 0x0a, 0x29, 0x49, 0x63, 0x66, 0x66, 0x65, 0xb0, 0x66, 0x01,
+    0x65, 0x67, 0x84, 0x66, 0x0e, 0x22, 0x00, 0x46, 0x66, 0x66, 0x65, 0x66, 0x67, 0x18, 0x00, 0x51,
+    0x65, 0x66, 0x66, 0x67, 0x85, 0x66, 0x00, 0x65, 0xbc, 0x66, 0x04, 0x65, 0x65, 0x66, 0x66, 0x67,
+    0xa4, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xad, 0x66, 0xa1, 0x88, 0x00, 0x7a, 0xc2, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x00, 0x79, 0x95, 0x88, 0x9f, 0x66, 0x04, 0x3c, 0x06, 0x2e, 0x66, 0x67, 0x85,
+    0x66, 0x02, 0x4a, 0x03, 0x1f, 0xb6, 0x66, 0x0a, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x63,
+    0x4a, 0x2a, 0x0a, 0x82, 0x00, 0x03, 0x04, 0x20, 0x3e, 0x5c, 0xb3, 0x66, 0x00, 0x67, 0x82, 0x66,
+    0x02, 0x22, 0x00, 0x3d, 0x82, 0x5e, 0x04, 0x5d, 0x5e, 0x16, 0x00, 0x4c, 0x84, 0x5e, 0x02, 0x5c,
+    0x58, 0x51, 0x83, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x00, 0x65, 0xda, 0x66, 0x00, 0x65, 0xa1, 0x88,
+    0x01, 0x80, 0x75, 0xc3, 0x66, 0x03, 0x65, 0x66, 0x74, 0x7f, 0x95, 0x88, 0x9a, 0x66, 0x00, 0x65,
+    0x83, 0x66, 0x02, 0x3e, 0x00, 0x33, 0x82, 0x66, 0x07, 0x67, 0x66, 0x65, 0x66, 0x67, 0x62, 0x06,
+    0x0a, 0xb5, 0x66, 0x00, 0x65, 0x89, 0x66, 0x08, 0x67, 0x51, 0x33, 0x14, 0x00, 0x00, 0x01, 0x00,
+    0x1c, 0xb6, 0x66, 0x00, 0x21, 0x90, 0x00, 0x00, 0x0e, 0x84, 0x66, 0x00, 0x65, 0xb6, 0x66, 0x00,
+    0x67, 0xa7, 0x66, 0x00, 0x67, 0xb4, 0x66, 0xa1, 0x88, 0x05, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x67,
+    0xbe, 0x66, 0x04, 0x69, 0x6d, 0x7a, 0x80, 0x84, 0x95, 0x88, 0x9e, 0x66, 0x10, 0x67, 0x41, 0x00,
+    0x37, 0x66, 0x66, 0x67, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65, 0x07, 0x00, 0x5f, 0x65, 0xba, 0x66,
+    0x01, 0x67, 0x67, 0x83, 0x66, 0x06, 0x64, 0x4c, 0x2b, 0x00, 0x00, 0x01, 0x0e, 0xb5, 0x66, 0x01,
+    0x67, 0x1d, 0x85, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x0d, 0x66, 0x65, 0xbc, 0x66, 0x00, 0x67,
+    0xa6, 0x66, 0x00, 0x67, 0xb2, 0x66, 0x00, 0x65, 0xa1, 0x88, 0x07, 0x84, 0x7f, 0x79, 0x70, 0x69,
+    0x66, 0x66, 0x65, 0xb7, 0x66, 0x00, 0x65, 0x83, 0x66, 0x04, 0x69, 0x70, 0x7c, 0x7f, 0x84, 0x95,
+    0x88, 0x9a, 0x66, 0x07, 0x65, 0x66, 0x38, 0x39, 0x3f, 0x2b, 0x00, 0x24, 0x87, 0x43, 0x03, 0x2b,
+    0x00, 0x01, 0x63, 0xb6, 0x66, 0x00, 0x67, 0x86, 0x66, 0x09, 0x55, 0x39, 0x1d, 0x03, 0x01, 0x00,
+    0x00, 0x02, 0x1c, 0x3c, 0xb4, 0x66, 0x06, 0x65, 0x66, 0x55, 0x4e, 0x55, 0x5c, 0x5b, 0x84, 0x5c,
+    0x00, 0x5b, 0x84, 0x5c, 0x04, 0x5a, 0x55, 0x53, 0x65, 0x65, 0x82, 0x66, 0x00, 0x65, 0xdf, 0x66,
+    0x00, 0x69, 0xb3, 0x66, 0x00, 0x68, 0xa1, 0x88, 0x02, 0x7f, 0x74, 0x65, 0xc4, 0x66, 0x01, 0x76,
+    0x7f, 0x95, 0x88, 0x97, 0x66, 0x05, 0x65, 0x66, 0x67, 0x66, 0x66, 0x06, 0x8e, 0x00, 0x01, 0x25,
+    0x67, 0xb6, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x5d, 0x42, 0x26, 0x0b, 0x83, 0x00, 0x03, 0x0c,
+    0x29, 0x46, 0x61, 0xb8, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x8b, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x00, 0x67, 0xb3, 0x66, 0x00, 0x65, 0x8a, 0x66, 0x00, 0x65, 0xa2, 0x66, 0x00, 0x6f, 0xaf, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x00, 0x71, 0xa1, 0x88, 0x03, 0x7a, 0x66, 0x67, 0x64, 0xc3, 0x66, 0x01,
+    0x67, 0x7b, 0x95, 0x88, 0x9b, 0x66, 0x06, 0x67, 0x11, 0x0f, 0x16, 0x10, 0x00, 0x0a, 0x83, 0x19,
+    0x00, 0x1a, 0x82, 0x19, 0x02, 0x1e, 0x31, 0x5f, 0xb7, 0x66, 0x0b, 0x5b, 0x48, 0x2f, 0x13, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x19, 0x36, 0x54, 0xff, 0x66, 0xb5, 0x66, 0x00, 0x79, 0x82, 0x66, 0x00,
+    0x65, 0xa8, 0x66, 0x00, 0x67, 0x85, 0x66, 0x01, 0x79, 0x87, 0xa0, 0x88, 0x00, 0x6f, 0xc6, 0x66,
+    0x01, 0x67, 0x6f, 0x95, 0x88, 0x9e, 0x66, 0x03, 0x65, 0x41, 0x00, 0x36, 0x89, 0x66, 0x01, 0x65,
+    0x65, 0xb2, 0x66, 0x03, 0x65, 0x66, 0x66, 0x25, 0x84, 0x00, 0x05, 0x09, 0x26, 0x44, 0x60, 0x66,
+    0x67, 0xff, 0x66, 0xb6, 0x66, 0x01, 0x7f, 0x76, 0xab, 0x66, 0x02, 0x65, 0x66, 0x65, 0x82, 0x66,
+    0x01, 0x74, 0x7f, 0xa1, 0x88, 0x05, 0x69, 0x66, 0x65, 0x66, 0x66, 0x65, 0xc2, 0x66, 0x00, 0x69,
+    0x95, 0x88, 0x9f, 0x66, 0x02, 0x3d, 0x00, 0x30, 0xbc, 0x66, 0x0c, 0x65, 0x66, 0x66, 0x65, 0x66,
+    0x22, 0x01, 0x01, 0x16, 0x34, 0x52, 0x66, 0x67, 0x83, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0xcc,
+    0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xe1, 0x66, 0x04, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0xab, 0x66,
+    0x04, 0x69, 0x6d, 0x7a, 0x7f, 0x84, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x06, 0x3f,
+    0x0c, 0x33, 0x66, 0x65, 0x66, 0x65, 0x82, 0x66, 0x04, 0x65, 0x66, 0x66, 0x67, 0x65, 0xb5, 0x66,
+    0x03, 0x32, 0x3a, 0x5c, 0x65, 0x82, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x65, 0xcd, 0x66, 0x03,
+    0x67, 0x66, 0x66, 0x65, 0xe1, 0x66, 0x06, 0x84, 0x7f, 0x79, 0x70, 0x67, 0x66, 0x65, 0xa0, 0x66,
+    0x00, 0x67, 0x84, 0x66, 0x07, 0x67, 0x65, 0x66, 0x68, 0x70, 0x79, 0x7f, 0x84, 0xa1, 0x88, 0x84,
+    0x66, 0x00, 0x65, 0xc3, 0x66, 0x95, 0x88, 0x98, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x02, 0x65, 0x66, 0x65, 0xc3, 0x66, 0x00, 0x67, 0x87, 0x66, 0x04, 0x65, 0x67, 0x66, 0x66,
+    0x67, 0xff, 0x66, 0xb1, 0x66, 0x04, 0x7f, 0x74, 0x66, 0x66, 0x67, 0xa7, 0x66, 0x00, 0x65, 0x85,
+    0x66, 0x01, 0x75, 0x7f, 0xa1, 0x88, 0xc7, 0x66, 0x01, 0x67, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x00,
+    0x68, 0x83, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0xb4, 0x66, 0x00, 0x65, 0x87, 0x66, 0x00,
+    0x67, 0xff, 0x66, 0xbd, 0x66, 0x03, 0x7a, 0x65, 0x67, 0x67, 0xac, 0x66, 0x04, 0x67, 0x65, 0x66,
+    0x66, 0x79, 0xa1, 0x88, 0x03, 0x66, 0x66, 0x65, 0x65, 0xc5, 0x66, 0x82, 0x88, 0x00, 0x87, 0x91,
+    0x88, 0x9a, 0x66, 0x05, 0x25, 0x09, 0x0e, 0x10, 0x11, 0x10, 0x86, 0x11, 0x07, 0x12, 0x11, 0x12,
+    0x0f, 0x0a, 0x10, 0x66, 0x65, 0xc2, 0x66, 0x03, 0x65, 0x67, 0x66, 0x65, 0xff, 0x66, 0xb0, 0x66,
+    0x00, 0x6f, 0xb0, 0x66, 0x03, 0x65, 0x66, 0x66, 0x70, 0xa1, 0x88, 0x82, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x67, 0xc2, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x00, 0x22, 0x83, 0x00, 0x00, 0x01, 0x88, 0x00,
+    0x03, 0x01, 0x00, 0x00, 0x0e, 0xb1, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0xff, 0x66, 0xc2,
+    0x66, 0x00, 0x69, 0xae, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x9a, 0x66, 0x02, 0x4c, 0x43, 0x4a, 0x82, 0x4b, 0x00, 0x4a, 0x82, 0x4b, 0x00, 0x4a, 0x84,
+    0x4b, 0x02, 0x49, 0x44, 0x46, 0xff, 0x66, 0xff, 0x66, 0xaf, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x9a, 0x66, 0x00, 0x65, 0x86, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0xb9, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xa8, 0x66, 0x05, 0x67, 0x66, 0x66, 0x4b, 0x2a, 0x67, 0xff, 0x66,
+    0xff, 0x66, 0xae, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x03, 0x67, 0x66, 0x66,
+    0x65, 0x83, 0x66, 0x01, 0x67, 0x67, 0x84, 0x66, 0x05, 0x65, 0x61, 0x3d, 0x11, 0x00, 0x0f, 0xff,
+    0x66, 0xff, 0x66, 0xaf, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0x83, 0x66, 0x00, 0x67, 0x82, 0x66, 0x06, 0x53, 0x2a, 0x05, 0x01, 0x00, 0x00, 0x0f,
+    0xff, 0x66, 0xff, 0x66, 0xaf, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x97, 0x66, 0x00, 0x67,
+    0x85, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x62, 0x40, 0x16, 0x82, 0x00, 0x03, 0x01, 0x22, 0x41,
+    0x60, 0xff, 0x66, 0xff, 0x66, 0xaf, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x00,
+    0x65, 0x85, 0x66, 0x02, 0x56, 0x2d, 0x07, 0x82, 0x00, 0x02, 0x0e, 0x37, 0x5e, 0xff, 0x66, 0xff,
+    0x66, 0xb2, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9e, 0x66, 0x02, 0x65, 0x43, 0x19, 0x82,
+    0x00, 0x04, 0x07, 0x06, 0x00, 0x46, 0x67, 0x84, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0xad,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x06, 0x67, 0x65, 0x65, 0x66, 0x58, 0x30,
+    0x08, 0x82, 0x00, 0x08, 0x1a, 0x42, 0x64, 0x26, 0x00, 0x46, 0x65, 0x66, 0x67, 0xff, 0x66, 0xff,
+    0x66, 0xb0, 0x66, 0x00, 0x67, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x03, 0x65, 0x67,
+    0x48, 0x1c, 0x82, 0x00, 0x08, 0x0a, 0x2f, 0x58, 0x66, 0x67, 0x66, 0x26, 0x00, 0x46, 0xff, 0x66,
+    0xff, 0x66, 0xb4, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x06, 0x21, 0x00, 0x00,
+    0x1e, 0x46, 0x64, 0x67, 0x82, 0x66, 0x05, 0x67, 0x26, 0x00, 0x47, 0x66, 0x67, 0xff, 0x66, 0xff,
+    0x66, 0xb2, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x97, 0x66, 0x08, 0x65, 0x66, 0x67, 0x21,
+    0x00, 0x00, 0x1f, 0x46, 0x64, 0x84, 0x66, 0x02, 0x26, 0x00, 0x46, 0xff, 0x66, 0xff, 0x66, 0xb3,
+    0x66, 0x00, 0x65, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x09, 0x65, 0x66, 0x47, 0x1c,
+    0x01, 0x00, 0x00, 0x09, 0x30, 0x56, 0x82, 0x66, 0x02, 0x26, 0x00, 0x46, 0xff, 0x66, 0xff, 0x66,
+    0xb3, 0x66, 0x00, 0x65, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9c, 0x66, 0x02, 0x5a, 0x32, 0x0a,
+    0x82, 0x00, 0x09, 0x18, 0x40, 0x63, 0x26, 0x00, 0x47, 0x66, 0x67, 0x66, 0x65, 0xff, 0x66, 0xff,
+    0x66, 0xb0, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9e, 0x66, 0x02, 0x64, 0x45, 0x1c, 0x82,
+    0x00, 0x03, 0x05, 0x09, 0x00, 0x46, 0x82, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0xb0, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x97, 0x66, 0x82, 0x65, 0x86, 0x66, 0x02, 0x58, 0x2f, 0x07,
+    0x82, 0x00, 0x02, 0x0d, 0x35, 0x5c, 0x82, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0xad, 0x66,
+    0x00, 0x67, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa2, 0x66, 0x03, 0x67, 0x65, 0x42, 0x19, 0x82,
+    0x00, 0x05, 0x02, 0x1e, 0x3f, 0x5e, 0x65, 0x67, 0x9b, 0x66, 0x00, 0x65, 0xff, 0x66, 0x8b, 0x66,
+    0x06, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xbf, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67,
+    0x9b, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0xa6, 0x66, 0x02, 0x55, 0x2c, 0x06, 0x82, 0x00, 0x00, 0x0f, 0x9e, 0x66, 0x01, 0x67, 0x67, 0xff,
+    0x66, 0xd5, 0x66, 0x00, 0x65, 0xb7, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa0, 0x66, 0x03,
+    0x67, 0x66, 0x66, 0x65, 0x83, 0x66, 0x04, 0x62, 0x40, 0x16, 0x00, 0x0e, 0xe5, 0x66, 0x00, 0x65,
+    0xc2, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0xc5, 0x66, 0x00, 0x65, 0xb8, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x00, 0x67, 0x8a, 0x66, 0x03, 0x4f, 0x2c, 0x66, 0x67, 0x9b,
+    0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xc1, 0x66, 0x03, 0x67, 0x66, 0x67, 0x67, 0xc6, 0x66, 0x00,
+    0x67, 0xc5, 0x66, 0x00, 0x65, 0x95, 0x66, 0x01, 0x67, 0x65, 0x87, 0x66, 0x00, 0x65, 0x97, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa7, 0x66, 0x02, 0x67, 0x66, 0x65, 0x9e, 0x66, 0x00, 0x69,
+    0xc7, 0x66, 0x01, 0x68, 0x69, 0xc7, 0x66, 0x01, 0x68, 0x69, 0xc7, 0x66, 0x00, 0x68, 0x9e, 0x66,
+    0x00, 0x65, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa3, 0x66, 0x00, 0x65, 0x88, 0x66,
+    0x00, 0x65, 0x9a, 0x66, 0x00, 0x6e, 0xc7, 0x66, 0x03, 0x70, 0x6e, 0x66, 0x67, 0xc5, 0x66, 0x01,
+    0x70, 0x6e, 0xc7, 0x66, 0x00, 0x71, 0x8f, 0x66, 0x08, 0x67, 0x66, 0x66, 0x65, 0x67, 0x66, 0x66,
+    0x65, 0x65, 0x84, 0x66, 0x00, 0x67, 0x96, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa1, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x01, 0x65, 0x67, 0xa1, 0x66, 0x05, 0x79, 0x65, 0x67, 0x66, 0x66, 0x65,
+    0xc1, 0x66, 0x02, 0x65, 0x79, 0x79, 0xc7, 0x66, 0x02, 0x79, 0x79, 0x67, 0xbf, 0x66, 0x03, 0x67,
+    0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x79, 0x99, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0x95,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa0, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0x83,
+    0x66, 0x00, 0x65, 0x9c, 0x66, 0x03, 0x81, 0x75, 0x66, 0x65, 0xc1, 0x66, 0x06, 0x67, 0x66, 0x74,
+    0x7f, 0x7f, 0x76, 0x65, 0xc3, 0x66, 0x04, 0x67, 0x74, 0x80, 0x7f, 0x75, 0xbf, 0x66, 0x00, 0x65,
+    0x84, 0x66, 0x01, 0x74, 0x7f, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x04,
+    0x84, 0x7f, 0x79, 0x6e, 0x68, 0xba, 0x66, 0x11, 0x67, 0x65, 0x66, 0x67, 0x66, 0x68, 0x6f, 0x7a,
+    0x7f, 0x84, 0x84, 0x7f, 0x78, 0x6e, 0x68, 0x66, 0x67, 0x67, 0xbc, 0x66, 0x0a, 0x68, 0x6e, 0x7a,
+    0x7f, 0x84, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x65, 0xbe, 0x66, 0x04, 0x69, 0x6d, 0x7a, 0x7f, 0x84,
+    0x95, 0x66, 0x08, 0x60, 0x4f, 0x47, 0x41, 0x41, 0x4c, 0x58, 0x63, 0x67, 0x96, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x05, 0x85, 0x7f, 0x7a, 0x70, 0x69, 0x65, 0xbe, 0x66, 0x09,
+    0x69, 0x70, 0x7b, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x70, 0x6a, 0xbf, 0x66, 0x09, 0x68, 0x70, 0x7a,
+    0x7f, 0x84, 0x85, 0x7f, 0x79, 0x70, 0x68, 0xbd, 0x66, 0x06, 0x65, 0x66, 0x68, 0x70, 0x79, 0x7f,
+    0x84, 0x90, 0x66, 0x05, 0x67, 0x66, 0x66, 0x43, 0x12, 0x01, 0x86, 0x00, 0x04, 0x08, 0x26, 0x4d,
+    0x66, 0x65, 0x92, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x67, 0xa0, 0x66,
+    0x95, 0x88, 0xa8, 0x66, 0x05, 0x67, 0x66, 0x65, 0x67, 0x66, 0x65, 0x9a, 0x66, 0x01, 0x7f, 0x74,
+    0x82, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x00, 0x67, 0x86, 0x66, 0x03, 0x75, 0x7f, 0x7f, 0x74, 0x83,
+    0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0xbb, 0x66, 0x03, 0x75, 0x7e, 0x7f, 0x74, 0x86, 0x66,
+    0x00, 0x67, 0xbd, 0x66, 0x01, 0x76, 0x7f, 0x8f, 0x66, 0x03, 0x67, 0x67, 0x60, 0x24, 0x86, 0x00,
+    0x02, 0x17, 0x17, 0x05, 0x82, 0x00, 0x01, 0x23, 0x62, 0x92, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x03,
+    0x67, 0x66, 0x66, 0x67, 0x86, 0x66, 0x00, 0x65, 0xa0, 0x66, 0x95, 0x88, 0xc7, 0x66, 0x02, 0x65,
+    0x66, 0x7a, 0x82, 0x66, 0x01, 0x65, 0x67, 0xbc, 0x66, 0x0b, 0x65, 0x65, 0x66, 0x66, 0x67, 0x66,
+    0x7a, 0x7a, 0x67, 0x66, 0x66, 0x67, 0xc3, 0x66, 0x01, 0x7a, 0x7a, 0xc3, 0x66, 0x04, 0x68, 0x65,
+    0x66, 0x66, 0x79, 0x90, 0x66, 0x13, 0x64, 0x11, 0x00, 0x02, 0x31, 0x4e, 0x56, 0x42, 0x14, 0x00,
+    0x0d, 0x62, 0x65, 0x50, 0x27, 0x02, 0x00, 0x24, 0x66, 0x67, 0x90, 0x66, 0xa1, 0x88, 0x9c, 0x66,
+    0x00, 0x67, 0x86, 0x66, 0x00, 0x65, 0xa3, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x00, 0x6f, 0xbc, 0x66,
+    0x01, 0x65, 0x67, 0x84, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x6f, 0x6f, 0x85, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x00, 0x67, 0xb8, 0x66, 0x06, 0x67, 0x66, 0x66, 0x67, 0x70, 0x70, 0x65, 0x82, 0x66,
+    0x01, 0x65, 0x67, 0xbc, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x70, 0x90, 0x66, 0x03, 0x38, 0x00,
+    0x05, 0x54, 0x83, 0x66, 0x03, 0x64, 0x23, 0x00, 0x2c, 0x82, 0x66, 0x03, 0x46, 0x02, 0x00, 0x3a,
+    0x91, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x65, 0xa0, 0x66, 0x95, 0x88,
+    0xc8, 0x66, 0x05, 0x65, 0x69, 0x66, 0x67, 0x66, 0x65, 0xbc, 0x66, 0x00, 0x67, 0x85, 0x66, 0x01,
+    0x68, 0x69, 0xc3, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x68, 0x69, 0x66, 0x65, 0x83, 0x66, 0x00,
+    0x65, 0xc0, 0x66, 0x00, 0x68, 0x90, 0x66, 0x02, 0x17, 0x00, 0x3a, 0x84, 0x66, 0x0c, 0x65, 0x5f,
+    0x08, 0x01, 0x5b, 0x66, 0x66, 0x67, 0x41, 0x00, 0x17, 0x66, 0x67, 0x8f, 0x66, 0xa1, 0x88, 0xa5,
+    0x66, 0x00, 0x67, 0xa2, 0x66, 0x95, 0x88, 0xca, 0x66, 0x02, 0x68, 0x66, 0x67, 0xba, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x89, 0x66, 0x00, 0x67, 0xbb, 0x66, 0x00, 0x67,
+    0x88, 0x66, 0x02, 0x67, 0x66, 0x65, 0xd1, 0x66, 0x03, 0x65, 0x02, 0x00, 0x5d, 0x86, 0x66, 0x02,
+    0x25, 0x00, 0x4a, 0x82, 0x66, 0x03, 0x61, 0x01, 0x05, 0x65, 0x90, 0x66, 0xa1, 0x88, 0x9f, 0x66,
+    0x04, 0x61, 0x64, 0x66, 0x66, 0x65, 0xa4, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x00, 0x65, 0xc2, 0x66,
+    0x00, 0x67, 0xc9, 0x66, 0x01, 0x65, 0x65, 0xdc, 0x66, 0x14, 0x65, 0x02, 0x02, 0x65, 0x66, 0x65,
+    0x67, 0x66, 0x66, 0x65, 0x65, 0x32, 0x00, 0x3a, 0x66, 0x65, 0x66, 0x66, 0x11, 0x00, 0x58, 0x90,
+    0x66, 0xa1, 0x88, 0x99, 0x66, 0x0b, 0x65, 0x66, 0x65, 0x67, 0x66, 0x66, 0x38, 0x04, 0x2e, 0x66,
+    0x66, 0x65, 0xa3, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x11, 0x00, 0x53,
+    0x86, 0x66, 0x09, 0x29, 0x00, 0x3a, 0x66, 0x67, 0x66, 0x66, 0x08, 0x00, 0x5e, 0x90, 0x66, 0xa1,
+    0x88, 0x9b, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x2e, 0x00, 0x2e, 0x83, 0x66, 0x03, 0x65, 0x66,
+    0x66, 0x65, 0x9e, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb6, 0x66, 0x05, 0x65, 0x67, 0x22,
+    0x00, 0x31, 0x67, 0x84, 0x66, 0x03, 0x62, 0x0c, 0x01, 0x4f, 0x82, 0x66, 0x02, 0x4d, 0x00, 0x07,
+    0x91, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x00, 0x65, 0x82, 0x66, 0x05, 0x65, 0x66, 0x66, 0x2f, 0x00,
+    0x36, 0x82, 0x66, 0x00, 0x65, 0xa2, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03,
+    0x47, 0x00, 0x00, 0x3f, 0x83, 0x66, 0x0a, 0x63, 0x26, 0x00, 0x04, 0x63, 0x66, 0x66, 0x59, 0x0e,
+    0x00, 0x26, 0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x0a, 0x65, 0x66, 0x67,
+    0x3c, 0x00, 0x22, 0x66, 0x65, 0x66, 0x66, 0x67, 0x86, 0x66, 0x00, 0x65, 0x99, 0x66, 0x95, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xb5, 0x66, 0x00, 0x67, 0x82, 0x66, 0x14, 0x20, 0x00, 0x01, 0x21, 0x3c,
+    0x43, 0x33, 0x0e, 0x00, 0x00, 0x3f, 0x67, 0x66, 0x49, 0x03, 0x00, 0x03, 0x5a, 0x66, 0x67, 0x67,
+    0x8e, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x67, 0x83, 0x66, 0x0e, 0x5e, 0x04, 0x02, 0x4e, 0x66,
+    0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x65, 0x66, 0x66, 0x67, 0x9a, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xb5, 0x66, 0x05, 0x65, 0x66, 0x67, 0x65, 0x60, 0x24, 0x85, 0x00, 0x09, 0x03, 0x33,
+    0x67, 0x66, 0x66, 0x59, 0x00, 0x06, 0x4a, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xa0, 0x66, 0x0a, 0x3a,
+    0x00, 0x07, 0x42, 0x64, 0x65, 0x66, 0x66, 0x65, 0x66, 0x67, 0x82, 0x66, 0x00, 0x65, 0x99, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbb, 0x66, 0x06, 0x4a, 0x2c, 0x19, 0x0d, 0x1c, 0x2e, 0x56,
+    0x84, 0x66, 0x01, 0x3a, 0x5e, 0x93, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x06, 0x48, 0x11, 0x00, 0x01,
+    0x00, 0x03, 0x10, 0x83, 0x11, 0x02, 0x0f, 0x0a, 0x10, 0x9b, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xb6, 0x66, 0x00, 0x67, 0x89, 0x66, 0x02, 0x67, 0x66, 0x67, 0x86, 0x66, 0x00, 0x67, 0x90,
+    0x66, 0xa1, 0x88, 0x9f, 0x66, 0x00, 0x42, 0x8b, 0x00, 0x00, 0x0e, 0x9b, 0x66, 0x95, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xb8, 0x66, 0x03, 0x2c, 0x1a, 0x42, 0x67, 0x83, 0x66, 0x02, 0x65, 0x66, 0x67,
+    0x99, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x67, 0x83, 0x66, 0x06, 0x5a, 0x40, 0x48, 0x4a, 0x4b,
+    0x4a, 0x4a, 0x83, 0x4b, 0x02, 0x4a, 0x44, 0x46, 0x9b, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb8, 0x66, 0x02, 0x1b, 0x00, 0x3e, 0x84, 0x66, 0x04, 0x3d, 0x3a, 0x5a, 0x66, 0x65, 0x97, 0x66,
+    0xa1, 0x88, 0x9a, 0x66, 0x00, 0x65, 0x8a, 0x66, 0x00, 0x67, 0xa1, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xb8, 0x66, 0x0c, 0x21, 0x00, 0x43, 0x66, 0x66, 0x67, 0x66, 0x66, 0x0c, 0x00, 0x48,
+    0x66, 0x65, 0x97, 0x66, 0xa1, 0x88, 0xa1, 0x66, 0x0d, 0x65, 0x67, 0x66, 0x65, 0x5c, 0x5d, 0x66,
+    0x66, 0x64, 0x66, 0x66, 0x65, 0x66, 0x67, 0x99, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8,
+    0x66, 0x02, 0x22, 0x00, 0x45, 0x84, 0x66, 0x02, 0x16, 0x00, 0x50, 0x99, 0x66, 0xa1, 0x88, 0x9b,
+    0x66, 0x00, 0x65, 0x85, 0x66, 0x09, 0x43, 0x1e, 0x05, 0x00, 0x22, 0x66, 0x63, 0x0a, 0x32, 0x64,
+    0x9c, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03, 0x22, 0x00, 0x46, 0x67, 0x83,
+    0x66, 0x05, 0x17, 0x00, 0x52, 0x66, 0x66, 0x65, 0x83, 0x66, 0x01, 0x67, 0x65, 0x90, 0x66, 0xa1,
+    0x88, 0x98, 0x66, 0x00, 0x65, 0x82, 0x66, 0x05, 0x65, 0x66, 0x66, 0x65, 0x62, 0x1e, 0x83, 0x00,
+    0x06, 0x22, 0x66, 0x43, 0x00, 0x00, 0x24, 0x67, 0x9b, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb8, 0x66, 0x02, 0x22, 0x00, 0x46, 0x83, 0x66, 0x06, 0x67, 0x18, 0x00, 0x52, 0x66, 0x66, 0x65,
+    0x83, 0x66, 0x01, 0x67, 0x65, 0x90, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x00, 0x65, 0x87, 0x66, 0x0c,
+    0x25, 0x00, 0x05, 0x37, 0x47, 0x00, 0x22, 0x66, 0x63, 0x2b, 0x00, 0x00, 0x46, 0x9b, 0x66, 0x95,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03, 0x22, 0x00, 0x46, 0x65, 0x83, 0x66, 0x06, 0x18,
+    0x00, 0x51, 0x66, 0x66, 0x65, 0x67, 0x95, 0x66, 0xa1, 0x88, 0x9e, 0x66, 0x08, 0x67, 0x53, 0x00,
+    0x05, 0x56, 0x66, 0x59, 0x00, 0x23, 0x82, 0x66, 0x02, 0x3d, 0x00, 0x14, 0x9b, 0x66, 0x95, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03, 0x22, 0x00, 0x46, 0x67, 0x82, 0x66, 0x03, 0x67, 0x18,
+    0x00, 0x53, 0x99, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x11, 0x67, 0x67, 0x65, 0x33, 0x00, 0x36, 0x66,
+    0x66, 0x59, 0x00, 0x22, 0x67, 0x66, 0x65, 0x62, 0x03, 0x02, 0x64, 0x9a, 0x66, 0x95, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xb7, 0x66, 0x04, 0x65, 0x22, 0x00, 0x46, 0x67, 0x83, 0x66, 0x04, 0x18, 0x00,
+    0x52, 0x65, 0x65, 0x97, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x07, 0x23, 0x00, 0x4e, 0x66, 0x66, 0x58,
+    0x00, 0x22, 0x83, 0x66, 0x03, 0x1a, 0x00, 0x56, 0x67, 0x99, 0x66, 0x95, 0x88, 0xc1, 0x66, 0x00,
+    0x65, 0x88, 0x66, 0x00, 0x65, 0xff, 0x66, 0xeb, 0x66, 0x02, 0x22, 0x00, 0x3e, 0x84, 0x5e, 0x02,
+    0x16, 0x00, 0x4d, 0x84, 0x5e, 0x02, 0x5c, 0x58, 0x51, 0x91, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x0e,
+    0x2a, 0x00, 0x48, 0x66, 0x66, 0x59, 0x00, 0x22, 0x66, 0x67, 0x66, 0x66, 0x11, 0x00, 0x58, 0x9a,
+    0x66, 0x95, 0x88, 0x85, 0x66, 0x00, 0x67, 0xb8, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0x87, 0x66,
+    0x00, 0x65, 0xff, 0x66, 0xea, 0x66, 0x01, 0x67, 0x21, 0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x89,
+    0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x00, 0x65, 0x85, 0x66, 0x0e, 0x3e, 0x00,
+    0x2b, 0x66, 0x66, 0x59, 0x00, 0x22, 0x67, 0x67, 0x66, 0x5a, 0x00, 0x05, 0x64, 0x9a, 0x66, 0x95,
+    0x88, 0x00, 0x65, 0x85, 0x66, 0x00, 0x67, 0xb8, 0x66, 0x02, 0x67, 0x66, 0x65, 0x82, 0x66, 0x00,
+    0x65, 0x86, 0x66, 0x00, 0x65, 0xff, 0x66, 0xe8, 0x66, 0x00, 0x1d, 0x90, 0x00, 0x00, 0x0d, 0x91,
+    0x66, 0xa1, 0x88, 0x98, 0x66, 0x00, 0x67, 0x85, 0x66, 0x0d, 0x57, 0x02, 0x00, 0x3f, 0x66, 0x59,
+    0x00, 0x22, 0x67, 0x66, 0x62, 0x13, 0x00, 0x2a, 0x9b, 0x66, 0x95, 0x88, 0x02, 0x69, 0x66, 0x65,
+    0xbe, 0x66, 0x00, 0x65, 0x85, 0x66, 0x03, 0x68, 0x66, 0x66, 0x67, 0xff, 0x66, 0xeb, 0x66, 0x02,
+    0x55, 0x4f, 0x56, 0x84, 0x5c, 0x00, 0x5d, 0x86, 0x5c, 0x04, 0x5a, 0x55, 0x53, 0x66, 0x65, 0x8f,
+    0x66, 0xa1, 0x88, 0x9d, 0x66, 0x0f, 0x65, 0x66, 0x66, 0x35, 0x00, 0x00, 0x26, 0x3d, 0x00, 0x1c,
+    0x50, 0x3a, 0x0c, 0x01, 0x08, 0x58, 0x9b, 0x66, 0x95, 0x88, 0x03, 0x6e, 0x66, 0x66, 0x67, 0x82,
+    0x66, 0x00, 0x67, 0xb9, 0x66, 0x02, 0x67, 0x66, 0x67, 0x83, 0x66, 0x01, 0x70, 0x67, 0xff, 0x66,
+    0xf0, 0x66, 0x00, 0x65, 0x87, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65,
+    0x8d, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x05, 0x67, 0x66, 0x66, 0x65, 0x2d, 0x01, 0x82, 0x00, 0x00,
+    0x01, 0x82, 0x00, 0x01, 0x0a, 0x53, 0x9c, 0x66, 0x95, 0x88, 0x03, 0x79, 0x66, 0x66, 0x65, 0xc3,
+    0x66, 0x02, 0x67, 0x79, 0x65, 0xff, 0x66, 0xff, 0x66, 0x00, 0x65, 0x91, 0x66, 0xa1, 0x88, 0xa2,
+    0x66, 0x08, 0x56, 0x28, 0x15, 0x06, 0x00, 0x0c, 0x19, 0x3c, 0x63, 0x82, 0x66, 0x00, 0x67, 0x99,
+    0x66, 0x95, 0x88, 0x04, 0x7f, 0x74, 0x66, 0x66, 0x67, 0xc0, 0x66, 0x03, 0x64, 0x65, 0x74, 0x7f,
+    0xff, 0x66, 0xf2, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0x8b, 0x66, 0x00, 0x67, 0x8f, 0x66, 0xa1,
+    0x88, 0xa1, 0x66, 0x06, 0x65, 0x66, 0x67, 0x66, 0x67, 0x66, 0x65, 0x82, 0x66, 0x01, 0x61, 0x58,
+    0x9b, 0x66, 0x95, 0x88, 0x04, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0xbc, 0x66, 0x07, 0x65, 0x66, 0x66,
+    0x69, 0x6e, 0x7b, 0x7f, 0x84, 0x82, 0x66, 0x00, 0x67, 0xff, 0x66, 0xeb, 0x66, 0x00, 0x67, 0x87,
+    0x66, 0x09, 0x67, 0x65, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x65, 0x90, 0x66, 0xa1, 0x88,
+    0x9a, 0x66, 0x01, 0x67, 0x65, 0x82, 0x66, 0x0d, 0x3c, 0x05, 0x2e, 0x66, 0x66, 0x67, 0x66, 0x66,
+    0x67, 0x67, 0x66, 0x4a, 0x02, 0x1f, 0x9b, 0x66, 0x95, 0x88, 0x04, 0x84, 0x7f, 0x79, 0x70, 0x69,
+    0xba, 0x66, 0x09, 0x67, 0x66, 0x66, 0x65, 0x66, 0x68, 0x70, 0x7b, 0x7f, 0x85, 0x9e, 0x66, 0x00,
+    0x65, 0x84, 0x66, 0x00, 0x65, 0xc2, 0x66, 0x01, 0x67, 0x67, 0x89, 0x66, 0x00, 0x67, 0x82, 0x66,
+    0x00, 0x67, 0xb5, 0x66, 0x00, 0x65, 0x85, 0x66, 0x01, 0x67, 0x65, 0x88, 0x66, 0x00, 0x65, 0xd0,
+    0x66, 0xa1, 0x88, 0x9a, 0x66, 0x07, 0x67, 0x66, 0x66, 0x65, 0x66, 0x3e, 0x00, 0x33, 0x87, 0x66,
+    0x02, 0x63, 0x07, 0x0a, 0x9b, 0x66, 0x95, 0x88, 0x04, 0x7f, 0x74, 0x65, 0x66, 0x65, 0xc2, 0x66,
+    0x01, 0x76, 0x7f, 0x9c, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x8f, 0x66, 0x00, 0x67, 0xb4, 0x66,
+    0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0x83, 0x66, 0x01, 0x67, 0x65, 0x82, 0x66, 0x03, 0x65, 0x65,
+    0x66, 0x67, 0xb3, 0x66, 0x03, 0x67, 0x29, 0x0d, 0x13, 0x88, 0x16, 0x00, 0x15, 0x82, 0x16, 0x04,
+    0x14, 0x10, 0x12, 0x67, 0x65, 0xcf, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x07, 0x65, 0x66, 0x66, 0x67,
+    0x66, 0x41, 0x00, 0x37, 0x85, 0x66, 0x06, 0x65, 0x66, 0x65, 0x08, 0x00, 0x5f, 0x65, 0x99, 0x66,
+    0x95, 0x88, 0x03, 0x7b, 0x66, 0x66, 0x65, 0xc3, 0x66, 0x01, 0x67, 0x7a, 0x95, 0x66, 0x00, 0x67,
+    0x87, 0x66, 0x0e, 0x46, 0x2a, 0x1d, 0x0f, 0x03, 0x0a, 0x13, 0x24, 0x42, 0x61, 0x66, 0x67, 0x66,
+    0x5b, 0x62, 0xb7, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x83, 0x66, 0x00, 0x64, 0x89, 0x66, 0x03,
+    0x65, 0x67, 0x66, 0x67, 0xb1, 0x66, 0x00, 0x21, 0x82, 0x00, 0x00, 0x01, 0x8c, 0x00, 0x00, 0x0e,
+    0xd1, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x06, 0x38, 0x39, 0x3f, 0x2b, 0x00, 0x24, 0x42, 0x82, 0x43,
+    0x07, 0x42, 0x43, 0x43, 0x42, 0x2c, 0x00, 0x02, 0x63, 0x9a, 0x66, 0x95, 0x88, 0x00, 0x6f, 0xc4,
+    0x66, 0x03, 0x67, 0x66, 0x67, 0x70, 0x9c, 0x66, 0x01, 0x42, 0x11, 0x88, 0x00, 0x07, 0x06, 0x37,
+    0x65, 0x5e, 0x0e, 0x19, 0x61, 0x65, 0xb8, 0x66, 0x0a, 0x63, 0x38, 0x1f, 0x11, 0x04, 0x00, 0x04,
+    0x15, 0x28, 0x39, 0x62, 0xba, 0x66, 0x00, 0x21, 0x82, 0x00, 0x01, 0x18, 0x39, 0x85, 0x48, 0x00,
+    0x47, 0x82, 0x48, 0x05, 0x46, 0x41, 0x41, 0x66, 0x66, 0x67, 0xce, 0x66, 0xa1, 0x88, 0x98, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x04, 0x06, 0x00, 0x00, 0x01, 0x01, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00,
+    0x01, 0x24, 0x67, 0x9a, 0x66, 0x95, 0x88, 0x02, 0x69, 0x66, 0x65, 0xc1, 0x66, 0x04, 0x67, 0x67,
+    0x65, 0x66, 0x68, 0x9b, 0x66, 0x00, 0x30, 0x82, 0x00, 0x0e, 0x18, 0x2c, 0x39, 0x43, 0x37, 0x23,
+    0x10, 0x01, 0x00, 0x00, 0x1e, 0x13, 0x01, 0x0b, 0x57, 0x82, 0x66, 0x01, 0x65, 0x67, 0xb2, 0x66,
+    0x02, 0x65, 0x3b, 0x0a, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x0c, 0x48, 0x67, 0x83, 0x66,
+    0x00, 0x67, 0xb3, 0x66, 0x0d, 0x5a, 0x37, 0x13, 0x00, 0x01, 0x00, 0x1f, 0x4d, 0x67, 0x67, 0x65,
+    0x67, 0x66, 0x67, 0x82, 0x66, 0x02, 0x65, 0x66, 0x67, 0xd0, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x07,
+    0x65, 0x66, 0x11, 0x0e, 0x16, 0x10, 0x00, 0x0a, 0x84, 0x19, 0x07, 0x1a, 0x19, 0x19, 0x1e, 0x31,
+    0x5f, 0x67, 0x65, 0x99, 0x66, 0x95, 0x88, 0x02, 0x66, 0x66, 0x67, 0xc4, 0x66, 0x02, 0x67, 0x66,
+    0x67, 0x97, 0x66, 0x06, 0x67, 0x66, 0x38, 0x00, 0x00, 0x1a, 0x4f, 0x86, 0x66, 0x01, 0x60, 0x2e,
+    0x82, 0x00, 0x03, 0x0e, 0x5a, 0x66, 0x65, 0xb5, 0x66, 0x0f, 0x67, 0x31, 0x00, 0x00, 0x03, 0x28,
+    0x3a, 0x48, 0x52, 0x46, 0x36, 0x24, 0x03, 0x00, 0x00, 0x27, 0xbb, 0x66, 0x0a, 0x4e, 0x20, 0x01,
+    0x00, 0x01, 0x16, 0x44, 0x65, 0x65, 0x66, 0x65, 0xd6, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x05, 0x67,
+    0x66, 0x41, 0x00, 0x36, 0x65, 0x82, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00,
+    0x65, 0x99, 0x66, 0x95, 0x88, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0xc4, 0x66, 0x00, 0x67, 0x97,
+    0x66, 0x04, 0x5d, 0x01, 0x00, 0x27, 0x65, 0x88, 0x66, 0x04, 0x60, 0x0e, 0x00, 0x00, 0x45, 0x84,
+    0x66, 0x00, 0x67, 0xb2, 0x66, 0x04, 0x48, 0x00, 0x00, 0x1f, 0x5a, 0x84, 0x66, 0x06, 0x65, 0x66,
+    0x56, 0x1b, 0x00, 0x00, 0x42, 0x82, 0x66, 0x00, 0x65, 0xb8, 0x66, 0x07, 0x58, 0x2b, 0x04, 0x00,
+    0x00, 0x0d, 0x3a, 0x61, 0xd7, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x06, 0x65, 0x64, 0x66, 0x66, 0x3e,
+    0x00, 0x30, 0x88, 0x66, 0x00, 0x65, 0x9c, 0x66, 0x95, 0x88, 0xc0, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x00, 0x67, 0x9a, 0x66, 0x05, 0x65, 0x66, 0x39, 0x00, 0x13, 0x62, 0x88, 0x66, 0x01, 0x5e, 0x15,
+    0x82, 0x00, 0x02, 0x20, 0x67, 0x65, 0x85, 0x66, 0x00, 0x65, 0xaf, 0x66, 0x06, 0x0b, 0x00, 0x26,
+    0x67, 0x65, 0x66, 0x65, 0x85, 0x66, 0x04, 0x65, 0x29, 0x00, 0x08, 0x5f, 0xb7, 0x66, 0x00, 0x67,
+    0x84, 0x66, 0x07, 0x5f, 0x36, 0x0b, 0x00, 0x00, 0x07, 0x31, 0x5c, 0x85, 0x66, 0x00, 0x65, 0xce,
+    0x66, 0xa1, 0x88, 0x9f, 0x66, 0x04, 0x3f, 0x0c, 0x32, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xa0,
+    0x66, 0x95, 0x88, 0xe3, 0x66, 0x13, 0x14, 0x00, 0x40, 0x65, 0x66, 0x65, 0x66, 0x67, 0x66, 0x66,
+    0x65, 0x66, 0x66, 0x4c, 0x03, 0x0a, 0x4c, 0x00, 0x02, 0x65, 0xb0, 0x66, 0x01, 0x67, 0x65, 0x83,
+    0x66, 0x03, 0x57, 0x00, 0x08, 0x5e, 0x8a, 0x66, 0x05, 0x63, 0x0c, 0x00, 0x3f, 0x66, 0x65, 0xb7,
+    0x66, 0x00, 0x67, 0x84, 0x66, 0x07, 0x64, 0x41, 0x14, 0x00, 0x00, 0x04, 0x28, 0x55, 0xd3, 0x66,
+    0xa1, 0x88, 0xa0, 0x66, 0x00, 0x67, 0x87, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0x9b, 0x66, 0x95,
+    0x88, 0xe3, 0x66, 0x05, 0x04, 0x00, 0x56, 0x66, 0x66, 0x67, 0x87, 0x66, 0x05, 0x49, 0x4f, 0x66,
+    0x0e, 0x00, 0x5a, 0xb6, 0x66, 0x02, 0x3c, 0x00, 0x28, 0x82, 0x66, 0x00, 0x67, 0x82, 0x66, 0x0b,
+    0x67, 0x66, 0x66, 0x65, 0x66, 0x66, 0x37, 0x00, 0x2e, 0x66, 0x66, 0x67, 0xbb, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x01, 0x4c, 0x1e, 0x82, 0x00, 0x01, 0x1a, 0x40, 0x82, 0x66, 0x00, 0x67, 0xcd, 0x66,
+    0xa1, 0x88, 0xa3, 0x66, 0x00, 0x5f, 0x85, 0x5a, 0x02, 0x58, 0x54, 0x4e, 0x9b, 0x66, 0x95, 0x88,
+    0xe2, 0x66, 0x03, 0x65, 0x01, 0x00, 0x64, 0x8c, 0x66, 0x03, 0x67, 0x12, 0x00, 0x53, 0xb6, 0x66,
+    0x03, 0x27, 0x00, 0x37, 0x67, 0x84, 0x66, 0x00, 0x67, 0x85, 0x66, 0x05, 0x48, 0x00, 0x1b, 0x66,
+    0x66, 0x67, 0xb3, 0x66, 0x00, 0x65, 0x88, 0x66, 0x09, 0x65, 0x65, 0x66, 0x66, 0x56, 0x0d, 0x00,
+    0x00, 0x0e, 0x67, 0xd0, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x05, 0x65, 0x64, 0x2c, 0x06, 0x00, 0x01,
+    0x86, 0x00, 0x00, 0x0e, 0x9b, 0x66, 0x95, 0x88, 0xe1, 0x66, 0x06, 0x65, 0x66, 0x10, 0x00, 0x53,
+    0x66, 0x68, 0x87, 0x66, 0x06, 0x67, 0x66, 0x66, 0x63, 0x02, 0x00, 0x57, 0xb6, 0x66, 0x02, 0x22,
+    0x01, 0x46, 0x87, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x58, 0x00, 0x11, 0x82, 0x66, 0x00, 0x65,
+    0xb4, 0x66, 0x02, 0x65, 0x66, 0x67, 0x83, 0x66, 0x05, 0x65, 0x67, 0x67, 0x63, 0x3e, 0x0f, 0x82,
+    0x00, 0x03, 0x1e, 0x66, 0x66, 0x67, 0xce, 0x66, 0xa1, 0x88, 0xa0, 0x66, 0x00, 0x25, 0x83, 0x00,
+    0x84, 0x02, 0x02, 0x00, 0x00, 0x10, 0x9b, 0x66, 0x95, 0x88, 0xe3, 0x66, 0x02, 0x24, 0x00, 0x3d,
+    0x86, 0x66, 0x00, 0x65, 0x83, 0x66, 0x04, 0x67, 0x50, 0x00, 0x06, 0x63, 0xb6, 0x66, 0x02, 0x22,
+    0x00, 0x49, 0x8c, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0xb9, 0x66, 0x02, 0x67, 0x66, 0x67, 0x83, 0x66,
+    0x0a, 0x5c, 0x32, 0x07, 0x00, 0x00, 0x09, 0x32, 0x56, 0x66, 0x66, 0x65, 0xcf, 0x66, 0xa1, 0x88,
+    0x9f, 0x66, 0x05, 0x50, 0x00, 0x00, 0x32, 0x5a, 0x65, 0x85, 0x66, 0x01, 0x62, 0x5e, 0x9b, 0x66,
+    0x95, 0x88, 0xe3, 0x66, 0x03, 0x38, 0x00, 0x0c, 0x5f, 0x84, 0x66, 0x00, 0x67, 0x84, 0x66, 0x03,
+    0x65, 0x18, 0x00, 0x28, 0xb3, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x21, 0x00, 0x48, 0x67, 0x8b,
+    0x66, 0x02, 0x5c, 0x00, 0x0e, 0xbe, 0x66, 0x07, 0x57, 0x28, 0x02, 0x00, 0x00, 0x10, 0x3e, 0x63,
+    0xd4, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x02, 0x37, 0x00, 0x2a, 0x82, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x00, 0x67, 0x9e, 0x66, 0x95, 0x88, 0xe3, 0x66, 0x04, 0x5d, 0x0a, 0x00, 0x1c, 0x65, 0x83, 0x66,
+    0x02, 0x65, 0x67, 0x67, 0x82, 0x66, 0x03, 0x2e, 0x00, 0x00, 0x4f, 0xb3, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x05, 0x22, 0x00, 0x48, 0x67, 0x66, 0x67, 0x89, 0x66, 0x04, 0x5c, 0x00, 0x0e, 0x66, 0x67,
+    0xb3, 0x66, 0x00, 0x65, 0x85, 0x66, 0x01, 0x4b, 0x1e, 0x82, 0x00, 0x01, 0x1a, 0x48, 0x84, 0x66,
+    0x03, 0x67, 0x66, 0x66, 0x67, 0xce, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x02, 0x2a, 0x00, 0x45, 0x85,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0x9a, 0x66, 0x95, 0x88, 0xe4, 0x66, 0x06, 0x4a, 0x00,
+    0x00, 0x10, 0x45, 0x66, 0x65, 0x84, 0x66, 0x04, 0x51, 0x19, 0x00, 0x00, 0x2c, 0xb8, 0x66, 0x02,
+    0x21, 0x00, 0x44, 0x8c, 0x61, 0x02, 0x56, 0x00, 0x0d, 0xb5, 0x66, 0x00, 0x67, 0x82, 0x66, 0x09,
+    0x65, 0x41, 0x12, 0x01, 0x00, 0x02, 0x25, 0x52, 0x66, 0x65, 0x88, 0x66, 0x00, 0x65, 0xcd, 0x66,
+    0xa1, 0x88, 0x9f, 0x66, 0x03, 0x3d, 0x00, 0x37, 0x67, 0x83, 0x66, 0x02, 0x67, 0x66, 0x65, 0x83,
+    0x66, 0x00, 0x67, 0x99, 0x66, 0x95, 0x88, 0xe2, 0x66, 0x03, 0x65, 0x65, 0x66, 0x36, 0x82, 0x00,
+    0x06, 0x10, 0x24, 0x32, 0x3e, 0x36, 0x27, 0x16, 0x82, 0x00, 0x00, 0x26, 0xb8, 0x66, 0x01, 0x67,
+    0x21, 0x90, 0x00, 0x01, 0x0d, 0x67, 0xb4, 0x66, 0x0c, 0x67, 0x67, 0x57, 0x32, 0x0c, 0x00, 0x00,
+    0x06, 0x2e, 0x5b, 0x66, 0x66, 0x65, 0x87, 0x66, 0x00, 0x65, 0x9b, 0x66, 0x00, 0x67, 0xb2, 0x66,
+    0xa1, 0x88, 0x9a, 0x66, 0x01, 0x65, 0x67, 0x82, 0x66, 0x03, 0x58, 0x00, 0x16, 0x64, 0x82, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x00, 0x65, 0x9d, 0x66, 0x95, 0x88, 0xe6, 0x66, 0x02, 0x56, 0x1d, 0x01,
+    0x87, 0x00, 0x05, 0x10, 0x40, 0x65, 0x66, 0x66, 0x67, 0xb6, 0x66, 0x00, 0x1d, 0x90, 0x00, 0x00,
+    0x0a, 0xb6, 0x66, 0x07, 0x2a, 0x00, 0x00, 0x01, 0x10, 0x39, 0x60, 0x67, 0x82, 0x66, 0x07, 0x65,
+    0x65, 0x66, 0x65, 0x66, 0x66, 0x62, 0x59, 0x9c, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x01, 0x65, 0x66,
+    0xa1, 0x88, 0xa0, 0x66, 0x04, 0x18, 0x00, 0x26, 0x66, 0x65, 0x88, 0x66, 0x00, 0x67, 0x99, 0x66,
+    0x95, 0x88, 0xe6, 0x66, 0x0a, 0x68, 0x67, 0x4f, 0x39, 0x29, 0x1b, 0x0c, 0x15, 0x22, 0x30, 0x46,
+    0xb5, 0x66, 0x00, 0x65, 0x85, 0x66, 0x02, 0x55, 0x53, 0x5a, 0x8a, 0x5c, 0x04, 0x5d, 0x5c, 0x5a,
+    0x55, 0x51, 0x82, 0x66, 0x01, 0x67, 0x67, 0xb0, 0x66, 0x01, 0x65, 0x20, 0x82, 0x00, 0x00, 0x06,
+    0x84, 0x02, 0x00, 0x03, 0x84, 0x02, 0x05, 0x00, 0x00, 0x0e, 0x66, 0x66, 0x67, 0x98, 0x66, 0x03,
+    0x64, 0x66, 0x66, 0x65, 0xb1, 0x66, 0xa1, 0x88, 0xa0, 0x66, 0x07, 0x61, 0x1a, 0x00, 0x1f, 0x55,
+    0x66, 0x67, 0x67, 0xa0, 0x66, 0x95, 0x88, 0xe2, 0x66, 0x00, 0x65, 0x86, 0x66, 0x00, 0x65, 0x85,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0xb2, 0x66, 0x0b, 0x67, 0x65, 0x67, 0x66, 0x67, 0x66,
+    0x65, 0x66, 0x67, 0x66, 0x66, 0x67, 0x89, 0x66, 0x00, 0x68, 0xb6, 0x66, 0x00, 0x22, 0x8a, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x0e, 0x9b, 0x66, 0x00, 0x69, 0x82, 0x66, 0x00, 0x65, 0xaf,
+    0x66, 0x00, 0x68, 0xa1, 0x88, 0x9f, 0x66, 0x02, 0x48, 0x11, 0x0e, 0x82, 0x00, 0x01, 0x0c, 0x10,
+    0x82, 0x11, 0x04, 0x10, 0x0a, 0x11, 0x66, 0x67, 0x99, 0x66, 0x95, 0x88, 0xf5, 0x66, 0x00, 0x65,
+    0xb9, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x89, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x65, 0xb1,
+    0x66, 0x02, 0x53, 0x53, 0x59, 0x82, 0x5c, 0x02, 0x5d, 0x5c, 0x5d, 0x86, 0x5c, 0x05, 0x5a, 0x54,
+    0x53, 0x66, 0x66, 0x67, 0x98, 0x66, 0x00, 0x6e, 0x82, 0x66, 0x00, 0x65, 0xae, 0x66, 0x01, 0x67,
+    0x70, 0xa1, 0x88, 0x99, 0x66, 0x07, 0x65, 0x66, 0x66, 0x67, 0x66, 0x66, 0x42, 0x01, 0x89, 0x00,
+    0x01, 0x01, 0x0e, 0x9b, 0x66, 0x95, 0x88, 0xe6, 0x66, 0x00, 0x65, 0xc6, 0x66, 0x00, 0x65, 0xcc,
+    0x66, 0x00, 0x67, 0x86, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x99, 0x66,
+    0x00, 0x79, 0xb3, 0x66, 0x00, 0x79, 0xa1, 0x88, 0x9f, 0x66, 0x02, 0x5a, 0x40, 0x4a, 0x86, 0x4d,
+    0x04, 0x4e, 0x4b, 0x46, 0x44, 0x65, 0x9a, 0x66, 0x95, 0x88, 0xe0, 0x66, 0x02, 0x65, 0x66, 0x65,
+    0x83, 0x66, 0x07, 0x67, 0x67, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65, 0x86, 0x66, 0x00, 0x67, 0xb7,
+    0x66, 0x04, 0x65, 0x66, 0x65, 0x66, 0x67, 0x89, 0x66, 0x00, 0x68, 0xbd, 0x66, 0x00, 0x67, 0x8a,
+    0x66, 0x00, 0x67, 0x9c, 0x66, 0x04, 0x7f, 0x74, 0x66, 0x66, 0x65, 0xab, 0x66, 0x04, 0x67, 0x67,
+    0x66, 0x74, 0x7f, 0xa1, 0x88, 0xa7, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0x9b, 0x66, 0x95,
+    0x88, 0xf5, 0x66, 0x00, 0x65, 0xff, 0x66, 0x84, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x67, 0x84,
+    0x66, 0x00, 0x67, 0x9d, 0x66, 0x04, 0x84, 0x7e, 0x79, 0x6e, 0x68, 0xab, 0x66, 0x04, 0x69, 0x6e,
+    0x7a, 0x7f, 0x85, 0xa1, 0x88, 0x99, 0x66, 0x00, 0x67, 0x8e, 0x66, 0x01, 0x67, 0x67, 0x9d, 0x66,
+    0x95, 0x88, 0xa0, 0x66, 0x00, 0x67, 0x8b, 0x66, 0x00, 0x67, 0xff, 0x66, 0xf8, 0x66, 0x05, 0x85,
+    0x7f, 0x7a, 0x70, 0x68, 0x67, 0xaa, 0x66, 0x06, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0x88, 0x87, 0x9f,
+    0x88, 0x9a, 0x66, 0x05, 0x5c, 0x57, 0x5f, 0x65, 0x66, 0x67, 0x83, 0x66, 0x02, 0x65, 0x66, 0x65,
+    0x82, 0x66, 0x02, 0x5e, 0x42, 0x44, 0x9b, 0x66, 0x95, 0x88, 0xa9, 0x66, 0x00, 0x67, 0xff, 0x66,
+    0xfc, 0x66, 0x01, 0x7f, 0x74, 0xb1, 0x66, 0x01, 0x75, 0x7f, 0xa1, 0x88, 0x99, 0x66, 0x03, 0x67,
+    0x13, 0x00, 0x3b, 0x82, 0x66, 0x0e, 0x67, 0x66, 0x5f, 0x5e, 0x64, 0x66, 0x66, 0x67, 0x66, 0x66,
+    0x51, 0x00, 0x04, 0x67, 0x65, 0x99, 0x66, 0x95, 0x88, 0xa3, 0x66, 0x01, 0x67, 0x67, 0x82, 0x66,
+    0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0xff, 0x66, 0xf7, 0x66, 0x00, 0x7a, 0xaa, 0x66, 0x02, 0x65,
+    0x65, 0x67, 0x85, 0x66, 0x00, 0x7a, 0xa1, 0x88, 0x9a, 0x66, 0x0b, 0x1a, 0x00, 0x44, 0x65, 0x66,
+    0x67, 0x66, 0x66, 0x04, 0x01, 0x4c, 0x65, 0x83, 0x66, 0x02, 0x58, 0x00, 0x0c, 0x9b, 0x66, 0x95,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x00, 0x6e, 0x82, 0x66, 0x03, 0x67, 0x67, 0x66, 0x65,
+    0xab, 0x66, 0x01, 0x67, 0x70, 0xa1, 0x88, 0x9a, 0x66, 0x02, 0x20, 0x00, 0x47, 0x84, 0x66, 0x02,
+    0x0c, 0x00, 0x56, 0x82, 0x66, 0x04, 0x67, 0x66, 0x5b, 0x00, 0x0e, 0x9b, 0x66, 0x95, 0x88, 0xa1,
+    0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0x84, 0x66, 0x00, 0x69, 0x85, 0x66, 0x00, 0x65, 0xa7,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x6a, 0xa1, 0x88, 0x98, 0x66, 0x06, 0x67, 0x66, 0x22, 0x00,
+    0x48, 0x66, 0x65, 0x82, 0x66, 0x02, 0x0e, 0x00, 0x58, 0x84, 0x66, 0x02, 0x5c, 0x01, 0x0d, 0x9b,
+    0x66, 0x95, 0x88, 0xa4, 0x66, 0x01, 0x67, 0x65, 0x86, 0x66, 0x00, 0x67, 0xff, 0x66, 0xfb, 0x66,
+    0x00, 0x65, 0xa6, 0x66, 0x00, 0x65, 0x82, 0x66, 0x06, 0x67, 0x67, 0x65, 0x66, 0x65, 0x66, 0x65,
+    0xa1, 0x88, 0x9a, 0x66, 0x02, 0x22, 0x00, 0x48, 0x84, 0x66, 0x03, 0x11, 0x00, 0x59, 0x65, 0x83,
+    0x66, 0x04, 0x5c, 0x00, 0x0e, 0x66, 0x65, 0x99, 0x66, 0x95, 0x88, 0xa0, 0x66, 0x04, 0x65, 0x66,
+    0x67, 0x66, 0x68, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x02, 0x22, 0x00,
+    0x4a, 0x84, 0x66, 0x02, 0x10, 0x01, 0x5a, 0x84, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0x9b, 0x66, 0x95,
+    0x88, 0x9f, 0x66, 0x04, 0x65, 0x67, 0x66, 0x65, 0x5d, 0x85, 0x5a, 0x04, 0x58, 0x54, 0x4e, 0x68,
+    0x67, 0xff, 0x66, 0xf9, 0x66, 0x00, 0x67, 0xb2, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x02, 0x22, 0x00,
+    0x48, 0x83, 0x66, 0x0b, 0x65, 0x10, 0x00, 0x5a, 0x66, 0x66, 0x65, 0x66, 0x66, 0x5c, 0x00, 0x0e,
+    0x9b, 0x66, 0x95, 0x88, 0xa0, 0x66, 0x02, 0x64, 0x2c, 0x06, 0x85, 0x00, 0x03, 0x01, 0x00, 0x00,
+    0x0e, 0xff, 0x66, 0xff, 0x66, 0xaf, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x03, 0x65, 0x22, 0x00, 0x48,
+    0x83, 0x66, 0x03, 0x65, 0x10, 0x00, 0x5a, 0x83, 0x66, 0x03, 0x65, 0x5c, 0x00, 0x0f, 0x9b, 0x66,
+    0x95, 0x88, 0x98, 0x66, 0x08, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x67, 0x67, 0x24, 0x83, 0x00,
+    0x83, 0x02, 0x05, 0x03, 0x00, 0x00, 0x10, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0xad, 0x66, 0xa1,
+    0x88, 0x9a, 0x66, 0x04, 0x22, 0x00, 0x48, 0x66, 0x67, 0x82, 0x66, 0x03, 0x10, 0x00, 0x5a, 0x67,
+    0x82, 0x66, 0x03, 0x65, 0x5d, 0x00, 0x0e, 0x9b, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x05, 0x51, 0x00,
+    0x01, 0x32, 0x5b, 0x64, 0x84, 0x66, 0x04, 0x67, 0x62, 0x5e, 0x65, 0x67, 0xff, 0x66, 0xff, 0x66,
+    0xad, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x04, 0x65, 0x66, 0x22, 0x00, 0x41, 0x84, 0x5e, 0x0c, 0x0e,
+    0x00, 0x52, 0x5e, 0x5f, 0x5e, 0x5f, 0x5e, 0x55, 0x00, 0x0e, 0x66, 0x65, 0x99, 0x66, 0x95, 0x88,
+    0x9f, 0x66, 0x02, 0x37, 0x00, 0x2a, 0x88, 0x66, 0x01, 0x67, 0x67, 0xff, 0x66, 0xff, 0x66, 0xaf,
+    0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x21, 0x90, 0x00, 0x02, 0x0c, 0x67, 0x67, 0x99, 0x66, 0x95,
+    0x88, 0x9f, 0x66, 0x02, 0x2a, 0x00, 0x45, 0x83, 0x66, 0x00, 0x64, 0x82, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0xad, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x1d, 0x8b,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x0a, 0x9b, 0x66, 0x95, 0x88, 0x98, 0x66, 0x09, 0x65, 0x66,
+    0x66, 0x65, 0x66, 0x66, 0x65, 0x3e, 0x00, 0x37, 0x89, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66,
+    0xaf, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x06, 0x65, 0x66, 0x55, 0x53, 0x5a, 0x5c, 0x5d, 0x84, 0x5c,
+    0x00, 0x5d, 0x84, 0x5c, 0x03, 0x5a, 0x55, 0x51, 0x65, 0x9a, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x03,
+    0x57, 0x00, 0x15, 0x64, 0x85, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0xb2, 0x66, 0xa1, 0x88,
+    0x9d, 0x66, 0x00, 0x67, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0x83, 0x66, 0x00, 0x65, 0x9e,
+    0x66, 0x95, 0x88, 0xa0, 0x66, 0x02, 0x19, 0x00, 0x26, 0x8a, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff,
+    0x66, 0xad, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x03, 0x65, 0x66, 0x65, 0x65,
+    0x83, 0x66, 0x0a, 0x62, 0x1b, 0x00, 0x1e, 0x55, 0x66, 0x66, 0x67, 0x66, 0x65, 0x67, 0xa1, 0x66,
+    0x00, 0x65, 0xff, 0x66, 0xd0, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xb8, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x0d, 0x48, 0x11, 0x0e, 0x00, 0x00, 0x01, 0x0d, 0x12, 0x11,
+    0x11, 0x10, 0x10, 0x0a, 0x11, 0xff, 0x66, 0xff, 0x66, 0xaf, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x99, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x65, 0x66, 0x42, 0x8b, 0x00, 0x01, 0x0d, 0x67,
+    0xff, 0x66, 0xff, 0x66, 0xae, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x02, 0x5a,
+    0x40, 0x4a, 0x85, 0x4d, 0x04, 0x4c, 0x4d, 0x4b, 0x46, 0x44, 0x9f, 0x66, 0x00, 0x65, 0xff, 0x66,
+    0xd7, 0x66, 0x00, 0x65, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9d, 0x66, 0x00, 0x67,
+    0x84, 0x66, 0x02, 0x65, 0x66, 0x65, 0x83, 0x66, 0x04, 0x67, 0x67, 0x66, 0x66, 0x67, 0x99, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0xd7, 0x66, 0x00, 0x65, 0xb5, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x9d, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0x9a, 0x66, 0x00, 0x65, 0xff, 0x66, 0x91, 0x66,
+    0x01, 0x65, 0x65, 0xc7, 0x66, 0x00, 0x65, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a,
+    0x66, 0x02, 0x5e, 0x57, 0x5b, 0x82, 0x66, 0x00, 0x65, 0x83, 0x66, 0x02, 0x68, 0x66, 0x65, 0x83,
+    0x66, 0x00, 0x63, 0x9b, 0x66, 0x00, 0x67, 0xff, 0x66, 0x91, 0x66, 0x01, 0x67, 0x67, 0xc7, 0x66,
+    0x00, 0x67, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x99, 0x66, 0x09, 0x65, 0x22, 0x00,
+    0x19, 0x66, 0x66, 0x43, 0x02, 0x09, 0x0b, 0x83, 0x0c, 0x05, 0x0d, 0x0c, 0x0c, 0x0a, 0x05, 0x0e,
+    0x9b, 0x66, 0x00, 0x69, 0x83, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x01, 0x69, 0x69, 0xc7, 0x66, 0x01,
+    0x69, 0x69, 0xc4, 0x66, 0x03, 0x65, 0x65, 0x67, 0x68, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x99, 0x66, 0x06, 0x65, 0x21, 0x00, 0x19, 0x66, 0x66, 0x44, 0x8b, 0x00, 0x01, 0x0e, 0x67,
+    0x9a, 0x66, 0x00, 0x6f, 0xc7, 0x66, 0x04, 0x6f, 0x6e, 0x66, 0x66, 0x67, 0x82, 0x66, 0x00, 0x67,
+    0xc0, 0x66, 0x06, 0x70, 0x6e, 0x66, 0x67, 0x67, 0x66, 0x67, 0xbe, 0x66, 0x04, 0x65, 0x66, 0x66,
+    0x65, 0x70, 0x96, 0x66, 0x00, 0x65, 0x9d, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a, 0x66,
+    0x09, 0x49, 0x37, 0x43, 0x65, 0x66, 0x5a, 0x45, 0x4c, 0x4f, 0x51, 0x85, 0x50, 0x02, 0x4e, 0x49,
+    0x4a, 0x9b, 0x66, 0x00, 0x79, 0xc7, 0x66, 0x02, 0x79, 0x79, 0x67, 0xc6, 0x66, 0x01, 0x79, 0x7a,
+    0xc7, 0x66, 0x00, 0x79, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa5, 0x66, 0x01, 0x67,
+    0x65, 0x83, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x99, 0x66, 0x03, 0x7f, 0x75, 0x66, 0x67, 0xbc,
+    0x66, 0x00, 0x65, 0x85, 0x66, 0x03, 0x74, 0x7d, 0x7f, 0x75, 0xc1, 0x66, 0x0b, 0x65, 0x66, 0x65,
+    0x66, 0x74, 0x7f, 0x7f, 0x76, 0x66, 0x66, 0x65, 0x65, 0xbf, 0x66, 0x03, 0x67, 0x66, 0x74, 0x7f,
+    0x96, 0x66, 0x00, 0x65, 0x9d, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x04, 0x2a,
+    0x26, 0x48, 0x63, 0x67, 0x88, 0x66, 0x00, 0x65, 0x9f, 0x66, 0x04, 0x84, 0x7e, 0x78, 0x6e, 0x68,
+    0xbb, 0x66, 0x00, 0x67, 0x82, 0x66, 0x09, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e,
+    0x69, 0xbf, 0x66, 0x0b, 0x6a, 0x6d, 0x7a, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x66, 0x65,
+    0xba, 0x66, 0x07, 0x67, 0x66, 0x66, 0x68, 0x6e, 0x7b, 0x7f, 0x84, 0x92, 0x66, 0x00, 0x67, 0xa1,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x08, 0x67, 0x66, 0x21, 0x00, 0x00, 0x04,
+    0x1e, 0x3c, 0x59, 0x84, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0x9a, 0x66, 0x05, 0x67, 0x84,
+    0x80, 0x78, 0x70, 0x68, 0xbb, 0x66, 0x00, 0x67, 0x82, 0x66, 0x09, 0x68, 0x70, 0x7a, 0x7f, 0x84,
+    0x84, 0x7f, 0x79, 0x70, 0x69, 0xbf, 0x66, 0x09, 0x67, 0x70, 0x7b, 0x7f, 0x84, 0x84, 0x7f, 0x79,
+    0x70, 0x69, 0x83, 0x66, 0x00, 0x65, 0xb8, 0x66, 0x06, 0x65, 0x66, 0x68, 0x70, 0x7a, 0x7f, 0x84,
+    0x8f, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0x9f, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0x97, 0x66, 0x04, 0x65, 0x66, 0x66, 0x32, 0x08, 0x84, 0x00, 0x06, 0x11, 0x2f, 0x4d, 0x64, 0x66,
+    0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x9b, 0x66, 0x01, 0x7e, 0x74, 0xbe, 0x66, 0x00, 0x65, 0x85,
+    0x66, 0x04, 0x74, 0x7e, 0x7f, 0x74, 0x65, 0xc4, 0x66, 0x03, 0x76, 0x7f, 0x7e, 0x74, 0x83, 0x66,
+    0x00, 0x67, 0xbb, 0x66, 0x00, 0x67, 0x83, 0x66, 0x01, 0x75, 0x7f, 0x8f, 0x66, 0x04, 0x67, 0x4c,
+    0x44, 0x57, 0x67, 0xa0, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x03, 0x5c, 0x43, 0x27, 0x0b, 0x83, 0x00, 0x03, 0x06, 0x22, 0x40, 0x5d, 0x83, 0x66, 0x00,
+    0x65, 0x9b, 0x66, 0x00, 0x7a, 0xc7, 0x66, 0x04, 0x7a, 0x7b, 0x65, 0x66, 0x65, 0xbf, 0x66, 0x06,
+    0x67, 0x65, 0x66, 0x66, 0x67, 0x7a, 0x7a, 0x82, 0x66, 0x02, 0x67, 0x66, 0x65, 0xbd, 0x66, 0x04,
+    0x67, 0x66, 0x66, 0x67, 0x7a, 0x90, 0x66, 0x03, 0x1b, 0x00, 0x07, 0x48, 0xa0, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x9d, 0x66, 0x06, 0x65, 0x66, 0x66, 0x55, 0x3a, 0x1d, 0x05, 0x83, 0x00,
+    0x03, 0x15, 0x32, 0x50, 0x65, 0x9c, 0x66, 0x00, 0x6f, 0xc7, 0x66, 0x01, 0x70, 0x6f, 0x85, 0x66,
+    0x00, 0x67, 0xbf, 0x66, 0x02, 0x68, 0x70, 0x6f, 0x85, 0x66, 0x02, 0x65, 0x66, 0x67, 0xbd, 0x66,
+    0x01, 0x67, 0x70, 0x90, 0x66, 0x05, 0x20, 0x00, 0x01, 0x00, 0x25, 0x5f, 0x9e, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x99, 0x66, 0x00, 0x67, 0x88, 0x66, 0x03, 0x64, 0x4c, 0x30, 0x14, 0x83,
+    0x00, 0x01, 0x08, 0x29, 0x9b, 0x66, 0x00, 0x69, 0x83, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x04, 0x68,
+    0x69, 0x66, 0x65, 0x67, 0xc1, 0x66, 0x04, 0x67, 0x66, 0x66, 0x69, 0x69, 0xc2, 0x66, 0x01, 0x65,
+    0x64, 0x82, 0x66, 0x00, 0x68, 0x90, 0x66, 0x07, 0x22, 0x00, 0x1a, 0x03, 0x01, 0x07, 0x41, 0x67,
+    0x82, 0x66, 0x02, 0x67, 0x65, 0x65, 0x84, 0x66, 0x00, 0x67, 0x90, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0x9a, 0x66, 0x00, 0x65, 0x83, 0x66, 0x02, 0x67, 0x65, 0x65, 0x84, 0x66, 0x01, 0x5d,
+    0x2d, 0x82, 0x00, 0x00, 0x0e, 0x9b, 0x66, 0x00, 0x67, 0xff, 0x66, 0x8c, 0x66, 0x01, 0x67, 0x65,
+    0xc6, 0x66, 0x05, 0x65, 0x66, 0x67, 0x66, 0x66, 0x67, 0x91, 0x66, 0x08, 0x22, 0x00, 0x46, 0x51,
+    0x0f, 0x00, 0x00, 0x15, 0x4c, 0x86, 0x66, 0x02, 0x67, 0x66, 0x65, 0x91, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0x95, 0x88, 0x97, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0x87, 0x66, 0x03, 0x5c, 0x3e,
+    0x1e, 0x04, 0x82, 0x00, 0x01, 0x0a, 0x2c, 0x9b, 0x66, 0x00, 0x65, 0xff, 0x66, 0xec, 0x66, 0x0c,
+    0x67, 0x22, 0x00, 0x46, 0x65, 0x63, 0x30, 0x03, 0x00, 0x00, 0x14, 0x3c, 0x62, 0x84, 0x66, 0x01,
+    0x65, 0x65, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x97, 0x66, 0x00, 0x65, 0x88, 0x66,
+    0x02, 0x55, 0x35, 0x16, 0x83, 0x00, 0x06, 0x15, 0x33, 0x52, 0x65, 0x66, 0x66, 0x65, 0x99, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0x88, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x67,
+    0xc0, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0x91, 0x66, 0x07, 0x22, 0x00, 0x46, 0x66, 0x67,
+    0x66, 0x59, 0x24, 0x82, 0x00, 0x06, 0x04, 0x28, 0x48, 0x62, 0x66, 0x66, 0x67, 0x92, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x9d, 0x66, 0x03, 0x64, 0x4c, 0x2d, 0x0e, 0x82, 0x00, 0x09, 0x01,
+    0x1c, 0x3c, 0x59, 0x66, 0x66, 0x67, 0x66, 0x67, 0x65, 0x9e, 0x66, 0x00, 0x65, 0xc0, 0x66, 0x06,
+    0x65, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65, 0xff, 0x66, 0xa1, 0x66, 0x02, 0x22, 0x00, 0x46, 0x84,
+    0x66, 0x02, 0x52, 0x23, 0x02, 0x82, 0x00, 0x04, 0x02, 0x18, 0x2c, 0x3e, 0x50, 0x91, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x03, 0x58, 0x3c, 0x22, 0x07, 0x82, 0x00, 0x04, 0x07,
+    0x24, 0x44, 0x61, 0x68, 0xff, 0x66, 0xff, 0x66, 0x91, 0x66, 0x02, 0x22, 0x01, 0x46, 0x82, 0x66,
+    0x06, 0x67, 0x67, 0x66, 0x67, 0x5e, 0x37, 0x0e, 0x83, 0x00, 0x01, 0x01, 0x0e, 0x91, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x97, 0x66, 0x03, 0x65, 0x66, 0x67, 0x22, 0x82, 0x00, 0x03, 0x17,
+    0x31, 0x4d, 0x64, 0x87, 0x66, 0x02, 0x65, 0x66, 0x65, 0xff, 0x66, 0xff, 0x66, 0x8a, 0x66, 0x06,
+    0x22, 0x00, 0x46, 0x67, 0x66, 0x66, 0x67, 0x85, 0x66, 0x05, 0x4f, 0x34, 0x1b, 0x05, 0x00, 0x0e,
+    0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x99, 0x66, 0x08, 0x67, 0x23, 0x01, 0x00, 0x00,
+    0x05, 0x1e, 0x3b, 0x5a, 0x83, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x67, 0x66, 0x65, 0x9f, 0x66,
+    0x00, 0x65, 0xff, 0x66, 0xe8, 0x66, 0x08, 0x65, 0x23, 0x00, 0x45, 0x67, 0x65, 0x67, 0x65, 0x67,
+    0x82, 0x66, 0x02, 0x65, 0x66, 0x65, 0x82, 0x66, 0x01, 0x56, 0x4e, 0x91, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0x95, 0x88, 0x97, 0x66, 0x07, 0x65, 0x66, 0x65, 0x64, 0x52, 0x37, 0x18, 0x01, 0x82, 0x00,
+    0x05, 0x13, 0x32, 0x51, 0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0x8b,
+    0x66, 0x02, 0x20, 0x00, 0x43, 0x84, 0x66, 0x02, 0x67, 0x66, 0x67, 0x99, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0x95, 0x88, 0x9e, 0x66, 0x0b, 0x5e, 0x41, 0x21, 0x05, 0x00, 0x01, 0x00, 0x0a, 0x29, 0x47,
+    0x64, 0x65, 0xff, 0x66, 0xff, 0x66, 0x89, 0x66, 0x06, 0x67, 0x66, 0x66, 0x67, 0x1a, 0x00, 0x3c,
+    0x82, 0x66, 0x01, 0x65, 0x67, 0x82, 0x66, 0x00, 0x67, 0x98, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x97, 0x66, 0x00, 0x67, 0x83, 0x66, 0x11, 0x67, 0x65, 0x65, 0x66, 0x66, 0x63, 0x4a, 0x2a,
+    0x0b, 0x00, 0x01, 0x00, 0x04, 0x20, 0x3e, 0x5c, 0x66, 0x65, 0xff, 0x66, 0xff, 0x66, 0x85, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x07, 0x30, 0x24, 0x4a, 0x66, 0x66, 0x67, 0x66, 0x65, 0x9c, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x9b, 0x66, 0x00, 0x65, 0x88, 0x66, 0x02, 0x52, 0x33, 0x14, 0x83,
+    0x00, 0x02, 0x1b, 0x67, 0x67, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66, 0x00, 0x65, 0xa4, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x03, 0x67, 0x67, 0x66, 0x67, 0x83, 0x66, 0x08, 0x65,
+    0x67, 0x66, 0x65, 0x66, 0x66, 0x65, 0x4c, 0x2b, 0x82, 0x00, 0x02, 0x0e, 0x66, 0x67, 0xff, 0x66,
+    0xff, 0x66, 0x88, 0x66, 0x02, 0x2c, 0x1a, 0x42, 0x83, 0x66, 0x00, 0x65, 0x9c, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x9c, 0x66, 0x00, 0x65, 0x85, 0x66, 0x03, 0x55, 0x39, 0x1e, 0x04, 0x82,
+    0x00, 0x04, 0x02, 0x1c, 0x3c, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x84, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x0a, 0x1b, 0x00, 0x3f, 0x66, 0x66, 0x67, 0x66, 0x66, 0x3e, 0x3a, 0x5a, 0x99, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x00, 0x65, 0x82, 0x66, 0x06, 0x65, 0x66, 0x66, 0x5d,
+    0x43, 0x26, 0x0b, 0x83, 0x00, 0x03, 0x0c, 0x29, 0x46, 0x61, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66,
+    0xff, 0x66, 0x84, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x21, 0x00, 0x43, 0x84, 0x66, 0x02, 0x0d,
+    0x00, 0x48, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x97, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x03, 0x5b, 0x48, 0x2f, 0x13, 0x83, 0x00, 0x03, 0x02, 0x19, 0x36, 0x55, 0x85, 0x66, 0x00, 0x67,
+    0xff, 0x66, 0xff, 0x66, 0x89, 0x66, 0x03, 0x22, 0x01, 0x45, 0x67, 0x83, 0x66, 0x02, 0x14, 0x00,
+    0x50, 0x82, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1, 0x88, 0x00, 0x64, 0xbf, 0x66, 0x01, 0x65, 0x65,
+    0x82, 0x66, 0x03, 0x67, 0x66, 0x65, 0x65, 0x95, 0x88, 0x9a, 0x66, 0x00, 0x25, 0x82, 0x00, 0x07,
+    0x01, 0x00, 0x0a, 0x26, 0x44, 0x5f, 0x65, 0x67, 0xff, 0x66, 0xff, 0x66, 0x8e, 0x66, 0x05, 0x67,
+    0x66, 0x66, 0x22, 0x00, 0x46, 0x84, 0x66, 0x04, 0x17, 0x00, 0x52, 0x66, 0x67, 0x97, 0x66, 0xa1,
+    0x88, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x00, 0x67, 0x82, 0x88, 0x01, 0x87, 0x87,
+    0x90, 0x88, 0x98, 0x66, 0x07, 0x65, 0x66, 0x22, 0x00, 0x01, 0x16, 0x34, 0x52, 0x83, 0x66, 0x00,
+    0x65, 0xff, 0x66, 0xff, 0x66, 0x8b, 0x66, 0x00, 0x65, 0x84, 0x66, 0x0b, 0x65, 0x22, 0x00, 0x46,
+    0x66, 0x66, 0x67, 0x66, 0x66, 0x17, 0x00, 0x52, 0x86, 0x66, 0x00, 0x65, 0x91, 0x66, 0xa1, 0x88,
+    0x01, 0x69, 0x67, 0xc6, 0x66, 0x00, 0x68, 0x95, 0x88, 0x9a, 0x66, 0x06, 0x32, 0x3a, 0x5c, 0x67,
+    0x67, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x93, 0x66, 0x0d, 0x65, 0x66, 0x66, 0x22, 0x00, 0x46,
+    0x66, 0x66, 0x65, 0x66, 0x66, 0x18, 0x00, 0x52, 0x83, 0x66, 0x02, 0x67, 0x66, 0x65, 0x92, 0x66,
+    0xa1, 0x88, 0x06, 0x6e, 0x66, 0x67, 0x66, 0x66, 0x67, 0x65, 0xc0, 0x66, 0x01, 0x65, 0x70, 0x95,
+    0x88, 0x99, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0x96, 0x66, 0x06,
+    0x68, 0x66, 0x66, 0x22, 0x00, 0x47, 0x65, 0x83, 0x66, 0x02, 0x17, 0x00, 0x52, 0x83, 0x66, 0x00,
+    0x67, 0x94, 0x66, 0xa1, 0x88, 0x00, 0x79, 0xc7, 0x66, 0x00, 0x79, 0x95, 0x88, 0x9c, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0x95, 0x66, 0x02, 0x22, 0x00, 0x47, 0x84,
+    0x66, 0x05, 0x18, 0x00, 0x53, 0x66, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x91, 0x66, 0xa1, 0x88,
+    0x01, 0x7e, 0x76, 0x82, 0x66, 0x00, 0x65, 0xba, 0x66, 0x00, 0x67, 0x85, 0x66, 0x01, 0x74, 0x7f,
+    0x95, 0x88, 0xa3, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0x90, 0x66, 0x0d, 0x65, 0x66, 0x66,
+    0x22, 0x00, 0x3e, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x16, 0x00, 0x4c, 0x84, 0x5e, 0x02, 0x5c, 0x58,
+    0x51, 0x91, 0x66, 0xa1, 0x88, 0x04, 0x85, 0x80, 0x79, 0x6e, 0x68, 0xbc, 0x66, 0x07, 0x67, 0x66,
+    0x66, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x95, 0x88, 0x9e, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x67,
+    0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x8b, 0x66, 0x07, 0x65, 0x66, 0x66, 0x64, 0x66, 0x65, 0x66,
+    0x21, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x01, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0x04,
+    0x84, 0x7f, 0x79, 0x70, 0x69, 0xbf, 0x66, 0x04, 0x69, 0x70, 0x7a, 0x7e, 0x85, 0x95, 0x88, 0x9d,
+    0x66, 0x01, 0x65, 0x65, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x00, 0x1d, 0x82, 0x00, 0x00, 0x01,
+    0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x0d, 0x91, 0x66, 0xa1, 0x88, 0x07, 0x7f, 0x74, 0x66,
+    0x65, 0x65, 0x66, 0x66, 0x67, 0xb7, 0x66, 0x00, 0x67, 0x86, 0x66, 0x01, 0x75, 0x7f, 0x95, 0x88,
+    0xe7, 0x66, 0x00, 0x65, 0xff, 0x66, 0x92, 0x66, 0x00, 0x67, 0x8c, 0x66, 0x04, 0x65, 0x65, 0x66,
+    0x66, 0x65, 0xa9, 0x66, 0x02, 0x55, 0x4e, 0x56, 0x8b, 0x5c, 0x03, 0x5d, 0x59, 0x55, 0x53, 0x91,
+    0x66, 0xa1, 0x88, 0x02, 0x7b, 0x65, 0x65, 0xbd, 0x66, 0x08, 0x65, 0x67, 0x66, 0x66, 0x65, 0x67,
+    0x66, 0x66, 0x7a, 0x95, 0x88, 0xe7, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xbe, 0x66, 0x02,
+    0x67, 0x66, 0x67, 0x84, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x65, 0xc5, 0x66, 0x00, 0x67, 0xb0,
+    0x66, 0x00, 0x65, 0x8f, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x67, 0x66, 0x67, 0x90, 0x66, 0xa1,
+    0x88, 0x00, 0x6f, 0x82, 0x66, 0x02, 0x65, 0x66, 0x65, 0xbb, 0x66, 0x00, 0x65, 0x82, 0x66, 0x07,
+    0x65, 0x66, 0x71, 0x88, 0x88, 0x87, 0x88, 0x87, 0x90, 0x88, 0xf0, 0x66, 0x00, 0x67, 0xba, 0x66,
+    0x00, 0x65, 0x85, 0x66, 0x00, 0x67, 0x83, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xc7, 0x66, 0x00,
+    0x65, 0x87, 0x66, 0x00, 0x67, 0xaa, 0x66, 0x00, 0x65, 0x8c, 0x66, 0x02, 0x65, 0x66, 0x67, 0x92,
+    0x66, 0xa1, 0x88, 0x01, 0x6a, 0x65, 0x82, 0x66, 0x00, 0x65, 0xbd, 0x66, 0x00, 0x65, 0x83, 0x66,
+    0x00, 0x69, 0x95, 0x88, 0xea, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0xbb, 0x66, 0x03, 0x67,
+    0x66, 0x66, 0x64, 0xc6, 0x66, 0x04, 0x65, 0x66, 0x65, 0x66, 0x67, 0x83, 0x66, 0x02, 0x67, 0x65,
+    0x65, 0xb3, 0x66, 0x00, 0x67, 0x8d, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1, 0x88, 0x85, 0x66, 0x00,
+    0x67, 0xbb, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0x95, 0x88, 0xf0, 0x66, 0x00, 0x65, 0xba,
+    0x66, 0x00, 0x65, 0x86, 0x66, 0x02, 0x67, 0x66, 0x65, 0xc0, 0x66, 0x01, 0x65, 0x67, 0xbf, 0x66,
+    0x01, 0x67, 0x67, 0x8d, 0x66, 0x00, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xc3, 0x66, 0x00, 0x67, 0x84,
+    0x66, 0x95, 0x88, 0xeb, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x00, 0x67, 0xce, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0x82, 0x66, 0x00, 0x67, 0x88, 0x66, 0x01, 0x67, 0x65, 0xb7, 0x66, 0x00, 0x67, 0x94,
+    0x66, 0xa1, 0x88, 0x06, 0x66, 0x66, 0x65, 0x65, 0x66, 0x66, 0x65, 0xbc, 0x66, 0x00, 0x65, 0x84,
+    0x66, 0x95, 0x88, 0xea, 0x66, 0x00, 0x68, 0x84, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0xb4,
+    0x66, 0x05, 0x65, 0x67, 0x65, 0x66, 0x65, 0x65, 0x89, 0x66, 0x00, 0x65, 0xba, 0x66, 0x03, 0x67,
+    0x35, 0x1d, 0x24, 0x86, 0x26, 0x00, 0x27, 0x84, 0x26, 0x04, 0x24, 0x20, 0x20, 0x66, 0x65, 0xa6,
+    0x66, 0x01, 0x65, 0x67, 0x8d, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67,
+    0x8d, 0x66, 0xa1, 0x88, 0xc6, 0x66, 0x02, 0x65, 0x66, 0x66, 0x95, 0x88, 0xe7, 0x66, 0x0d, 0x67,
+    0x66, 0x66, 0x28, 0x40, 0x66, 0x66, 0x4e, 0x27, 0x4a, 0x66, 0x66, 0x67, 0x65, 0xbb, 0x66, 0x02,
+    0x56, 0x37, 0x62, 0x84, 0x66, 0x05, 0x43, 0x22, 0x15, 0x1f, 0x31, 0x56, 0xb8, 0x66, 0x00, 0x22,
+    0x85, 0x00, 0x02, 0x02, 0x00, 0x01, 0x87, 0x00, 0x00, 0x0e, 0xc1, 0x66, 0x00, 0x67, 0x8e, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xea, 0x66, 0x06, 0x00, 0x21, 0x66, 0x66, 0x3e, 0x00, 0x31,
+    0xb8, 0x66, 0x00, 0x67, 0x83, 0x66, 0x05, 0x64, 0x26, 0x00, 0x00, 0x51, 0x65, 0x82, 0x66, 0x00,
+    0x22, 0x84, 0x00, 0x01, 0x04, 0x42, 0xb7, 0x66, 0x06, 0x38, 0x2a, 0x31, 0x34, 0x33, 0x33, 0x32,
+    0x85, 0x33, 0x08, 0x34, 0x36, 0x17, 0x00, 0x00, 0x0c, 0x66, 0x66, 0x65, 0xce, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xea, 0x66, 0x06, 0x00, 0x21, 0x66, 0x66, 0x3e, 0x00, 0x31, 0xb9, 0x66,
+    0x17, 0x67, 0x66, 0x65, 0x67, 0x2b, 0x00, 0x00, 0x04, 0x4b, 0x66, 0x65, 0x66, 0x3d, 0x00, 0x00,
+    0x18, 0x31, 0x2a, 0x09, 0x00, 0x02, 0x59, 0x66, 0x65, 0xbc, 0x66, 0x00, 0x67, 0x83, 0x66, 0x05,
+    0x55, 0x18, 0x00, 0x00, 0x13, 0x4c, 0xd1, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xea, 0x66,
+    0x06, 0x00, 0x21, 0x66, 0x66, 0x3e, 0x00, 0x31, 0xbc, 0x66, 0x04, 0x4b, 0x00, 0x00, 0x2e, 0x63,
+    0x83, 0x66, 0x09, 0x10, 0x00, 0x24, 0x65, 0x66, 0x66, 0x5d, 0x10, 0x01, 0x27, 0xb5, 0x66, 0x03,
+    0x65, 0x66, 0x66, 0x65, 0x83, 0x66, 0x0a, 0x67, 0x66, 0x66, 0x68, 0x65, 0x37, 0x03, 0x00, 0x03,
+    0x38, 0x65, 0xd2, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xea, 0x66, 0x06, 0x00, 0x21, 0x66,
+    0x66, 0x3e, 0x00, 0x31, 0xbc, 0x66, 0x03, 0x2c, 0x00, 0x1d, 0x67, 0x83, 0x66, 0x03, 0x51, 0x00,
+    0x04, 0x5f, 0x83, 0x66, 0x02, 0x47, 0x00, 0x0a, 0x82, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x00, 0x65,
+    0x84, 0x66, 0x00, 0x65, 0x83, 0x66, 0x09, 0x56, 0x16, 0x00, 0x00, 0x17, 0x56, 0x67, 0x66, 0x66,
+    0x65, 0xd0, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xea, 0x66, 0x06, 0x00, 0x21, 0x66, 0x66,
+    0x3e, 0x00, 0x31, 0xb6, 0x66, 0x01, 0x67, 0x65, 0x83, 0x66, 0x02, 0x10, 0x00, 0x4d, 0x83, 0x66,
+    0x0c, 0x67, 0x37, 0x00, 0x1f, 0x67, 0x66, 0x67, 0x66, 0x67, 0x65, 0x03, 0x00, 0x63, 0xb8, 0x66,
+    0x01, 0x65, 0x65, 0x82, 0x66, 0x07, 0x65, 0x37, 0x03, 0x00, 0x03, 0x38, 0x65, 0x67, 0xd4, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xea, 0x66, 0x06, 0x00, 0x21, 0x66, 0x66, 0x3e, 0x00, 0x31,
+    0xb8, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x05, 0x00, 0x5f, 0x84, 0x66, 0x02, 0x20, 0x01, 0x38,
+    0x85, 0x66, 0x02, 0x0e, 0x00, 0x57, 0xb4, 0x66, 0x00, 0x65, 0x85, 0x66, 0x0e, 0x67, 0x56, 0x16,
+    0x00, 0x00, 0x18, 0x56, 0x66, 0x65, 0x67, 0x66, 0x66, 0x65, 0x66, 0x67, 0xcf, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xea, 0x66, 0x06, 0x00, 0x21, 0x66, 0x66, 0x3e, 0x00, 0x31, 0xbc, 0x66,
+    0x02, 0x08, 0x00, 0x61, 0x84, 0x66, 0x02, 0x08, 0x00, 0x4f, 0x85, 0x66, 0x02, 0x06, 0x00, 0x5a,
+    0xba, 0x66, 0x08, 0x65, 0x38, 0x03, 0x00, 0x05, 0x39, 0x66, 0x66, 0x65, 0xd6, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xea, 0x66, 0x06, 0x00, 0x21, 0x66, 0x66, 0x3e, 0x00, 0x31, 0xbc, 0x66,
+    0x0a, 0x16, 0x00, 0x50, 0x67, 0x66, 0x65, 0x66, 0x54, 0x00, 0x05, 0x64, 0x83, 0x66, 0x04, 0x67,
+    0x5a, 0x00, 0x01, 0x62, 0x83, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x0b, 0x67, 0x66, 0x66, 0x58, 0x17,
+    0x00, 0x00, 0x17, 0x57, 0x66, 0x66, 0x64, 0xd7, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x01,
+    0x67, 0x65, 0x82, 0x67, 0xc3, 0x66, 0x01, 0x67, 0x67, 0x82, 0x66, 0x00, 0x67, 0x9b, 0x66, 0x06,
+    0x00, 0x20, 0x66, 0x66, 0x3e, 0x00, 0x32, 0xbb, 0x66, 0x03, 0x67, 0x26, 0x00, 0x22, 0x82, 0x66,
+    0x03, 0x67, 0x1e, 0x00, 0x1f, 0x84, 0x66, 0x03, 0x67, 0x2d, 0x00, 0x18, 0x82, 0x66, 0x00, 0x65,
+    0xb5, 0x66, 0x08, 0x38, 0x05, 0x01, 0x03, 0x38, 0x65, 0x66, 0x65, 0x65, 0x82, 0x66, 0x04, 0x67,
+    0x65, 0x66, 0x66, 0x67, 0xd0, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xc8, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x02, 0x65, 0x66, 0x67, 0x98, 0x66, 0x0b, 0x67, 0x66, 0x00, 0x21, 0x66, 0x66, 0x3e,
+    0x00, 0x31, 0x66, 0x66, 0x67, 0xb9, 0x66, 0x09, 0x54, 0x00, 0x00, 0x2b, 0x5d, 0x5b, 0x2f, 0x00,
+    0x00, 0x48, 0x82, 0x66, 0x07, 0x67, 0x65, 0x43, 0x00, 0x00, 0x37, 0x66, 0x65, 0x99, 0x66, 0x00,
+    0x67, 0x9a, 0x66, 0x05, 0x54, 0x17, 0x00, 0x00, 0x18, 0x57, 0xdd, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0xcb, 0x66, 0x00, 0x67, 0x9d, 0x66, 0x06, 0x00, 0x21, 0x66, 0x66, 0x3e, 0x00, 0x31,
+    0xb8, 0x66, 0x82, 0x67, 0x02, 0x66, 0x66, 0x2a, 0x85, 0x00, 0x00, 0x29, 0x83, 0x66, 0x05, 0x33,
+    0x16, 0x00, 0x00, 0x10, 0x60, 0x9b, 0x66, 0x00, 0x65, 0x99, 0x66, 0x04, 0x36, 0x01, 0x00, 0x08,
+    0x38, 0x86, 0x5e, 0x00, 0x5d, 0x82, 0x5e, 0x02, 0x5d, 0x57, 0x50, 0xd1, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0x95, 0x88, 0x02, 0x66, 0x67, 0x65, 0x83, 0x66, 0x00, 0x65, 0xe2, 0x66, 0x06, 0x00, 0x21,
+    0x65, 0x66, 0x3e, 0x00, 0x31, 0xb6, 0x66, 0x00, 0x65, 0x82, 0x66, 0x0a, 0x65, 0x66, 0x66, 0x67,
+    0x38, 0x08, 0x00, 0x00, 0x07, 0x2c, 0x65, 0x82, 0x66, 0x07, 0x65, 0x1c, 0x00, 0x00, 0x0d, 0x5a,
+    0x66, 0x65, 0x83, 0x66, 0x00, 0x67, 0xb0, 0x66, 0x00, 0x22, 0x90, 0x00, 0x00, 0x0e, 0x82, 0x66,
+    0x00, 0x65, 0xcd, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xcb, 0x66, 0x00, 0x65, 0x9d, 0x66,
+    0x06, 0x0e, 0x2a, 0x66, 0x66, 0x47, 0x0d, 0x39, 0xb8, 0x66, 0x00, 0x65, 0x85, 0x66, 0x05, 0x65,
+    0x57, 0x54, 0x65, 0x66, 0x65, 0x82, 0x66, 0x04, 0x67, 0x34, 0x24, 0x3e, 0x63, 0xb8, 0x66, 0x00,
+    0x22, 0x90, 0x00, 0x00, 0x0f, 0xd1, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x00, 0x69, 0xc7,
+    0x66, 0x00, 0x68, 0xa3, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x65, 0xb9, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x00, 0x67, 0x87, 0x66, 0x00, 0x67, 0x8a, 0x66, 0x00, 0x67, 0x96, 0x66, 0x00, 0x65, 0x99,
+    0x66, 0x02, 0x58, 0x58, 0x5e, 0x86, 0x61, 0x00, 0x62, 0x84, 0x61, 0x05, 0x60, 0x5b, 0x57, 0x66,
+    0x67, 0x65, 0xce, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x03, 0x6e, 0x66, 0x66, 0x67, 0x82,
+    0x66, 0x00, 0x67, 0xc0, 0x66, 0x01, 0x70, 0x65, 0x9f, 0x66, 0x00, 0x67, 0xf1, 0x66, 0x00, 0x67,
+    0xaa, 0x66, 0x05, 0x65, 0x65, 0x66, 0x66, 0x67, 0x67, 0xcd, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x00, 0x79, 0x83, 0x66, 0x00, 0x65, 0xc2, 0x66, 0x00, 0x79, 0xa7, 0x66, 0x00, 0x65, 0xc5,
+    0x66, 0x00, 0x67, 0x88, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x00, 0x67, 0x85,
+    0x66, 0x00, 0x67, 0xdb, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x01, 0x7f, 0x75, 0xbd, 0x66,
+    0x00, 0x67, 0x84, 0x66, 0x03, 0x65, 0x66, 0x74, 0x7f, 0x83, 0x66, 0x00, 0x67, 0xff, 0x66, 0xd8,
+    0x66, 0x00, 0x69, 0x83, 0x66, 0x00, 0x65, 0xae, 0x66, 0x00, 0x68, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x05, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0x67, 0xbc, 0x66, 0x06, 0x67, 0x66, 0x69, 0x6e, 0x7a,
+    0x7f, 0x84, 0xff, 0x66, 0xdd, 0x66, 0x03, 0x6e, 0x65, 0x67, 0x65, 0xab, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x01, 0x67, 0x70, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x04, 0x84, 0x7f, 0x79, 0x70, 0x69,
+    0xbf, 0x66, 0x04, 0x68, 0x70, 0x7b, 0x7f, 0x84, 0xff, 0x66, 0xdd, 0x66, 0x02, 0x7a, 0x66, 0x65,
+    0xaf, 0x66, 0x02, 0x67, 0x66, 0x79, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x02, 0x7f, 0x75, 0x65,
+    0xc4, 0x66, 0x01, 0x76, 0x7f, 0xff, 0x66, 0xdd, 0x66, 0x03, 0x7f, 0x75, 0x66, 0x65, 0xad, 0x66,
+    0x04, 0x65, 0x66, 0x74, 0x7f, 0x87, 0xa0, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x00, 0x7b, 0x82, 0x65,
+    0xc3, 0x66, 0x05, 0x67, 0x7a, 0x67, 0x66, 0x66, 0x65, 0xff, 0x66, 0xd9, 0x66, 0x04, 0x84, 0x7f,
+    0x79, 0x6e, 0x68, 0xab, 0x66, 0x04, 0x69, 0x6e, 0x7a, 0x7f, 0x85, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x00, 0x6f, 0xbf, 0x66, 0x00, 0x67, 0x85, 0x66, 0x05, 0x67, 0x6f, 0x66, 0x66, 0x65, 0x65,
+    0xff, 0x66, 0xd9, 0x66, 0x04, 0x84, 0x7e, 0x79, 0x70, 0x68, 0xab, 0x66, 0x04, 0x68, 0x70, 0x7b,
+    0x7f, 0x84, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x02, 0x69, 0x65, 0x65, 0x83, 0x66, 0x00, 0x65,
+    0xbd, 0x66, 0x03, 0x67, 0x65, 0x66, 0x68, 0x83, 0x66, 0x00, 0x67, 0xff, 0x66, 0xd8, 0x66, 0x04,
+    0x80, 0x74, 0x66, 0x66, 0x65, 0xae, 0x66, 0x01, 0x76, 0x7f, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0xbf, 0x66, 0x00, 0x65, 0xff, 0x66, 0xe6, 0x66, 0x00, 0x7a, 0xaf, 0x66, 0x04, 0x67, 0x66, 0x66,
+    0x67, 0x7a, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x03, 0x6f,
+    0x66, 0x66, 0x68, 0xaf, 0x66, 0x01, 0x67, 0x70, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xa7, 0x66, 0x02, 0x69, 0x66, 0x65, 0xae, 0x66, 0x03, 0x67, 0x65, 0x66, 0x68, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xd9, 0x66, 0x03, 0x65, 0x67, 0x66, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x67, 0xb2, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xab, 0x66, 0x00, 0x65, 0xaa, 0x66, 0x00, 0x65, 0x84, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa8, 0x66, 0x82, 0x65, 0xad, 0x66,
+    0x03, 0x65, 0x65, 0x66, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdc,
+    0x66, 0x00, 0x65, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0x8a, 0x66, 0x00, 0x67, 0x89,
+    0x66, 0x00, 0x65, 0xc6, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x00, 0x67, 0xb7,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xcb, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xbc, 0x66,
+    0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66,
+    0x86, 0x66, 0x00, 0x65, 0xb9, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x00, 0x69,
+    0x83, 0x66, 0x00, 0x65, 0xbd, 0x66, 0x01, 0x67, 0x65, 0x82, 0x66, 0x06, 0x68, 0x69, 0x66, 0x66,
+    0x65, 0x66, 0x67, 0x84, 0x66, 0x00, 0x65, 0xbc, 0x66, 0x01, 0x68, 0x69, 0x85, 0x66, 0x00, 0x65,
+    0xb9, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x68, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0xc9, 0x66, 0x00, 0x6e, 0xc7, 0x66, 0x07, 0x70, 0x6e, 0x66, 0x65, 0x66, 0x65, 0x66, 0x65, 0x83,
+    0x66, 0x00, 0x65, 0xbb, 0x66, 0x05, 0x67, 0x70, 0x6e, 0x66, 0x66, 0x67, 0x82, 0x66, 0x01, 0x67,
+    0x65, 0xb8, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x70, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0xc9, 0x66, 0x05, 0x79, 0x66, 0x67, 0x66, 0x66, 0x65, 0xbd, 0x66, 0x06, 0x67, 0x66, 0x66,
+    0x67, 0x66, 0x79, 0x79, 0xc4, 0x66, 0x07, 0x65, 0x66, 0x66, 0x79, 0x79, 0x66, 0x65, 0x67, 0xc4,
+    0x66, 0x00, 0x79, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x03, 0x80, 0x75,
+    0x66, 0x65, 0xbf, 0x66, 0x00, 0x67, 0x82, 0x66, 0x03, 0x73, 0x7f, 0x7f, 0x76, 0x82, 0x66, 0x00,
+    0x65, 0xbe, 0x66, 0x06, 0x67, 0x66, 0x66, 0x74, 0x7e, 0x7f, 0x75, 0xc3, 0x66, 0x03, 0x65, 0x66,
+    0x73, 0x7f, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xc9, 0x66, 0x05, 0x84, 0x7f, 0x79,
+    0x6d, 0x68, 0x65, 0xba, 0x66, 0x10, 0x65, 0x66, 0x67, 0x66, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x84,
+    0x80, 0x79, 0x6e, 0x68, 0x66, 0x66, 0x67, 0xbc, 0x66, 0x09, 0x68, 0x6e, 0x7a, 0x7f, 0x85, 0x86,
+    0x7f, 0x7a, 0x6e, 0x68, 0xbd, 0x66, 0x06, 0x65, 0x66, 0x69, 0x6e, 0x7a, 0x7f, 0x84, 0xb5, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xc8, 0x66, 0x06, 0x65, 0x84, 0x7f, 0x7a, 0x70, 0x69, 0x65,
+    0xbe, 0x66, 0x0c, 0x69, 0x70, 0x7c, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x70, 0x6a, 0x66, 0x66, 0x65,
+    0xbb, 0x66, 0x0a, 0x65, 0x68, 0x70, 0x7a, 0x80, 0x84, 0x84, 0x7e, 0x79, 0x70, 0x69, 0xbf, 0x66,
+    0x04, 0x68, 0x70, 0x7b, 0x7f, 0x84, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa3, 0x66,
+    0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0x9f, 0x66, 0x01, 0x7f, 0x74, 0xc5, 0x66, 0x04, 0x75, 0x7f,
+    0x7f, 0x74, 0x65, 0xc3, 0x66, 0x05, 0x65, 0x75, 0x80, 0x7f, 0x74, 0x65, 0x85, 0x66, 0x00, 0x67,
+    0xb9, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x77, 0x7f, 0x97, 0x66, 0x01, 0x65, 0x67, 0x9b, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x98, 0x66, 0x00, 0x67, 0xaf, 0x66, 0x00, 0x7a, 0xc2, 0x66,
+    0x06, 0x65, 0x66, 0x67, 0x67, 0x66, 0x7a, 0x7b, 0xc7, 0x66, 0x04, 0x7a, 0x7b, 0x66, 0x66, 0x65,
+    0x83, 0x66, 0x00, 0x67, 0xbe, 0x66, 0x01, 0x67, 0x7a, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x9e, 0x66, 0x02, 0x67, 0x66, 0x67, 0x82, 0x66, 0x00, 0x65, 0x86, 0x66, 0x00, 0x67, 0x9b,
+    0x66, 0x00, 0x6f, 0x83, 0x66, 0x00, 0x65, 0xc2, 0x66, 0x03, 0x70, 0x6f, 0x66, 0x65, 0xc5, 0x66,
+    0x01, 0x70, 0x70, 0xc6, 0x66, 0x01, 0x67, 0x70, 0x92, 0x66, 0x03, 0x67, 0x62, 0x66, 0x67, 0x82,
+    0x66, 0x06, 0x67, 0x4e, 0x38, 0x2b, 0x30, 0x42, 0x58, 0x82, 0x66, 0x03, 0x65, 0x65, 0x66, 0x65,
+    0x8d, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x03, 0x25, 0x09, 0x0e, 0x10, 0x88,
+    0x11, 0x07, 0x12, 0x12, 0x11, 0x10, 0x0a, 0x10, 0x66, 0x65, 0x97, 0x66, 0x02, 0x65, 0x65, 0x69,
+    0x82, 0x66, 0x00, 0x65, 0xbc, 0x66, 0x00, 0x67, 0x85, 0x66, 0x01, 0x68, 0x69, 0xc7, 0x66, 0x01,
+    0x68, 0x69, 0xc4, 0x66, 0x03, 0x67, 0x65, 0x66, 0x68, 0x8f, 0x66, 0x05, 0x67, 0x66, 0x65, 0x3b,
+    0x08, 0x54, 0x82, 0x66, 0x01, 0x58, 0x16, 0x84, 0x00, 0x04, 0x01, 0x2c, 0x62, 0x66, 0x67, 0x90,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x00, 0x22, 0x90, 0x00, 0x02, 0x0d, 0x67,
+    0x65, 0x9a, 0x66, 0x00, 0x67, 0xc1, 0x66, 0x06, 0x65, 0x66, 0x65, 0x65, 0x66, 0x66, 0x67, 0xc5,
+    0x66, 0x02, 0x65, 0x66, 0x67, 0xda, 0x66, 0x11, 0x65, 0x2a, 0x00, 0x00, 0x34, 0x66, 0x67, 0x5b,
+    0x0c, 0x00, 0x00, 0x13, 0x22, 0x24, 0x0d, 0x00, 0x00, 0x1a, 0x92, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0x98, 0x66, 0x04, 0x67, 0x66, 0x4c, 0x43, 0x49, 0x8c, 0x4b, 0x02, 0x49, 0x44, 0x46,
+    0xe5, 0x66, 0x00, 0x65, 0xc7, 0x66, 0x00, 0x65, 0xda, 0x66, 0x0a, 0x4f, 0x00, 0x00, 0x23, 0x58,
+    0x66, 0x66, 0x2a, 0x00, 0x0a, 0x4a, 0x83, 0x66, 0x03, 0x3c, 0x00, 0x00, 0x40, 0x91, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x9c, 0x66, 0x03, 0x67, 0x65, 0x67, 0x61, 0x83, 0x65, 0x86, 0x66,
+    0x01, 0x65, 0x67, 0x9f, 0x66, 0x00, 0x65, 0xbf, 0x66, 0x00, 0x67, 0xff, 0x66, 0xa8, 0x66, 0x09,
+    0x26, 0x00, 0x21, 0x67, 0x66, 0x66, 0x64, 0x04, 0x01, 0x48, 0x85, 0x66, 0x02, 0x35, 0x00, 0x12,
+    0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9b, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x38,
+    0x05, 0x2e, 0x88, 0x66, 0x00, 0x65, 0xdd, 0x66, 0x01, 0x65, 0x65, 0x83, 0x66, 0x00, 0x65, 0xff,
+    0x66, 0xa5, 0x66, 0x03, 0x65, 0x0a, 0x00, 0x58, 0x82, 0x66, 0x02, 0x58, 0x00, 0x0d, 0x86, 0x66,
+    0x03, 0x5f, 0x00, 0x01, 0x64, 0x90, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00,
+    0x67, 0xa7, 0x66, 0x95, 0x88, 0x98, 0x66, 0x03, 0x65, 0x67, 0x66, 0x67, 0x82, 0x66, 0x02, 0x2e,
+    0x00, 0x2e, 0x86, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0xff, 0x66, 0xff, 0x66, 0x8a, 0x66, 0x0a,
+    0x02, 0x02, 0x66, 0x66, 0x65, 0x66, 0x4e, 0x00, 0x1d, 0x66, 0x65, 0x84, 0x66, 0x06, 0x67, 0x11,
+    0x00, 0x56, 0x66, 0x66, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00,
+    0x67, 0x8a, 0x66, 0x00, 0x67, 0x9a, 0x66, 0x95, 0x88, 0x9b, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02,
+    0x2f, 0x00, 0x36, 0x8a, 0x66, 0x01, 0x65, 0x65, 0xff, 0x66, 0xff, 0x66, 0x88, 0x66, 0x08, 0x10,
+    0x00, 0x52, 0x67, 0x65, 0x66, 0x58, 0x00, 0x14, 0x86, 0x66, 0x03, 0x67, 0x0c, 0x00, 0x59, 0x90,
+    0x66, 0xa1, 0x88, 0x9b, 0x66, 0x04, 0x65, 0x66, 0x67, 0x66, 0x65, 0x83, 0x66, 0x01, 0x67, 0x67,
+    0x83, 0x66, 0x03, 0x65, 0x61, 0x59, 0x67, 0x9a, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x02, 0x3c, 0x00,
+    0x21, 0xff, 0x66, 0xff, 0x66, 0x95, 0x66, 0x02, 0x28, 0x00, 0x33, 0x83, 0x66, 0x02, 0x04, 0x02,
+    0x5c, 0x84, 0x66, 0x05, 0x65, 0x58, 0x00, 0x02, 0x66, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0x9a, 0x66,
+    0x0a, 0x65, 0x66, 0x67, 0x66, 0x66, 0x3c, 0x04, 0x2e, 0x68, 0x67, 0x65, 0x83, 0x66, 0x03, 0x67,
+    0x4a, 0x03, 0x1f, 0x9b, 0x66, 0x95, 0x88, 0x98, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x82, 0x66,
+    0x03, 0x5e, 0x04, 0x02, 0x4e, 0x89, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0x89, 0x66, 0x03,
+    0x44, 0x00, 0x05, 0x3f, 0x82, 0x66, 0x0f, 0x2e, 0x00, 0x20, 0x67, 0x66, 0x67, 0x66, 0x66, 0x65,
+    0x19, 0x01, 0x2a, 0x67, 0x66, 0x66, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x00, 0x65, 0x84,
+    0x66, 0x02, 0x3e, 0x00, 0x34, 0x82, 0x66, 0x00, 0x65, 0x83, 0x66, 0x03, 0x62, 0x06, 0x0a, 0x67,
+    0x9a, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x0a, 0x65, 0x65, 0x66, 0x65, 0x66, 0x66, 0x3b, 0x00, 0x07,
+    0x42, 0x64, 0x85, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0x8c, 0x66, 0x11, 0x28, 0x00, 0x00,
+    0x27, 0x58, 0x66, 0x61, 0x0b, 0x00, 0x20, 0x5a, 0x66, 0x66, 0x53, 0x18, 0x00, 0x03, 0x5b, 0x91,
+    0x66, 0xa1, 0x88, 0x98, 0x66, 0x02, 0x67, 0x66, 0x67, 0x83, 0x66, 0x02, 0x41, 0x00, 0x37, 0x87,
+    0x66, 0x03, 0x65, 0x08, 0x00, 0x5f, 0x9a, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x07, 0x48, 0x10, 0x01,
+    0x00, 0x00, 0x03, 0x11, 0x10, 0x82, 0x11, 0x02, 0x0f, 0x0a, 0x10, 0xff, 0x66, 0xff, 0x66, 0x89,
+    0x66, 0x03, 0x65, 0x66, 0x63, 0x1d, 0x82, 0x00, 0x02, 0x12, 0x2a, 0x2a, 0x82, 0x00, 0x07, 0x08,
+    0x05, 0x00, 0x00, 0x02, 0x3c, 0x66, 0x67, 0x90, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x12, 0x38, 0x39,
+    0x3f, 0x2a, 0x00, 0x23, 0x42, 0x42, 0x43, 0x43, 0x42, 0x43, 0x43, 0x42, 0x2c, 0x00, 0x02, 0x63,
+    0x67, 0x99, 0x66, 0x95, 0x88, 0x9d, 0x66, 0x02, 0x67, 0x66, 0x42, 0x8b, 0x00, 0x02, 0x0e, 0x66,
+    0x67, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66, 0x05, 0x67, 0x66, 0x66, 0x65, 0x3d, 0x0f, 0x89, 0x00,
+    0x05, 0x1c, 0x4f, 0x66, 0x66, 0x67, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x06, 0x8e,
+    0x00, 0x00, 0x26, 0x9b, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x00, 0x65, 0x83, 0x66, 0x04, 0x5a, 0x40,
+    0x48, 0x4a, 0x4a, 0x85, 0x4b, 0x03, 0x49, 0x44, 0x46, 0x67, 0xff, 0x66, 0xff, 0x66, 0x8a, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x0b, 0x55, 0x44, 0x37, 0x2c, 0x20, 0x21, 0x30, 0x3e, 0x4c, 0x5c, 0x66,
+    0x67, 0x93, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x00, 0x67, 0x83, 0x66, 0x05, 0x11, 0x0f, 0x15, 0x10,
+    0x00, 0x0a, 0x86, 0x19, 0x03, 0x18, 0x1e, 0x30, 0x60, 0x9b, 0x66, 0x95, 0x88, 0xa2, 0x66, 0x00,
+    0x65, 0x82, 0x66, 0x04, 0x67, 0x65, 0x66, 0x67, 0x67, 0xff, 0x66, 0xff, 0x66, 0x8d, 0x66, 0x00,
+    0x67, 0xa2, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x02, 0x41, 0x00, 0x36, 0x82, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x67, 0x9f, 0x66, 0x95, 0x88, 0x98, 0x66, 0x02, 0x67, 0x66, 0x67, 0x84, 0x66, 0x00, 0x65,
+    0x87, 0x66, 0x06, 0x65, 0x66, 0x60, 0x58, 0x66, 0x66, 0x65, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66,
+    0x04, 0x2b, 0x1a, 0x42, 0x66, 0x65, 0x9f, 0x66, 0xa1, 0x88, 0x9e, 0x66, 0x06, 0x65, 0x3e, 0x00,
+    0x30, 0x66, 0x66, 0x67, 0x82, 0x66, 0x06, 0x67, 0x67, 0x65, 0x66, 0x65, 0x66, 0x67, 0x99, 0x66,
+    0x95, 0x88, 0x9c, 0x66, 0x08, 0x67, 0x66, 0x66, 0x3c, 0x05, 0x2e, 0x66, 0x66, 0x67, 0x84, 0x66,
+    0x02, 0x4a, 0x02, 0x1f, 0xff, 0x66, 0xff, 0x66, 0x8a, 0x66, 0x02, 0x1b, 0x00, 0x3f, 0x84, 0x66,
+    0x02, 0x3e, 0x3a, 0x5a, 0x99, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x3f,
+    0x0c, 0x32, 0x86, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0x9b, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x0c,
+    0x65, 0x66, 0x66, 0x67, 0x66, 0x3e, 0x00, 0x34, 0x67, 0x66, 0x66, 0x67, 0x65, 0x82, 0x66, 0x05,
+    0x63, 0x05, 0x0a, 0x66, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66, 0x02, 0x20, 0x00, 0x43,
+    0x84, 0x66, 0x02, 0x0d, 0x00, 0x48, 0x99, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x07, 0x3b, 0x20, 0x4f,
+    0x66, 0x65, 0x60, 0x58, 0x5f, 0x8a, 0x66, 0x00, 0x65, 0x9a, 0x66, 0x95, 0x88, 0x9e, 0x66, 0x03,
+    0x65, 0x41, 0x00, 0x37, 0x82, 0x66, 0x01, 0x65, 0x65, 0x82, 0x66, 0x05, 0x65, 0x08, 0x00, 0x5f,
+    0x66, 0x65, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66, 0x02, 0x22, 0x00, 0x45, 0x84, 0x66, 0x04, 0x15,
+    0x00, 0x4f, 0x66, 0x67, 0x97, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x07, 0x23, 0x00, 0x45, 0x66, 0x66,
+    0x37, 0x00, 0x2d, 0x83, 0x66, 0x00, 0x65, 0xa1, 0x66, 0x95, 0x88, 0x98, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x05, 0x38, 0x39, 0x3f, 0x2b, 0x00, 0x24, 0x82, 0x43, 0x09, 0x44, 0x43, 0x43, 0x42, 0x42,
+    0x2c, 0x00, 0x02, 0x64, 0x67, 0xff, 0x66, 0xff, 0x66, 0x88, 0x66, 0x02, 0x22, 0x00, 0x47, 0x84,
+    0x66, 0x02, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x08, 0x65, 0x10, 0x00, 0x5f,
+    0x67, 0x66, 0x3e, 0x00, 0x35, 0x84, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0x9c, 0x66, 0x95,
+    0x88, 0x9a, 0x66, 0x02, 0x65, 0x66, 0x06, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x03, 0x25, 0x67,
+    0x65, 0x67, 0xff, 0x66, 0xff, 0x66, 0x86, 0x66, 0x0b, 0x67, 0x22, 0x00, 0x47, 0x67, 0x66, 0x67,
+    0x66, 0x66, 0x18, 0x00, 0x52, 0x82, 0x66, 0x00, 0x65, 0x95, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x0c,
+    0x67, 0x16, 0x00, 0x49, 0x66, 0x65, 0x40, 0x00, 0x37, 0x66, 0x67, 0x66, 0x67, 0x85, 0x66, 0x00,
+    0x65, 0x9b, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x07, 0x65, 0x66, 0x11, 0x0f, 0x16, 0x10, 0x00, 0x09,
+    0x85, 0x19, 0x06, 0x1a, 0x19, 0x1e, 0x30, 0x5f, 0x66, 0x68, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66,
+    0x05, 0x65, 0x22, 0x00, 0x46, 0x66, 0x65, 0x82, 0x66, 0x02, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1,
+    0x88, 0x98, 0x66, 0x09, 0x65, 0x66, 0x2a, 0x00, 0x0f, 0x35, 0x3c, 0x28, 0x00, 0x23, 0x87, 0x3e,
+    0x02, 0x3c, 0x37, 0x36, 0x9b, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x02, 0x41, 0x00, 0x36, 0x87, 0x66,
+    0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0x89, 0x66, 0x07, 0x65, 0x66, 0x66, 0x22, 0x00, 0x46, 0x66,
+    0x67, 0x82, 0x66, 0x02, 0x19, 0x00, 0x53, 0x88, 0x66, 0x00, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0x9a,
+    0x66, 0x01, 0x5d, 0x08, 0x88, 0x00, 0x00, 0x01, 0x85, 0x00, 0x02, 0x0e, 0x66, 0x67, 0x99, 0x66,
+    0x95, 0x88, 0x9b, 0x66, 0x07, 0x65, 0x65, 0x66, 0x66, 0x3e, 0x00, 0x30, 0x67, 0x84, 0x66, 0x00,
+    0x67, 0xff, 0x66, 0xff, 0x66, 0x8e, 0x66, 0x02, 0x22, 0x00, 0x47, 0x83, 0x66, 0x03, 0x67, 0x17,
+    0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x09, 0x5d, 0x32, 0x24, 0x1d, 0x0e, 0x00, 0x10,
+    0x1e, 0x1e, 0x1d, 0x84, 0x1e, 0x03, 0x1a, 0x13, 0x1e, 0x67, 0x9a, 0x66, 0x95, 0x88, 0x9f, 0x66,
+    0x06, 0x3f, 0x0c, 0x32, 0x67, 0x66, 0x66, 0x67, 0xff, 0x66, 0xdd, 0x66, 0x00, 0x67, 0xaf, 0x66,
+    0x05, 0x67, 0x66, 0x66, 0x22, 0x00, 0x3e, 0x82, 0x5e, 0x05, 0x5d, 0x5f, 0x16, 0x00, 0x4c, 0x5f,
+    0x83, 0x5e, 0x02, 0x5c, 0x58, 0x51, 0x91, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x08, 0x41, 0x00, 0x36, 0x66, 0x66, 0x65, 0x66, 0x67, 0x67, 0x84, 0x66, 0x00, 0x65, 0x9a, 0x66,
+    0x95, 0x88, 0x99, 0x66, 0x00, 0x65, 0x84, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x82, 0x66, 0x00,
+    0x65, 0x84, 0x66, 0x02, 0x67, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x84, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x04, 0x21, 0x01, 0x00, 0x00, 0x01, 0x8c, 0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0x98,
+    0x66, 0x02, 0x65, 0x66, 0x65, 0x82, 0x66, 0x03, 0x65, 0x3e, 0x00, 0x30, 0x84, 0x66, 0x00, 0x65,
+    0xa0, 0x66, 0x95, 0x88, 0x9d, 0x66, 0x06, 0x54, 0x24, 0x45, 0x66, 0x66, 0x65, 0x68, 0x82, 0x66,
+    0x02, 0x0d, 0x17, 0x42, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0xd5, 0x66, 0x00, 0x65, 0xae, 0x66,
+    0x04, 0x67, 0x66, 0x65, 0x67, 0x1d, 0x90, 0x00, 0x03, 0x0e, 0x66, 0x66, 0x65, 0x8e, 0x66, 0xa1,
+    0x88, 0x9a, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x3f, 0x0c, 0x32, 0x82, 0x66, 0x02, 0x65, 0x67,
+    0x67, 0xa0, 0x66, 0x95, 0x88, 0x97, 0x66, 0x00, 0x67, 0x82, 0x66, 0x04, 0x67, 0x38, 0x01, 0x00,
+    0x25, 0x83, 0x66, 0x02, 0x67, 0x65, 0x5b, 0x82, 0x00, 0x00, 0x25, 0xff, 0x66, 0xd3, 0x66, 0x00,
+    0x67, 0x84, 0x66, 0x00, 0x65, 0xaf, 0x66, 0x08, 0x65, 0x67, 0x55, 0x4f, 0x56, 0x5e, 0x5b, 0x5c,
+    0x5d, 0x88, 0x5c, 0x02, 0x5a, 0x55, 0x53, 0x82, 0x66, 0x00, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0x9a,
+    0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0x88, 0x66, 0x01, 0x65, 0x65, 0x84, 0x66, 0x00, 0x65, 0x99,
+    0x66, 0x95, 0x88, 0x98, 0x66, 0x09, 0x65, 0x66, 0x66, 0x41, 0x00, 0x01, 0x0b, 0x3e, 0x66, 0x67,
+    0x83, 0x66, 0x07, 0x63, 0x42, 0x1c, 0x00, 0x00, 0x38, 0x66, 0x65, 0xff, 0x66, 0xff, 0x66, 0x91,
+    0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x65, 0x94, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x05, 0x65, 0x67,
+    0x66, 0x5e, 0x57, 0x5b, 0x82, 0x66, 0x03, 0x65, 0x66, 0x64, 0x67, 0x86, 0x66, 0x02, 0x65, 0x63,
+    0x67, 0x9a, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x04, 0x5f, 0x08, 0x00, 0x1f, 0x62, 0x82, 0x66, 0x00,
+    0x65, 0x85, 0x66, 0x03, 0x31, 0x00, 0x02, 0x4e, 0xff, 0x66, 0xd1, 0x66, 0x00, 0x65, 0x84, 0x66,
+    0x00, 0x67, 0xaf, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0x83, 0x66,
+    0x02, 0x67, 0x66, 0x65, 0x94, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x0a, 0x23, 0x00, 0x19, 0x66, 0x67,
+    0x43, 0x02, 0x09, 0x0b, 0x0c, 0x0b, 0x84, 0x0c, 0x03, 0x0a, 0x05, 0x0e, 0x67, 0x9a, 0x66, 0x95,
+    0x88, 0x9a, 0x66, 0x03, 0x32, 0x00, 0x0d, 0x60, 0x8a, 0x66, 0x03, 0x65, 0x1d, 0x00, 0x27, 0xbd,
+    0x66, 0x00, 0x65, 0xbc, 0x66, 0x00, 0x67, 0x8a, 0x66, 0x00, 0x67, 0x83, 0x66, 0x01, 0x67, 0x67,
+    0x82, 0x66, 0x01, 0x4b, 0x2a, 0xb8, 0x66, 0x00, 0x65, 0x8e, 0x66, 0x00, 0x67, 0xd1, 0x66, 0xa1,
+    0x88, 0x9a, 0x66, 0x05, 0x21, 0x00, 0x1a, 0x66, 0x66, 0x42, 0x8b, 0x00, 0x00, 0x0d, 0x9b, 0x66,
+    0x95, 0x88, 0x99, 0x66, 0x03, 0x67, 0x1f, 0x01, 0x40, 0x8c, 0x66, 0x02, 0x50, 0x00, 0x13, 0xbb,
+    0x66, 0x00, 0x65, 0xc2, 0x66, 0x04, 0x67, 0x66, 0x66, 0x67, 0x67, 0x84, 0x66, 0x01, 0x67, 0x65,
+    0x82, 0x66, 0x05, 0x61, 0x3d, 0x12, 0x00, 0x0e, 0x67, 0xb6, 0x66, 0x09, 0x65, 0x67, 0x65, 0x66,
+    0x66, 0x65, 0x66, 0x65, 0x66, 0x65, 0x86, 0x66, 0x04, 0x67, 0x68, 0x66, 0x66, 0x67, 0xcd, 0x66,
+    0xa1, 0x88, 0x97, 0x66, 0x0b, 0x67, 0x66, 0x66, 0x49, 0x37, 0x42, 0x66, 0x66, 0x59, 0x45, 0x4c,
+    0x4f, 0x86, 0x50, 0x04, 0x4e, 0x49, 0x4a, 0x66, 0x65, 0x99, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x04,
+    0x0e, 0x00, 0x54, 0x66, 0x67, 0x88, 0x66, 0x05, 0x65, 0x66, 0x63, 0x02, 0x02, 0x63, 0xfa, 0x66,
+    0x00, 0x67, 0x8d, 0x66, 0x04, 0x64, 0x66, 0x53, 0x2a, 0x06, 0x82, 0x00, 0x00, 0x0e, 0xb6, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x01, 0x5d, 0x59, 0x84, 0x66, 0x05, 0x42, 0x29, 0x19, 0x22, 0x35, 0x5c,
+    0xd3, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x03, 0x67, 0x67, 0x66, 0x67, 0x9a,
+    0x66, 0x95, 0x88, 0x99, 0x66, 0x03, 0x65, 0x02, 0x00, 0x62, 0x8c, 0x66, 0x03, 0x65, 0x0d, 0x00,
+    0x55, 0xbd, 0x66, 0x01, 0x67, 0x67, 0xc4, 0x66, 0x06, 0x67, 0x65, 0x67, 0x66, 0x62, 0x40, 0x16,
+    0x82, 0x00, 0x04, 0x02, 0x22, 0x41, 0x5f, 0x67, 0xb6, 0x66, 0x09, 0x65, 0x34, 0x13, 0x00, 0x00,
+    0x09, 0x3a, 0x66, 0x61, 0x1d, 0x84, 0x00, 0x01, 0x08, 0x4a, 0xd2, 0x66, 0xa1, 0x88, 0x98, 0x66,
+    0x01, 0x65, 0x67, 0x83, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x5f, 0x85, 0x5a, 0x02, 0x58, 0x53,
+    0x4e, 0x9b, 0x66, 0x95, 0x88, 0x9a, 0x66, 0x03, 0x0e, 0x00, 0x52, 0x65, 0x8b, 0x66, 0x03, 0x62,
+    0x01, 0x00, 0x60, 0xba, 0x66, 0x01, 0x67, 0x65, 0xc3, 0x66, 0x08, 0x67, 0x66, 0x67, 0x66, 0x66,
+    0x65, 0x56, 0x2d, 0x07, 0x82, 0x00, 0x08, 0x0e, 0x37, 0x5e, 0x67, 0x65, 0x66, 0x67, 0x65, 0x65,
+    0xb4, 0x66, 0x00, 0x39, 0x85, 0x00, 0x0b, 0x34, 0x2e, 0x00, 0x03, 0x26, 0x32, 0x25, 0x04, 0x00,
+    0x09, 0x62, 0x65, 0xd0, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x03, 0x67, 0x62, 0x2f, 0x07, 0x88, 0x00,
+    0x01, 0x0d, 0x67, 0x9a, 0x66, 0x95, 0x88, 0x99, 0x66, 0x03, 0x67, 0x20, 0x00, 0x3d, 0x8c, 0x66,
+    0x02, 0x4e, 0x00, 0x0c, 0xbe, 0x66, 0x02, 0x3f, 0x00, 0x12, 0xb7, 0x66, 0x00, 0x67, 0x89, 0x66,
+    0x02, 0x64, 0x43, 0x19, 0x82, 0x00, 0x07, 0x07, 0x06, 0x00, 0x46, 0x65, 0x66, 0x66, 0x67, 0xb7,
+    0x66, 0x0b, 0x57, 0x03, 0x00, 0x2e, 0x58, 0x5b, 0x3d, 0x05, 0x03, 0x04, 0x09, 0x57, 0x82, 0x66,
+    0x05, 0x58, 0x0a, 0x01, 0x38, 0x66, 0x67, 0xcf, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x04, 0x67, 0x66,
+    0x67, 0x66, 0x1e, 0x82, 0x00, 0x00, 0x01, 0x84, 0x02, 0x04, 0x00, 0x00, 0x10, 0x66, 0x65, 0x99,
+    0x66, 0x95, 0x88, 0x98, 0x66, 0x05, 0x68, 0x65, 0x32, 0x00, 0x0e, 0x60, 0x89, 0x66, 0x04, 0x67,
+    0x65, 0x1a, 0x00, 0x1e, 0xbe, 0x66, 0x02, 0x46, 0x00, 0x16, 0xb7, 0x66, 0x0b, 0x67, 0x66, 0x65,
+    0x66, 0x66, 0x67, 0x65, 0x65, 0x66, 0x58, 0x30, 0x07, 0x82, 0x00, 0x05, 0x1a, 0x42, 0x63, 0x26,
+    0x00, 0x46, 0x83, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xb2, 0x66, 0x0a, 0x3b, 0x00, 0x1e,
+    0x66, 0x67, 0x66, 0x67, 0x40, 0x00, 0x00, 0x39, 0x82, 0x66, 0x04, 0x67, 0x66, 0x3c, 0x00, 0x24,
+    0xd1, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x0c, 0x65, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x4e, 0x00,
+    0x00, 0x28, 0x49, 0x64, 0x82, 0x66, 0x05, 0x67, 0x66, 0x67, 0x62, 0x5d, 0x67, 0x9a, 0x66, 0x95,
+    0x88, 0x9a, 0x66, 0x03, 0x5e, 0x08, 0x00, 0x21, 0x8a, 0x66, 0x03, 0x2e, 0x00, 0x00, 0x4e, 0xbe,
+    0x66, 0x02, 0x48, 0x00, 0x17, 0xbe, 0x66, 0x01, 0x47, 0x1c, 0x82, 0x00, 0x08, 0x0a, 0x30, 0x58,
+    0x66, 0x66, 0x67, 0x26, 0x00, 0x45, 0x83, 0x66, 0x00, 0x65, 0xb6, 0x66, 0x02, 0x2d, 0x00, 0x40,
+    0x83, 0x66, 0x05, 0x65, 0x03, 0x00, 0x52, 0x67, 0x67, 0x82, 0x66, 0x04, 0x55, 0x00, 0x16, 0x67,
+    0x67, 0xcf, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x06, 0x67, 0x66, 0x66, 0x67, 0x32, 0x00, 0x29, 0x82,
+    0x66, 0x00, 0x67, 0xa2, 0x66, 0x95, 0x88, 0x9b, 0x66, 0x04, 0x40, 0x00, 0x00, 0x14, 0x49, 0x83,
+    0x66, 0x08, 0x65, 0x66, 0x66, 0x50, 0x1c, 0x00, 0x00, 0x2a, 0x67, 0xbe, 0x66, 0x05, 0x48, 0x00,
+    0x18, 0x66, 0x67, 0x65, 0xbb, 0x66, 0x05, 0x22, 0x00, 0x00, 0x1f, 0x46, 0x65, 0x83, 0x66, 0x03,
+    0x65, 0x26, 0x00, 0x45, 0x84, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0xb0, 0x66, 0x04, 0x23,
+    0x00, 0x4b, 0x66, 0x67, 0x82, 0x66, 0x02, 0x0e, 0x00, 0x5d, 0x84, 0x66, 0x06, 0x60, 0x00, 0x0e,
+    0x67, 0x66, 0x65, 0x65, 0xcd, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x2b,
+    0x00, 0x43, 0x84, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0x9c, 0x66, 0x95, 0x88, 0x97, 0x66,
+    0x00, 0x65, 0x83, 0x66, 0x0a, 0x38, 0x04, 0x00, 0x00, 0x13, 0x25, 0x33, 0x3e, 0x35, 0x27, 0x15,
+    0x82, 0x00, 0x02, 0x23, 0x60, 0x67, 0xbe, 0x66, 0x02, 0x48, 0x00, 0x18, 0xbe, 0x66, 0x0d, 0x21,
+    0x01, 0x00, 0x1f, 0x46, 0x65, 0x67, 0x67, 0x66, 0x66, 0x65, 0x26, 0x00, 0x46, 0x83, 0x66, 0x00,
+    0x67, 0xb6, 0x66, 0x03, 0x22, 0x00, 0x4d, 0x65, 0x83, 0x66, 0x02, 0x10, 0x00, 0x5f, 0x83, 0x66,
+    0x03, 0x65, 0x60, 0x00, 0x0e, 0xd1, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x02, 0x37, 0x00, 0x36, 0x87,
+    0x66, 0x00, 0x67, 0x9d, 0x66, 0x95, 0x88, 0x99, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x5a, 0x1d,
+    0x88, 0x00, 0x01, 0x0f, 0x4b, 0xc1, 0x66, 0x02, 0x47, 0x00, 0x18, 0xbe, 0x66, 0x07, 0x47, 0x1c,
+    0x01, 0x00, 0x00, 0x09, 0x2e, 0x56, 0x82, 0x66, 0x04, 0x26, 0x00, 0x46, 0x66, 0x67, 0x82, 0x66,
+    0x00, 0x65, 0xb5, 0x66, 0x04, 0x22, 0x00, 0x4d, 0x66, 0x65, 0x82, 0x66, 0x04, 0x10, 0x01, 0x60,
+    0x66, 0x65, 0x82, 0x66, 0x02, 0x60, 0x00, 0x0d, 0xd1, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x03, 0x65,
+    0x66, 0x66, 0x67, 0x82, 0x66, 0x04, 0x65, 0x4b, 0x00, 0x16, 0x65, 0xa5, 0x66, 0x95, 0x88, 0x9a,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x09, 0x52, 0x3e, 0x2c, 0x1a, 0x0c, 0x17, 0x27, 0x38, 0x48, 0x64,
+    0x82, 0x66, 0x01, 0x65, 0x67, 0xb9, 0x66, 0x09, 0x65, 0x66, 0x67, 0x67, 0x42, 0x00, 0x13, 0x66,
+    0x67, 0x65, 0xbb, 0x66, 0x04, 0x65, 0x66, 0x5b, 0x31, 0x0a, 0x82, 0x00, 0x05, 0x19, 0x40, 0x62,
+    0x26, 0x00, 0x46, 0x82, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0xb2, 0x66, 0x02, 0x22, 0x00,
+    0x4e, 0x84, 0x66, 0x02, 0x10, 0x01, 0x5f, 0x82, 0x66, 0x04, 0x67, 0x66, 0x60, 0x00, 0x0e, 0xd1,
+    0x66, 0xa1, 0x88, 0x9d, 0x66, 0x05, 0x67, 0x66, 0x66, 0x1a, 0x00, 0x29, 0xa5, 0x66, 0x95, 0x88,
+    0x9d, 0x66, 0x03, 0x65, 0x65, 0x66, 0x65, 0x83, 0x66, 0x06, 0x65, 0x65, 0x67, 0x66, 0x66, 0x67,
+    0x67, 0xbf, 0x66, 0x05, 0x54, 0x36, 0x3e, 0x66, 0x67, 0x65, 0xbe, 0x66, 0x03, 0x65, 0x64, 0x45,
+    0x1c, 0x82, 0x00, 0x03, 0x05, 0x09, 0x00, 0x46, 0x85, 0x66, 0x00, 0x65, 0xb3, 0x66, 0x03, 0x65,
+    0x22, 0x00, 0x4d, 0x84, 0x66, 0x03, 0x10, 0x00, 0x5f, 0x67, 0x83, 0x66, 0x05, 0x60, 0x01, 0x0e,
+    0x66, 0x66, 0x65, 0xce, 0x66, 0xa1, 0x88, 0xa0, 0x66, 0x04, 0x58, 0x0a, 0x00, 0x1f, 0x56, 0x87,
+    0x66, 0x00, 0x65, 0x9a, 0x66, 0x95, 0x88, 0xa4, 0x66, 0x06, 0x67, 0x66, 0x65, 0x65, 0x66, 0x66,
+    0x65, 0xfc, 0x66, 0x00, 0x65, 0x88, 0x66, 0x05, 0x67, 0x66, 0x66, 0x58, 0x2f, 0x09, 0x82, 0x00,
+    0x05, 0x0c, 0x35, 0x5c, 0x66, 0x66, 0x67, 0xb6, 0x66, 0x04, 0x22, 0x00, 0x49, 0x62, 0x60, 0x82,
+    0x61, 0x02, 0x0e, 0x00, 0x5a, 0x84, 0x61, 0x06, 0x5b, 0x00, 0x0e, 0x65, 0x66, 0x66, 0x67, 0xcd,
+    0x66, 0xa1, 0x88, 0x9a, 0x66, 0x07, 0x29, 0x0c, 0x13, 0x14, 0x16, 0x17, 0x16, 0x0d, 0x82, 0x00,
+    0x08, 0x0d, 0x13, 0x13, 0x14, 0x13, 0x11, 0x0c, 0x14, 0x67, 0x9a, 0x66, 0x95, 0x88, 0x9c, 0x66,
+    0x06, 0x67, 0x65, 0x66, 0x66, 0x65, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x65,
+    0xbd, 0x66, 0x02, 0x65, 0x66, 0x67, 0xbe, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x83, 0x66, 0x05,
+    0x65, 0x66, 0x66, 0x64, 0x42, 0x19, 0x82, 0x00, 0x03, 0x02, 0x1f, 0x3f, 0x5d, 0xb6, 0x66, 0x00,
+    0x22, 0x90, 0x00, 0x00, 0x0d, 0xd1, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x22, 0x90, 0x00, 0x00,
+    0x0e, 0x9b, 0x66, 0x95, 0x88, 0x97, 0x66, 0x03, 0x67, 0x67, 0x66, 0x67, 0xd4, 0x66, 0x01, 0x67,
+    0x65, 0xb6, 0x66, 0x00, 0x67, 0x8c, 0x66, 0x09, 0x67, 0x66, 0x66, 0x55, 0x2c, 0x05, 0x00, 0x01,
+    0x00, 0x0f, 0xb6, 0x66, 0x00, 0x20, 0x89, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x00, 0x0a,
+    0xd1, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x05, 0x65, 0x66, 0x4a, 0x43, 0x47, 0x4c, 0x87, 0x4b, 0x06,
+    0x4a, 0x4c, 0x4b, 0x4b, 0x49, 0x46, 0x44, 0x9b, 0x66, 0x95, 0x88, 0xff, 0x66, 0xb7, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x04, 0x62, 0x41, 0x16, 0x00, 0x0e, 0xb6, 0x66, 0x02, 0x58, 0x55, 0x5c, 0x8a,
+    0x5e, 0x04, 0x5f, 0x5e, 0x5c, 0x57, 0x52, 0x9b, 0x66, 0x00, 0x65, 0xb4, 0x66, 0xa1, 0x88, 0x98,
+    0x66, 0x02, 0x67, 0x66, 0x65, 0x8b, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0x9d, 0x66, 0x95, 0x88,
+    0xff, 0x66, 0xbf, 0x66, 0x04, 0x4f, 0x2d, 0x66, 0x66, 0x68, 0xb2, 0x66, 0x02, 0x67, 0x66, 0x67,
+    0x82, 0x66, 0x00, 0x65, 0xde, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x00, 0x65, 0x82, 0x66, 0x01, 0x65,
+    0x65, 0x84, 0x66, 0x01, 0x67, 0x65, 0x84, 0x66, 0x00, 0x67, 0x9d, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xb8, 0x66, 0x04, 0x67, 0x66, 0x66, 0x65, 0x67, 0x82, 0x66, 0x01, 0x65, 0x65, 0xb8, 0x66, 0x00,
+    0x65, 0x82, 0x66, 0x00, 0x67, 0x85, 0x66, 0x03, 0x65, 0x66, 0x67, 0x67, 0xce, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x06, 0x65, 0x66, 0x65, 0x66, 0x56, 0x38, 0x61, 0x84, 0x66,
+    0x06, 0x43, 0x22, 0x13, 0x1d, 0x31, 0x56, 0x67, 0x9c, 0x66, 0x95, 0x88, 0xff, 0x66, 0xc2, 0x66,
+    0x03, 0x67, 0x66, 0x66, 0x65, 0xb3, 0x66, 0x04, 0x67, 0x67, 0x66, 0x66, 0x67, 0x88, 0x66, 0x02,
+    0x65, 0x66, 0x67, 0x9c, 0x66, 0x00, 0x67, 0xb3, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x04, 0x64, 0x26,
+    0x00, 0x00, 0x51, 0x82, 0x66, 0x01, 0x68, 0x22, 0x84, 0x00, 0x02, 0x04, 0x43, 0x67, 0x9b, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xc6, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x00, 0x65, 0x8f, 0x66, 0x00, 0x67,
+    0x9c, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0xa9, 0x66, 0x05, 0x65, 0x67, 0x66, 0x67, 0x66,
+    0x87, 0xa0, 0x88, 0x9b, 0x66, 0x13, 0x2b, 0x00, 0x00, 0x04, 0x4c, 0x65, 0x65, 0x66, 0x3d, 0x00,
+    0x00, 0x18, 0x31, 0x2b, 0x08, 0x00, 0x02, 0x57, 0x66, 0x65, 0x99, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xc0, 0x66, 0x00, 0x67, 0xb7, 0x66, 0x00, 0x65, 0x8f, 0x66, 0x00, 0x67, 0x9b, 0x66, 0x02, 0x69,
+    0x66, 0x67, 0xb1, 0x66, 0x00, 0x69, 0xa1, 0x88, 0x98, 0x66, 0x06, 0x67, 0x66, 0x4c, 0x00, 0x00,
+    0x2e, 0x62, 0x83, 0x66, 0x09, 0x10, 0x00, 0x25, 0x65, 0x67, 0x66, 0x5c, 0x10, 0x00, 0x27, 0x9b,
+    0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x05, 0x6e, 0x66, 0x67, 0x66, 0x66, 0x65,
+    0xa9, 0x66, 0x05, 0x65, 0x66, 0x67, 0x66, 0x66, 0x70, 0xa1, 0x88, 0x9a, 0x66, 0x02, 0x2c, 0x00,
+    0x1d, 0x84, 0x66, 0x0a, 0x51, 0x00, 0x04, 0x5f, 0x66, 0x67, 0x66, 0x66, 0x46, 0x00, 0x0a, 0x9b,
+    0x66, 0x95, 0x88, 0xff, 0x66, 0xc2, 0x66, 0x00, 0x67, 0xe3, 0x66, 0x00, 0x79, 0xaf, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x00, 0x7a, 0xa1, 0x88, 0x99, 0x66, 0x0c, 0x67, 0x10, 0x00, 0x4e, 0x65, 0x66,
+    0x65, 0x66, 0x66, 0x37, 0x00, 0x1f, 0x65, 0x83, 0x66, 0x03, 0x65, 0x03, 0x01, 0x62, 0x9a, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x01, 0x7e, 0x75, 0x82, 0x66, 0x00, 0x65, 0xac,
+    0x66, 0x02, 0x65, 0x74, 0x7f, 0xa1, 0x88, 0x98, 0x66, 0x0c, 0x67, 0x66, 0x04, 0x00, 0x5f, 0x66,
+    0x66, 0x65, 0x67, 0x66, 0x20, 0x01, 0x38, 0x82, 0x66, 0x05, 0x67, 0x65, 0x66, 0x0e, 0x00, 0x58,
+    0x9a, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x68,
+    0xab, 0x66, 0x04, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0xa1, 0x88, 0x97, 0x66, 0x07, 0x67, 0x66, 0x66,
+    0x08, 0x00, 0x61, 0x66, 0x65, 0x82, 0x66, 0x0b, 0x09, 0x00, 0x50, 0x66, 0x66, 0x65, 0x66, 0x66,
+    0x67, 0x06, 0x00, 0x59, 0x9a, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x04, 0x85,
+    0x7e, 0x79, 0x70, 0x69, 0xab, 0x66, 0x04, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0xa1, 0x88, 0x99, 0x66,
+    0x03, 0x65, 0x16, 0x00, 0x4f, 0x82, 0x66, 0x04, 0x65, 0x54, 0x01, 0x05, 0x64, 0x84, 0x66, 0x03,
+    0x5a, 0x00, 0x01, 0x61, 0x9a, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x01, 0x7f,
+    0x74, 0xb1, 0x66, 0x01, 0x75, 0x7f, 0xa1, 0x88, 0x9a, 0x66, 0x03, 0x27, 0x00, 0x22, 0x68, 0x82,
+    0x66, 0x02, 0x1e, 0x00, 0x1f, 0x83, 0x66, 0x05, 0x67, 0x65, 0x2e, 0x00, 0x18, 0x67, 0x9a, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x00, 0x7a, 0xb2, 0x66, 0x01, 0x67, 0x7a, 0xa1,
+    0x88, 0x99, 0x66, 0x0a, 0x65, 0x54, 0x00, 0x00, 0x2c, 0x5c, 0x5b, 0x2f, 0x00, 0x00, 0x48, 0x84,
+    0x66, 0x03, 0x43, 0x00, 0x00, 0x37, 0x9b, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66,
+    0x00, 0x6f, 0x83, 0x66, 0x00, 0x65, 0xad, 0x66, 0x01, 0x67, 0x6f, 0xa1, 0x88, 0x9b, 0x66, 0x00,
+    0x2a, 0x85, 0x00, 0x01, 0x29, 0x65, 0x82, 0x66, 0x06, 0x32, 0x16, 0x00, 0x00, 0x11, 0x60, 0x67,
+    0x9a, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x00, 0x69, 0x82, 0x66, 0x03, 0x65,
+    0x66, 0x66, 0x67, 0xa8, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x68, 0xa1, 0x88, 0x98, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x06, 0x39, 0x09, 0x00, 0x00, 0x07, 0x2c, 0x64, 0x83, 0x66, 0x04, 0x1c, 0x00,
+    0x00, 0x0d, 0x5b, 0x9c, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xab, 0x66, 0x00, 0x67, 0xab,
+    0x66, 0x00, 0x67, 0x83, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x00, 0x67, 0x84, 0x66, 0x03, 0x58, 0x53,
+    0x66, 0x65, 0x82, 0x66, 0x05, 0x65, 0x66, 0x34, 0x24, 0x3e, 0x63, 0x9d, 0x66, 0x95, 0x88, 0x83,
+    0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0xd8, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x00, 0x67, 0x85,
+    0x66, 0x0c, 0x65, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65, 0x66, 0x67, 0x66, 0x65, 0x66, 0x65, 0x9c,
+    0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xa5, 0x66, 0x03, 0x67, 0x65,
+    0x66, 0x65, 0x84, 0x66, 0x00, 0x67, 0x99, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66,
+    0xa1, 0x88, 0x98, 0x66, 0x00, 0x65, 0x8c, 0x66, 0x02, 0x68, 0x66, 0x65, 0x9f, 0x66, 0x95, 0x88,
+    0x83, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0xd8, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x00, 0x65,
+    0xac, 0x66, 0x95, 0x88, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0xd8, 0x66,
+    0xa1, 0x88, 0xa0, 0x66, 0x00, 0x65, 0x84, 0x66, 0x08, 0x67, 0x66, 0x66, 0x65, 0x66, 0x67, 0x66,
+    0x66, 0x67, 0x99, 0x66, 0x95, 0x88, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0xdc, 0x66, 0xa1, 0x88,
+    0x98, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x67, 0x64, 0x89, 0x66, 0x00, 0x67, 0x9f, 0x66, 0x95,
+    0x88, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0xdc, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x02, 0x65, 0x66,
+    0x65, 0x8f, 0x66, 0x00, 0x67, 0x9a, 0x66, 0x95, 0x88, 0x01, 0x69, 0x67, 0xff, 0x66, 0xff, 0x66,
+    0xdb, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x03, 0x6e, 0x66, 0x66, 0x67, 0x82, 0x66, 0x00,
+    0x67, 0xb9, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x70, 0xc5, 0x66, 0x00, 0x65, 0xff, 0x66, 0xcc,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x00, 0x78, 0xc5, 0x66, 0x02, 0x67, 0x66, 0x79, 0xca,
+    0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0xc1, 0x66, 0x00, 0x67, 0xc0, 0x66, 0x00, 0x67, 0xbc,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x01, 0x7f, 0x75, 0xc3, 0x66, 0x05, 0x65, 0x66, 0x74,
+    0x7f, 0x66, 0x67, 0xff, 0x66, 0xd4, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0xb8, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x04, 0x84, 0x7f, 0x7a, 0x6d, 0x68, 0xba, 0x66, 0x00, 0x65, 0x83, 0x66,
+    0x06, 0x69, 0x6e, 0x7a, 0x7f, 0x84, 0x66, 0x65, 0xc8, 0x66, 0x02, 0x67, 0x66, 0x67, 0x82, 0x66,
+    0x01, 0x65, 0x67, 0xff, 0x66, 0xc0, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x04, 0x84, 0x7f,
+    0x79, 0x70, 0x69, 0xbf, 0x66, 0x07, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0x66, 0x66, 0x65, 0xff, 0x66,
+    0x95, 0x66, 0x04, 0x65, 0x66, 0x65, 0x66, 0x65, 0xf5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0x03, 0x7f, 0x74, 0x66, 0x65, 0x82, 0x66, 0x00, 0x67, 0xb8, 0x66, 0x00, 0x67, 0x85, 0x66, 0x02,
+    0x75, 0x7f, 0x69, 0xc7, 0x66, 0x01, 0x68, 0x69, 0x85, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67,
+    0xb9, 0x66, 0x04, 0x65, 0x66, 0x66, 0x68, 0x69, 0xc7, 0x66, 0x00, 0x68, 0xb5, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x00, 0x7a, 0xbf, 0x66, 0x03, 0x65, 0x67, 0x66, 0x67, 0x83, 0x66, 0x01,
+    0x7a, 0x6f, 0xc7, 0x66, 0x02, 0x6f, 0x6e, 0x68, 0xc6, 0x66, 0x02, 0x70, 0x6d, 0x66, 0x82, 0x65,
+    0x03, 0x66, 0x65, 0x66, 0x65, 0xb9, 0x66, 0x01, 0x65, 0x67, 0x82, 0x66, 0x01, 0x67, 0x70, 0xb5,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x00, 0x6f, 0x82, 0x66, 0x03, 0x65, 0x66, 0x65, 0x65,
+    0xba, 0x66, 0x09, 0x65, 0x67, 0x66, 0x66, 0x65, 0x66, 0x70, 0x79, 0x66, 0x67, 0xc5, 0x66, 0x04,
+    0x7a, 0x78, 0x67, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0xbc, 0x66, 0x04, 0x65, 0x66, 0x66, 0x7a,
+    0x7a, 0x85, 0x66, 0x00, 0x65, 0xbd, 0x66, 0x03, 0x64, 0x66, 0x66, 0x79, 0xb5, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x05, 0x6b, 0x66, 0x65, 0x66, 0x66, 0x65, 0xc2, 0x66, 0x08, 0x69, 0x7e,
+    0x74, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x84, 0x66, 0x00, 0x65, 0xb4, 0x66, 0x08, 0x65, 0x66,
+    0x67, 0x66, 0x66, 0x74, 0x7e, 0x7f, 0x75, 0xc2, 0x66, 0x09, 0x67, 0x66, 0x66, 0x74, 0x7e, 0x7f,
+    0x76, 0x66, 0x66, 0x65, 0xbf, 0x66, 0x04, 0x67, 0x66, 0x66, 0x74, 0x7f, 0x9d, 0x66, 0x00, 0x64,
+    0x83, 0x66, 0x00, 0x65, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x85, 0x66, 0x00, 0x67,
+    0xc1, 0x66, 0x06, 0x65, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x67, 0xba, 0x66, 0x00, 0x67, 0x82, 0x66,
+    0x0c, 0x68, 0x6e, 0x7b, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e, 0x69, 0x66, 0x66, 0x67, 0xbc, 0x66,
+    0x09, 0x68, 0x6d, 0x7b, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0x82, 0x66, 0x00, 0x67, 0xba,
+    0x66, 0x05, 0x65, 0x68, 0x6e, 0x7a, 0x7f, 0x85, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0xc9, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x70, 0x69, 0xbf, 0x66, 0x0f, 0x68, 0x70, 0x7a, 0x7f, 0x85,
+    0x85, 0x7f, 0x79, 0x70, 0x6a, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xb9, 0x66, 0x0d, 0x68, 0x70,
+    0x7b, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x70, 0x6a, 0x66, 0x66, 0x65, 0x67, 0xba, 0x66, 0x05, 0x65,
+    0x69, 0x70, 0x7a, 0x80, 0x85, 0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x84, 0x66, 0x00,
+    0x65, 0xc3, 0x66, 0x03, 0x7f, 0x74, 0x66, 0x65, 0x86, 0x66, 0x00, 0x65, 0xbb, 0x66, 0x06, 0x75,
+    0x7f, 0x7f, 0x73, 0x65, 0x66, 0x67, 0xc0, 0x66, 0x06, 0x67, 0x66, 0x76, 0x7f, 0x7f, 0x73, 0x65,
+    0xc4, 0x66, 0x01, 0x76, 0x80, 0x97, 0x66, 0x00, 0x67, 0x9c, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0xc9, 0x66, 0x00, 0x7a, 0x89, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x04, 0x65, 0x66, 0x66, 0x65,
+    0x67, 0x85, 0x66, 0x05, 0x7a, 0x7a, 0x66, 0x66, 0x65, 0x65, 0xc2, 0x66, 0x03, 0x67, 0x7a, 0x7a,
+    0x67, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xb8, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x7a,
+    0xb5, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xc7, 0x66, 0x02, 0x67, 0x66, 0x6e, 0x82, 0x66,
+    0x05, 0x65, 0x66, 0x65, 0x66, 0x66, 0x67, 0xb8, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x65, 0x66,
+    0x70, 0x6f, 0xc6, 0x66, 0x08, 0x67, 0x6f, 0x6f, 0x66, 0x65, 0x66, 0x67, 0x66, 0x65, 0xbd, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x00, 0x70, 0x9e, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x65, 0x91, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x83, 0x66, 0x00, 0x65, 0xc4, 0x66, 0x00, 0x6a, 0x83, 0x66,
+    0x00, 0x64, 0xbc, 0x66, 0x09, 0x65, 0x65, 0x66, 0x67, 0x66, 0x66, 0x69, 0x69, 0x67, 0x65, 0xc2,
+    0x66, 0x04, 0x67, 0x65, 0x66, 0x69, 0x69, 0xc1, 0x66, 0x02, 0x65, 0x66, 0x65, 0x82, 0x66, 0x00,
+    0x68, 0x9c, 0x66, 0x02, 0x47, 0x40, 0x58, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xca,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x02, 0x67, 0x66, 0x65, 0xb4, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00,
+    0x67, 0x84, 0x66, 0x00, 0x65, 0xc9, 0x66, 0x00, 0x68, 0x85, 0x66, 0x00, 0x67, 0xbb, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x00, 0x67, 0x9a, 0x66, 0x04, 0x67, 0x66, 0x10, 0x00, 0x47, 0x95, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb4, 0x66, 0x02, 0x65, 0x66, 0x65, 0x8b,
+    0x66, 0x03, 0x67, 0x18, 0x00, 0x4f, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xb7, 0x66, 0x02, 0x67, 0x62, 0x60, 0x84, 0x66, 0x00, 0x67, 0x83, 0x66, 0x08, 0x1a,
+    0x00, 0x52, 0x67, 0x66, 0x62, 0x5a, 0x66, 0x67, 0x8f, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xb4, 0x66, 0x07, 0x65, 0x66, 0x65, 0x67, 0x24, 0x00, 0x00, 0x02, 0x83,
+    0x03, 0x0a, 0x04, 0x02, 0x03, 0x04, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0d, 0x91, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x01, 0x65, 0x22, 0x87, 0x00,
+    0x00, 0x01, 0x87, 0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xb8, 0x66, 0x05, 0x5a, 0x17, 0x01, 0x04, 0x3c, 0x5f, 0x85, 0x5e, 0x06, 0x1b, 0x00,
+    0x49, 0x5c, 0x5a, 0x54, 0x52, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xb3, 0x66, 0x0b, 0x65, 0x66, 0x65, 0x65, 0x66, 0x66, 0x65, 0x2f, 0x00, 0x00, 0x27, 0x63,
+    0x84, 0x66, 0x02, 0x1e, 0x00, 0x52, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xbb, 0x66, 0x05, 0x44, 0x04, 0x00, 0x13, 0x5c, 0x65, 0x82, 0x66, 0x05, 0x1d, 0x00,
+    0x52, 0x66, 0x67, 0x67, 0x92, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb3, 0x66, 0x02, 0x65, 0x66, 0x65, 0x85, 0x66, 0x0c, 0x54, 0x0e, 0x00, 0x08, 0x4c, 0x66, 0x65,
+    0x66, 0x1e, 0x00, 0x52, 0x66, 0x68, 0x82, 0x66, 0x00, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x01, 0x67, 0x65, 0x82, 0x66, 0x09, 0x5f, 0x1c,
+    0x00, 0x02, 0x38, 0x66, 0x66, 0x1e, 0x00, 0x52, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x00, 0x67, 0x85, 0x66, 0x08, 0x65, 0x2f, 0x00, 0x01, 0x23,
+    0x62, 0x1e, 0x00, 0x52, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xc0, 0x66, 0x06, 0x43, 0x04, 0x00, 0x12, 0x0f, 0x00, 0x51, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x01, 0x68, 0x67, 0x82, 0x66, 0x00, 0x65, 0x83,
+    0x66, 0x01, 0x54, 0x0d, 0x82, 0x00, 0x00, 0x4f, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xbb, 0x66, 0x00, 0x65, 0x84, 0x66, 0x05, 0x65, 0x5e, 0x18, 0x00, 0x00,
+    0x4d, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb9, 0x66, 0x00,
+    0x65, 0x88, 0x66, 0x03, 0x64, 0x40, 0x3e, 0x5c, 0x95, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0x99, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x03, 0x65, 0x2c, 0x19, 0x42, 0xa1,
+    0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x1b, 0x00,
+    0x3f, 0x82, 0x66, 0x05, 0x65, 0x66, 0x3e, 0x3a, 0x5b, 0x67, 0x98, 0x66, 0xa1, 0x88, 0xc9, 0x66,
+    0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x20, 0x00, 0x43, 0x83, 0x66, 0x03, 0x67,
+    0x0c, 0x00, 0x48, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8,
+    0x66, 0x02, 0x22, 0x00, 0x45, 0x84, 0x66, 0x02, 0x15, 0x00, 0x50, 0x99, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x22, 0x00, 0x46, 0x83, 0x66, 0x03,
+    0x65, 0x18, 0x00, 0x53, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa7, 0x66, 0x82, 0x65,
+    0x01, 0x66, 0x65, 0xff, 0x66, 0xff, 0x66, 0x8b, 0x66, 0x03, 0x22, 0x00, 0x46, 0x67, 0x83, 0x66,
+    0x02, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb8, 0x66, 0x02, 0x22, 0x00, 0x46, 0x84, 0x66, 0x02, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xa8, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66,
+    0x89, 0x66, 0x02, 0x22, 0x00, 0x46, 0x84, 0x66, 0x02, 0x19, 0x00, 0x53, 0x99, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0xaa, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x89,
+    0x66, 0x0a, 0x22, 0x00, 0x47, 0x66, 0x66, 0x67, 0x66, 0x67, 0x17, 0x00, 0x52, 0x99, 0x66, 0xa1,
+    0x88, 0xc9, 0x66, 0x95, 0x88, 0x9d, 0x66, 0x00, 0x67, 0x87, 0x66, 0x04, 0x68, 0x65, 0x66, 0x66,
+    0x65, 0xb9, 0x66, 0x05, 0x67, 0x66, 0x66, 0x65, 0x66, 0x67, 0xd6, 0x66, 0x00, 0x65, 0xf4, 0x66,
+    0x02, 0x22, 0x00, 0x3e, 0x82, 0x5e, 0x04, 0x5d, 0x5f, 0x16, 0x00, 0x4c, 0x84, 0x5e, 0x05, 0x5c,
+    0x58, 0x51, 0x66, 0x66, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0xa0, 0x66, 0x0c,
+    0x65, 0x66, 0x66, 0x55, 0x44, 0x37, 0x32, 0x40, 0x4f, 0x63, 0x66, 0x66, 0x67, 0xc0, 0x66, 0x02,
+    0x65, 0x66, 0x65, 0xd4, 0x66, 0x00, 0x65, 0xb2, 0x66, 0x00, 0x65, 0x88, 0x66, 0x00, 0x67, 0xae,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x21, 0x90, 0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xc9,
+    0x66, 0x95, 0x88, 0xa1, 0x66, 0x01, 0x51, 0x1c, 0x85, 0x00, 0x04, 0x09, 0x3e, 0x65, 0x66, 0x67,
+    0xc0, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0xff, 0x66, 0x86, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x00, 0x65, 0xb0, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x1d, 0x90, 0x00, 0x04, 0x0e, 0x66, 0x66,
+    0x65, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x0c, 0x65, 0x51, 0x03,
+    0x00, 0x00, 0x12, 0x1e, 0x21, 0x16, 0x04, 0x00, 0x00, 0x28, 0xbb, 0x66, 0x02, 0x67, 0x66, 0x67,
+    0xd5, 0x66, 0x00, 0x67, 0xb4, 0x66, 0x03, 0x67, 0x28, 0x28, 0x55, 0x83, 0x66, 0x00, 0x65, 0x84,
+    0x66, 0x00, 0x67, 0xb0, 0x66, 0x06, 0x67, 0x55, 0x50, 0x56, 0x5d, 0x5b, 0x5d, 0x89, 0x5c, 0x02,
+    0x5a, 0x54, 0x53, 0x91, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x04, 0x63, 0x0b,
+    0x00, 0x18, 0x52, 0x82, 0x66, 0x06, 0x67, 0x5f, 0x2f, 0x00, 0x00, 0x46, 0x67, 0xb4, 0x66, 0x00,
+    0x65, 0x88, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0xcb, 0x66, 0x00, 0x67, 0xb6, 0x66, 0x05,
+    0x22, 0x00, 0x00, 0x17, 0x3f, 0x62, 0xc1, 0x66, 0x00, 0x65, 0x85, 0x66, 0x02, 0x65, 0x67, 0x67,
+    0x92, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88, 0x9b, 0x66, 0x09, 0x65, 0x66, 0x67, 0x66, 0x4b,
+    0x00, 0x0e, 0x60, 0x65, 0x67, 0x84, 0x66, 0x02, 0x30, 0x00, 0x1b, 0xb2, 0x66, 0x01, 0x67, 0x67,
+    0x85, 0x66, 0x0c, 0x62, 0x4a, 0x32, 0x26, 0x1e, 0x18, 0x1f, 0x2a, 0x36, 0x41, 0x5c, 0x66, 0x65,
+    0xff, 0x66, 0x82, 0x66, 0x01, 0x30, 0x03, 0x82, 0x00, 0x08, 0x04, 0x28, 0x50, 0x66, 0x66, 0x67,
+    0x65, 0x66, 0x65, 0xae, 0x66, 0x01, 0x65, 0x67, 0x8d, 0x66, 0x00, 0x67, 0x96, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x0f, 0x31, 0x00, 0x39, 0x66, 0x66, 0x65, 0x65, 0x66, 0x67,
+    0x66, 0x67, 0x63, 0x03, 0x08, 0x66, 0x67, 0xaf, 0x66, 0x00, 0x65, 0x85, 0x66, 0x02, 0x60, 0x29,
+    0x02, 0x89, 0x00, 0x01, 0x1b, 0x51, 0xce, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x05, 0x65, 0x66, 0x62,
+    0x43, 0x1f, 0x02, 0x82, 0x00, 0x02, 0x11, 0x38, 0x5e, 0x82, 0x66, 0x00, 0x68, 0xad, 0x66, 0x01,
+    0x65, 0x67, 0x84, 0x66, 0x00, 0x67, 0x86, 0x66, 0x02, 0x65, 0x66, 0x67, 0x95, 0x66, 0xa1, 0x88,
+    0xc9, 0x66, 0x95, 0x88, 0x9f, 0x66, 0x03, 0x27, 0x00, 0x4a, 0x67, 0x87, 0x66, 0x02, 0x11, 0x00,
+    0x5f, 0xb4, 0x66, 0x0d, 0x65, 0x66, 0x50, 0x0a, 0x00, 0x00, 0x05, 0x19, 0x25, 0x2f, 0x36, 0x2a,
+    0x1b, 0x0b, 0x82, 0x00, 0x01, 0x02, 0x4d, 0xc8, 0x66, 0x03, 0x64, 0x45, 0x1c, 0x30, 0xb7, 0x66,
+    0x03, 0x65, 0x5e, 0x3a, 0x14, 0x82, 0x00, 0x03, 0x02, 0x21, 0x4a, 0x65, 0xb1, 0x66, 0x00, 0x65,
+    0xa3, 0x66, 0xa1, 0x88, 0x83, 0x66, 0x00, 0x65, 0xc4, 0x66, 0x95, 0x88, 0x9d, 0x66, 0x04, 0x65,
+    0x66, 0x3a, 0x00, 0x3f, 0x84, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x09, 0x03, 0x65, 0xb5, 0x66,
+    0x07, 0x62, 0x0e, 0x00, 0x08, 0x42, 0x63, 0x66, 0x67, 0x84, 0x66, 0x0a, 0x61, 0x46, 0x0e, 0x00,
+    0x07, 0x56, 0x66, 0x65, 0x66, 0x67, 0x65, 0xb7, 0x66, 0x00, 0x65, 0x87, 0x66, 0x08, 0x57, 0x2f,
+    0x09, 0x00, 0x00, 0x2a, 0x66, 0x66, 0x65, 0xb1, 0x66, 0x01, 0x65, 0x65, 0x84, 0x66, 0x02, 0x54,
+    0x30, 0x0b, 0x82, 0x00, 0x02, 0x0b, 0x33, 0x5a, 0xd4, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95, 0x88,
+    0x9f, 0x66, 0x02, 0x52, 0x00, 0x23, 0x83, 0x66, 0x06, 0x65, 0x66, 0x66, 0x65, 0x52, 0x00, 0x13,
+    0xb6, 0x66, 0x04, 0x31, 0x00, 0x0a, 0x55, 0x66, 0x82, 0x65, 0x86, 0x66, 0x03, 0x63, 0x1c, 0x00,
+    0x21, 0x84, 0x66, 0x00, 0x65, 0xb2, 0x66, 0x00, 0x67, 0x88, 0x66, 0x02, 0x63, 0x41, 0x19, 0x82,
+    0x00, 0x02, 0x10, 0x39, 0x5e, 0xb3, 0x66, 0x01, 0x65, 0x67, 0x85, 0x66, 0x0b, 0x67, 0x65, 0x65,
+    0x4b, 0x25, 0x04, 0x00, 0x00, 0x01, 0x1c, 0x41, 0x60, 0xd1, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x95,
+    0x88, 0x9f, 0x66, 0x03, 0x64, 0x0d, 0x00, 0x46, 0x85, 0x66, 0x05, 0x62, 0x11, 0x00, 0x42, 0x66,
+    0x67, 0xb3, 0x66, 0x06, 0x67, 0x1a, 0x00, 0x40, 0x66, 0x65, 0x65, 0x89, 0x66, 0x05, 0x5a, 0x01,
+    0x0a, 0x66, 0x66, 0x65, 0xbd, 0x66, 0x07, 0x54, 0x2c, 0x07, 0x00, 0x00, 0x03, 0x26, 0x4e, 0x84,
+    0x66, 0x00, 0x67, 0xb3, 0x66, 0x02, 0x65, 0x66, 0x67, 0x86, 0x66, 0x02, 0x61, 0x3f, 0x1b, 0x82,
+    0x00, 0x02, 0x0f, 0x66, 0x67, 0xcf, 0x66, 0xa1, 0x88, 0x83, 0x66, 0x00, 0x65, 0xc4, 0x66, 0x95,
+    0x88, 0x9f, 0x66, 0x0c, 0x67, 0x59, 0x0a, 0x02, 0x2f, 0x5d, 0x67, 0x66, 0x63, 0x45, 0x0f, 0x00,
+    0x1c, 0xb3, 0x66, 0x00, 0x65, 0x82, 0x66, 0x05, 0x08, 0x00, 0x59, 0x66, 0x66, 0x65, 0x88, 0x66,
+    0x07, 0x65, 0x66, 0x10, 0x01, 0x5b, 0x66, 0x66, 0x67, 0xaf, 0x66, 0x02, 0x65, 0x67, 0x67, 0x83,
+    0x66, 0x05, 0x65, 0x66, 0x66, 0x62, 0x3e, 0x16, 0x82, 0x00, 0x02, 0x13, 0x3c, 0x60, 0x82, 0x66,
+    0x04, 0x65, 0x66, 0x67, 0x66, 0x65, 0xb0, 0x66, 0x00, 0x67, 0x8c, 0x66, 0x05, 0x67, 0x62, 0x38,
+    0x00, 0x00, 0x0e, 0xd1, 0x66, 0xa1, 0x88, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xc4, 0x66, 0x95,
+    0x88, 0x9a, 0x66, 0x03, 0x2a, 0x0e, 0x13, 0x15, 0x82, 0x16, 0x00, 0x0b, 0x82, 0x00, 0x02, 0x08,
+    0x0d, 0x01, 0x82, 0x00, 0x02, 0x15, 0x25, 0x65, 0xb5, 0x66, 0x05, 0x06, 0x00, 0x62, 0x66, 0x66,
+    0x65, 0x8a, 0x66, 0x03, 0x0f, 0x00, 0x57, 0x65, 0xb9, 0x66, 0x07, 0x50, 0x29, 0x05, 0x00, 0x00,
+    0x05, 0x29, 0x51, 0x89, 0x66, 0x00, 0x65, 0xbd, 0x66, 0x08, 0x4d, 0x26, 0x06, 0x00, 0x00, 0x01,
+    0x20, 0x66, 0x65, 0xcf, 0x66, 0xa1, 0x88, 0x00, 0x65, 0xc8, 0x66, 0x95, 0x88, 0x99, 0x66, 0x01,
+    0x67, 0x22, 0x90, 0x00, 0x00, 0x0d, 0xb6, 0x66, 0x02, 0x1e, 0x00, 0x4e, 0x86, 0x66, 0x00, 0x67,
+    0x84, 0x66, 0x03, 0x5c, 0x00, 0x02, 0x64, 0xb5, 0x66, 0x0b, 0x67, 0x66, 0x5f, 0x3a, 0x12, 0x01,
+    0x00, 0x00, 0x16, 0x3e, 0x61, 0x65, 0x83, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xbb, 0x66, 0x05,
+    0x67, 0x66, 0x66, 0x58, 0x32, 0x0d, 0x82, 0x00, 0x02, 0x0d, 0x34, 0x5a, 0xd2, 0x66, 0xa1, 0x88,
+    0x00, 0x67, 0xc8, 0x66, 0x95, 0x88, 0x98, 0x66, 0x06, 0x65, 0x66, 0x49, 0x3f, 0x46, 0x4a, 0x4c,
+    0x82, 0x4b, 0x01, 0x4c, 0x4a, 0x82, 0x4b, 0x05, 0x4c, 0x4b, 0x4b, 0x49, 0x44, 0x45, 0xb2, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x05, 0x37, 0x00, 0x14, 0x65, 0x66, 0x65, 0x84, 0x66, 0x08, 0x67, 0x66,
+    0x66, 0x65, 0x66, 0x27, 0x00, 0x14, 0x67, 0xaf, 0x66, 0x00, 0x65, 0x83, 0x66, 0x08, 0x67, 0x4c,
+    0x25, 0x03, 0x01, 0x00, 0x07, 0x2c, 0x55, 0x83, 0x66, 0x00, 0x65, 0xbc, 0x66, 0x08, 0x65, 0x66,
+    0x67, 0x67, 0x66, 0x67, 0x60, 0x3e, 0x18, 0x82, 0x00, 0x02, 0x04, 0x23, 0x4b, 0x84, 0x66, 0x01,
+    0x67, 0x67, 0xce, 0x66, 0xa1, 0x88, 0x01, 0x69, 0x67, 0xc6, 0x66, 0x00, 0x67, 0x83, 0x88, 0x00,
+    0x87, 0x90, 0x88, 0x97, 0x66, 0x00, 0x65, 0x87, 0x66, 0x00, 0x65, 0x88, 0x66, 0x02, 0x65, 0x66,
+    0x65, 0xb6, 0x66, 0x07, 0x57, 0x06, 0x00, 0x16, 0x52, 0x66, 0x67, 0x68, 0x83, 0x66, 0x06, 0x67,
+    0x66, 0x61, 0x25, 0x00, 0x00, 0x4a, 0xb4, 0x66, 0x01, 0x42, 0x0f, 0x82, 0x00, 0x04, 0x19, 0x41,
+    0x63, 0x66, 0x67, 0xc0, 0x66, 0x0d, 0x67, 0x66, 0x65, 0x66, 0x65, 0x4a, 0x24, 0x04, 0x00, 0x01,
+    0x00, 0x12, 0x3a, 0x5e, 0xd7, 0x66, 0xa1, 0x88, 0x03, 0x6e, 0x66, 0x66, 0x67, 0x82, 0x66, 0x00,
+    0x67, 0xb9, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x70, 0x95, 0x88, 0xa0, 0x66, 0x04, 0x65, 0x66,
+    0x65, 0x58, 0x59, 0x84, 0x58, 0x02, 0x55, 0x4f, 0x4b, 0xb5, 0x66, 0x12, 0x65, 0x66, 0x51, 0x06,
+    0x00, 0x01, 0x10, 0x21, 0x30, 0x3f, 0x4d, 0x49, 0x40, 0x33, 0x1e, 0x04, 0x00, 0x00, 0x2c, 0xb0,
+    0x66, 0x00, 0x67, 0x83, 0x66, 0x04, 0x22, 0x00, 0x07, 0x2c, 0x56, 0x83, 0x66, 0x00, 0x67, 0xc1,
+    0x66, 0x03, 0x63, 0x4a, 0x2c, 0x0a, 0x82, 0x00, 0x02, 0x06, 0x2a, 0x51, 0xda, 0x66, 0xa1, 0x88,
+    0x03, 0x79, 0x66, 0x66, 0x65, 0xc4, 0x66, 0x00, 0x79, 0x95, 0x88, 0xa0, 0x66, 0x02, 0x56, 0x27,
+    0x08, 0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x02, 0x0e, 0x66, 0x67, 0xb3, 0x66, 0x04, 0x67, 0x66,
+    0x66, 0x50, 0x0d, 0x8a, 0x00, 0x01, 0x0a, 0x46, 0xb3, 0x66, 0x06, 0x65, 0x66, 0x66, 0x3a, 0x44,
+    0x64, 0x67, 0xc7, 0x66, 0x00, 0x23, 0x83, 0x00, 0x03, 0x18, 0x40, 0x63, 0x67, 0xdb, 0x66, 0xa1,
+    0x88, 0x01, 0x7f, 0x75, 0xc3, 0x66, 0x03, 0x65, 0x66, 0x74, 0x7f, 0x83, 0x88, 0x00, 0x87, 0x90,
+    0x88, 0xa0, 0x66, 0x0c, 0x15, 0x00, 0x00, 0x07, 0x07, 0x00, 0x05, 0x0a, 0x01, 0x00, 0x00, 0x01,
+    0x1a, 0xb5, 0x66, 0x11, 0x65, 0x66, 0x66, 0x65, 0x65, 0x4a, 0x2e, 0x1e, 0x13, 0x09, 0x00, 0x05,
+    0x0c, 0x16, 0x2e, 0x47, 0x61, 0x65, 0xb5, 0x66, 0x02, 0x65, 0x66, 0x67, 0x84, 0x66, 0x00, 0x67,
+    0xc3, 0x66, 0x0b, 0x22, 0x00, 0x08, 0x2f, 0x56, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x86,
+    0x66, 0x03, 0x65, 0x66, 0x67, 0x65, 0xcd, 0x66, 0xa1, 0x88, 0x04, 0x85, 0x7f, 0x79, 0x6e, 0x68,
+    0xbf, 0x66, 0x04, 0x6a, 0x6e, 0x7a, 0x7e, 0x85, 0x95, 0x88, 0x9f, 0x66, 0x0d, 0x44, 0x00, 0x10,
+    0x47, 0x65, 0x40, 0x00, 0x44, 0x66, 0x62, 0x2b, 0x00, 0x12, 0x62, 0xb2, 0x66, 0x00, 0x65, 0x85,
+    0x66, 0x02, 0x65, 0x66, 0x67, 0xc7, 0x66, 0x00, 0x67, 0xc4, 0x66, 0x02, 0x34, 0x40, 0x63, 0x8c,
+    0x66, 0x02, 0x67, 0x66, 0x65, 0xd1, 0x66, 0xa1, 0x88, 0xc4, 0x66, 0x09, 0x65, 0x67, 0x65, 0x66,
+    0x66, 0x68, 0x70, 0x7a, 0x7f, 0x85, 0x90, 0x88, 0x9f, 0x66, 0x0e, 0x26, 0x00, 0x3d, 0x66, 0x65,
+    0x44, 0x00, 0x3f, 0x66, 0x65, 0x66, 0x1b, 0x00, 0x38, 0x65, 0xb1, 0x66, 0x00, 0x67, 0xcd, 0x66,
+    0x03, 0x65, 0x66, 0x65, 0x67, 0xc5, 0x66, 0x02, 0x67, 0x66, 0x67, 0xe0, 0x66, 0xa1, 0x88, 0xc0,
+    0x66, 0x00, 0x65, 0x8a, 0x66, 0x01, 0x75, 0x7f, 0x90, 0x88, 0x9f, 0x66, 0x07, 0x1c, 0x00, 0x57,
+    0x66, 0x66, 0x4b, 0x00, 0x36, 0x82, 0x66, 0x02, 0x5a, 0x00, 0x1a, 0xb9, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x00, 0x65, 0x89, 0x66, 0x00, 0x65, 0xff, 0x66, 0x8e, 0x66, 0x00, 0x67, 0xd5, 0x66, 0xa1,
+    0x88, 0xc5, 0x66, 0x02, 0x67, 0x66, 0x65, 0x83, 0x66, 0x01, 0x67, 0x7a, 0x90, 0x88, 0x9f, 0x66,
+    0x07, 0x22, 0x00, 0x58, 0x66, 0x66, 0x57, 0x00, 0x24, 0x83, 0x66, 0x03, 0x0e, 0x06, 0x66, 0x67,
+    0xc2, 0x66, 0x00, 0x67, 0xb7, 0x66, 0x00, 0x67, 0xcf, 0x66, 0x00, 0x65, 0xdf, 0x66, 0xa1, 0x88,
+    0xc6, 0x66, 0x00, 0x64, 0x85, 0x66, 0x00, 0x70, 0x90, 0x88, 0x9f, 0x66, 0x02, 0x30, 0x00, 0x3e,
+    0x82, 0x66, 0x01, 0x06, 0x0a, 0x83, 0x66, 0x02, 0x17, 0x00, 0x5f, 0xb1, 0x66, 0x00, 0x67, 0x89,
+    0x66, 0x03, 0x67, 0x67, 0x66, 0x65, 0x82, 0x66, 0x01, 0x67, 0x67, 0xb7, 0x66, 0x00, 0x65, 0xcd,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0xd6, 0x66, 0xa1, 0x88, 0xc8,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0x90, 0x88, 0x9b, 0x66, 0x00, 0x67, 0x82, 0x66, 0x0d,
+    0x48, 0x00, 0x08, 0x5a, 0x67, 0x66, 0x1e, 0x00, 0x3b, 0x66, 0x67, 0x5f, 0x02, 0x06, 0xff, 0x66,
+    0xff, 0x66, 0x00, 0x65, 0xac, 0x66, 0x01, 0x65, 0x66, 0xa1, 0x88, 0xc9, 0x66, 0x04, 0x67, 0x65,
+    0x66, 0x66, 0x65, 0x90, 0x88, 0x9c, 0x66, 0x00, 0x67, 0x82, 0x66, 0x0c, 0x19, 0x00, 0x04, 0x46,
+    0x66, 0x48, 0x00, 0x04, 0x2d, 0x3a, 0x11, 0x00, 0x1c, 0xff, 0x66, 0xff, 0x66, 0x00, 0x65, 0xae,
+    0x66, 0xa1, 0x88, 0xcd, 0x66, 0x00, 0x65, 0x90, 0x88, 0x9c, 0x66, 0x0b, 0x67, 0x66, 0x66, 0x67,
+    0x59, 0x10, 0x00, 0x4c, 0x66, 0x66, 0x2a, 0x02, 0x82, 0x00, 0x01, 0x07, 0x57, 0xff, 0x66, 0xf9,
+    0x66, 0x03, 0x69, 0x65, 0x66, 0x67, 0xad, 0x66, 0x03, 0x64, 0x66, 0x66, 0x68, 0xa1, 0x88, 0xcd,
+    0x66, 0x00, 0x67, 0x90, 0x88, 0x98, 0x66, 0x02, 0x67, 0x66, 0x65, 0x83, 0x66, 0x04, 0x65, 0x66,
+    0x64, 0x3f, 0x61, 0x82, 0x66, 0x07, 0x3e, 0x21, 0x14, 0x2e, 0x52, 0x66, 0x66, 0x67, 0xff, 0x66,
+    0xf7, 0x66, 0x00, 0x6e, 0xae, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x70, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0x9e, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x84, 0x66, 0x03,
+    0x79, 0x66, 0x66, 0x65, 0xb0, 0x66, 0x00, 0x79, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66,
+    0x05, 0x48, 0x3d, 0x53, 0x66, 0x65, 0x65, 0xff, 0x66, 0xff, 0x66, 0x86, 0x66, 0x05, 0x7f, 0x75,
+    0x65, 0x66, 0x66, 0x67, 0xaa, 0x66, 0x04, 0x67, 0x66, 0x66, 0x75, 0x7f, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0x99, 0x66, 0x06, 0x67, 0x18, 0x00, 0x3e, 0x66, 0x66, 0x65, 0xff, 0x66, 0xff, 0x66,
+    0x86, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0xab, 0x66, 0x04, 0x68, 0x6d, 0x7a, 0x7f, 0x84,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x99, 0x66, 0x04, 0x67, 0x20, 0x00, 0x45, 0x65, 0x83, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0x86, 0x66, 0x00, 0x65, 0xff, 0x66, 0xf7, 0x66, 0x04, 0x85,
+    0x7e, 0x79, 0x6f, 0x69, 0xab, 0x66, 0x04, 0x68, 0x70, 0x78, 0x80, 0x84, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0x98, 0x66, 0x05, 0x67, 0x66, 0x22, 0x00, 0x47, 0x65, 0xff, 0x66, 0xff, 0x66, 0x88,
+    0x66, 0x01, 0x7f, 0x74, 0xb1, 0x66, 0x01, 0x75, 0x7f, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a,
+    0x66, 0x02, 0x22, 0x00, 0x48, 0x8e, 0x66, 0x00, 0x67, 0xff, 0x66, 0xf9, 0x66, 0x01, 0x7b, 0x65,
+    0xaf, 0x66, 0x03, 0x65, 0x66, 0x67, 0x7a, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x02,
+    0x22, 0x00, 0x48, 0x8a, 0x66, 0x00, 0x67, 0xff, 0x66, 0xfd, 0x66, 0x00, 0x70, 0xae, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x00, 0x70, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x02, 0x22, 0x00,
+    0x48, 0x90, 0x66, 0x00, 0x67, 0xff, 0x66, 0xf7, 0x66, 0x01, 0x69, 0x65, 0x82, 0x66, 0x02, 0x65,
+    0x66, 0x65, 0xac, 0x66, 0x00, 0x68, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x02, 0x22,
+    0x00, 0x08, 0x8a, 0x0f, 0x04, 0x0e, 0x0f, 0x0d, 0x08, 0x0e, 0xff, 0x66, 0xfb, 0x66, 0x03, 0x67,
+    0x66, 0x66, 0x67, 0xad, 0x66, 0x01, 0x67, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66,
+    0x01, 0x22, 0x01, 0x8f, 0x00, 0x01, 0x0e, 0x67, 0xff, 0x66, 0xff, 0x66, 0xa8, 0x66, 0x00, 0x67,
+    0x84, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x03, 0x23, 0x00, 0x32, 0x47, 0x8b,
+    0x48, 0x02, 0x47, 0x41, 0x40, 0xff, 0x66, 0xf9, 0x66, 0x00, 0x65, 0xae, 0x66, 0x05, 0x67, 0x66,
+    0x66, 0x67, 0x66, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x02, 0x22, 0x00, 0x48,
+    0x8e, 0x66, 0x00, 0x67, 0xff, 0x66, 0xfb, 0x66, 0x00, 0x65, 0xb2, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0x98, 0x66, 0x05, 0x67, 0x66, 0x22, 0x00, 0x48, 0x65, 0xff, 0x66, 0xff, 0x66, 0xbe,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x02, 0x21, 0x00, 0x48, 0xff, 0x66, 0xff,
+    0x66, 0xbf, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x98, 0x66, 0x04, 0x65, 0x65, 0x20, 0x00,
+    0x46, 0xff, 0x66, 0xff, 0x66, 0xbf, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x02,
+    0x1c, 0x00, 0x42, 0xff, 0x66, 0xff, 0x66, 0xbf, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x97,
+    0x66, 0x05, 0x65, 0x66, 0x67, 0x27, 0x14, 0x41, 0xff, 0x66, 0xff, 0x66, 0xbf, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0x99, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66, 0xc2, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x00, 0x67, 0xff, 0x66, 0xff, 0x66, 0xc1, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0x99, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff, 0x66,
+    0xbe, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x69, 0x82, 0x66, 0x00, 0x67,
+    0xbe, 0x66, 0x00, 0x65, 0x83, 0x66, 0x01, 0x68, 0x69, 0xc2, 0x66, 0x01, 0x67, 0x65, 0x82, 0x66,
+    0x04, 0x68, 0x68, 0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xb9, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x03, 0x65, 0x67, 0x66, 0x68, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00,
+    0x6e, 0x82, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x08, 0x65, 0x71, 0x6e, 0x65, 0x65, 0x66, 0x64, 0x66,
+    0x65, 0xbd, 0x66, 0x06, 0x67, 0x66, 0x66, 0x67, 0x70, 0x6e, 0x67, 0x83, 0x66, 0x03, 0x65, 0x66,
+    0x66, 0x67, 0xbd, 0x66, 0x01, 0x67, 0x70, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9,
+    0x66, 0x03, 0x79, 0x67, 0x66, 0x65, 0xbd, 0x66, 0x00, 0x67, 0x83, 0x66, 0x03, 0x67, 0x66, 0x79,
+    0x79, 0x86, 0x66, 0x03, 0x67, 0x65, 0x66, 0x67, 0xb9, 0x66, 0x07, 0x65, 0x66, 0x66, 0x7a, 0x78,
+    0x67, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x00, 0x79, 0xb5, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xc9, 0x66, 0x04, 0x7f, 0x75, 0x66, 0x66, 0x67, 0xbc, 0x66, 0x09, 0x65, 0x66,
+    0x66, 0x65, 0x67, 0x66, 0x74, 0x7f, 0x7f, 0x76, 0xc2, 0x66, 0x09, 0x67, 0x66, 0x66, 0x74, 0x7f,
+    0x7e, 0x75, 0x66, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0xb7, 0x66, 0x07, 0x65, 0x65, 0x66, 0x67,
+    0x66, 0x66, 0x74, 0x7f, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x04, 0x84,
+    0x7f, 0x79, 0x6e, 0x68, 0xba, 0x66, 0x00, 0x65, 0x83, 0x66, 0x09, 0x69, 0x6d, 0x7b, 0x7f, 0x84,
+    0x84, 0x7f, 0x79, 0x6e, 0x68, 0xbf, 0x66, 0x09, 0x68, 0x6e, 0x7a, 0x7f, 0x85, 0x85, 0x7f, 0x79,
+    0x6e, 0x68, 0xbf, 0x66, 0x04, 0x68, 0x6d, 0x7a, 0x7f, 0x85, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xc9, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x71, 0x68, 0xb9, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x0e, 0x64, 0x66, 0x68, 0x70, 0x79, 0x7e, 0x85, 0x84, 0x80, 0x79, 0x70, 0x6b, 0x66, 0x66, 0x65,
+    0xbb, 0x66, 0x0b, 0x64, 0x68, 0x70, 0x7a, 0x80, 0x84, 0x84, 0x7f, 0x79, 0x70, 0x68, 0x67, 0xbe,
+    0x66, 0x04, 0x68, 0x71, 0x79, 0x7f, 0x84, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc7,
+    0x66, 0x03, 0x65, 0x66, 0x7f, 0x74, 0xbb, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x85, 0x66, 0x04,
+    0x75, 0x7f, 0x7f, 0x74, 0x65, 0x84, 0x66, 0x01, 0x65, 0x65, 0xbd, 0x66, 0x06, 0x75, 0x80, 0x7f,
+    0x74, 0x66, 0x66, 0x67, 0xc2, 0x66, 0x01, 0x75, 0x7f, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xc9, 0x66, 0x00, 0x7a, 0x82, 0x66, 0x00, 0x67, 0xc0, 0x66, 0x04, 0x65, 0x66, 0x66, 0x78,
+    0x7a, 0x83, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xbf, 0x66, 0x07, 0x7a, 0x7a, 0x66, 0x66, 0x65,
+    0x66, 0x66, 0x67, 0xbe, 0x66, 0x03, 0x65, 0x66, 0x67, 0x7a, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xc9, 0x66, 0x00, 0x6f, 0xc6, 0x66, 0x05, 0x65, 0x70, 0x6f, 0x66, 0x65, 0x67, 0xc4,
+    0x66, 0x01, 0x70, 0x71, 0xc7, 0x66, 0x00, 0x71, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xc9, 0x66, 0x02, 0x69, 0x66, 0x65, 0xc5, 0x66, 0x01, 0x68, 0x69, 0xc7, 0x66, 0x01, 0x68, 0x68,
+    0xc7, 0x66, 0x00, 0x68, 0x93, 0x66, 0x01, 0x65, 0x67, 0x83, 0x66, 0x00, 0x67, 0x9a, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xc7, 0x66, 0x00, 0x67, 0xca, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x01, 0x65, 0x67, 0xc4, 0x66, 0x00, 0x65, 0x99, 0x66, 0x00, 0x65, 0x85, 0x66,
+    0x02, 0x65, 0x66, 0x65, 0x95, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x00, 0x65, 0xc2, 0x66, 0x02, 0x65, 0x66, 0x65, 0xc7, 0x66, 0x01, 0x65, 0x67, 0xde,
+    0x66, 0x00, 0x67, 0x8f, 0x66, 0x00, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xbb, 0x66, 0x00, 0x67, 0x87, 0x66, 0x04, 0x5d, 0x4a, 0x50, 0x63, 0x65, 0x83,
+    0x66, 0x00, 0x67, 0x8e, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xcd, 0x66, 0x00, 0x67, 0xff,
+    0x66, 0x8e, 0x66, 0x00, 0x65, 0xc3, 0x66, 0x00, 0x65, 0x96, 0x66, 0x09, 0x5c, 0x3f, 0x25, 0x26,
+    0x3e, 0x64, 0x66, 0x66, 0x59, 0x15, 0x82, 0x00, 0x04, 0x02, 0x2a, 0x64, 0x66, 0x67, 0x90, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xce, 0x66, 0x00, 0x65, 0xff, 0x66, 0x8a, 0x66, 0x03, 0x65,
+    0x66, 0x66, 0x65, 0xc7, 0x66, 0x00, 0x65, 0x90, 0x66, 0x0a, 0x67, 0x4b, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x10, 0x5c, 0x5c, 0x06, 0x82, 0x00, 0x06, 0x01, 0x00, 0x00, 0x18, 0x65, 0x66, 0x67, 0x8f,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xdc, 0x66, 0x00, 0x65, 0xc3, 0x66, 0x02,
+    0x65, 0x66, 0x67, 0x93, 0x66, 0x16, 0x56, 0x04, 0x00, 0x0a, 0x24, 0x23, 0x05, 0x00, 0x1c, 0x2b,
+    0x00, 0x11, 0x4e, 0x62, 0x58, 0x2b, 0x01, 0x00, 0x42, 0x67, 0x66, 0x66, 0x65, 0x8d, 0x66, 0xa1,
+    0x88, 0x97, 0x66, 0x07, 0x67, 0x66, 0x66, 0x67, 0x66, 0x35, 0x32, 0x63, 0x84, 0x66, 0x00, 0x65,
+    0x85, 0x66, 0x00, 0x65, 0xa1, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x12, 0x2e,
+    0x00, 0x17, 0x5f, 0x66, 0x66, 0x5b, 0x10, 0x00, 0x06, 0x07, 0x5f, 0x66, 0x66, 0x65, 0x67, 0x2c,
+    0x00, 0x13, 0x91, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x04, 0x67, 0x2e, 0x00, 0x0a, 0x41, 0xad, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x0a, 0x1a, 0x00, 0x50, 0x66, 0x67, 0x66, 0x66,
+    0x4c, 0x00, 0x00, 0x2f, 0x84, 0x66, 0x03, 0x5f, 0x02, 0x02, 0x65, 0x90, 0x66, 0xa1, 0x88, 0x98,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x2d, 0x82, 0x00, 0x01, 0x16, 0x50, 0x83, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x02, 0x67, 0x66, 0x67, 0xa0, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66,
+    0x01, 0x06, 0x04, 0x85, 0x66, 0x02, 0x05, 0x00, 0x45, 0x83, 0x66, 0x04, 0x67, 0x66, 0x0f, 0x00,
+    0x5a, 0x90, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x02, 0x65, 0x66, 0x2d, 0x84, 0x00, 0x01, 0x24, 0x5b,
+    0x82, 0x66, 0x01, 0x67, 0x65, 0xa4, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x02,
+    0x67, 0x01, 0x08, 0x82, 0x66, 0x07, 0x65, 0x66, 0x65, 0x13, 0x00, 0x50, 0x66, 0x65, 0x83, 0x66,
+    0x02, 0x13, 0x01, 0x52, 0x90, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x00, 0x65, 0x82, 0x66, 0x01, 0x67,
+    0x2d, 0x85, 0x00, 0x02, 0x03, 0x34, 0x62, 0xa7, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8,
+    0x66, 0x03, 0x0f, 0x00, 0x5f, 0x65, 0x83, 0x66, 0x04, 0x14, 0x00, 0x4f, 0x66, 0x67, 0x83, 0x66,
+    0x02, 0x0c, 0x00, 0x60, 0x90, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x01, 0x65, 0x2d, 0x85, 0x00, 0x03,
+    0x01, 0x00, 0x0c, 0x43, 0xa6, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x20,
+    0x01, 0x32, 0x84, 0x66, 0x02, 0x26, 0x18, 0x50, 0x84, 0x66, 0x02, 0x50, 0x01, 0x0a, 0x91, 0x66,
+    0xa1, 0x88, 0x9c, 0x66, 0x06, 0x2d, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x17,
+    0x52, 0x84, 0x66, 0x00, 0x65, 0x9e, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x04,
+    0x48, 0x00, 0x01, 0x36, 0x5f, 0x82, 0x66, 0x00, 0x65, 0x85, 0x66, 0x07, 0x62, 0x18, 0x00, 0x1e,
+    0x66, 0x67, 0x66, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x2d,
+    0x8b, 0x00, 0x04, 0x28, 0x5c, 0x66, 0x67, 0x67, 0x9f, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb9, 0x66, 0x03, 0x24, 0x01, 0x00, 0x18, 0x82, 0x66, 0x00, 0x65, 0x84, 0x66, 0x04, 0x41, 0x10,
+    0x00, 0x03, 0x55, 0x91, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x2d, 0x8c, 0x00, 0x05, 0x04, 0x36,
+    0x63, 0x66, 0x66, 0x67, 0x9d, 0x66, 0x90, 0x88, 0xca, 0x66, 0x00, 0x65, 0xff, 0x66, 0xeb, 0x66,
+    0x05, 0x67, 0x66, 0x62, 0x29, 0x01, 0x2b, 0x86, 0x66, 0x05, 0x65, 0x66, 0x1a, 0x00, 0x00, 0x37,
+    0x92, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x2d, 0x8c, 0x00, 0x03, 0x01, 0x00, 0x0d, 0x45, 0x87,
+    0x66, 0x00, 0x67, 0x96, 0x66, 0x90, 0x88, 0x01, 0x66, 0x67, 0x84, 0x66, 0x00, 0x67, 0xc2, 0x66,
+    0x00, 0x67, 0xff, 0x66, 0xec, 0x66, 0x05, 0x65, 0x66, 0x66, 0x5b, 0x58, 0x65, 0x86, 0x66, 0x03,
+    0x67, 0x33, 0x12, 0x44, 0x93, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x00, 0x65, 0x82, 0x66, 0x01, 0x67,
+    0x2d, 0x90, 0x00, 0x03, 0x19, 0x55, 0x66, 0x65, 0x9b, 0x66, 0x90, 0x88, 0xcc, 0x66, 0x01, 0x65,
+    0x65, 0xff, 0x66, 0xff, 0x66, 0x8e, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x2d, 0x90, 0x00, 0x01,
+    0x1a, 0x56, 0x9d, 0x66, 0x90, 0x88, 0x82, 0x66, 0x02, 0x65, 0x66, 0x67, 0xbb, 0x66, 0x00, 0x67,
+    0x8a, 0x66, 0x00, 0x65, 0xff, 0x66, 0xe9, 0x66, 0x06, 0x2b, 0x1a, 0x42, 0x66, 0x66, 0x67, 0x65,
+    0x9d, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x2d, 0x8e, 0x00, 0x01, 0x0e, 0x45, 0x9f, 0x66, 0x90,
+    0x88, 0x01, 0x69, 0x65, 0xbf, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x68, 0xff, 0x66, 0xee, 0x66,
+    0x0a, 0x1a, 0x02, 0x3f, 0x66, 0x66, 0x65, 0x66, 0x66, 0x3e, 0x39, 0x5a, 0x86, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x2d, 0x8c, 0x00, 0x02, 0x05,
+    0x35, 0x63, 0x83, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0x98, 0x66, 0x90, 0x88, 0x03, 0x6e, 0x66,
+    0x66, 0x67, 0x82, 0x66, 0x00, 0x67, 0xc0, 0x66, 0x00, 0x70, 0xff, 0x66, 0xee, 0x66, 0x02, 0x20,
+    0x00, 0x42, 0x84, 0x66, 0x02, 0x0d, 0x00, 0x48, 0x83, 0x66, 0x00, 0x65, 0x94, 0x66, 0xa1, 0x88,
+    0x9c, 0x66, 0x00, 0x2d, 0x8a, 0x00, 0x02, 0x01, 0x28, 0x5d, 0xa2, 0x66, 0x90, 0x88, 0x01, 0x79,
+    0x65, 0xc6, 0x66, 0x00, 0x79, 0xff, 0x66, 0xee, 0x66, 0x02, 0x23, 0x00, 0x45, 0x83, 0x66, 0x0b,
+    0x67, 0x14, 0x00, 0x51, 0x66, 0x66, 0x65, 0x66, 0x67, 0x66, 0x66, 0x67, 0x91, 0x66, 0xa1, 0x88,
+    0x9c, 0x66, 0x00, 0x2d, 0x89, 0x00, 0x03, 0x17, 0x52, 0x66, 0x65, 0xa2, 0x66, 0x90, 0x88, 0x01,
+    0x7f, 0x75, 0xc5, 0x66, 0x01, 0x74, 0x7f, 0xff, 0x66, 0xee, 0x66, 0x02, 0x22, 0x00, 0x47, 0x84,
+    0x66, 0x03, 0x17, 0x00, 0x52, 0x67, 0x83, 0x66, 0x02, 0x67, 0x66, 0x65, 0x91, 0x66, 0xa1, 0x88,
+    0x98, 0x66, 0x04, 0x65, 0x66, 0x65, 0x66, 0x2d, 0x87, 0x00, 0x01, 0x0d, 0x44, 0xa6, 0x66, 0x90,
+    0x88, 0x06, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x66, 0x67, 0xbd, 0x66, 0x04, 0x69, 0x6e, 0x7a, 0x7f,
+    0x84, 0xff, 0x66, 0xb0, 0x66, 0x00, 0x65, 0x89, 0x66, 0x00, 0x65, 0x85, 0x66, 0x01, 0x65, 0x67,
+    0xa9, 0x66, 0x02, 0x22, 0x00, 0x46, 0x84, 0x66, 0x02, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88,
+    0x99, 0x66, 0x03, 0x67, 0x66, 0x66, 0x2d, 0x85, 0x00, 0x02, 0x05, 0x35, 0x63, 0xa7, 0x66, 0x90,
+    0x88, 0x04, 0x84, 0x7f, 0x79, 0x70, 0x68, 0xbf, 0x66, 0x04, 0x68, 0x70, 0x7b, 0x7f, 0x85, 0xff,
+    0x66, 0xb5, 0x66, 0x06, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xad,
+    0x66, 0x02, 0x22, 0x00, 0x46, 0x84, 0x66, 0x04, 0x18, 0x00, 0x52, 0x66, 0x65, 0x97, 0x66, 0xa1,
+    0x88, 0x9c, 0x66, 0x02, 0x2d, 0x00, 0x01, 0x82, 0x00, 0x01, 0x28, 0x5c, 0xa9, 0x66, 0x90, 0x88,
+    0x01, 0x7f, 0x74, 0xc4, 0x66, 0x02, 0x65, 0x77, 0x7e, 0x82, 0x66, 0x00, 0x67, 0xff, 0x66, 0xb7,
+    0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x67, 0xab, 0x66, 0x0b, 0x22, 0x00, 0x46, 0x65, 0x66, 0x66,
+    0x64, 0x66, 0x18, 0x00, 0x52, 0x67, 0x98, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x00, 0x2c, 0x82, 0x00,
+    0x01, 0x18, 0x51, 0x82, 0x66, 0x00, 0x67, 0xa7, 0x66, 0x90, 0x88, 0x05, 0x7a, 0x66, 0x66, 0x65,
+    0x66, 0x65, 0xc1, 0x66, 0x01, 0x67, 0x7b, 0xff, 0x66, 0xb1, 0x66, 0x01, 0x67, 0x67, 0x83, 0x66,
+    0x01, 0x67, 0x67, 0x82, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xac, 0x66, 0x02, 0x22, 0x00,
+    0x46, 0x83, 0x66, 0x03, 0x67, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x08, 0x67,
+    0x2d, 0x00, 0x0c, 0x43, 0x67, 0x66, 0x66, 0x67, 0xa9, 0x66, 0x90, 0x88, 0x00, 0x6f, 0xc4, 0x66,
+    0x04, 0x65, 0x66, 0x67, 0x6f, 0x65, 0xa4, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x67, 0xff, 0x66,
+    0x89, 0x66, 0x00, 0x67, 0x86, 0x66, 0x01, 0x65, 0x68, 0xab, 0x66, 0x05, 0x67, 0x22, 0x00, 0x3e,
+    0x5e, 0x5f, 0x82, 0x5e, 0x02, 0x16, 0x00, 0x4d, 0x83, 0x5e, 0x04, 0x5f, 0x5c, 0x58, 0x51, 0x65,
+    0x90, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x02, 0x33, 0x34, 0x62, 0xae, 0x66, 0x90, 0x88, 0x02, 0x69,
+    0x66, 0x65, 0xc2, 0x66, 0x07, 0x67, 0x65, 0x66, 0x69, 0x66, 0x66, 0x67, 0x67, 0xff, 0x66, 0xbd,
+    0x66, 0x01, 0x65, 0x68, 0xaa, 0x66, 0x00, 0x21, 0x90, 0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88,
+    0x9c, 0x66, 0x00, 0x67, 0xb0, 0x66, 0x90, 0x88, 0x02, 0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65,
+    0xbf, 0x66, 0x00, 0x65, 0xa7, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x65, 0xff, 0x66, 0x01, 0x65,
+    0x67, 0x8d, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x67, 0x66, 0x67, 0xa9, 0x66, 0x00, 0x1d, 0x87,
+    0x00, 0x00, 0x01, 0x87, 0x00, 0x03, 0x0e, 0x66, 0x65, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0x9b, 0x66,
+    0x02, 0x65, 0x67, 0x68, 0x86, 0x66, 0x00, 0x67, 0xa7, 0x66, 0x90, 0x88, 0xc1, 0x66, 0x03, 0x65,
+    0x66, 0x66, 0x67, 0x84, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0xff, 0x66, 0xac, 0x66, 0x06, 0x54,
+    0x23, 0x45, 0x65, 0x66, 0x66, 0x65, 0x82, 0x66, 0x04, 0x0e, 0x18, 0x42, 0x66, 0x65, 0x83, 0x66,
+    0x00, 0x67, 0xa8, 0x66, 0x03, 0x55, 0x4f, 0x56, 0x5d, 0x89, 0x5c, 0x05, 0x5b, 0x5c, 0x5a, 0x55,
+    0x53, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xdf, 0x66, 0x00, 0x65, 0x84, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x07, 0x60, 0x4e, 0x46, 0x41, 0x41, 0x4c, 0x58, 0x63, 0x88, 0x66, 0x00,
+    0x65, 0x82, 0x66, 0x00, 0x65, 0xab, 0x66, 0x02, 0x67, 0x66, 0x65, 0x93, 0x66, 0x01, 0x65, 0x67,
+    0xb3, 0x66, 0x06, 0x65, 0x66, 0x38, 0x00, 0x00, 0x24, 0x67, 0x84, 0x66, 0x00, 0x5b, 0x82, 0x00,
+    0x00, 0x24, 0xd3, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe0, 0x66, 0x00, 0x65, 0x84, 0x66,
+    0x03, 0x67, 0x43, 0x12, 0x01, 0x86, 0x00, 0x04, 0x09, 0x26, 0x4d, 0x66, 0x65, 0x83, 0x66, 0x00,
+    0x67, 0xab, 0x66, 0x00, 0x65, 0x99, 0x66, 0x01, 0x65, 0x67, 0xb4, 0x66, 0x05, 0x41, 0x00, 0x00,
+    0x0c, 0x3e, 0x65, 0x84, 0x66, 0x05, 0x62, 0x42, 0x1b, 0x00, 0x00, 0x38, 0xd2, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x02, 0x65, 0x60, 0x23, 0x86, 0x00, 0x02, 0x18, 0x18, 0x05,
+    0x82, 0x00, 0x04, 0x22, 0x62, 0x65, 0x66, 0x67, 0xc8, 0x66, 0x01, 0x65, 0x67, 0xb3, 0x66, 0x05,
+    0x5f, 0x08, 0x00, 0x1f, 0x62, 0x67, 0x83, 0x66, 0x08, 0x65, 0x66, 0x66, 0x67, 0x66, 0x31, 0x00,
+    0x01, 0x4c, 0xd1, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe3, 0x66, 0x12, 0x65, 0x64, 0x10,
+    0x00, 0x02, 0x31, 0x4f, 0x56, 0x43, 0x14, 0x00, 0x0e, 0x62, 0x66, 0x50, 0x27, 0x02, 0x01, 0x23,
+    0x86, 0x66, 0x00, 0x67, 0xae, 0x66, 0x00, 0x65, 0xc9, 0x66, 0x03, 0x32, 0x00, 0x0d, 0x60, 0x8a,
+    0x66, 0x06, 0x65, 0x1d, 0x00, 0x27, 0x66, 0x67, 0x65, 0xce, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xe4, 0x66, 0x04, 0x39, 0x00, 0x05, 0x53, 0x67, 0x82, 0x66, 0x03, 0x64, 0x23, 0x00, 0x2c,
+    0x82, 0x66, 0x03, 0x46, 0x02, 0x00, 0x3b, 0x82, 0x66, 0x00, 0x65, 0xb0, 0x66, 0x02, 0x51, 0x40,
+    0x41, 0x91, 0x40, 0x02, 0x3f, 0x50, 0x65, 0xb3, 0x66, 0x04, 0x1f, 0x00, 0x40, 0x66, 0x67, 0x8a,
+    0x66, 0x02, 0x50, 0x00, 0x12, 0xd1, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe3, 0x66, 0x03,
+    0x67, 0x17, 0x00, 0x3b, 0x85, 0x66, 0x03, 0x5f, 0x08, 0x01, 0x5c, 0x82, 0x66, 0x02, 0x41, 0x00,
+    0x17, 0x86, 0x66, 0x00, 0x67, 0xa9, 0x66, 0x03, 0x65, 0x66, 0x66, 0x22, 0x94, 0x00, 0x00, 0x2b,
+    0xb4, 0x66, 0x02, 0x0d, 0x00, 0x56, 0x8a, 0x66, 0x07, 0x65, 0x66, 0x63, 0x02, 0x02, 0x63, 0x66,
+    0x64, 0xce, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x02, 0x02, 0x00, 0x5d, 0x82,
+    0x66, 0x06, 0x65, 0x67, 0x66, 0x66, 0x25, 0x00, 0x4a, 0x82, 0x66, 0x05, 0x61, 0x00, 0x05, 0x65,
+    0x66, 0x65, 0xb1, 0x66, 0x02, 0x22, 0x00, 0x18, 0x90, 0x1e, 0x05, 0x13, 0x00, 0x2b, 0x66, 0x66,
+    0x67, 0xb0, 0x66, 0x04, 0x67, 0x02, 0x00, 0x62, 0x65, 0x84, 0x66, 0x01, 0x67, 0x67, 0x82, 0x66,
+    0x05, 0x65, 0x66, 0x67, 0x0d, 0x00, 0x56, 0xd0, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe0,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x01, 0x02, 0x02, 0x87, 0x66, 0x02, 0x31, 0x00, 0x3a, 0x83, 0x66,
+    0x02, 0x11, 0x01, 0x58, 0x84, 0x66, 0x01, 0x65, 0x67, 0xac, 0x66, 0x02, 0x22, 0x00, 0x53, 0x90,
+    0x66, 0x02, 0x49, 0x00, 0x2b, 0x82, 0x66, 0x00, 0x67, 0xb0, 0x66, 0x05, 0x0f, 0x00, 0x53, 0x66,
+    0x66, 0x65, 0x82, 0x66, 0x03, 0x67, 0x67, 0x66, 0x67, 0x82, 0x66, 0x06, 0x62, 0x01, 0x00, 0x5f,
+    0x66, 0x66, 0x67, 0xcd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x06, 0x11, 0x00,
+    0x53, 0x66, 0x65, 0x66, 0x67, 0x82, 0x66, 0x02, 0x29, 0x00, 0x3a, 0x83, 0x66, 0x03, 0x08, 0x00,
+    0x5e, 0x67, 0xb2, 0x66, 0x02, 0x22, 0x00, 0x52, 0x83, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x02, 0x49,
+    0x00, 0x2b, 0xb4, 0x66, 0x04, 0x20, 0x00, 0x3d, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x04, 0x65, 0x66, 0x4d, 0x00, 0x0c, 0xd1, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xdf, 0x66,
+    0x00, 0x65, 0x83, 0x66, 0x02, 0x22, 0x00, 0x30, 0x85, 0x66, 0x03, 0x62, 0x0c, 0x00, 0x4f, 0x82,
+    0x66, 0x02, 0x4e, 0x00, 0x07, 0x84, 0x66, 0x00, 0x67, 0xac, 0x66, 0x08, 0x67, 0x66, 0x3a, 0x25,
+    0x5d, 0x66, 0x66, 0x65, 0x67, 0x8b, 0x66, 0x03, 0x65, 0x54, 0x25, 0x41, 0xb4, 0x66, 0x03, 0x33,
+    0x00, 0x0e, 0x61, 0x8a, 0x66, 0x06, 0x65, 0x1a, 0x00, 0x1e, 0x66, 0x66, 0x65, 0xce, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xe3, 0x66, 0x13, 0x67, 0x47, 0x00, 0x00, 0x3f, 0x67, 0x66, 0x65,
+    0x67, 0x63, 0x26, 0x00, 0x06, 0x63, 0x66, 0x66, 0x59, 0x0e, 0x00, 0x26, 0x83, 0x66, 0x00, 0x65,
+    0xc4, 0x66, 0x00, 0x67, 0xb5, 0x66, 0x05, 0x5e, 0x08, 0x00, 0x20, 0x66, 0x65, 0x88, 0x66, 0x03,
+    0x2e, 0x00, 0x00, 0x4e, 0xd1, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe5, 0x66, 0x11, 0x20,
+    0x00, 0x01, 0x21, 0x3d, 0x42, 0x33, 0x0d, 0x00, 0x01, 0x3e, 0x66, 0x66, 0x49, 0x03, 0x00, 0x03,
+    0x5a, 0x84, 0x66, 0x00, 0x65, 0xc3, 0x66, 0x00, 0x65, 0xb4, 0x66, 0x06, 0x65, 0x67, 0x40, 0x00,
+    0x00, 0x14, 0x49, 0x85, 0x66, 0x09, 0x67, 0x50, 0x1b, 0x00, 0x00, 0x2a, 0x66, 0x66, 0x65, 0x65,
+    0xce, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe5, 0x66, 0x02, 0x5f, 0x24, 0x01, 0x84, 0x00,
+    0x01, 0x02, 0x33, 0x82, 0x66, 0x05, 0x58, 0x00, 0x06, 0x4a, 0x66, 0x67, 0xb4, 0x66, 0x00, 0x65,
+    0xcb, 0x66, 0x0a, 0x38, 0x03, 0x00, 0x00, 0x12, 0x25, 0x33, 0x3e, 0x35, 0x27, 0x16, 0x82, 0x00,
+    0x04, 0x22, 0x60, 0x66, 0x65, 0x67, 0xcf, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe1, 0x66,
+    0x0c, 0x67, 0x66, 0x66, 0x65, 0x65, 0x66, 0x4b, 0x2c, 0x19, 0x0c, 0x1c, 0x2e, 0x56, 0x84, 0x66,
+    0x01, 0x39, 0x5f, 0x82, 0x66, 0x00, 0x65, 0xae, 0x66, 0x00, 0x65, 0x95, 0x66, 0x00, 0x67, 0xba,
+    0x66, 0x01, 0x59, 0x1e, 0x88, 0x00, 0x01, 0x0f, 0x4c, 0x84, 0x66, 0x00, 0x65, 0xce, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xe8, 0x66, 0x01, 0x67, 0x65, 0x87, 0x66, 0x05, 0x67, 0x66, 0x66,
+    0x65, 0x67, 0x67, 0xb0, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xc8, 0x66, 0x00, 0x67, 0x84,
+    0x66, 0x0a, 0x51, 0x3e, 0x2c, 0x1a, 0x0b, 0x16, 0x27, 0x38, 0x48, 0x64, 0x65, 0xd4, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xdf, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0x84, 0x66, 0x06,
+    0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x65, 0x85, 0x66, 0x00, 0x65, 0xcb, 0x66, 0x00, 0x67, 0xb9,
+    0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0x87, 0x66, 0x00, 0x67, 0xce, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xa8, 0x66, 0x00, 0x65, 0xff, 0x66, 0xfd, 0x66, 0x00, 0x67, 0xb4, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xaa, 0x66, 0x00, 0x67, 0xff, 0x66, 0xfb, 0x66, 0x05, 0x65, 0x66, 0x67, 0x66, 0x66, 0x65,
+    0xaf, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xa8, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65,
+    0xff, 0x66, 0xff, 0x66, 0x80, 0x66, 0x00, 0x65, 0xad, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xae, 0x66, 0x00, 0x67, 0xff, 0x66, 0xfb, 0x66, 0x00, 0x65, 0xb0, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa9, 0x66, 0x02, 0x65, 0x66, 0x65, 0xb0, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xaa, 0x66, 0x04, 0x67, 0x65, 0x66, 0x66, 0x67, 0xff, 0x66, 0xf7, 0x66,
+    0x00, 0x67, 0xb0, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xac,
+    0x66, 0x00, 0x59, 0xff, 0x66, 0xf9, 0x66, 0x03, 0x69, 0x67, 0x66, 0x65, 0xad, 0x66, 0x03, 0x65,
+    0x66, 0x66, 0x67, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x99, 0x66, 0x0b, 0x65, 0x66, 0x66, 0x65,
+    0x66, 0x66, 0x4c, 0x54, 0x66, 0x67, 0x66, 0x67, 0x82, 0x66, 0x04, 0x65, 0x66, 0x66, 0x43, 0x12,
+    0xff, 0x66, 0xf9, 0x66, 0x01, 0x6e, 0x68, 0xb2, 0x66, 0x00, 0x6f, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0x98, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x82, 0x66, 0x0d, 0x42, 0x0a, 0x5a, 0x67, 0x66,
+    0x67, 0x66, 0x66, 0x65, 0x66, 0x64, 0x2e, 0x00, 0x0f, 0xff, 0x66, 0xf9, 0x66, 0x00, 0x79, 0x82,
+    0x66, 0x00, 0x67, 0xaf, 0x66, 0x00, 0x79, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x98, 0x66, 0x00,
+    0x67, 0x85, 0x66, 0x0f, 0x41, 0x00, 0x0d, 0x5b, 0x67, 0x66, 0x66, 0x65, 0x66, 0x5c, 0x1a, 0x00,
+    0x00, 0x15, 0x66, 0x65, 0xff, 0x66, 0xf7, 0x66, 0x01, 0x7f, 0x75, 0xae, 0x66, 0x04, 0x67, 0x66,
+    0x66, 0x73, 0x7e, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x00, 0x67, 0x82, 0x66, 0x0e,
+    0x65, 0x52, 0x06, 0x00, 0x10, 0x5e, 0x66, 0x67, 0x66, 0x4e, 0x09, 0x00, 0x00, 0x2d, 0x63, 0xff,
+    0x66, 0xf9, 0x66, 0x04, 0x84, 0x7d, 0x79, 0x6e, 0x69, 0xab, 0x66, 0x04, 0x68, 0x6e, 0x7a, 0x7f,
+    0x85, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9f, 0x66, 0x0f, 0x67, 0x54, 0x08, 0x00, 0x15, 0x61,
+    0x66, 0x38, 0x02, 0x00, 0x08, 0x48, 0x66, 0x66, 0x65, 0x67, 0xff, 0x66, 0xf7, 0x66, 0x07, 0x84,
+    0x7f, 0x79, 0x70, 0x69, 0x66, 0x66, 0x65, 0xa7, 0x66, 0x05, 0x64, 0x68, 0x70, 0x7a, 0x80, 0x84,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9d, 0x66, 0x00, 0x65, 0x82, 0x66, 0x0b, 0x54, 0x08, 0x00,
+    0x19, 0x21, 0x00, 0x00, 0x1a, 0x5c, 0x66, 0x66, 0x65, 0xff, 0x66, 0xf9, 0x66, 0x02, 0x7f, 0x74,
+    0x65, 0xb0, 0x66, 0x01, 0x75, 0x7f, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xa2, 0x66, 0x07, 0x52,
+    0x05, 0x00, 0x00, 0x02, 0x35, 0x64, 0x68, 0xff, 0x66, 0xfc, 0x66, 0x03, 0x7a, 0x66, 0x66, 0x65,
+    0xb0, 0x66, 0x00, 0x7b, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xa3, 0x66, 0x03, 0x50, 0x05, 0x00,
+    0x21, 0x85, 0x66, 0x00, 0x67, 0xff, 0x66, 0xf8, 0x66, 0x03, 0x6f, 0x66, 0x67, 0x65, 0xb0, 0x66,
+    0x00, 0x70, 0xa1, 0x88, 0xc7, 0x66, 0x00, 0x65, 0x83, 0x66, 0x01, 0x65, 0x66, 0x90, 0x88, 0xa1,
+    0x66, 0x0e, 0x65, 0x66, 0x66, 0x4e, 0x04, 0x00, 0x34, 0x66, 0x65, 0x67, 0x67, 0x66, 0x66, 0x65,
+    0x67, 0xff, 0x66, 0xf6, 0x66, 0x02, 0x69, 0x66, 0x64, 0xb1, 0x66, 0x00, 0x67, 0xa1, 0x88, 0xca,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x90, 0x88, 0x97, 0x66, 0x05, 0x67, 0x66, 0x66, 0x26, 0x0a, 0x11,
+    0x85, 0x13, 0x09, 0x12, 0x13, 0x01, 0x00, 0x01, 0x11, 0x13, 0x11, 0x0d, 0x12, 0xff, 0x66, 0xf9,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x64, 0xaf, 0x66, 0x00, 0x67, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0x98, 0x66, 0x02, 0x67, 0x66, 0x22, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x00, 0x0e, 0xff, 0x66, 0xfb, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x00, 0x67, 0xa1,
+    0x88, 0xc9, 0x66, 0x00, 0x67, 0x83, 0x66, 0x90, 0x88, 0x98, 0x66, 0x04, 0x65, 0x66, 0x4c, 0x43,
+    0x47, 0x86, 0x4b, 0x01, 0x4c, 0x4a, 0x83, 0x4b, 0x05, 0x49, 0x44, 0x46, 0x66, 0x66, 0x67, 0xff,
+    0x66, 0xfa, 0x66, 0x00, 0x67, 0xb0, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x97, 0x66, 0x00,
+    0x65, 0x85, 0x66, 0x01, 0x65, 0x67, 0x85, 0x66, 0x05, 0x65, 0x66, 0x67, 0x66, 0x66, 0x67, 0xff,
+    0x66, 0xfa, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xb1, 0x66, 0xa1, 0x88, 0xc8, 0x66, 0x01, 0x65,
+    0x64, 0x82, 0x66, 0x00, 0x68, 0x90, 0x88, 0xa0, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x65, 0x65,
+    0x87, 0x66, 0x01, 0x65, 0x65, 0xff, 0x66, 0xff, 0x66, 0xac, 0x66, 0xa1, 0x88, 0xc8, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x00, 0x70, 0x90, 0x88, 0x98, 0x66, 0x00, 0x65, 0x87, 0x66, 0x02, 0x61, 0x30,
+    0x42, 0x83, 0x66, 0x02, 0x5c, 0x10, 0x3f, 0x82, 0x66, 0x01, 0x65, 0x65, 0xff, 0x66, 0xff, 0x66,
+    0xab, 0x66, 0x00, 0x65, 0xa1, 0x88, 0xc9, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x79, 0x90, 0x88,
+    0x9c, 0x66, 0x11, 0x67, 0x65, 0x66, 0x66, 0x61, 0x13, 0x00, 0x1b, 0x67, 0x65, 0x66, 0x67, 0x41,
+    0x00, 0x00, 0x31, 0x66, 0x67, 0xff, 0x66, 0xfc, 0x66, 0x00, 0x65, 0xaf, 0x66, 0x00, 0x65, 0xa1,
+    0x88, 0x84, 0x66, 0x00, 0x65, 0xc6, 0x66, 0x01, 0x74, 0x7f, 0x90, 0x88, 0x9f, 0x66, 0x0e, 0x65,
+    0x1f, 0x00, 0x02, 0x36, 0x66, 0x65, 0x67, 0x66, 0x5d, 0x31, 0x00, 0x00, 0x48, 0x65, 0xdb, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0x93, 0x66, 0x02, 0x67, 0x66, 0x67, 0xb6, 0x66,
+    0xa1, 0x88, 0xc9, 0x66, 0x04, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x90, 0x88, 0x9f, 0x66, 0x03, 0x4e,
+    0x00, 0x0a, 0x53, 0x86, 0x66, 0x02, 0x35, 0x00, 0x18, 0x9f, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x04,
+    0x65, 0x67, 0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0xbb, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x00, 0x67, 0xc7, 0x66, 0x00, 0x67, 0xb5, 0x66, 0xa1, 0x88, 0x07, 0x84, 0x7f,
+    0x79, 0x70, 0x69, 0x66, 0x66, 0x65, 0xbf, 0x66, 0x01, 0x65, 0x65, 0x84, 0x66, 0x90, 0x88, 0x9b,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x39, 0x00, 0x2f, 0x85, 0x66, 0x05, 0x65, 0x66, 0x65, 0x04,
+    0x05, 0x65, 0x9e, 0x66, 0x00, 0x65, 0xbf, 0x66, 0x04, 0x65, 0x66, 0x66, 0x65, 0x67, 0xca, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x04, 0x65, 0x65, 0x66, 0x66, 0x67, 0xba, 0x66, 0x00, 0x65, 0xb9, 0x66,
+    0xa1, 0x88, 0x01, 0x7f, 0x74, 0x84, 0x66, 0x00, 0x67, 0xc1, 0x66, 0x00, 0x67, 0x83, 0x66, 0x90,
+    0x88, 0x9a, 0x66, 0x00, 0x67, 0x83, 0x66, 0x03, 0x23, 0x00, 0x4c, 0x65, 0x84, 0x66, 0x05, 0x65,
+    0x66, 0x66, 0x16, 0x00, 0x58, 0x9a, 0x66, 0x00, 0x68, 0xc4, 0x66, 0x04, 0x67, 0x66, 0x66, 0x68,
+    0x69, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x64, 0xbb, 0x66, 0x09, 0x65, 0x66, 0x65, 0x66, 0x66,
+    0x68, 0x69, 0x66, 0x66, 0x67, 0x83, 0x66, 0x00, 0x65, 0xb8, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00,
+    0x69, 0xb5, 0x66, 0xa1, 0x88, 0x00, 0x79, 0x82, 0x66, 0x03, 0x64, 0x66, 0x66, 0x65, 0xc6, 0x66,
+    0x90, 0x88, 0x9f, 0x66, 0x02, 0x28, 0x00, 0x46, 0x84, 0x66, 0x06, 0x65, 0x67, 0x66, 0x66, 0x0a,
+    0x00, 0x5c, 0x9a, 0x66, 0x05, 0x6e, 0x66, 0x67, 0x66, 0x66, 0x67, 0xbe, 0x66, 0x06, 0x67, 0x67,
+    0x66, 0x66, 0x70, 0x6e, 0x67, 0xc3, 0x66, 0x04, 0x67, 0x67, 0x66, 0x70, 0x6e, 0xc3, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x00, 0x70, 0xb5, 0x66, 0xa1, 0x88, 0x00, 0x6f, 0x83, 0x66, 0x00, 0x65, 0xc8,
+    0x66, 0x90, 0x88, 0x9f, 0x66, 0x02, 0x3e, 0x00, 0x25, 0x85, 0x66, 0x06, 0x67, 0x66, 0x4f, 0x00,
+    0x07, 0x66, 0x65, 0x99, 0x66, 0x00, 0x79, 0xc7, 0x66, 0x04, 0x79, 0x78, 0x67, 0x66, 0x67, 0x82,
+    0x66, 0x01, 0x65, 0x67, 0xbf, 0x66, 0x01, 0x79, 0x79, 0x82, 0x66, 0x02, 0x67, 0x66, 0x65, 0xbd,
+    0x66, 0x04, 0x68, 0x66, 0x65, 0x66, 0x79, 0xb5, 0x66, 0xa1, 0x88, 0x03, 0x69, 0x66, 0x66, 0x67,
+    0xca, 0x66, 0x90, 0x88, 0x9f, 0x66, 0x03, 0x56, 0x02, 0x00, 0x3c, 0x84, 0x66, 0x04, 0x67, 0x5c,
+    0x0c, 0x00, 0x2e, 0x9b, 0x66, 0x01, 0x7e, 0x76, 0x82, 0x66, 0x00, 0x65, 0xba, 0x66, 0x01, 0x67,
+    0x67, 0x84, 0x66, 0x03, 0x74, 0x7f, 0x7f, 0x75, 0x88, 0x66, 0x00, 0x65, 0xb7, 0x66, 0x07, 0x67,
+    0x67, 0x66, 0x66, 0x74, 0x7f, 0x7e, 0x75, 0x84, 0x66, 0x00, 0x65, 0xba, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x02, 0x65, 0x74, 0x7f, 0xb5, 0x66, 0xa1, 0x88, 0x84, 0x66, 0x00, 0x65, 0xc7, 0x66, 0x00,
+    0x67, 0x90, 0x88, 0xa0, 0x66, 0x0c, 0x39, 0x00, 0x00, 0x18, 0x41, 0x51, 0x56, 0x48, 0x2e, 0x04,
+    0x00, 0x0a, 0x5a, 0x9b, 0x66, 0x05, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x65, 0xbe, 0x66, 0x09, 0x67,
+    0x6e, 0x7a, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0x83, 0x66, 0x00, 0x65, 0xb9, 0x66, 0x0a,
+    0x65, 0x68, 0x6d, 0x7a, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x6e, 0x67, 0xbf, 0x66, 0x04, 0x68, 0x6e,
+    0x7a, 0x7f, 0x85, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xa1, 0x66, 0x01, 0x2e, 0x02,
+    0x86, 0x00, 0x03, 0x0a, 0x55, 0x66, 0x67, 0x9a, 0x66, 0x04, 0x84, 0x80, 0x79, 0x70, 0x69, 0xbc,
+    0x66, 0x0d, 0x65, 0x64, 0x66, 0x69, 0x70, 0x7a, 0x7f, 0x84, 0x84, 0x7e, 0x79, 0x70, 0x68, 0x67,
+    0xbe, 0x66, 0x0b, 0x67, 0x71, 0x7a, 0x7f, 0x84, 0x84, 0x80, 0x79, 0x70, 0x68, 0x66, 0x65, 0xbd,
+    0x66, 0x04, 0x68, 0x71, 0x7a, 0x7f, 0x84, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9b,
+    0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x82, 0x66, 0x09, 0x58, 0x28, 0x16, 0x07, 0x01, 0x0a, 0x18,
+    0x3c, 0x63, 0x65, 0x9a, 0x66, 0x05, 0x67, 0x66, 0x7f, 0x74, 0x66, 0x65, 0xc3, 0x66, 0x07, 0x76,
+    0x7f, 0x7f, 0x74, 0x66, 0x66, 0x67, 0x67, 0xc1, 0x66, 0x03, 0x75, 0x7f, 0x7d, 0x74, 0xc5, 0x66,
+    0x01, 0x74, 0x7e, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x05, 0x67, 0x66,
+    0x67, 0x67, 0x66, 0x65, 0xa8, 0x66, 0x04, 0x7a, 0x66, 0x66, 0x67, 0x67, 0xc2, 0x66, 0x08, 0x67,
+    0x7a, 0x7a, 0x67, 0x66, 0x65, 0x66, 0x66, 0x67, 0xbe, 0x66, 0x04, 0x65, 0x66, 0x67, 0x7a, 0x7a,
+    0xc1, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x7a, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0x9b, 0x66, 0x07, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x65, 0x87, 0x66, 0x00, 0x67, 0x9c,
+    0x66, 0x00, 0x6f, 0x82, 0x66, 0x01, 0x65, 0x67, 0xbe, 0x66, 0x05, 0x65, 0x66, 0x66, 0x67, 0x70,
+    0x70, 0x82, 0x66, 0x02, 0x65, 0x66, 0x67, 0xc1, 0x66, 0x03, 0x71, 0x6f, 0x66, 0x65, 0xc5, 0x66,
+    0x00, 0x70, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9f, 0x66, 0x03, 0x65, 0x65, 0x66,
+    0x65, 0x86, 0x58, 0x02, 0x56, 0x51, 0x4b, 0x9b, 0x66, 0x00, 0x69, 0xc3, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x05, 0x67, 0x69, 0x66, 0x66, 0x65, 0x65, 0xc3, 0x66, 0x01, 0x68, 0x69, 0x87, 0x66, 0x00,
+    0x67, 0xbe, 0x66, 0x00, 0x68, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xa0, 0x66, 0x02,
+    0x56, 0x27, 0x08, 0x88, 0x00, 0x00, 0x0e, 0x9a, 0x66, 0x00, 0x67, 0xc4, 0x66, 0x00, 0x67, 0x84,
+    0x66, 0x00, 0x65, 0xc4, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x00, 0x67, 0x83,
+    0x66, 0x00, 0x67, 0xb7, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9c, 0x66, 0x10, 0x65, 0x65,
+    0x66, 0x66, 0x16, 0x00, 0x01, 0x07, 0x07, 0x00, 0x05, 0x0b, 0x01, 0x00, 0x00, 0x01, 0x1a, 0x9e,
+    0x66, 0x00, 0x67, 0xc5, 0x66, 0x00, 0x67, 0xc3, 0x66, 0x00, 0x65, 0xff, 0x66, 0x83, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0x9f, 0x66, 0x0d, 0x42, 0x00, 0x10, 0x46, 0x65, 0x40, 0x00, 0x44,
+    0x66, 0x62, 0x2b, 0x00, 0x12, 0x62, 0xd9, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0x85, 0x66,
+    0x00, 0x65, 0xc5, 0x66, 0x00, 0x65, 0x83, 0x66, 0x03, 0x65, 0x66, 0x65, 0x65, 0xbf, 0x66, 0x00,
+    0x65, 0xb8, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9f, 0x66, 0x07, 0x26, 0x00, 0x3c, 0x66,
+    0x65, 0x44, 0x01, 0x40, 0x82, 0x66, 0x02, 0x1a, 0x00, 0x38, 0xff, 0x66, 0xff, 0x66, 0xa0, 0x66,
+    0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9f, 0x66, 0x0d, 0x1c, 0x00, 0x57,
+    0x66, 0x66, 0x4b, 0x00, 0x36, 0x66, 0x65, 0x66, 0x5a, 0x00, 0x19, 0xff, 0x66, 0xff, 0x66, 0x8d,
+    0x66, 0x00, 0x65, 0xa0, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9c, 0x66, 0x0a, 0x65, 0x66,
+    0x66, 0x22, 0x00, 0x57, 0x66, 0x66, 0x57, 0x00, 0x23, 0x82, 0x66, 0x02, 0x67, 0x0e, 0x06, 0xff,
+    0x66, 0xff, 0x66, 0x8c, 0x66, 0x00, 0x67, 0xa1, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a,
+    0x66, 0x07, 0x65, 0x66, 0x66, 0x67, 0x66, 0x31, 0x00, 0x3e, 0x82, 0x66, 0x01, 0x07, 0x0a, 0x83,
+    0x66, 0x03, 0x16, 0x00, 0x5f, 0x65, 0xff, 0x66, 0xff, 0x66, 0x88, 0x66, 0x03, 0x43, 0x39, 0x3e,
+    0x44, 0x8b, 0x49, 0x02, 0x47, 0x42, 0x3e, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9b,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x0d, 0x48, 0x00, 0x08, 0x5b, 0x66, 0x66, 0x1e, 0x00, 0x3b, 0x66,
+    0x66, 0x5f, 0x02, 0x06, 0xff, 0x66, 0xff, 0x66, 0x89, 0x66, 0x03, 0x67, 0x1d, 0x00, 0x01, 0x8e,
+    0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9b, 0x66, 0x00, 0x65, 0x83,
+    0x66, 0x0c, 0x19, 0x00, 0x04, 0x46, 0x66, 0x47, 0x00, 0x03, 0x2d, 0x3a, 0x11, 0x00, 0x1b, 0xff,
+    0x66, 0xff, 0x66, 0x8a, 0x66, 0x05, 0x22, 0x00, 0x07, 0x0b, 0x0b, 0x0a, 0x89, 0x0b, 0x02, 0x09,
+    0x04, 0x0f, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xa0, 0x66, 0x06, 0x59, 0x10, 0x01,
+    0x4c, 0x66, 0x66, 0x2a, 0x83, 0x00, 0x03, 0x06, 0x58, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x87,
+    0x66, 0x05, 0x67, 0x22, 0x00, 0x4d, 0x66, 0x67, 0x8c, 0x66, 0x00, 0x63, 0x91, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xa1, 0x66, 0x02, 0x64, 0x40, 0x61, 0x82, 0x66, 0x04, 0x3e, 0x21, 0x15,
+    0x2e, 0x52, 0xff, 0x66, 0xff, 0x66, 0x8b, 0x66, 0x02, 0x21, 0x00, 0x49, 0x8b, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x00, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x97, 0x66, 0x00, 0x65,
+    0x84, 0x66, 0x06, 0x65, 0x66, 0x66, 0x65, 0x66, 0x66, 0x67, 0xff, 0x66, 0xff, 0x66, 0x93, 0x66,
+    0x06, 0x1c, 0x00, 0x42, 0x65, 0x66, 0x66, 0x65, 0x9d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0x9c, 0x66, 0x00, 0x65, 0x89, 0x66, 0x01, 0x67, 0x65, 0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0xff,
+    0x66, 0x8a, 0x66, 0x04, 0x52, 0x4a, 0x5d, 0x66, 0x67, 0x9f, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0x99, 0x66, 0x00, 0x65, 0x83, 0x66, 0x01, 0x5f, 0x5a, 0x84, 0x66, 0x05, 0x42, 0x29, 0x18,
+    0x22, 0x35, 0x5c, 0xff, 0x66, 0xff, 0x66, 0x8d, 0x66, 0x01, 0x67, 0x65, 0xa1, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0x9b, 0x66, 0x09, 0x65, 0x33, 0x14, 0x00, 0x00, 0x0a, 0x3b, 0x66, 0x61,
+    0x1e, 0x82, 0x00, 0x06, 0x01, 0x00, 0x07, 0x4a, 0x66, 0x66, 0x65, 0xff, 0x66, 0xff, 0x66, 0xad,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9b, 0x66, 0x00, 0x38, 0x85, 0x00, 0x0a, 0x34, 0x2e,
+    0x00, 0x04, 0x26, 0x33, 0x26, 0x04, 0x00, 0x09, 0x61, 0xff, 0x66, 0xff, 0x66, 0x8a, 0x66, 0x07,
+    0x67, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0x98, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0x99, 0x66, 0x0c, 0x65, 0x57, 0x03, 0x00, 0x2e, 0x57, 0x5b, 0x3d, 0x05,
+    0x04, 0x04, 0x09, 0x57, 0x82, 0x66, 0x03, 0x59, 0x09, 0x00, 0x38, 0xff, 0x66, 0xff, 0x66, 0x89,
+    0x66, 0x00, 0x65, 0x84, 0x66, 0x03, 0x67, 0x67, 0x66, 0x65, 0x9b, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0x9a, 0x66, 0x0a, 0x3b, 0x00, 0x1d, 0x66, 0x65, 0x66, 0x66, 0x40, 0x00, 0x00, 0x39,
+    0x84, 0x66, 0x03, 0x3c, 0x00, 0x23, 0x67, 0xff, 0x66, 0xff, 0x66, 0x89, 0x66, 0x04, 0x2c, 0x1a,
+    0x42, 0x66, 0x65, 0x9f, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x0c, 0x2d, 0x00,
+    0x3f, 0x65, 0x67, 0x66, 0x66, 0x65, 0x02, 0x00, 0x52, 0x66, 0x65, 0x82, 0x66, 0x02, 0x54, 0x00,
+    0x16, 0xff, 0x66, 0xff, 0x66, 0x8a, 0x66, 0x02, 0x1b, 0x00, 0x3f, 0x84, 0x66, 0x02, 0x3e, 0x39,
+    0x5b, 0x99, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x9a, 0x66, 0x14, 0x24, 0x00, 0x4b, 0x66,
+    0x67, 0x66, 0x67, 0x67, 0x0e, 0x00, 0x5d, 0x65, 0x66, 0x66, 0x65, 0x65, 0x5f, 0x00, 0x0d, 0x66,
+    0x65, 0xff, 0x66, 0xff, 0x66, 0x88, 0x66, 0x0a, 0x20, 0x00, 0x43, 0x66, 0x67, 0x66, 0x66, 0x67,
+    0x0c, 0x00, 0x48, 0x84, 0x66, 0x01, 0x65, 0x65, 0x83, 0x66, 0x00, 0x65, 0x8d, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0x98, 0x66, 0x06, 0x67, 0x66, 0x22, 0x00, 0x4d, 0x65, 0x65, 0x82, 0x66,
+    0x02, 0x10, 0x00, 0x5e, 0x84, 0x66, 0x02, 0x60, 0x00, 0x0e, 0xff, 0x66, 0xff, 0x66, 0x89, 0x66,
+    0x03, 0x65, 0x22, 0x00, 0x45, 0x83, 0x66, 0x07, 0x67, 0x15, 0x00, 0x51, 0x66, 0x65, 0x66, 0x65,
+    0x95, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x99, 0x66, 0x03, 0x67, 0x22, 0x00, 0x4d, 0x84,
+    0x66, 0x0c, 0x10, 0x00, 0x5f, 0x66, 0x65, 0x65, 0x66, 0x66, 0x60, 0x00, 0x0e, 0x66, 0x65, 0xff,
+    0x66, 0xff, 0x66, 0x88, 0x66, 0x0b, 0x22, 0x00, 0x46, 0x66, 0x66, 0x67, 0x66, 0x66, 0x17, 0x00,
+    0x53, 0x67, 0x82, 0x66, 0x00, 0x67, 0x94, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x98, 0x66,
+    0x0d, 0x67, 0x65, 0x22, 0x00, 0x4d, 0x66, 0x66, 0x67, 0x66, 0x66, 0x10, 0x00, 0x5f, 0x65, 0x83,
+    0x66, 0x02, 0x60, 0x00, 0x0d, 0xff, 0x66, 0xff, 0x66, 0x8a, 0x66, 0x0c, 0x22, 0x00, 0x46, 0x66,
+    0x67, 0x66, 0x66, 0x67, 0x18, 0x01, 0x53, 0x66, 0x65, 0x82, 0x66, 0x01, 0x67, 0x67, 0x92, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x98, 0x66, 0x14, 0x67, 0x65, 0x22, 0x00, 0x4d, 0x66, 0x67,
+    0x66, 0x65, 0x67, 0x10, 0x00, 0x5f, 0x66, 0x67, 0x65, 0x66, 0x66, 0x60, 0x00, 0x0e, 0xff, 0x66,
+    0xff, 0x66, 0x8a, 0x66, 0x02, 0x23, 0x00, 0x46, 0x84, 0x66, 0x02, 0x18, 0x00, 0x52, 0x99, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x97, 0x66, 0x05, 0x65, 0x65, 0x66, 0x21, 0x00, 0x49, 0x84,
+    0x61, 0x0a, 0x0e, 0x00, 0x5a, 0x61, 0x61, 0x60, 0x61, 0x61, 0x5b, 0x00, 0x0e, 0xff, 0x66, 0xff,
+    0x66, 0x89, 0x66, 0x04, 0x67, 0x21, 0x00, 0x46, 0x65, 0x82, 0x66, 0x04, 0x67, 0x17, 0x00, 0x52,
+    0x67, 0x84, 0x66, 0x00, 0x65, 0x92, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x97, 0x66, 0x03,
+    0x67, 0x66, 0x67, 0x22, 0x90, 0x00, 0x01, 0x0d, 0x65, 0xff, 0x66, 0xff, 0x66, 0x89, 0x66, 0x02,
+    0x22, 0x00, 0x46, 0x84, 0x66, 0x02, 0x17, 0x00, 0x53, 0x82, 0x66, 0x01, 0x67, 0x65, 0x94, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x98, 0x66, 0x02, 0x67, 0x66, 0x20, 0x86, 0x00, 0x00, 0x01,
+    0x88, 0x00, 0x00, 0x09, 0xff, 0x66, 0xff, 0x66, 0x89, 0x66, 0x0b, 0x65, 0x22, 0x00, 0x3d, 0x5d,
+    0x5e, 0x5e, 0x5d, 0x5e, 0x16, 0x00, 0x4c, 0x84, 0x5e, 0x02, 0x5d, 0x58, 0x51, 0x82, 0x66, 0x00,
+    0x65, 0x8d, 0x66, 0xa1, 0x88, 0xaf, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0x98, 0x66, 0x90,
+    0x88, 0x98, 0x66, 0x06, 0x67, 0x67, 0x57, 0x56, 0x5c, 0x5e, 0x5d, 0x87, 0x5e, 0x05, 0x5f, 0x5d,
+    0x5e, 0x5d, 0x57, 0x50, 0xb7, 0x66, 0x00, 0x65, 0x83, 0x66, 0x04, 0x65, 0x66, 0x65, 0x66, 0x67,
+    0x84, 0x66, 0x00, 0x64, 0xc9, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0xef, 0x66, 0x06, 0x65,
+    0x66, 0x67, 0x66, 0x21, 0x00, 0x01, 0x8e, 0x00, 0x02, 0x0e, 0x66, 0x65, 0x8f, 0x66, 0xa1, 0x88,
+    0xab, 0x66, 0x02, 0x67, 0x66, 0x65, 0x87, 0x66, 0x00, 0x65, 0x96, 0x66, 0x90, 0x88, 0xe7, 0x66,
+    0x00, 0x67, 0x89, 0x66, 0x03, 0x65, 0x66, 0x66, 0x64, 0x98, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00,
+    0x67, 0xea, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0xa4, 0x66, 0x04,
+    0x65, 0x65, 0x66, 0x66, 0x1d, 0x90, 0x00, 0x03, 0x0e, 0x66, 0x66, 0x65, 0x8e, 0x66, 0xa1, 0x88,
+    0xb1, 0x66, 0x00, 0x67, 0x9b, 0x66, 0x90, 0x88, 0x97, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x65,
+    0x66, 0x65, 0x8b, 0x66, 0x00, 0x65, 0xb8, 0x66, 0x00, 0x67, 0xc8, 0x66, 0x00, 0x65, 0x93, 0x66,
+    0x03, 0x65, 0x66, 0x66, 0x67, 0xb0, 0x66, 0x00, 0x61, 0x82, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65,
+    0x88, 0x66, 0x02, 0x53, 0x1d, 0x65, 0xa7, 0x66, 0x06, 0x65, 0x66, 0x67, 0x66, 0x55, 0x4f, 0x56,
+    0x88, 0x5c, 0x07, 0x5d, 0x5d, 0x5c, 0x5c, 0x5a, 0x55, 0x54, 0x67, 0x90, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0x9c, 0x66, 0x00, 0x65, 0x8c, 0x66, 0x82, 0x67, 0x01, 0x66, 0x67, 0xb4, 0x66,
+    0x00, 0x65, 0x89, 0x66, 0x05, 0x57, 0x38, 0x22, 0x24, 0x38, 0x56, 0x9c, 0x66, 0x01, 0x65, 0x65,
+    0x98, 0x66, 0x00, 0x67, 0x90, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xb3, 0x66, 0x07, 0x65, 0x23,
+    0x31, 0x65, 0x66, 0x66, 0x65, 0x68, 0x88, 0x66, 0x04, 0x3f, 0x04, 0x0e, 0x66, 0x65, 0xa8, 0x66,
+    0x01, 0x67, 0x65, 0x82, 0x66, 0x00, 0x65, 0xa0, 0x66, 0xa1, 0x88, 0xa7, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0x84, 0x66, 0x00, 0x65, 0x9c, 0x66, 0x90, 0x88, 0xa7, 0x66, 0x02, 0x67, 0x66, 0x67,
+    0x82, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x0f, 0x67, 0x66, 0x67, 0x66, 0x66, 0x65, 0x46, 0x27, 0x0c,
+    0x14, 0x2e, 0x54, 0x66, 0x66, 0x45, 0x04, 0x83, 0x00, 0x01, 0x04, 0x45, 0xff, 0x66, 0x81, 0x66,
+    0x03, 0x22, 0x02, 0x1a, 0x5c, 0x83, 0x66, 0x00, 0x65, 0x84, 0x66, 0x06, 0x60, 0x23, 0x00, 0x00,
+    0x0e, 0x66, 0x67, 0xa6, 0x66, 0x01, 0x65, 0x65, 0x8f, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x65,
+    0x66, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xa7, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x67, 0x85, 0x66,
+    0x00, 0x67, 0x97, 0x66, 0x90, 0x88, 0xe5, 0x66, 0x11, 0x3c, 0x00, 0x00, 0x01, 0x01, 0x00, 0x05,
+    0x54, 0x51, 0x01, 0x00, 0x0f, 0x26, 0x24, 0x06, 0x00, 0x01, 0x57, 0xcb, 0x66, 0x00, 0x65, 0xb3,
+    0x66, 0x06, 0x27, 0x00, 0x00, 0x08, 0x47, 0x66, 0x65, 0x84, 0x66, 0x06, 0x67, 0x4d, 0x0c, 0x00,
+    0x00, 0x10, 0x4c, 0xab, 0x66, 0x00, 0x67, 0x95, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xa7,
+    0x66, 0x00, 0x65, 0x84, 0x66, 0x02, 0x61, 0x2f, 0x35, 0x9d, 0x66, 0x90, 0x88, 0xac, 0x66, 0x00,
+    0x65, 0xb6, 0x66, 0x12, 0x4f, 0x01, 0x00, 0x1d, 0x43, 0x44, 0x22, 0x00, 0x0c, 0x1c, 0x00, 0x2a,
+    0x64, 0x66, 0x66, 0x5c, 0x0d, 0x00, 0x27, 0x9a, 0x66, 0x01, 0x65, 0x65, 0xaa, 0x66, 0x00, 0x64,
+    0x85, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x05, 0x3c, 0x06, 0x00, 0x00, 0x28, 0x62, 0x83, 0x66, 0x06,
+    0x64, 0x31, 0x00, 0x00, 0x03, 0x33, 0x64, 0xa7, 0x66, 0x01, 0x67, 0x67, 0x87, 0x66, 0x00, 0x65,
+    0x89, 0x66, 0x00, 0x67, 0x94, 0x66, 0xa1, 0x88, 0xac, 0x66, 0x03, 0x3e, 0x08, 0x00, 0x31, 0x9d,
+    0x66, 0x90, 0x88, 0x98, 0x66, 0x00, 0x67, 0xc7, 0x66, 0x05, 0x65, 0x66, 0x66, 0x2b, 0x00, 0x21,
+    0x82, 0x66, 0x04, 0x65, 0x2e, 0x00, 0x00, 0x0f, 0x84, 0x66, 0x02, 0x48, 0x00, 0x04, 0xb0, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x02, 0x28, 0x08, 0x54, 0x90, 0x66, 0x02, 0x4e, 0x07, 0x32, 0xb6, 0x66,
+    0x0d, 0x5c, 0x1f, 0x00, 0x00, 0x10, 0x52, 0x66, 0x66, 0x59, 0x15, 0x00, 0x00, 0x13, 0x53, 0xd4,
+    0x66, 0xa1, 0x88, 0xa6, 0x66, 0x00, 0x65, 0x82, 0x66, 0x05, 0x4e, 0x14, 0x00, 0x00, 0x01, 0x31,
+    0x9d, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x03, 0x18, 0x01, 0x57, 0x65, 0x82, 0x66, 0x03, 0x60, 0x04,
+    0x00, 0x37, 0x82, 0x66, 0x08, 0x67, 0x66, 0x66, 0x08, 0x00, 0x5f, 0x66, 0x67, 0x67, 0xb0, 0x66,
+    0x02, 0x22, 0x00, 0x52, 0x90, 0x66, 0x02, 0x49, 0x00, 0x2b, 0xb6, 0x66, 0x0c, 0x67, 0x66, 0x44,
+    0x08, 0x00, 0x02, 0x35, 0x3d, 0x05, 0x00, 0x02, 0x33, 0x64, 0x83, 0x66, 0x00, 0x67, 0xd0, 0x66,
+    0xa1, 0x88, 0x9e, 0x66, 0x02, 0x65, 0x66, 0x67, 0x86, 0x66, 0x01, 0x5b, 0x22, 0x84, 0x00, 0x00,
+    0x31, 0x9d, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x04, 0x05, 0x06, 0x66, 0x66, 0x65, 0x82, 0x66, 0x02,
+    0x12, 0x00, 0x46, 0x84, 0x66, 0x05, 0x67, 0x16, 0x00, 0x52, 0x66, 0x65, 0xaf, 0x66, 0x04, 0x67,
+    0x66, 0x22, 0x00, 0x52, 0x90, 0x66, 0x02, 0x48, 0x00, 0x2b, 0xb7, 0x66, 0x03, 0x65, 0x66, 0x5f,
+    0x23, 0x83, 0x00, 0x01, 0x12, 0x54, 0x82, 0x66, 0x04, 0x67, 0x66, 0x67, 0x65, 0x65, 0xcf, 0x66,
+    0xa1, 0x88, 0x98, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x65, 0x83, 0x66,
+    0x02, 0x62, 0x32, 0x03, 0x85, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x01, 0x01,
+    0x08, 0x85, 0x66, 0x02, 0x14, 0x00, 0x47, 0x85, 0x66, 0x02, 0x1b, 0x00, 0x53, 0xb3, 0x66, 0x01,
+    0x22, 0x00, 0x92, 0x01, 0x01, 0x00, 0x2b, 0xba, 0x66, 0x05, 0x5b, 0x0c, 0x00, 0x00, 0x02, 0x55,
+    0xd8, 0x66, 0xa1, 0x88, 0xa5, 0x66, 0x01, 0x41, 0x0a, 0x87, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90,
+    0x88, 0xe2, 0x66, 0x04, 0x67, 0x66, 0x0c, 0x00, 0x5e, 0x83, 0x66, 0x03, 0x65, 0x06, 0x00, 0x3c,
+    0x85, 0x66, 0x02, 0x0f, 0x00, 0x62, 0x85, 0x66, 0x00, 0x67, 0xac, 0x66, 0x00, 0x22, 0x94, 0x00,
+    0x00, 0x2b, 0xb9, 0x66, 0x08, 0x40, 0x06, 0x00, 0x02, 0x04, 0x00, 0x03, 0x3a, 0x65, 0x84, 0x66,
+    0x00, 0x67, 0xd0, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x00, 0x65, 0x86, 0x66, 0x01, 0x50, 0x15, 0x82,
+    0x00, 0x00, 0x01, 0x82, 0x00, 0x03, 0x01, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xe1, 0x66,
+    0x0d, 0x67, 0x66, 0x66, 0x1c, 0x00, 0x31, 0x67, 0x66, 0x66, 0x65, 0x3d, 0x00, 0x01, 0x1a, 0x84,
+    0x66, 0x02, 0x56, 0x00, 0x0a, 0x82, 0x66, 0x00, 0x67, 0xae, 0x66, 0x00, 0x67, 0xcb, 0x66, 0x00,
+    0x65, 0x82, 0x66, 0x0e, 0x5d, 0x1f, 0x00, 0x00, 0x10, 0x52, 0x58, 0x17, 0x00, 0x00, 0x16, 0x58,
+    0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x67, 0xce, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x05, 0x67, 0x66,
+    0x66, 0x65, 0x5b, 0x24, 0x8b, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xe2, 0x66, 0x0d, 0x65,
+    0x66, 0x46, 0x00, 0x01, 0x34, 0x5c, 0x5e, 0x39, 0x03, 0x03, 0x10, 0x00, 0x43, 0x82, 0x66, 0x03,
+    0x64, 0x1e, 0x01, 0x1d, 0xff, 0x66, 0x82, 0x66, 0x0d, 0x42, 0x08, 0x00, 0x00, 0x2a, 0x62, 0x66,
+    0x66, 0x65, 0x33, 0x01, 0x01, 0x04, 0x3a, 0x82, 0x66, 0x02, 0x67, 0x67, 0x65, 0xce, 0x66, 0xa1,
+    0x88, 0x9f, 0x66, 0x02, 0x63, 0x34, 0x04, 0x8c, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xdf,
+    0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x1c, 0x84, 0x00, 0x0e, 0x01, 0x45, 0x44, 0x00, 0x00, 0x27,
+    0x40, 0x3b, 0x16, 0x00, 0x03, 0x53, 0x66, 0x66, 0x67, 0xc4, 0x66, 0x00, 0x65, 0xb7, 0x66, 0x05,
+    0x55, 0x18, 0x00, 0x00, 0x08, 0x48, 0x85, 0x66, 0x08, 0x4f, 0x0d, 0x00, 0x00, 0x18, 0x53, 0x66,
+    0x67, 0x67, 0xcf, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x00, 0x65, 0x85, 0x66, 0x01, 0x43, 0x0c, 0x88,
+    0x00, 0x06, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x0a,
+    0x65, 0x64, 0x2e, 0x07, 0x00, 0x02, 0x18, 0x42, 0x66, 0x66, 0x2a, 0x85, 0x00, 0x03, 0x3a, 0x66,
+    0x66, 0x65, 0x84, 0x66, 0x00, 0x67, 0xaa, 0x66, 0x02, 0x67, 0x66, 0x65, 0x97, 0x66, 0x01, 0x65,
+    0x67, 0xb0, 0x66, 0x04, 0x22, 0x00, 0x00, 0x1d, 0x5c, 0x85, 0x66, 0x07, 0x67, 0x66, 0x62, 0x26,
+    0x00, 0x00, 0x01, 0x2f, 0xd1, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x01, 0x53, 0x18, 0x85, 0x00, 0x00,
+    0x01, 0x84, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xe8, 0x66, 0x03,
+    0x5b, 0x60, 0x66, 0x65, 0x82, 0x66, 0x05, 0x40, 0x16, 0x07, 0x06, 0x16, 0x3f, 0xff, 0x66, 0x82,
+    0x66, 0x05, 0x22, 0x02, 0x37, 0x66, 0x67, 0x65, 0x83, 0x66, 0x08, 0x65, 0x66, 0x67, 0x66, 0x65,
+    0x43, 0x05, 0x00, 0x0e, 0xd1, 0x66, 0xa1, 0x88, 0x99, 0x66, 0x04, 0x65, 0x66, 0x66, 0x53, 0x18,
+    0x89, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xe9, 0x66, 0x02, 0x65,
+    0x66, 0x67, 0xff, 0x66, 0x8a, 0x66, 0x02, 0x67, 0x2e, 0x4f, 0x83, 0x66, 0x05, 0x67, 0x67, 0x65,
+    0x65, 0x66, 0x67, 0x83, 0x66, 0x04, 0x59, 0x16, 0x0e, 0x67, 0x65, 0xcf, 0x66, 0xa1, 0x88, 0x9e,
+    0x66, 0x01, 0x43, 0x0c, 0x82, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x01, 0x01, 0x82, 0x00, 0x00,
+    0x31, 0x9d, 0x66, 0x90, 0x88, 0xe8, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00,
+    0x67, 0xff, 0x66, 0x91, 0x66, 0x03, 0x67, 0x67, 0x63, 0x3f, 0xd1, 0x66, 0xa1, 0x88, 0x9c, 0x66,
+    0x05, 0x67, 0x66, 0x66, 0x63, 0x34, 0x04, 0x8c, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xf5,
+    0x66, 0x00, 0x67, 0xff, 0x66, 0xe6, 0x66, 0xa1, 0x88, 0x98, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x01, 0x5b, 0x25, 0x82, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x31, 0x9d, 0x66,
+    0x90, 0x88, 0xe9, 0x66, 0x00, 0x67, 0xff, 0x66, 0x9d, 0x66, 0x00, 0x65, 0xd3, 0x66, 0xa1, 0x88,
+    0x98, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0x83, 0x66, 0x01, 0x50, 0x16, 0x89, 0x00, 0x00,
+    0x31, 0x9d, 0x66, 0x90, 0x88, 0xe8, 0x66, 0x01, 0x67, 0x67, 0x85, 0x66, 0x03, 0x67, 0x66, 0x66,
+    0x67, 0xff, 0x66, 0xe8, 0x66, 0xa1, 0x88, 0xa2, 0x66, 0x04, 0x65, 0x66, 0x66, 0x42, 0x0b, 0x87,
+    0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0x8d, 0x66, 0x00, 0x67, 0xce,
+    0x66, 0xa1, 0x88, 0x9b, 0x66, 0x00, 0x67, 0x88, 0x66, 0x03, 0x67, 0x62, 0x33, 0x04, 0x85, 0x00,
+    0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0xef, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0xff, 0x66,
+    0x85, 0x66, 0x00, 0x65, 0x8d, 0x66, 0x00, 0x65, 0xd2, 0x66, 0xa1, 0x88, 0xa8, 0x66, 0x01, 0x5a,
+    0x24, 0x84, 0x00, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0x03, 0x66, 0x65, 0x66, 0x67, 0x82, 0x66,
+    0x00, 0x65, 0xbc, 0x66, 0x00, 0x65, 0xff, 0x66, 0xe2, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0xad,
+    0x66, 0x02, 0x65, 0x66, 0x66, 0xa1, 0x88, 0xaa, 0x66, 0x01, 0x4f, 0x16, 0x82, 0x00, 0x01, 0x30,
+    0x67, 0x9c, 0x66, 0x90, 0x88, 0x03, 0x6a, 0x66, 0x66, 0x67, 0xc4, 0x66, 0x00, 0x69, 0x82, 0x66,
+    0x02, 0x67, 0x66, 0x65, 0xff, 0x66, 0xd8, 0x66, 0x00, 0x65, 0xb3, 0x66, 0xa1, 0x88, 0xac, 0x66,
+    0x03, 0x40, 0x0a, 0x00, 0x31, 0x9d, 0x66, 0x90, 0x88, 0x00, 0x6e, 0x85, 0x66, 0x00, 0x67, 0xbc,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x70, 0xff, 0x66, 0xe0, 0x66, 0x01, 0x67, 0x67, 0xb0, 0x66,
+    0x00, 0x87, 0xa0, 0x88, 0xa7, 0x66, 0x82, 0x67, 0x82, 0x66, 0x02, 0x63, 0x32, 0x3a, 0x9d, 0x66,
+    0x90, 0x88, 0x00, 0x79, 0x83, 0x66, 0x01, 0x65, 0x64, 0xbd, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00,
+    0x79, 0xff, 0x66, 0xdd, 0x66, 0x00, 0x67, 0xb2, 0x66, 0x01, 0x67, 0x66, 0xa1, 0x88, 0xa7, 0x66,
+    0x00, 0x67, 0x85, 0x66, 0x00, 0x65, 0x9e, 0x66, 0x90, 0x88, 0x01, 0x7e, 0x75, 0xbf, 0x66, 0x01,
+    0x65, 0x67, 0x82, 0x66, 0x02, 0x65, 0x74, 0x7f, 0xff, 0x66, 0xdd, 0x66, 0x00, 0x6a, 0xaf, 0x66,
+    0x00, 0x65, 0x82, 0x66, 0x00, 0x68, 0xa1, 0x88, 0xae, 0x66, 0x01, 0x67, 0x67, 0x9d, 0x66, 0x90,
+    0x88, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x67, 0xbf, 0x66, 0x04, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x83,
+    0x66, 0x00, 0x67, 0xff, 0x66, 0xd8, 0x66, 0x00, 0x6e, 0x82, 0x66, 0x00, 0x65, 0xaf, 0x66, 0x00,
+    0x70, 0xa1, 0x88, 0xad, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0x9b, 0x66, 0x90, 0x88, 0x04,
+    0x84, 0x7f, 0x79, 0x70, 0x6a, 0xbe, 0x66, 0x05, 0x67, 0x69, 0x70, 0x7c, 0x7f, 0x85, 0xff, 0x66,
+    0xdd, 0x66, 0x04, 0x79, 0x67, 0x65, 0x66, 0x67, 0xaf, 0x66, 0x00, 0x79, 0xa1, 0x88, 0xab, 0x66,
+    0x02, 0x65, 0x66, 0x67, 0x86, 0x66, 0x00, 0x67, 0x97, 0x66, 0x90, 0x88, 0x02, 0x7f, 0x74, 0x65,
+    0xbc, 0x66, 0x00, 0x65, 0x86, 0x66, 0x01, 0x76, 0x7f, 0x83, 0x66, 0x01, 0x65, 0x67, 0xff, 0x66,
+    0xd7, 0x66, 0x03, 0x80, 0x76, 0x66, 0x67, 0xab, 0x66, 0x05, 0x67, 0x66, 0x65, 0x66, 0x74, 0x7f,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x03, 0x7b, 0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x67, 0xbf,
+    0x66, 0x01, 0x67, 0x7b, 0xff, 0x66, 0xdd, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0xab, 0x66,
+    0x04, 0x68, 0x6e, 0x7b, 0x7f, 0x84, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x01, 0x6f, 0x65, 0xc5,
+    0x66, 0x01, 0x67, 0x70, 0xff, 0x66, 0xdd, 0x66, 0x06, 0x84, 0x7e, 0x79, 0x70, 0x69, 0x67, 0x65,
+    0xa9, 0x66, 0x04, 0x67, 0x70, 0x7b, 0x7f, 0x85, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x05, 0x69,
+    0x66, 0x65, 0x66, 0x66, 0x65, 0xc2, 0x66, 0x00, 0x69, 0xff, 0x66, 0xdd, 0x66, 0x04, 0x7f, 0x74,
+    0x66, 0x66, 0x65, 0xad, 0x66, 0x02, 0x67, 0x77, 0x7e, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xcd,
+    0x66, 0x00, 0x65, 0xff, 0x66, 0xd8, 0x66, 0x04, 0x7a, 0x65, 0x66, 0x66, 0x67, 0xae, 0x66, 0x01,
+    0x67, 0x7a, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x03, 0x65, 0x67, 0x67, 0x65, 0xff,
+    0x66, 0xd9, 0x66, 0x03, 0x6f, 0x66, 0x66, 0x67, 0xaf, 0x66, 0x01, 0x67, 0x6f, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0x00, 0x65, 0xc6, 0x66, 0x00, 0x67, 0xff, 0x66, 0xde, 0x66, 0x02, 0x69, 0x66,
+    0x65, 0xae, 0x66, 0x03, 0x67, 0x65, 0x66, 0x69, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0x82, 0x66,
+    0x00, 0x65, 0xc4, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x67, 0xff, 0x66, 0xd9, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x00, 0x65, 0xac, 0x66, 0x01, 0x67, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xd7, 0x66, 0x00, 0x65, 0x84, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc8,
+    0x66, 0x05, 0x65, 0x66, 0x67, 0x66, 0x66, 0x65, 0xc5, 0x66, 0x00, 0x67, 0xc1, 0x66, 0x01, 0x65,
+    0x67, 0xc7, 0x66, 0x00, 0x67, 0xba, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xcc, 0x66, 0x00,
+    0x65, 0xc6, 0x66, 0x00, 0x67, 0xcc, 0x66, 0x00, 0x65, 0xbb, 0x66, 0x05, 0x65, 0x66, 0x66, 0x65,
+    0x66, 0x67, 0xb7, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0x95, 0x66, 0x01, 0x67,
+    0x65, 0xc5, 0x66, 0x03, 0x67, 0x66, 0x65, 0x67, 0x83, 0x66, 0x00, 0x65, 0xbb, 0x66, 0x00, 0x65,
+    0xb9, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0x93, 0x66, 0x00, 0x65, 0xc4, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xf6, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x67, 0xc8, 0x66, 0x02, 0x67, 0x66, 0x65,
+    0xff, 0x66, 0xc6, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xcb, 0x66, 0x00, 0x65, 0xc7, 0x66,
+    0x00, 0x65, 0xc2, 0x66, 0x00, 0x65, 0x85, 0x66, 0x06, 0x65, 0x66, 0x66, 0x65, 0x66, 0x65, 0x65,
+    0xbe, 0x66, 0x00, 0x67, 0xb6, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x69,
+    0x82, 0x66, 0x00, 0x67, 0xc3, 0x66, 0x04, 0x68, 0x69, 0x66, 0x66, 0x67, 0xc4, 0x66, 0x01, 0x69,
+    0x69, 0x85, 0x66, 0x00, 0x67, 0xbc, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x68, 0xb5, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x03, 0x6e, 0x66, 0x66, 0x67, 0xc4, 0x66, 0x01, 0x70,
+    0x6e, 0xc7, 0x66, 0x01, 0x70, 0x6e, 0xc2, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x70, 0xb5, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x79, 0xbf, 0x66, 0x00, 0x65, 0x86, 0x66,
+    0x01, 0x79, 0x79, 0x83, 0x66, 0x82, 0x65, 0xbc, 0x66, 0x00, 0x67, 0x82, 0x66, 0x06, 0x79, 0x79,
+    0x66, 0x67, 0x66, 0x66, 0x65, 0xbc, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x79, 0xa0, 0x66, 0x01,
+    0x67, 0x65, 0x92, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x01, 0x7f, 0x75, 0xbf,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x07, 0x65, 0x66, 0x74, 0x7f, 0x7e, 0x75, 0x66, 0x65, 0xc3, 0x66,
+    0x03, 0x74, 0x7f, 0x80, 0x75, 0x83, 0x66, 0x00, 0x67, 0xbc, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01,
+    0x74, 0x7f, 0x9f, 0x66, 0x00, 0x67, 0x94, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66,
+    0x04, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0xbe, 0x66, 0x0a, 0x67, 0x69, 0x6e, 0x7a, 0x7f, 0x84, 0x84,
+    0x7f, 0x79, 0x6e, 0x67, 0xbe, 0x66, 0x0a, 0x67, 0x67, 0x6e, 0x7b, 0x7f, 0x84, 0x85, 0x7f, 0x79,
+    0x6e, 0x68, 0x83, 0x66, 0x00, 0x65, 0xb8, 0x66, 0x06, 0x67, 0x66, 0x68, 0x6e, 0x7a, 0x7f, 0x84,
+    0xa0, 0x66, 0x02, 0x65, 0x65, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66,
+    0x04, 0x84, 0x7f, 0x79, 0x70, 0x69, 0xbd, 0x66, 0x0b, 0x65, 0x66, 0x69, 0x70, 0x7b, 0x7f, 0x84,
+    0x85, 0x7e, 0x78, 0x70, 0x67, 0xbf, 0x66, 0x0d, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0x84, 0x7f, 0x7a,
+    0x70, 0x69, 0x65, 0x66, 0x65, 0x67, 0xbb, 0x66, 0x04, 0x69, 0x70, 0x7b, 0x7f, 0x84, 0xb5, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x02, 0x7f, 0x74, 0x65, 0xc4, 0x66, 0x03, 0x76,
+    0x7f, 0x7e, 0x73, 0xc5, 0x66, 0x08, 0x74, 0x7e, 0x7f, 0x74, 0x66, 0x66, 0x67, 0x67, 0x65, 0xbc,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x01, 0x75, 0x7f, 0x9f, 0x66, 0x03, 0x65, 0x66, 0x67, 0x67, 0x91,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x7b, 0xc7, 0x66, 0x02, 0x7a, 0x7a,
+    0x65, 0xc2, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x7a, 0x7b, 0x82, 0x66, 0x00, 0x67, 0xbe, 0x66,
+    0x05, 0x65, 0x66, 0x66, 0x67, 0x66, 0x7a, 0xa0, 0x66, 0x03, 0x5e, 0x3e, 0x3e, 0x65, 0x90, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc7, 0x66, 0x06, 0x67, 0x67, 0x6f, 0x67, 0x66, 0x66, 0x65,
+    0xc2, 0x66, 0x02, 0x67, 0x70, 0x6f, 0x84, 0x66, 0x01, 0x65, 0x65, 0xc0, 0x66, 0x01, 0x70, 0x6f,
+    0xc7, 0x66, 0x00, 0x70, 0x9f, 0x66, 0x06, 0x65, 0x4e, 0x00, 0x04, 0x66, 0x66, 0x67, 0x8e, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x02, 0x69, 0x67, 0x65, 0xbe, 0x66, 0x08, 0x67,
+    0x66, 0x65, 0x66, 0x67, 0x65, 0x66, 0x68, 0x69, 0xc7, 0x66, 0x01, 0x68, 0x69, 0x82, 0x66, 0x00,
+    0x65, 0xbc, 0x66, 0x07, 0x67, 0x66, 0x66, 0x65, 0x67, 0x66, 0x66, 0x68, 0xa0, 0x66, 0x02, 0x56,
+    0x00, 0x0c, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa1, 0x66,
+    0x03, 0x65, 0x66, 0x66, 0x65, 0xa2, 0x66, 0x02, 0x59, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0x8b,
+    0x66, 0x02, 0x59, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xc8, 0x66, 0x02, 0x59, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xa1, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xa2, 0x66, 0x02, 0x59, 0x00, 0x0d,
+    0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xbd, 0x66, 0x00, 0x67, 0x88, 0x66, 0x03, 0x67, 0x59, 0x01, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xc8, 0x66, 0x02, 0x59, 0x00, 0x0f, 0x82, 0x66, 0x00,
+    0x65, 0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xba, 0x66, 0x00,
+    0x65, 0x8c, 0x66, 0x02, 0x59, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xb8, 0x66, 0x04, 0x5a, 0x57, 0x5e, 0x61, 0x60, 0x8a, 0x61, 0x02, 0x53, 0x01,
+    0x0e, 0x91, 0x66, 0xa1, 0x88, 0x86, 0x66, 0x00, 0x67, 0xc6, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xb8, 0x66, 0x07, 0x22, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x88, 0x00, 0x01, 0x02,
+    0x0d, 0x91, 0x66, 0xa1, 0x88, 0x01, 0x66, 0x65, 0xcc, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb8, 0x66, 0x00, 0x22, 0x86, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x0a,
+    0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0x83, 0x66, 0x00, 0x67, 0xc9, 0x66, 0x90, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x05, 0x53, 0x53, 0x59, 0x5c, 0x5c, 0x5d, 0x89, 0x5c, 0x02,
+    0x5a, 0x54, 0x50, 0x91, 0x66, 0xa1, 0x88, 0x04, 0x69, 0x66, 0x65, 0x66, 0x65, 0xc9, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x01, 0x67, 0x67, 0x84, 0x66, 0x00, 0x67, 0x86, 0x66,
+    0x02, 0x65, 0x66, 0x65, 0x93, 0x66, 0xa1, 0x88, 0x00, 0x6e, 0xcd, 0x66, 0x90, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xb8, 0x66, 0x02, 0x5c, 0x56, 0x5f, 0x83, 0x66, 0x01, 0x65, 0x67, 0x86, 0x66, 0x02,
+    0x60, 0x43, 0x44, 0x91, 0x66, 0xa1, 0x88, 0x05, 0x79, 0x66, 0x67, 0x66, 0x65, 0x67, 0xc8, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x13, 0x00, 0x3b, 0x84, 0x66, 0x0a, 0x60,
+    0x5d, 0x64, 0x66, 0x66, 0x67, 0x66, 0x66, 0x4f, 0x00, 0x03, 0x91, 0x66, 0xa1, 0x88, 0x01, 0x7f,
+    0x75, 0xcc, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x03, 0x67, 0x1a, 0x00, 0x44,
+    0x83, 0x66, 0x03, 0x65, 0x04, 0x00, 0x4c, 0x84, 0x66, 0x02, 0x58, 0x00, 0x0c, 0x91, 0x66, 0xa1,
+    0x88, 0x06, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x66, 0x65, 0xc7, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xb8, 0x66, 0x02, 0x1f, 0x00, 0x47, 0x84, 0x66, 0x02, 0x0c, 0x00, 0x56, 0x84, 0x66, 0x02,
+    0x5b, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0x04, 0x84, 0x7f, 0x79, 0x70, 0x69, 0xc4, 0x66, 0x05,
+    0x68, 0x70, 0x7a, 0x80, 0x84, 0x87, 0x8f, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x12, 0x24,
+    0x00, 0x48, 0x66, 0x66, 0x65, 0x66, 0x66, 0x0f, 0x00, 0x5a, 0x66, 0x66, 0x65, 0x66, 0x65, 0x5c,
+    0x00, 0x0f, 0x91, 0x66, 0xa1, 0x88, 0x04, 0x7f, 0x73, 0x66, 0x66, 0x65, 0xc7, 0x66, 0x01, 0x75,
+    0x7e, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03, 0x22, 0x00, 0x47, 0x65, 0x83, 0x66,
+    0x02, 0x10, 0x01, 0x5a, 0x84, 0x66, 0x02, 0x5c, 0x01, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0x00, 0x7a,
+    0x82, 0x66, 0x02, 0x65, 0x66, 0x67, 0xc0, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x65, 0x66, 0x7a,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x22, 0x00, 0x48, 0x84, 0x66, 0x02, 0x11,
+    0x00, 0x5b, 0x84, 0x66, 0x03, 0x5c, 0x00, 0x0e, 0x67, 0x90, 0x66, 0xa1, 0x88, 0x00, 0x6f, 0xc7,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x70, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x03,
+    0x22, 0x00, 0x48, 0x65, 0x83, 0x66, 0x02, 0x10, 0x00, 0x5a, 0x84, 0x66, 0x02, 0x5c, 0x00, 0x0e,
+    0x91, 0x66, 0xa1, 0x88, 0x03, 0x69, 0x66, 0x66, 0x65, 0xc9, 0x66, 0x00, 0x68, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x22, 0x01, 0x48, 0x84, 0x66, 0x02, 0x10, 0x00, 0x5b, 0x84,
+    0x66, 0x02, 0x5c, 0x00, 0x0e, 0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0x04, 0x66, 0x65,
+    0x66, 0x66, 0x67, 0xc5, 0x66, 0x00, 0x65, 0x82, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8,
+    0x66, 0x02, 0x22, 0x00, 0x49, 0x82, 0x66, 0x04, 0x65, 0x65, 0x0f, 0x00, 0x5a, 0x84, 0x66, 0x02,
+    0x5d, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0x85, 0x66, 0x00, 0x65, 0xc4, 0x66, 0x02, 0x65, 0x66,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x13, 0x22, 0x00, 0x41, 0x60, 0x5d, 0x5f,
+    0x5e, 0x5e, 0x0f, 0x00, 0x52, 0x5e, 0x5e, 0x5f, 0x5e, 0x5e, 0x55, 0x00, 0x0e, 0x67, 0x90, 0x66,
+    0xa1, 0x88, 0x03, 0x64, 0x66, 0x66, 0x65, 0xc7, 0x66, 0x02, 0x65, 0x66, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xb8, 0x66, 0x00, 0x21, 0x8b, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x0d, 0x91,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe1, 0x66, 0x05, 0x65, 0x66, 0x67, 0x66, 0x66, 0x67,
+    0xce, 0x66, 0x00, 0x67, 0xcf, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0xab, 0x66, 0x00, 0x1d,
+    0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x0a, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xe4, 0x66, 0x00, 0x64, 0x86, 0x66, 0x00, 0x65, 0xff, 0x66, 0x8f, 0x66, 0x00, 0x65, 0xb9, 0x66,
+    0x03, 0x55, 0x54, 0x5b, 0x5d, 0x84, 0x5c, 0x00, 0x5d, 0x82, 0x5c, 0x07, 0x5d, 0x5c, 0x5c, 0x5a,
+    0x55, 0x51, 0x66, 0x67, 0x8f, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xec, 0x66, 0x01, 0x67,
+    0x65, 0xca, 0x66, 0x00, 0x67, 0xfd, 0x66, 0x00, 0x67, 0x87, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67,
+    0x84, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4,
+    0x66, 0x03, 0x67, 0x65, 0x66, 0x67, 0xd4, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x00, 0x67, 0x87, 0x66,
+    0x01, 0x67, 0x67, 0xaa, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0x87, 0x66, 0x00, 0x67, 0x87,
+    0x66, 0x02, 0x65, 0x66, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xb3,
+    0x66, 0x00, 0x67, 0xc3, 0x66, 0x03, 0x67, 0x66, 0x67, 0x67, 0xbb, 0x66, 0x11, 0x67, 0x65, 0x66,
+    0x66, 0x62, 0x37, 0x1f, 0x11, 0x04, 0x00, 0x05, 0x15, 0x28, 0x3b, 0x62, 0x65, 0x66, 0x67, 0x92,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xdf, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0xca,
+    0x66, 0x07, 0x64, 0x57, 0x49, 0x52, 0x61, 0x67, 0x66, 0x65, 0xbe, 0x66, 0x03, 0x64, 0x64, 0x66,
+    0x65, 0x8b, 0x66, 0x02, 0x5d, 0x3a, 0x3c, 0xa8, 0x66, 0x00, 0x65, 0x84, 0x66, 0x02, 0x65, 0x3b,
+    0x08, 0x88, 0x00, 0x01, 0x0c, 0x48, 0x85, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xdf, 0x66, 0x07, 0x65, 0x66, 0x66, 0x67, 0x66, 0x4c, 0x43, 0x57, 0xc8, 0x66, 0x07,
+    0x3c, 0x09, 0x00, 0x00, 0x01, 0x01, 0x1e, 0x5a, 0xbf, 0x66, 0x05, 0x1c, 0x00, 0x1d, 0x62, 0x66,
+    0x65, 0x89, 0x66, 0x03, 0x50, 0x00, 0x04, 0x67, 0xa6, 0x66, 0x02, 0x65, 0x67, 0x65, 0x83, 0x66,
+    0x10, 0x31, 0x00, 0x00, 0x03, 0x28, 0x39, 0x48, 0x52, 0x46, 0x36, 0x24, 0x02, 0x00, 0x00, 0x27,
+    0x67, 0x65, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe2, 0x66, 0x05, 0x65, 0x67, 0x1b,
+    0x01, 0x07, 0x48, 0xc6, 0x66, 0x00, 0x37, 0x82, 0x00, 0x05, 0x04, 0x01, 0x01, 0x00, 0x04, 0x58,
+    0xbd, 0x66, 0x05, 0x67, 0x1e, 0x00, 0x00, 0x11, 0x57, 0x8a, 0x66, 0x02, 0x58, 0x01, 0x0c, 0xa8,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x04, 0x48, 0x00, 0x00, 0x1e, 0x59, 0x82, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x04, 0x56, 0x1b, 0x00, 0x00, 0x42, 0x92, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe0,
+    0x66, 0x04, 0x65, 0x66, 0x67, 0x66, 0x20, 0x82, 0x00, 0x04, 0x27, 0x5f, 0x66, 0x66, 0x65, 0x83,
+    0x66, 0x00, 0x65, 0xb4, 0x66, 0x00, 0x67, 0x85, 0x66, 0x0a, 0x5e, 0x03, 0x00, 0x1c, 0x56, 0x66,
+    0x63, 0x46, 0x0b, 0x00, 0x20, 0xbe, 0x66, 0x00, 0x21, 0x82, 0x00, 0x01, 0x06, 0x45, 0x89, 0x66,
+    0x03, 0x5b, 0x01, 0x0e, 0x67, 0xac, 0x66, 0x09, 0x0b, 0x00, 0x26, 0x67, 0x66, 0x66, 0x65, 0x65,
+    0x66, 0x65, 0x83, 0x66, 0x05, 0x29, 0x00, 0x09, 0x5f, 0x66, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xe2, 0x66, 0x08, 0x67, 0x66, 0x22, 0x00, 0x1a, 0x02, 0x00, 0x08, 0x41, 0x82,
+    0x66, 0x02, 0x65, 0x66, 0x65, 0x82, 0x66, 0x02, 0x65, 0x67, 0x67, 0xb6, 0x66, 0x0b, 0x3c, 0x00,
+    0x0e, 0x64, 0x66, 0x65, 0x66, 0x66, 0x53, 0x01, 0x00, 0x5c, 0xbc, 0x66, 0x08, 0x67, 0x22, 0x00,
+    0x36, 0x0c, 0x00, 0x00, 0x2b, 0x64, 0x87, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0xac, 0x66, 0x06, 0x56,
+    0x00, 0x08, 0x5e, 0x66, 0x66, 0x65, 0x87, 0x66, 0x03, 0x62, 0x0d, 0x00, 0x3e, 0x91, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x08, 0x22, 0x00, 0x46, 0x51, 0x0f, 0x00, 0x00, 0x15,
+    0x4c, 0x85, 0x66, 0x02, 0x65, 0x66, 0x67, 0xb5, 0x66, 0x04, 0x65, 0x66, 0x2e, 0x01, 0x36, 0x85,
+    0x66, 0x04, 0x1d, 0x00, 0x4c, 0x66, 0x67, 0xbb, 0x66, 0x08, 0x22, 0x00, 0x48, 0x5f, 0x1e, 0x00,
+    0x00, 0x15, 0x5a, 0x86, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0xac, 0x66, 0x02, 0x3d, 0x00, 0x28, 0x8c,
+    0x66, 0x05, 0x38, 0x00, 0x2d, 0x66, 0x66, 0x67, 0x8e, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xe4, 0x66, 0x0b, 0x22, 0x00, 0x46, 0x66, 0x63, 0x30, 0x03, 0x00, 0x00, 0x14, 0x3d, 0x61, 0x85,
+    0x66, 0x00, 0x65, 0xb3, 0x66, 0x0f, 0x65, 0x65, 0x66, 0x24, 0x00, 0x45, 0x67, 0x66, 0x66, 0x67,
+    0x66, 0x66, 0x2c, 0x00, 0x3e, 0x65, 0xbb, 0x66, 0x0a, 0x65, 0x22, 0x00, 0x48, 0x66, 0x66, 0x36,
+    0x00, 0x00, 0x07, 0x49, 0x82, 0x66, 0x05, 0x67, 0x65, 0x66, 0x5c, 0x00, 0x0e, 0xab, 0x66, 0x03,
+    0x65, 0x27, 0x00, 0x37, 0x83, 0x66, 0x02, 0x65, 0x66, 0x65, 0x85, 0x66, 0x03, 0x48, 0x00, 0x1c,
+    0x65, 0x90, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xdf, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02,
+    0x23, 0x00, 0x46, 0x82, 0x66, 0x01, 0x59, 0x25, 0x82, 0x00, 0x06, 0x05, 0x28, 0x47, 0x60, 0x66,
+    0x66, 0x65, 0xb4, 0x66, 0x11, 0x67, 0x66, 0x66, 0x22, 0x00, 0x4a, 0x65, 0x66, 0x65, 0x66, 0x66,
+    0x65, 0x31, 0x00, 0x3c, 0x66, 0x66, 0x65, 0xb9, 0x66, 0x03, 0x65, 0x22, 0x00, 0x48, 0x82, 0x66,
+    0x05, 0x4d, 0x0a, 0x00, 0x00, 0x31, 0x65, 0x83, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0xac, 0x66, 0x02,
+    0x22, 0x00, 0x46, 0x8c, 0x66, 0x02, 0x59, 0x00, 0x0f, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xe3, 0x66, 0x04, 0x67, 0x22, 0x00, 0x46, 0x67, 0x83, 0x66, 0x02, 0x52, 0x23, 0x02, 0x82,
+    0x00, 0x04, 0x01, 0x18, 0x2c, 0x3e, 0x50, 0xb6, 0x66, 0x04, 0x22, 0x00, 0x4a, 0x66, 0x67, 0x83,
+    0x66, 0x02, 0x31, 0x00, 0x3c, 0x82, 0x66, 0x01, 0x65, 0x65, 0xb8, 0x66, 0x0c, 0x22, 0x00, 0x48,
+    0x66, 0x67, 0x66, 0x66, 0x5c, 0x1a, 0x00, 0x00, 0x1a, 0x5d, 0x82, 0x66, 0x02, 0x5c, 0x00, 0x0e,
+    0xac, 0x66, 0x02, 0x22, 0x00, 0x48, 0x89, 0x66, 0x05, 0x67, 0x66, 0x66, 0x5c, 0x01, 0x0e, 0x91,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x04, 0x23, 0x00, 0x46, 0x66, 0x67, 0x84,
+    0x66, 0x02, 0x5e, 0x37, 0x0f, 0x84, 0x00, 0x00, 0x0e, 0xb6, 0x66, 0x02, 0x23, 0x00, 0x49, 0x82,
+    0x66, 0x05, 0x65, 0x67, 0x66, 0x32, 0x00, 0x3b, 0xbd, 0x66, 0x02, 0x22, 0x00, 0x48, 0x82, 0x66,
+    0x0e, 0x65, 0x66, 0x65, 0x31, 0x00, 0x00, 0x0a, 0x4d, 0x65, 0x67, 0x5c, 0x00, 0x0e, 0x66, 0x67,
+    0xaa, 0x66, 0x02, 0x22, 0x00, 0x48, 0x88, 0x66, 0x06, 0x67, 0x66, 0x67, 0x66, 0x5c, 0x00, 0x0e,
+    0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x05, 0x22, 0x00, 0x45, 0x66, 0x66,
+    0x65, 0x86, 0x66, 0x05, 0x4f, 0x34, 0x1a, 0x05, 0x00, 0x0e, 0xb0, 0x66, 0x0b, 0x65, 0x67, 0x66,
+    0x65, 0x66, 0x67, 0x22, 0x00, 0x4c, 0x66, 0x65, 0x67, 0x82, 0x66, 0x02, 0x31, 0x00, 0x3c, 0x82,
+    0x66, 0x00, 0x67, 0xb8, 0x66, 0x03, 0x65, 0x22, 0x00, 0x48, 0x85, 0x66, 0x0b, 0x67, 0x48, 0x06,
+    0x01, 0x01, 0x36, 0x67, 0x5c, 0x00, 0x0d, 0x66, 0x67, 0xaa, 0x66, 0x02, 0x23, 0x00, 0x49, 0x8c,
+    0x66, 0x03, 0x5e, 0x00, 0x0e, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66,
+    0x05, 0x22, 0x00, 0x45, 0x67, 0x66, 0x67, 0x86, 0x66, 0x05, 0x67, 0x65, 0x66, 0x66, 0x57, 0x4e,
+    0xb5, 0x66, 0x03, 0x67, 0x22, 0x00, 0x46, 0x85, 0x61, 0x09, 0x2d, 0x00, 0x37, 0x62, 0x62, 0x61,
+    0x62, 0x5f, 0x5a, 0x55, 0xb6, 0x66, 0x02, 0x21, 0x00, 0x48, 0x87, 0x66, 0x07, 0x5b, 0x16, 0x00,
+    0x00, 0x1e, 0x56, 0x00, 0x0e, 0xa8, 0x66, 0x07, 0x67, 0x66, 0x67, 0x66, 0x22, 0x00, 0x44, 0x62,
+    0x8b, 0x61, 0x02, 0x55, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xdf, 0x66,
+    0x00, 0x67, 0x83, 0x66, 0x02, 0x20, 0x00, 0x43, 0x8c, 0x66, 0x00, 0x67, 0xb8, 0x66, 0x00, 0x21,
+    0x90, 0x00, 0x01, 0x0e, 0x67, 0xb5, 0x66, 0x02, 0x20, 0x00, 0x45, 0x88, 0x66, 0x09, 0x64, 0x2c,
+    0x00, 0x00, 0x09, 0x00, 0x0e, 0x66, 0x66, 0x67, 0xa5, 0x66, 0x04, 0x65, 0x66, 0x65, 0x66, 0x21,
+    0x90, 0x00, 0x00, 0x0d, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe2, 0x66, 0x05, 0x65,
+    0x66, 0x1a, 0x00, 0x3d, 0x67, 0xc5, 0x66, 0x00, 0x1d, 0x86, 0x00, 0x00, 0x01, 0x88, 0x00, 0x06,
+    0x0d, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65, 0xb0, 0x66, 0x02, 0x19, 0x00, 0x3e, 0x84, 0x66, 0x0b,
+    0x65, 0x66, 0x67, 0x67, 0x66, 0x66, 0x45, 0x05, 0x00, 0x00, 0x0d, 0x67, 0xab, 0x66, 0x00, 0x1d,
+    0x90, 0x00, 0x04, 0x0a, 0x67, 0x66, 0x66, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xe4, 0x66, 0x05, 0x30, 0x24, 0x4a, 0x66, 0x66, 0x67, 0x86, 0x66, 0x01, 0x67, 0x65, 0x83, 0x66,
+    0x03, 0x67, 0x65, 0x66, 0x67, 0xab, 0x66, 0x00, 0x65, 0x85, 0x66, 0x05, 0x55, 0x4f, 0x56, 0x5c,
+    0x5c, 0x5b, 0x83, 0x5c, 0x08, 0x5b, 0x5c, 0x5c, 0x5b, 0x5a, 0x5c, 0x5a, 0x55, 0x51, 0xb5, 0x66,
+    0x03, 0x65, 0x3d, 0x34, 0x53, 0x84, 0x66, 0x00, 0x67, 0x85, 0x66, 0x03, 0x55, 0x0d, 0x00, 0x0a,
+    0xa9, 0x66, 0x05, 0x65, 0x66, 0x66, 0x55, 0x53, 0x5a, 0x8c, 0x5c, 0x05, 0x5a, 0x55, 0x51, 0x65,
+    0x66, 0x67, 0x8e, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe9, 0x66, 0x00, 0x65, 0x87, 0x66,
+    0x00, 0x67, 0x83, 0x66, 0x03, 0x67, 0x65, 0x66, 0x67, 0xc3, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67,
+    0xc4, 0x66, 0x05, 0x5c, 0x3e, 0x45, 0x65, 0x66, 0x67, 0xa8, 0x66, 0x00, 0x65, 0xa4, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xe7, 0x66, 0x00, 0x65, 0x8d, 0x66, 0x00, 0x65, 0xb6, 0x66, 0x00,
+    0x67, 0x84, 0x66, 0x00, 0x67, 0x8c, 0x66, 0x00, 0x65, 0xb7, 0x66, 0x00, 0x67, 0x82, 0x66, 0x05,
+    0x65, 0x66, 0x67, 0x66, 0x66, 0x67, 0xad, 0x66, 0x03, 0x67, 0x66, 0x67, 0x67, 0xa5, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xf6, 0x66, 0x00, 0x67, 0xb5, 0x66, 0x00, 0x67, 0x85, 0x66, 0x02,
+    0x65, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xc1, 0x66, 0x00, 0x65, 0x8a, 0x66, 0x00, 0x67, 0xa9,
+    0x66, 0x00, 0x65, 0xa7, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe2, 0x66, 0x00, 0x65, 0x83,
+    0x66, 0x02, 0x65, 0x66, 0x65, 0x8a, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x00, 0x67, 0x92, 0x66, 0x00,
+    0x65, 0xbd, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x00, 0x65, 0xa0, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xaa, 0x66, 0x04, 0x67, 0x67, 0x66, 0x66,
+    0x67, 0xa4, 0x66, 0x05, 0x67, 0x66, 0x65, 0x66, 0x65, 0x67, 0x82, 0x66, 0xa1, 0x88, 0x9f, 0x66,
+    0x00, 0x67, 0xad, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x00, 0x67, 0xab, 0x66,
+    0x02, 0x65, 0x66, 0x67, 0x83, 0x66, 0x01, 0x67, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xa7, 0x66, 0x00, 0x69, 0x83, 0x66, 0x00, 0x67, 0xaa, 0x66, 0x05, 0x65, 0x66,
+    0x66, 0x67, 0x68, 0x87, 0xa0, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66,
+    0x00, 0x6e, 0xb3, 0x66, 0x00, 0x70, 0xa1, 0x88, 0xa1, 0x66, 0x04, 0x67, 0x66, 0x65, 0x66, 0x65,
+    0xa7, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x00, 0x79, 0x82, 0x66, 0x01, 0x67,
+    0x65, 0xae, 0x66, 0x00, 0x79, 0xa1, 0x88, 0xa2, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0xa7, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x01, 0x7f, 0x75, 0xad, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x01, 0x74, 0x7f, 0xa1, 0x88, 0xa5, 0x66, 0x00, 0x67, 0xa7, 0x66, 0x90, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xa7, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0xa7, 0x66, 0x08, 0x65, 0x66, 0x67,
+    0x66, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0xa1, 0x88, 0xa5, 0x66, 0x01, 0x2f, 0x57, 0xa6, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x05, 0x84, 0x7e, 0x79, 0x70, 0x69, 0x67, 0xa6, 0x66,
+    0x08, 0x67, 0x66, 0x65, 0x66, 0x68, 0x6f, 0x7a, 0x7f, 0x84, 0xa1, 0x88, 0xa4, 0x66, 0x03, 0x44,
+    0x00, 0x14, 0x64, 0x82, 0x66, 0x00, 0x65, 0xa1, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7,
+    0x66, 0x01, 0x80, 0x74, 0xb1, 0x66, 0x01, 0x75, 0x7f, 0xa1, 0x88, 0x9f, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x04, 0x5b, 0x07, 0x00, 0x00, 0x2f, 0xa5, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7,
+    0x66, 0x04, 0x7a, 0x65, 0x66, 0x66, 0x65, 0xaf, 0x66, 0x00, 0x7a, 0xa1, 0x88, 0xa3, 0x66, 0x00,
+    0x1a, 0x83, 0x00, 0x00, 0x4c, 0xa4, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x00,
+    0x6f, 0xb2, 0x66, 0x01, 0x67, 0x70, 0xa1, 0x88, 0xa2, 0x66, 0x00, 0x36, 0x84, 0x00, 0x06, 0x09,
+    0x5e, 0x66, 0x66, 0x67, 0x66, 0x67, 0x9e, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66,
+    0x00, 0x69, 0x85, 0x66, 0x00, 0x65, 0xa8, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x68, 0xa1, 0x88,
+    0xa1, 0x66, 0x01, 0x51, 0x01, 0x85, 0x00, 0x03, 0x1e, 0x66, 0x66, 0x65, 0xa0, 0x66, 0x90, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xaa, 0x66, 0x00, 0x65, 0xac, 0x66, 0x00, 0x67, 0x83, 0x66, 0xa1, 0x88,
+    0xa0, 0x66, 0x01, 0x63, 0x0f, 0x85, 0x00, 0x06, 0x01, 0x01, 0x3a, 0x65, 0x66, 0x66, 0x67, 0x9e,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0xad,
+    0x66, 0xa1, 0x88, 0xa0, 0x66, 0x00, 0x27, 0x88, 0x00, 0x01, 0x02, 0x54, 0xa1, 0x66, 0x90, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x00, 0x45, 0x8a, 0x00, 0x03, 0x11,
+    0x62, 0x66, 0x65, 0x9e, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xab, 0x66, 0x00, 0x65, 0xb0,
+    0x66, 0xa1, 0x88, 0x9e, 0x66, 0x01, 0x5b, 0x08, 0x8b, 0x00, 0x02, 0x29, 0x66, 0x65, 0x9e, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0x95, 0x66, 0x03, 0x65, 0x66, 0x66, 0x64, 0xc1, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0x83, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xb9, 0x66, 0x01, 0x65, 0x65, 0xb9, 0x66,
+    0xa1, 0x88, 0x9d, 0x66, 0x01, 0x67, 0x1a, 0x8d, 0x00, 0x04, 0x46, 0x67, 0x67, 0x66, 0x65, 0x82,
+    0x66, 0x00, 0x67, 0x97, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x01, 0x69, 0x67, 0xc0, 0x66, 0x00, 0x65,
+    0x84, 0x66, 0x01, 0x68, 0x69, 0x85, 0x66, 0x00, 0x67, 0xbc, 0x66, 0x00, 0x65, 0x82, 0x66, 0x01,
+    0x68, 0x69, 0x86, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x68, 0xb5, 0x66,
+    0xa1, 0x88, 0x97, 0x66, 0x06, 0x65, 0x66, 0x65, 0x66, 0x65, 0x66, 0x36, 0x82, 0x00, 0x00, 0x01,
+    0x8a, 0x00, 0x04, 0x07, 0x5b, 0x66, 0x66, 0x65, 0x9b, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x04, 0x6e,
+    0x66, 0x65, 0x66, 0x65, 0xba, 0x66, 0x0a, 0x65, 0x67, 0x66, 0x65, 0x66, 0x65, 0x66, 0x66, 0x67,
+    0x70, 0x6e, 0xc5, 0x66, 0x04, 0x65, 0x66, 0x70, 0x6f, 0x65, 0xc6, 0x66, 0x00, 0x6f, 0xb5, 0x66,
+    0xa1, 0x88, 0x9c, 0x66, 0x01, 0x52, 0x03, 0x83, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x00, 0x1a, 0x9e,
+    0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x79, 0xc4, 0x66, 0x09, 0x64, 0x66, 0x66, 0x79, 0x79, 0x66,
+    0x67, 0x66, 0x66, 0x65, 0xc2, 0x66, 0x01, 0x79, 0x79, 0xc6, 0x66, 0x01, 0x65, 0x79, 0xb5, 0x66,
+    0xa1, 0x88, 0x97, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x63, 0x0f, 0x91, 0x00, 0x03, 0x35, 0x66,
+    0x66, 0x65, 0x9a, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x01, 0x7f, 0x76, 0xc2, 0x66, 0x06, 0x67, 0x66,
+    0x66, 0x74, 0x7f, 0x80, 0x75, 0xc1, 0x66, 0x00, 0x67, 0x82, 0x66, 0x03, 0x74, 0x7f, 0x7e, 0x75,
+    0x84, 0x66, 0x01, 0x67, 0x67, 0xb9, 0x66, 0x00, 0x65, 0x83, 0x66, 0x01, 0x74, 0x7d, 0xb5, 0x66,
+    0xa1, 0x88, 0x9b, 0x66, 0x00, 0x28, 0x91, 0x00, 0x02, 0x01, 0x02, 0x50, 0x9c, 0x66, 0x90, 0x88,
+    0xc9, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0xbf, 0x66, 0x09, 0x69, 0x6f, 0x7a, 0x7f, 0x85,
+    0x84, 0x7f, 0x79, 0x6e, 0x68, 0xbf, 0x66, 0x0c, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x84, 0x7f, 0x79,
+    0x6e, 0x67, 0x66, 0x66, 0x65, 0xbc, 0x66, 0x04, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0xb5, 0x66, 0xa1,
+    0x88, 0x98, 0x66, 0x02, 0x67, 0x66, 0x45, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x84,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x02, 0x0e, 0x61, 0x67, 0x9a, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x04,
+    0x84, 0x7f, 0x79, 0x70, 0x6a, 0xbe, 0x66, 0x0b, 0x65, 0x69, 0x70, 0x7a, 0x80, 0x84, 0x85, 0x7f,
+    0x7a, 0x70, 0x6a, 0x65, 0xbe, 0x66, 0x09, 0x6a, 0x70, 0x7b, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x70,
+    0x69, 0xbd, 0x66, 0x06, 0x65, 0x66, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0xb5, 0x66, 0xa1, 0x88, 0x99,
+    0x66, 0x01, 0x67, 0x5a, 0x86, 0x4d, 0x02, 0x4e, 0x4d, 0x4e, 0x85, 0x4d, 0x02, 0x4c, 0x4d, 0x4e,
+    0x82, 0x4d, 0x01, 0x61, 0x65, 0x9a, 0x66, 0x90, 0x88, 0xc7, 0x66, 0x07, 0x67, 0x66, 0x7f, 0x74,
+    0x65, 0x66, 0x66, 0x67, 0xbe, 0x66, 0x06, 0x67, 0x66, 0x65, 0x75, 0x80, 0x7f, 0x74, 0x82, 0x66,
+    0x00, 0x67, 0xc0, 0x66, 0x04, 0x67, 0x75, 0x7e, 0x7e, 0x74, 0x83, 0x66, 0x01, 0x67, 0x67, 0xba,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x67, 0x75, 0x7f, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xc7, 0x66, 0x02, 0x65, 0x66, 0x7b, 0x83, 0x66, 0x00, 0x65, 0xc2, 0x66, 0x01, 0x7a, 0x7a,
+    0xc5, 0x66, 0x03, 0x67, 0x66, 0x7b, 0x7a, 0xc1, 0x66, 0x00, 0x67, 0x83, 0x66, 0x01, 0x67, 0x7a,
+    0x95, 0x66, 0x00, 0x65, 0x8c, 0x66, 0x00, 0x67, 0x90, 0x66, 0xa1, 0x88, 0x97, 0x66, 0x00, 0x67,
+    0xb5, 0x66, 0x90, 0x88, 0xc8, 0x66, 0x03, 0x65, 0x6f, 0x66, 0x65, 0xc5, 0x66, 0x01, 0x70, 0x6f,
+    0xc7, 0x66, 0x01, 0x70, 0x6f, 0xc6, 0x66, 0x01, 0x67, 0x70, 0xa6, 0x66, 0x00, 0x67, 0x8d, 0x66,
+    0xa1, 0x88, 0x99, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0xae, 0x66, 0x90, 0x88, 0xc9, 0x66,
+    0x00, 0x69, 0xc7, 0x66, 0x01, 0x68, 0x69, 0xc4, 0x66, 0x04, 0x65, 0x66, 0x66, 0x69, 0x69, 0xc3,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x68, 0xa2, 0x66, 0x00, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x67, 0xc7, 0x66, 0x00, 0x67, 0xc3, 0x66, 0x03, 0x65, 0x66,
+    0x66, 0x65, 0xc6, 0x66, 0x00, 0x67, 0xb9, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66,
+    0x00, 0x65, 0xc7, 0x66, 0x00, 0x65, 0xff, 0x66, 0x8b, 0x66, 0x01, 0x67, 0x67, 0xa9, 0x66, 0x00,
+    0x67, 0x90, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xcd, 0x66, 0x00, 0x65, 0xff, 0x66, 0x89,
+    0x66, 0x00, 0x67, 0xde, 0x66, 0x00, 0x65, 0xa3, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xca,
+    0x66, 0x00, 0x65, 0xff, 0x66, 0x8e, 0x66, 0x00, 0x65, 0xc7, 0x66, 0x00, 0x65, 0x93, 0x66, 0x00,
+    0x65, 0x84, 0x66, 0x00, 0x67, 0x87, 0x66, 0x00, 0x65, 0x94, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xcc, 0x66, 0x00, 0x67, 0xff, 0x66, 0xea, 0x66, 0x03, 0x43, 0x39, 0x3e, 0x44, 0x8b, 0x49,
+    0x02, 0x47, 0x42, 0x3e, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb4, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x1d, 0x8f, 0x00, 0x03, 0x01, 0x0d, 0x66, 0x65, 0x8f,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb6, 0x66, 0x07, 0x67, 0x67,
+    0x22, 0x00, 0x09, 0x0a, 0x0b, 0x0a, 0x89, 0x0b, 0x02, 0x09, 0x04, 0x10, 0x82, 0x66, 0x00, 0x65,
+    0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb4, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x02, 0x22, 0x00, 0x4d, 0x8b, 0x66, 0x03, 0x65, 0x66, 0x66, 0x63, 0x91, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb6, 0x66, 0x05, 0x65, 0x66, 0x21, 0x00,
+    0x4a, 0x67, 0xa0, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb6, 0x66,
+    0x04, 0x65, 0x66, 0x1c, 0x00, 0x42, 0x8d, 0x66, 0x02, 0x65, 0x66, 0x65, 0x90, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb4, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x52,
+    0x4a, 0x5d, 0xa1, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb6, 0x66,
+    0x03, 0x67, 0x66, 0x66, 0x67, 0xa2, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xb4, 0x66, 0x00, 0x65, 0x88, 0x66, 0x00, 0x65, 0x9d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x00, 0x65, 0x92, 0x66, 0x00, 0x67, 0x90, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb9, 0x66, 0x02, 0x65, 0x66, 0x65, 0x91,
+    0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xca,
+    0x66, 0x00, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb9,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0x9e, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xb7, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x00, 0x67, 0x90,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbc, 0x66, 0x02, 0x65, 0x66,
+    0x65, 0x9d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x00,
+    0x65, 0x8d, 0x66, 0x00, 0x65, 0x94, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xb8, 0x66, 0x03, 0x43, 0x39, 0x3e, 0x44, 0x8b, 0x49, 0x02, 0x47, 0x42, 0x3e, 0x91, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xb0, 0x66, 0x03, 0x67, 0x66, 0x67, 0x67, 0x84,
+    0x66, 0x00, 0x67, 0xf9, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x1d, 0x83, 0x00, 0x00, 0x01, 0x8a,
+    0x00, 0x03, 0x01, 0x0d, 0x66, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66,
+    0xbc, 0x66, 0x00, 0x67, 0xf8, 0x66, 0x04, 0x67, 0x66, 0x22, 0x00, 0x09, 0x8c, 0x0b, 0x02, 0x09,
+    0x04, 0x10, 0x82, 0x66, 0x00, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xec, 0x66,
+    0x00, 0x67, 0xc2, 0x66, 0x00, 0x67, 0x8a, 0x66, 0x01, 0x65, 0x67, 0xf9, 0x66, 0x02, 0x22, 0x00,
+    0x4d, 0x87, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x63, 0x91, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xb5, 0x66, 0x03, 0x67, 0x66, 0x67, 0x67, 0xfc, 0x66, 0x04,
+    0x65, 0x66, 0x22, 0x00, 0x4a, 0x85, 0x66, 0x02, 0x65, 0x66, 0x67, 0x98, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb6, 0x66, 0x05, 0x65, 0x66, 0x1c, 0x00, 0x42, 0x65,
+    0x88, 0x66, 0x06, 0x67, 0x67, 0x66, 0x66, 0x65, 0x66, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x02, 0x52, 0x4a, 0x5d, 0x84, 0x66, 0x00, 0x67,
+    0x9b, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xea, 0x66, 0x01, 0x65, 0x65, 0x84, 0x66, 0x03,
+    0x67, 0x66, 0x66, 0x65, 0xbf, 0x66, 0x02, 0x67, 0x66, 0x65, 0xfd, 0x66, 0x00, 0x67, 0x82, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x01, 0x65, 0x68, 0x82, 0x66, 0x00, 0x67, 0x98, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xe7, 0x66, 0x00, 0x67, 0x89, 0x66, 0x01, 0x65, 0x67, 0xbe, 0x66, 0x09, 0x46,
+    0x29, 0x1d, 0x10, 0x04, 0x0e, 0x1e, 0x2e, 0x3e, 0x63, 0xf6, 0x66, 0x00, 0x65, 0x87, 0x66, 0x02,
+    0x67, 0x66, 0x65, 0x9c, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xdf, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0x83, 0x66, 0x01, 0x65, 0x65, 0x8b, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xb2, 0x66,
+    0x06, 0x67, 0x65, 0x66, 0x67, 0x66, 0x42, 0x12, 0x88, 0x00, 0x02, 0x0c, 0x42, 0x65, 0x83, 0x66,
+    0x00, 0x67, 0xb2, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x65, 0xb3, 0x66,
+    0x01, 0x65, 0x67, 0xa3, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe2, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x04, 0x67, 0x61, 0x66, 0x66, 0x65, 0x82, 0x66, 0x05, 0x4e, 0x38, 0x2b, 0x30, 0x40, 0x58,
+    0x82, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0xb0, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x30, 0x82,
+    0x00, 0x0e, 0x17, 0x28, 0x37, 0x43, 0x39, 0x29, 0x19, 0x02, 0x00, 0x00, 0x1a, 0x65, 0x66, 0x66,
+    0x67, 0x82, 0x66, 0x00, 0x65, 0xb9, 0x66, 0x00, 0x65, 0xb5, 0x66, 0x03, 0x2c, 0x19, 0x42, 0x67,
+    0x82, 0x66, 0x00, 0x65, 0x83, 0x66, 0x02, 0x65, 0x66, 0x67, 0x95, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xe4, 0x66, 0x09, 0x65, 0x66, 0x3b, 0x08, 0x54, 0x65, 0x66, 0x66, 0x58, 0x16, 0x84,
+    0x00, 0x05, 0x01, 0x2e, 0x62, 0x66, 0x67, 0x65, 0x84, 0x66, 0x00, 0x65, 0xad, 0x66, 0x06, 0x64,
+    0x66, 0x39, 0x00, 0x00, 0x11, 0x4e, 0x86, 0x66, 0x04, 0x56, 0x1a, 0x00, 0x00, 0x30, 0xf7, 0x66,
+    0x02, 0x1a, 0x00, 0x3f, 0x84, 0x66, 0x02, 0x3e, 0x3a, 0x5a, 0x99, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xe0, 0x66, 0x00, 0x65, 0x83, 0x66, 0x10, 0x2a, 0x00, 0x00, 0x34, 0x66, 0x66, 0x5b,
+    0x0c, 0x00, 0x00, 0x13, 0x22, 0x24, 0x0d, 0x00, 0x00, 0x1a, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66,
+    0x67, 0xae, 0x66, 0x06, 0x67, 0x66, 0x5d, 0x00, 0x00, 0x2b, 0x64, 0x82, 0x66, 0x0e, 0x67, 0x66,
+    0x66, 0x65, 0x65, 0x66, 0x66, 0x3b, 0x00, 0x00, 0x4a, 0x66, 0x67, 0x66, 0x67, 0xbd, 0x66, 0x00,
+    0x67, 0xb3, 0x66, 0x02, 0x20, 0x01, 0x43, 0x83, 0x66, 0x03, 0x65, 0x0c, 0x00, 0x48, 0x99, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x0a, 0x4f, 0x00, 0x00, 0x22, 0x58, 0x66, 0x66,
+    0x2a, 0x00, 0x09, 0x4a, 0x82, 0x66, 0x04, 0x67, 0x3c, 0x00, 0x00, 0x3f, 0xb0, 0x66, 0x00, 0x65,
+    0x84, 0x66, 0x12, 0x3a, 0x01, 0x0f, 0x63, 0x65, 0x66, 0x66, 0x65, 0x67, 0x66, 0x65, 0x66, 0x66,
+    0x67, 0x65, 0x66, 0x20, 0x00, 0x22, 0xf6, 0x66, 0x03, 0x22, 0x00, 0x46, 0x65, 0x82, 0x66, 0x03,
+    0x65, 0x16, 0x00, 0x50, 0x99, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x12, 0x26,
+    0x01, 0x21, 0x67, 0x66, 0x66, 0x64, 0x04, 0x00, 0x48, 0x67, 0x66, 0x66, 0x65, 0x65, 0x66, 0x33,
+    0x00, 0x12, 0xb6, 0x66, 0x02, 0x16, 0x00, 0x44, 0x8a, 0x66, 0x04, 0x65, 0x66, 0x56, 0x00, 0x0e,
+    0xb8, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0xb2, 0x66, 0x02, 0x22,
+    0x00, 0x46, 0x84, 0x66, 0x02, 0x17, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xe3, 0x66, 0x03, 0x65, 0x0a, 0x00, 0x57, 0x82, 0x66, 0x02, 0x58, 0x00, 0x0d, 0x86, 0x66, 0x03,
+    0x5f, 0x00, 0x02, 0x64, 0xb5, 0x66, 0x02, 0x04, 0x00, 0x58, 0x89, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x02, 0x05, 0x00, 0x5f, 0xba, 0x66, 0x08, 0x67, 0x44, 0x35, 0x3d, 0x44, 0x4c, 0x54, 0x5f, 0x67,
+    0xb1, 0x66, 0x0a, 0x22, 0x00, 0x47, 0x66, 0x66, 0x67, 0x67, 0x65, 0x17, 0x00, 0x52, 0x99, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe2, 0x66, 0x03, 0x65, 0x66, 0x02, 0x01, 0x83, 0x66, 0x02,
+    0x4e, 0x00, 0x1c, 0x82, 0x66, 0x00, 0x65, 0x83, 0x66, 0x07, 0x11, 0x00, 0x55, 0x66, 0x66, 0x67,
+    0x66, 0x67, 0xae, 0x66, 0x0a, 0x65, 0x66, 0x01, 0x00, 0x64, 0x66, 0x66, 0x67, 0x66, 0x66, 0x65,
+    0x84, 0x66, 0x05, 0x65, 0x66, 0x66, 0x0f, 0x00, 0x52, 0xbb, 0x66, 0x01, 0x22, 0x01, 0x83, 0x00,
+    0x00, 0x1f, 0xb2, 0x66, 0x0a, 0x22, 0x00, 0x46, 0x66, 0x66, 0x65, 0x66, 0x66, 0x17, 0x00, 0x52,
+    0x99, 0x66, 0xa1, 0x88, 0x00, 0x65, 0xc6, 0x66, 0x00, 0x65, 0x85, 0x66, 0x90, 0x88, 0xe4, 0x66,
+    0x02, 0x10, 0x01, 0x52, 0x82, 0x66, 0x02, 0x59, 0x00, 0x14, 0x86, 0x66, 0x03, 0x65, 0x0b, 0x00,
+    0x58, 0xb2, 0x66, 0x05, 0x65, 0x66, 0x67, 0x0f, 0x00, 0x53, 0x84, 0x66, 0x00, 0x65, 0x84, 0x66,
+    0x06, 0x65, 0x66, 0x62, 0x01, 0x01, 0x57, 0x65, 0x82, 0x66, 0x00, 0x67, 0xb6, 0x66, 0x07, 0x2d,
+    0x13, 0x1c, 0x24, 0x2a, 0x33, 0x46, 0x67, 0xae, 0x66, 0x06, 0x67, 0x65, 0x66, 0x22, 0x00, 0x47,
+    0x67, 0x83, 0x66, 0x02, 0x18, 0x00, 0x52, 0x83, 0x66, 0x00, 0x67, 0x94, 0x66, 0xa1, 0x88, 0x03,
+    0x69, 0x66, 0x66, 0x67, 0xc9, 0x66, 0x00, 0x68, 0x90, 0x88, 0xe4, 0x66, 0x0b, 0x28, 0x00, 0x33,
+    0x65, 0x66, 0x66, 0x67, 0x04, 0x02, 0x5d, 0x66, 0x68, 0x83, 0x66, 0x05, 0x58, 0x00, 0x03, 0x64,
+    0x66, 0x67, 0x82, 0x66, 0x00, 0x67, 0xa9, 0x66, 0x00, 0x67, 0x84, 0x66, 0x04, 0x24, 0x00, 0x3f,
+    0x66, 0x65, 0x85, 0x66, 0x00, 0x67, 0x83, 0x66, 0x03, 0x4d, 0x00, 0x06, 0x65, 0x82, 0x66, 0x00,
+    0x67, 0xb3, 0x66, 0x00, 0x67, 0x87, 0x66, 0x00, 0x65, 0xb0, 0x66, 0x05, 0x65, 0x66, 0x66, 0x22,
+    0x00, 0x47, 0x84, 0x66, 0x03, 0x18, 0x00, 0x54, 0x65, 0x85, 0x66, 0x00, 0x67, 0x91, 0x66, 0xa1,
+    0x88, 0x00, 0x6d, 0xcc, 0x66, 0x00, 0x70, 0x90, 0x88, 0xe4, 0x66, 0x0b, 0x44, 0x00, 0x03, 0x3f,
+    0x66, 0x66, 0x65, 0x2f, 0x00, 0x21, 0x66, 0x64, 0x82, 0x66, 0x03, 0x65, 0x1a, 0x00, 0x2a, 0xb6,
+    0x66, 0x03, 0x38, 0x00, 0x0d, 0x5f, 0x85, 0x66, 0x00, 0x65, 0x83, 0x66, 0x06, 0x64, 0x17, 0x00,
+    0x28, 0x66, 0x66, 0x67, 0xbf, 0x66, 0x00, 0x65, 0xaf, 0x66, 0x05, 0x65, 0x66, 0x66, 0x22, 0x00,
+    0x3e, 0x83, 0x5e, 0x05, 0x5f, 0x15, 0x00, 0x4c, 0x5e, 0x5d, 0x82, 0x5e, 0x03, 0x5c, 0x59, 0x51,
+    0x67, 0x90, 0x66, 0xa1, 0x88, 0x00, 0x79, 0x84, 0x66, 0x00, 0x67, 0xc4, 0x66, 0x03, 0x67, 0x66,
+    0x79, 0x87, 0x8f, 0x88, 0xe5, 0x66, 0x11, 0x28, 0x00, 0x00, 0x26, 0x58, 0x66, 0x61, 0x0c, 0x00,
+    0x21, 0x5a, 0x66, 0x66, 0x54, 0x17, 0x00, 0x02, 0x5c, 0xb1, 0x66, 0x0a, 0x65, 0x66, 0x66, 0x67,
+    0x66, 0x5d, 0x0a, 0x00, 0x1d, 0x65, 0x67, 0x82, 0x66, 0x02, 0x65, 0x66, 0x65, 0x82, 0x66, 0x05,
+    0x2b, 0x00, 0x00, 0x4d, 0x66, 0x67, 0xb7, 0x66, 0x04, 0x65, 0x66, 0x66, 0x65, 0x67, 0x84, 0x66,
+    0x00, 0x67, 0xb1, 0x66, 0x00, 0x21, 0x83, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x01, 0x00, 0x0e,
+    0x91, 0x66, 0xa1, 0x88, 0x04, 0x80, 0x76, 0x66, 0x66, 0x65, 0xc2, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x01, 0x73, 0x7f, 0x90, 0x88, 0xe2, 0x66, 0x04, 0x65, 0x66, 0x66, 0x64, 0x1d, 0x82, 0x00, 0x02,
+    0x12, 0x2a, 0x2b, 0x82, 0x00, 0x05, 0x08, 0x05, 0x00, 0x00, 0x02, 0x3c, 0x82, 0x66, 0x00, 0x65,
+    0xac, 0x66, 0x00, 0x67, 0x85, 0x66, 0x08, 0x65, 0x4a, 0x00, 0x00, 0x11, 0x46, 0x66, 0x66, 0x67,
+    0x83, 0x66, 0x05, 0x4d, 0x18, 0x00, 0x01, 0x2c, 0x67, 0x83, 0x66, 0x00, 0x67, 0xb7, 0x66, 0x00,
+    0x67, 0xb6, 0x66, 0x02, 0x65, 0x66, 0x1d, 0x82, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x01, 0x83,
+    0x00, 0x03, 0x01, 0x00, 0x00, 0x0d, 0x91, 0x66, 0xa1, 0x88, 0x06, 0x84, 0x7f, 0x79, 0x6e, 0x68,
+    0x66, 0x65, 0xc2, 0x66, 0x05, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x87, 0x8f, 0x88, 0xe0, 0x66, 0x00,
+    0x65, 0x84, 0x66, 0x02, 0x65, 0x3e, 0x10, 0x89, 0x00, 0x01, 0x1b, 0x4f, 0x83, 0x66, 0x03, 0x64,
+    0x66, 0x66, 0x67, 0xb1, 0x66, 0x0b, 0x67, 0x35, 0x01, 0x00, 0x00, 0x11, 0x23, 0x32, 0x3e, 0x35,
+    0x27, 0x16, 0x82, 0x00, 0x00, 0x25, 0xba, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0xb6, 0x66,
+    0x02, 0x55, 0x4e, 0x56, 0x8c, 0x5c, 0x02, 0x5a, 0x55, 0x53, 0x91, 0x66, 0xa1, 0x88, 0x04, 0x83,
+    0x7f, 0x79, 0x70, 0x69, 0xc4, 0x66, 0x04, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0x90, 0x88, 0xe9, 0x66,
+    0x09, 0x55, 0x44, 0x37, 0x2c, 0x20, 0x21, 0x30, 0x3e, 0x4c, 0x5c, 0x83, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0xab, 0x66, 0x01, 0x65, 0x65, 0x86, 0x66, 0x02, 0x65, 0x55, 0x1d, 0x86, 0x00, 0x03,
+    0x01, 0x00, 0x10, 0x41, 0x85, 0x66, 0x00, 0x65, 0xb4, 0x66, 0x00, 0x65, 0xbe, 0x66, 0x05, 0x67,
+    0x66, 0x66, 0x67, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0x92, 0x66, 0xa1,
+    0x88, 0x04, 0x7e, 0x73, 0x66, 0x66, 0x65, 0xc2, 0x66, 0x00, 0x67, 0x83, 0x66, 0x01, 0x76, 0x7f,
+    0x90, 0x88, 0xe3, 0x66, 0x00, 0x68, 0x87, 0x66, 0x06, 0x65, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
+    0x85, 0x66, 0x00, 0x65, 0xb4, 0x66, 0x00, 0x65, 0x82, 0x66, 0x08, 0x4e, 0x38, 0x29, 0x19, 0x0d,
+    0x15, 0x23, 0x30, 0x46, 0x84, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xc6,
+    0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x91, 0x66, 0xa1, 0x88, 0x04, 0x7b, 0x67, 0x66, 0x66, 0x65,
+    0xc2, 0x66, 0x00, 0x64, 0x82, 0x66, 0x02, 0x65, 0x66, 0x7b, 0x90, 0x88, 0xff, 0x66, 0xb9, 0x66,
+    0x00, 0x67, 0xfc, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x67, 0x9d, 0x66, 0xa1, 0x88, 0x00, 0x6e,
+    0xcc, 0x66, 0x00, 0x70, 0x90, 0x88, 0xff, 0x66, 0xb9, 0x66, 0x00, 0x65, 0xf9, 0x66, 0x00, 0x67,
+    0x84, 0x66, 0x01, 0x67, 0x67, 0xa0, 0x66, 0xa1, 0x88, 0x00, 0x69, 0xcc, 0x66, 0x00, 0x68, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xb5, 0x66, 0x00, 0x65, 0xa6, 0x66, 0xa1, 0x88, 0x84, 0x66, 0x00,
+    0x65, 0xc8, 0x66, 0x90, 0x88, 0xff, 0x66, 0xb7, 0x66, 0x02, 0x65, 0x66, 0x67, 0x82, 0x66, 0x00,
+    0x65, 0xf5, 0x66, 0x01, 0x65, 0x67, 0xa6, 0x66, 0xa1, 0x88, 0x85, 0x66, 0x00, 0x67, 0xc3, 0x66,
+    0x03, 0x65, 0x65, 0x66, 0x65, 0x90, 0x88, 0xff, 0x66, 0xbb, 0x66, 0x00, 0x67, 0xf7, 0x66, 0x01,
+    0x67, 0x65, 0xa6, 0x66, 0xa1, 0x88, 0x03, 0x65, 0x66, 0x67, 0x65, 0xc7, 0x66, 0x02, 0x64, 0x66,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb4, 0x66, 0x00, 0x65, 0xa7, 0x66, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xb9, 0x66, 0x02, 0x67, 0x66, 0x65, 0xf4, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x00, 0x67, 0xa6, 0x66, 0xa1, 0x88, 0x01, 0x66, 0x68, 0x83, 0x66, 0x00, 0x67, 0xc5, 0x66,
+    0x01, 0x67, 0x65, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x05, 0x69, 0x66, 0x67, 0x66, 0x66, 0x67, 0xae, 0x66,
+    0x00, 0x69, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x02, 0x6e,
+    0x66, 0x67, 0x83, 0x66, 0x00, 0x65, 0xac, 0x66, 0x00, 0x70, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x00, 0x79, 0xaf, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x7a,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x06, 0x7e, 0x75, 0x66,
+    0x65, 0x66, 0x66, 0x67, 0xab, 0x66, 0x02, 0x65, 0x74, 0x7f, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x04, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0xab, 0x66, 0x04, 0x68,
+    0x6e, 0x7b, 0x7f, 0x84, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66,
+    0x04, 0x85, 0x7f, 0x79, 0x70, 0x69, 0xaa, 0x66, 0x05, 0x65, 0x68, 0x70, 0x7a, 0x80, 0x84, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x01, 0x7f, 0x74, 0xb1, 0x66,
+    0x01, 0x76, 0x80, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x00,
+    0x7a, 0x82, 0x66, 0x00, 0x65, 0xaa, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x7a, 0xa1, 0x88, 0xce,
+    0x66, 0x90, 0x88, 0xcd, 0x66, 0x00, 0x67, 0xff, 0x66, 0xd8, 0x66, 0x03, 0x6f, 0x66, 0x68, 0x65,
+    0xae, 0x66, 0x02, 0x65, 0x66, 0x70, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xcc, 0x66, 0x00, 0x67,
+    0xff, 0x66, 0x8a, 0x66, 0x01, 0x65, 0x65, 0xca, 0x66, 0x04, 0x67, 0x66, 0x69, 0x66, 0x65, 0xb1,
+    0x66, 0x01, 0x68, 0x87, 0xa0, 0x88, 0xce, 0x66, 0x90, 0x88, 0xcc, 0x66, 0x00, 0x67, 0xc4, 0x66,
+    0x00, 0x65, 0xff, 0x66, 0x8b, 0x66, 0x01, 0x65, 0x65, 0x89, 0x66, 0x00, 0x65, 0xb0, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0x90, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xc6, 0x66,
+    0x00, 0x67, 0xc5, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x00, 0x67, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x69, 0xc4, 0x66, 0x04, 0x65, 0x66, 0x66, 0x67, 0x69,
+    0xc7, 0x66, 0x01, 0x69, 0x69, 0xc0, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x69, 0x83, 0x66, 0x00,
+    0x67, 0xb0, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x01, 0x6e, 0x67, 0xc6, 0x66,
+    0x01, 0x70, 0x6f, 0xc7, 0x66, 0x01, 0x6e, 0x6e, 0xc0, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x70,
+    0x85, 0x66, 0x00, 0x65, 0xab, 0x66, 0x02, 0x65, 0x66, 0x67, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xc8, 0x66, 0x04, 0x67, 0x79, 0x66, 0x66, 0x67, 0xc4, 0x66, 0x01, 0x79, 0x79, 0xc7, 0x66, 0x01,
+    0x79, 0x79, 0xc7, 0x66, 0x01, 0x79, 0x65, 0xb3, 0x66, 0x00, 0x65, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xc9, 0x66, 0x01, 0x7f, 0x75, 0xc5, 0x66, 0x04, 0x74, 0x7f, 0x7e, 0x75, 0x65, 0xc1, 0x66,
+    0x06, 0x65, 0x66, 0x66, 0x75, 0x7e, 0x7f, 0x75, 0xc3, 0x66, 0x03, 0x65, 0x66, 0x74, 0x80, 0xb3,
+    0x66, 0x01, 0x65, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x04, 0x85, 0x7f, 0x79,
+    0x6e, 0x68, 0xbd, 0x66, 0x0b, 0x65, 0x66, 0x69, 0x6d, 0x7a, 0x7f, 0x84, 0x84, 0x80, 0x79, 0x6f,
+    0x68, 0xbd, 0x66, 0x0b, 0x67, 0x66, 0x68, 0x6d, 0x7a, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e, 0x68,
+    0xbf, 0x66, 0x04, 0x69, 0x6e, 0x7a, 0x7f, 0x84, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xc8, 0x66, 0x05, 0x67, 0x84, 0x7f, 0x79, 0x70, 0x68, 0xbf, 0x66, 0x09, 0x68, 0x71, 0x79, 0x7f,
+    0x84, 0x84, 0x7f, 0x79, 0x70, 0x69, 0xbe, 0x66, 0x0a, 0x65, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0x85,
+    0x7f, 0x79, 0x70, 0x69, 0xbf, 0x66, 0x04, 0x68, 0x70, 0x7b, 0x7f, 0x84, 0xb5, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x04, 0x7f, 0x74, 0x65, 0x66, 0x67, 0xbf, 0x66, 0x08, 0x67,
+    0x66, 0x66, 0x75, 0x7f, 0x7f, 0x74, 0x66, 0x65, 0x82, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x09, 0x75,
+    0x7f, 0x7e, 0x74, 0x65, 0x66, 0x66, 0x65, 0x66, 0x65, 0xbf, 0x66, 0x01, 0x76, 0x7f, 0xb5, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x7a, 0xc4, 0x66, 0x06, 0x65, 0x66, 0x67,
+    0x7b, 0x7a, 0x66, 0x65, 0x83, 0x66, 0x02, 0x65, 0x66, 0x65, 0xb6, 0x66, 0x01, 0x65, 0x67, 0x83,
+    0x66, 0x06, 0x67, 0x66, 0x7a, 0x7b, 0x66, 0x66, 0x65, 0xc3, 0x66, 0x01, 0x67, 0x7a, 0xb5, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x70, 0xc3, 0x66, 0x0e, 0x65, 0x66, 0x65,
+    0x66, 0x71, 0x6f, 0x67, 0x67, 0x66, 0x65, 0x66, 0x65, 0x67, 0x66, 0x65, 0xb8, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x04, 0x65, 0x65, 0x70, 0x6f, 0x67, 0xbf, 0x66, 0x01, 0x67, 0x67, 0x84, 0x66, 0x00,
+    0x70, 0xb5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x69, 0xc7, 0x66, 0x01,
+    0x68, 0x6a, 0x83, 0x66, 0x00, 0x65, 0xbd, 0x66, 0x08, 0x65, 0x66, 0x66, 0x67, 0x66, 0x69, 0x69,
+    0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xbe, 0x66, 0x03, 0x67, 0x65, 0x66, 0x68, 0xb5, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0x90, 0x66, 0x00, 0x67, 0x87, 0x66, 0x03, 0x67, 0x66,
+    0x65, 0x65, 0xb8, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0xc6, 0x66, 0x00, 0x67, 0xb7, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x67, 0xff, 0x66, 0x8a, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x00, 0x65, 0x89, 0x66, 0x00, 0x65, 0xbe, 0x66, 0x00, 0x67, 0xb7, 0x66, 0xa1, 0x88,
+    0xb1, 0x66, 0x04, 0x65, 0x66, 0x66, 0x67, 0x67, 0x97, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xdd, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x01, 0x65, 0x65, 0x90, 0x66, 0x00, 0x67, 0x9d, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xb0, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67,
+    0x99, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9e, 0x66, 0x02, 0x65,
+    0x66, 0x65, 0x91, 0x66, 0x00, 0x65, 0x99, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66,
+    0xa1, 0x88, 0x9b, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0x94, 0x66, 0x00, 0x65, 0x96, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x00, 0x56, 0x95, 0x4b,
+    0x00, 0x61, 0x9b, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9a, 0x66,
+    0x00, 0x46, 0x94, 0x00, 0x01, 0x0f, 0x61, 0x9b, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd,
+    0x66, 0xa1, 0x88, 0x98, 0x66, 0x03, 0x67, 0x66, 0x66, 0x2a, 0x93, 0x00, 0x00, 0x51, 0x9c, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x9b, 0x66, 0x01, 0x63, 0x10, 0x91,
+    0x00, 0x03, 0x37, 0x66, 0x66, 0x67, 0x9a, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xc9, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x01, 0x67, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0x9c, 0x66, 0x02, 0x53, 0x02,
+    0x01, 0x8e, 0x00, 0x05, 0x1b, 0x66, 0x66, 0x67, 0x66, 0x67, 0x99, 0x66, 0x90, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xbf, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x82, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1,
+    0x88, 0x9c, 0x66, 0x01, 0x67, 0x38, 0x8e, 0x00, 0x01, 0x08, 0x5c, 0x9e, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xb7, 0x66, 0x00, 0x65, 0x87, 0x66, 0x0c, 0x67, 0x66, 0x67, 0x57, 0x37, 0x22,
+    0x24, 0x38, 0x57, 0x66, 0x65, 0x66, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0x9e, 0x66, 0x00, 0x1c, 0x8d,
+    0x00, 0x02, 0x48, 0x66, 0x65, 0x9d, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xba, 0x66, 0x09,
+    0x46, 0x28, 0x0d, 0x13, 0x2e, 0x54, 0x66, 0x66, 0x47, 0x04, 0x83, 0x00, 0x03, 0x04, 0x44, 0x66,
+    0x67, 0x90, 0x66, 0xa1, 0x88, 0x9d, 0x66, 0x07, 0x65, 0x5d, 0x08, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x86, 0x00, 0x00, 0x2b, 0x85, 0x66, 0x00, 0x65, 0x99, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb9, 0x66, 0x00, 0x3c, 0x84, 0x00, 0x0c, 0x06, 0x54, 0x51, 0x01, 0x00, 0x0e, 0x26, 0x24, 0x06,
+    0x01, 0x01, 0x56, 0x67, 0x90, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x00, 0x46, 0x86, 0x00, 0x00, 0x01,
+    0x82, 0x00, 0x01, 0x11, 0x63, 0xa0, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x14,
+    0x4f, 0x02, 0x00, 0x1c, 0x43, 0x44, 0x22, 0x00, 0x0a, 0x1c, 0x00, 0x2b, 0x64, 0x66, 0x66, 0x5d,
+    0x0e, 0x00, 0x26, 0x66, 0x67, 0x8f, 0x66, 0xa1, 0x88, 0x9a, 0x66, 0x02, 0x65, 0x66, 0x67, 0x82,
+    0x66, 0x00, 0x29, 0x88, 0x00, 0x07, 0x04, 0x55, 0x66, 0x66, 0x67, 0x66, 0x66, 0x65, 0x9b, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x12, 0x2b, 0x00, 0x22, 0x66, 0x65, 0x67, 0x66,
+    0x2e, 0x00, 0x00, 0x0f, 0x65, 0x66, 0x65, 0x66, 0x65, 0x48, 0x00, 0x05, 0x91, 0x66, 0xa1, 0x88,
+    0x99, 0x66, 0x00, 0x67, 0x85, 0x66, 0x04, 0x62, 0x0f, 0x00, 0x01, 0x01, 0x82, 0x00, 0x07, 0x02,
+    0x00, 0x3c, 0x65, 0x67, 0x66, 0x66, 0x67, 0x9d, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8,
+    0x66, 0x0a, 0x18, 0x00, 0x57, 0x66, 0x66, 0x67, 0x66, 0x61, 0x04, 0x00, 0x37, 0x85, 0x66, 0x02,
+    0x08, 0x00, 0x5f, 0x90, 0x66, 0xa1, 0x88, 0xa1, 0x66, 0x01, 0x53, 0x02, 0x85, 0x00, 0x01, 0x20,
+    0x67, 0xa2, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x01, 0x05, 0x06, 0x85, 0x66,
+    0x02, 0x12, 0x00, 0x46, 0x85, 0x66, 0x02, 0x16, 0x00, 0x52, 0x90, 0x66, 0xa1, 0x88, 0x9b, 0x66,
+    0x00, 0x65, 0x85, 0x66, 0x00, 0x37, 0x84, 0x00, 0x01, 0x0c, 0x5e, 0x82, 0x66, 0x00, 0x65, 0x9f,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x01, 0x00, 0x07, 0x85, 0x66, 0x05, 0x14,
+    0x00, 0x47, 0x66, 0x66, 0x65, 0x82, 0x66, 0x02, 0x1b, 0x00, 0x53, 0x90, 0x66, 0xa1, 0x88, 0xa1,
+    0x66, 0x07, 0x64, 0x66, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x83, 0x66, 0x00, 0x67, 0x9f, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb7, 0x66, 0x0b, 0x67, 0x0c, 0x00, 0x5e, 0x66, 0x66, 0x67,
+    0x66, 0x65, 0x06, 0x00, 0x3c, 0x85, 0x66, 0x05, 0x0f, 0x00, 0x63, 0x66, 0x66, 0x67, 0x8d, 0x66,
+    0xa1, 0x88, 0xa3, 0x66, 0x05, 0x5c, 0x09, 0x01, 0x00, 0x30, 0x67, 0x84, 0x66, 0x00, 0x65, 0x9e,
+    0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x0b, 0x1b, 0x00, 0x31, 0x66, 0x68, 0x66,
+    0x66, 0x3d, 0x00, 0x00, 0x19, 0x67, 0x83, 0x66, 0x02, 0x57, 0x00, 0x0b, 0x91, 0x66, 0xa1, 0x88,
+    0x9b, 0x66, 0x00, 0x65, 0x87, 0x66, 0x03, 0x46, 0x00, 0x16, 0x65, 0xa5, 0x66, 0x90, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xb8, 0x66, 0x0b, 0x46, 0x00, 0x01, 0x34, 0x5b, 0x5c, 0x39, 0x03, 0x03, 0x0f,
+    0x00, 0x43, 0x82, 0x66, 0x03, 0x63, 0x1e, 0x00, 0x1d, 0x91, 0x66, 0xa1, 0x88, 0x9f, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x03, 0x65, 0x66, 0x31, 0x59, 0xa6, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xb9, 0x66, 0x02, 0x1c, 0x00, 0x01, 0x82, 0x00, 0x0b, 0x01, 0x46, 0x44, 0x00, 0x01, 0x27, 0x41,
+    0x3b, 0x16, 0x00, 0x03, 0x53, 0x91, 0x66, 0xa1, 0x88, 0xac, 0x66, 0x00, 0x67, 0xa0, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xb9, 0x66, 0x09, 0x64, 0x2e, 0x07, 0x00, 0x02, 0x19, 0x42, 0x66,
+    0x66, 0x2a, 0x85, 0x00, 0x00, 0x3b, 0x82, 0x66, 0x00, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbb, 0x66, 0x02, 0x67, 0x5a, 0x61, 0x84, 0x66, 0x06, 0x41,
+    0x17, 0x06, 0x07, 0x15, 0x40, 0x67, 0x82, 0x66, 0x00, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xce, 0x66,
+    0x90, 0x88, 0xe3, 0x66, 0x00, 0x65, 0xff, 0x66, 0xf8, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xbf, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xeb, 0x66, 0x00, 0x65, 0xff, 0x66, 0xcb, 0x66, 0x05, 0x2b, 0x1a, 0x42,
+    0x66, 0x66, 0x67, 0x9e, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x00, 0x67, 0x87,
+    0x66, 0x00, 0x65, 0xff, 0x66, 0xc9, 0x66, 0x0a, 0x1b, 0x01, 0x3f, 0x66, 0x66, 0x67, 0x66, 0x66,
+    0x3e, 0x3b, 0x5b, 0x99, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x0a, 0x65, 0x66, 0x65, 0x66, 0x65, 0x66, 0x66, 0x5a, 0x4a, 0x54, 0x64, 0xff, 0x66, 0x99,
+    0x66, 0x00, 0x67, 0xa9, 0x66, 0x02, 0x20, 0x00, 0x42, 0x82, 0x66, 0x04, 0x65, 0x66, 0x0c, 0x00,
+    0x48, 0x82, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x02,
+    0x4d, 0x46, 0x58, 0x84, 0x66, 0x02, 0x64, 0x38, 0x06, 0x83, 0x00, 0x03, 0x17, 0x52, 0x66, 0x67,
+    0xff, 0x66, 0xc0, 0x66, 0x02, 0x21, 0x00, 0x45, 0x84, 0x66, 0x02, 0x15, 0x00, 0x51, 0x99, 0x66,
+    0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x04, 0x15, 0x00, 0x3d, 0x66, 0x65, 0x82, 0x66,
+    0x00, 0x1c, 0x82, 0x00, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x3b, 0xff, 0x66, 0xc1, 0x66, 0x02,
+    0x22, 0x00, 0x46, 0x84, 0x66, 0x02, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xe4, 0x66, 0x02, 0x1e, 0x00, 0x46, 0x83, 0x66, 0x0b, 0x3d, 0x00, 0x00, 0x26, 0x55, 0x64,
+    0x5f, 0x48, 0x12, 0x00, 0x03, 0x57, 0xff, 0x66, 0x8f, 0x66, 0x02, 0x67, 0x66, 0x67, 0x82, 0x66,
+    0x00, 0x65, 0xa9, 0x66, 0x04, 0x22, 0x00, 0x46, 0x66, 0x67, 0x82, 0x66, 0x02, 0x18, 0x00, 0x52,
+    0x99, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x02, 0x22, 0x00, 0x4a, 0x83, 0x66,
+    0x0d, 0x0a, 0x00, 0x34, 0x66, 0x66, 0x65, 0x66, 0x66, 0x64, 0x18, 0x00, 0x20, 0x66, 0x67, 0xad,
+    0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x67, 0x86, 0x66, 0x00, 0x67, 0x8d, 0x66, 0x00, 0x65, 0xb4,
+    0x66, 0x00, 0x65, 0x88, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0xac, 0x66, 0x0a, 0x22, 0x00,
+    0x46, 0x66, 0x66, 0x65, 0x66, 0x66, 0x18, 0x00, 0x52, 0x85, 0x66, 0x00, 0x65, 0x92, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x02, 0x22, 0x00, 0x4a, 0x82, 0x66, 0x03, 0x5e, 0x00,
+    0x09, 0x64, 0x85, 0x66, 0x02, 0x57, 0x00, 0x09, 0x85, 0x66, 0x00, 0x67, 0xa9, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x07, 0x67, 0x67, 0x57, 0x52, 0x5b, 0x60, 0x61, 0x62, 0x84, 0x61, 0x07, 0x60, 0x61,
+    0x61, 0x60, 0x62, 0x5c, 0x54, 0x50, 0xb6, 0x66, 0x04, 0x67, 0x5f, 0x53, 0x52, 0x64, 0x86, 0x66,
+    0x04, 0x56, 0x52, 0x52, 0x59, 0x63, 0xae, 0x66, 0x02, 0x22, 0x00, 0x46, 0x82, 0x66, 0x04, 0x65,
+    0x66, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x08, 0x22,
+    0x00, 0x4a, 0x66, 0x66, 0x65, 0x4d, 0x00, 0x1f, 0x83, 0x66, 0x06, 0x67, 0x66, 0x65, 0x67, 0x0b,
+    0x00, 0x5e, 0xb3, 0x66, 0x02, 0x65, 0x66, 0x22, 0x8d, 0x00, 0x08, 0x01, 0x00, 0x00, 0x0e, 0x67,
+    0x66, 0x65, 0x66, 0x67, 0xb2, 0x66, 0x05, 0x42, 0x00, 0x00, 0x48, 0x66, 0x67, 0x84, 0x66, 0x00,
+    0x13, 0x82, 0x00, 0x01, 0x07, 0x48, 0xad, 0x66, 0x02, 0x21, 0x00, 0x46, 0x83, 0x66, 0x03, 0x67,
+    0x17, 0x00, 0x52, 0x87, 0x66, 0x01, 0x65, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xe4, 0x66, 0x02, 0x22, 0x00, 0x4a, 0x82, 0x66, 0x03, 0x54, 0x00, 0x20, 0x67, 0x83, 0x66, 0x06,
+    0x65, 0x66, 0x65, 0x11, 0x00, 0x54, 0x67, 0xad, 0x66, 0x01, 0x67, 0x65, 0x84, 0x66, 0x00, 0x21,
+    0x90, 0x00, 0x00, 0x0e, 0xb5, 0x66, 0x12, 0x65, 0x66, 0x42, 0x00, 0x00, 0x49, 0x66, 0x66, 0x67,
+    0x66, 0x67, 0x66, 0x66, 0x12, 0x00, 0x0b, 0x56, 0x1c, 0x12, 0xac, 0x66, 0x03, 0x68, 0x22, 0x00,
+    0x3e, 0x84, 0x5e, 0x02, 0x16, 0x00, 0x4c, 0x84, 0x5e, 0x02, 0x5c, 0x58, 0x51, 0x91, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xe0, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x22, 0x00, 0x4a, 0x82,
+    0x66, 0x06, 0x64, 0x04, 0x0f, 0x66, 0x66, 0x65, 0x67, 0x82, 0x66, 0x06, 0x65, 0x02, 0x01, 0x63,
+    0x66, 0x66, 0x65, 0xaf, 0x66, 0x05, 0x67, 0x66, 0x66, 0x55, 0x52, 0x5a, 0x8a, 0x5c, 0x04, 0x5b,
+    0x5c, 0x5a, 0x55, 0x53, 0x82, 0x66, 0x00, 0x65, 0xb3, 0x66, 0x05, 0x57, 0x37, 0x37, 0x59, 0x66,
+    0x65, 0x83, 0x66, 0x08, 0x67, 0x44, 0x36, 0x3e, 0x66, 0x61, 0x5e, 0x66, 0x67, 0xab, 0x66, 0x03,
+    0x21, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x02, 0x22, 0x00, 0x4a, 0x83, 0x66, 0x02, 0x23, 0x00, 0x44,
+    0x85, 0x66, 0x02, 0x3b, 0x00, 0x0e, 0xb6, 0x66, 0x03, 0x64, 0x66, 0x66, 0x65, 0xc7, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x00, 0x65, 0x88, 0x66, 0x00, 0x67, 0xae, 0x66, 0x00, 0x1d, 0x90, 0x00, 0x02,
+    0x0e, 0x66, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe4, 0x66, 0x0a, 0x21, 0x00,
+    0x0c, 0x18, 0x23, 0x2d, 0x36, 0x36, 0x00, 0x09, 0x50, 0x83, 0x66, 0x04, 0x4e, 0x03, 0x00, 0x34,
+    0x67, 0xaf, 0x66, 0x00, 0x65, 0x92, 0x66, 0x01, 0x67, 0x67, 0xb9, 0x66, 0x00, 0x65, 0x8b, 0x66,
+    0x01, 0x67, 0x67, 0xb0, 0x66, 0x03, 0x55, 0x4f, 0x56, 0x5d, 0x82, 0x5c, 0x01, 0x5d, 0x5b, 0x84,
+    0x5c, 0x05, 0x5b, 0x5d, 0x5a, 0x55, 0x53, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88,
+    0xe4, 0x66, 0x00, 0x1b, 0x88, 0x00, 0x0b, 0x01, 0x65, 0x66, 0x66, 0x3b, 0x00, 0x00, 0x0e, 0x63,
+    0x66, 0x66, 0x65, 0xae, 0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x65, 0x87, 0x66, 0x00, 0x65, 0xbb,
+    0x66, 0x00, 0x65, 0x87, 0x66, 0x00, 0x65, 0xd8, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe3,
+    0x66, 0x0b, 0x68, 0x56, 0x4f, 0x49, 0x41, 0x37, 0x2d, 0x23, 0x19, 0x0f, 0x02, 0x07, 0x82, 0x66,
+    0x03, 0x49, 0x00, 0x10, 0x56, 0xff, 0x66, 0xe6, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe1,
+    0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0x84, 0x66, 0x09, 0x65, 0x65, 0x5a, 0x65, 0x66, 0x66,
+    0x63, 0x3b, 0x64, 0x65, 0xff, 0x66, 0xe6, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe2, 0x66,
+    0x06, 0x65, 0x66, 0x66, 0x67, 0x66, 0x66, 0x65, 0x86, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65,
+    0xff, 0x66, 0xe5, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xf1, 0x66, 0x00, 0x65, 0xff, 0x66,
+    0xea, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe1, 0x66, 0x00, 0x67, 0x87, 0x66, 0x00, 0x65,
+    0x87, 0x66, 0x01, 0x65, 0x65, 0xff, 0x66, 0xe7, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe7,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xff, 0x66, 0xed, 0x66, 0xa1, 0x88,
+    0xce, 0x66, 0x90, 0x88, 0xe0, 0x66, 0x01, 0x67, 0x67, 0x8c, 0x66, 0x00, 0x67, 0xff, 0x66, 0xec,
+    0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xe3, 0x66, 0x00, 0x67, 0x88, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x00, 0x65, 0xff, 0x66, 0xea, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1,
+    0x88, 0xce, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0xce, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdd, 0x66, 0xa1, 0x88, 0x83, 0x66, 0x00, 0x65, 0xc6, 0x66, 0x02,
+    0x67, 0x66, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xaa, 0x66, 0x00, 0x65, 0xac, 0x66, 0x04,
+    0x65, 0x66, 0x66, 0x65, 0x66, 0xa1, 0x88, 0x00, 0x64, 0xc6, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00,
+    0x65, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x67, 0xac, 0x66, 0x00, 0x65, 0x83,
+    0x66, 0x00, 0x65, 0xa1, 0x88, 0xcd, 0x66, 0x00, 0x65, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdd,
+    0x66, 0xa1, 0x88, 0xcb, 0x66, 0x02, 0x65, 0x66, 0x65, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xaa,
+    0x66, 0x01, 0x67, 0x65, 0xb0, 0x66, 0xa1, 0x88, 0xca, 0x66, 0x03, 0x67, 0x65, 0x66, 0x66, 0x90,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xac, 0x66, 0x00, 0x65, 0xaf, 0x66, 0xa1, 0x88, 0xcb, 0x66, 0x02,
+    0x65, 0x66, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa8, 0x66, 0x01, 0x65, 0x65, 0xb2, 0x66,
+    0xa1, 0x88, 0x00, 0x65, 0xcd, 0x66, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x03, 0x69,
+    0x66, 0x66, 0x67, 0xb0, 0x66, 0x00, 0x68, 0xa1, 0x88, 0x01, 0x6a, 0x67, 0xc5, 0x66, 0x06, 0x65,
+    0x66, 0x66, 0x67, 0x66, 0x66, 0x68, 0x90, 0x88, 0xff, 0x66, 0xff, 0x66, 0xa7, 0x66, 0x01, 0x6f,
+    0x67, 0xb2, 0x66, 0x00, 0x6f, 0xa1, 0x88, 0x00, 0x6e, 0xcc, 0x66, 0x00, 0x70, 0x90, 0x88, 0xff,
+    0x66, 0xd7, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0xc9, 0x66, 0x04, 0x79, 0x67, 0x66, 0x66,
+    0x67, 0xaf, 0x66, 0x00, 0x79, 0xa1, 0x88, 0x03, 0x79, 0x66, 0x66, 0x65, 0xc9, 0x66, 0x00, 0x79,
+    0x90, 0x88, 0xff, 0x66, 0x92, 0x66, 0x01, 0x65, 0x65, 0xff, 0x66, 0x92, 0x66, 0x01, 0x7f, 0x75,
+    0xb1, 0x66, 0x01, 0x74, 0x7e, 0xa1, 0x88, 0x05, 0x7f, 0x74, 0x66, 0x66, 0x65, 0x67, 0xc1, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x02, 0x65, 0x74, 0x7f, 0x90, 0x88, 0xc9, 0x66, 0x00, 0x67, 0xff, 0x66,
+    0xdc, 0x66, 0x07, 0x84, 0x7e, 0x79, 0x6e, 0x69, 0x66, 0x66, 0x65, 0xa8, 0x66, 0x04, 0x67, 0x6e,
+    0x7a, 0x7f, 0x84, 0xa1, 0x88, 0x06, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x66, 0x64, 0xc2, 0x66, 0x04,
+    0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x90, 0x88, 0xff, 0x66, 0xdc, 0x66, 0x00, 0x65, 0xc9, 0x66, 0x04,
+    0x84, 0x7e, 0x79, 0x70, 0x69, 0xab, 0x66, 0x04, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0xa1, 0x88, 0x04,
+    0x85, 0x7f, 0x79, 0x70, 0x68, 0xd2, 0x66, 0x07, 0x65, 0x66, 0x67, 0x68, 0x71, 0x7a, 0x7e, 0x85,
+    0xc9, 0x66, 0x00, 0x65, 0xff, 0x66, 0xdc, 0x66, 0x01, 0x7f, 0x74, 0xb1, 0x66, 0x01, 0x74, 0x7e,
+    0xa1, 0x88, 0x01, 0x80, 0x74, 0x82, 0x66, 0x00, 0x65, 0xc7, 0x66, 0x01, 0x65, 0x67, 0x8d, 0x66,
+    0x01, 0x74, 0x7e, 0xff, 0x66, 0xdc, 0x66, 0x00, 0x65, 0xc9, 0x66, 0x02, 0x7a, 0x66, 0x65, 0x82,
+    0x66, 0x00, 0x67, 0xab, 0x66, 0x02, 0x65, 0x66, 0x7a, 0xa1, 0x88, 0x00, 0x7a, 0xc7, 0x66, 0x00,
+    0x65, 0x84, 0x66, 0x00, 0x67, 0x87, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x7a, 0xc9, 0x66, 0x01,
+    0x67, 0x65, 0xc3, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x65, 0xc0, 0x66, 0x00, 0x65, 0x82, 0x66,
+    0x00, 0x65, 0xc9, 0x66, 0x01, 0x6f, 0x67, 0xb2, 0x66, 0x00, 0x70, 0xa1, 0x88, 0x02, 0x6f, 0x66,
+    0x68, 0xdb, 0x66, 0x00, 0x70, 0xc9, 0x66, 0x04, 0x69, 0x65, 0x66, 0x67, 0x67, 0xc3, 0x66, 0x01,
+    0x69, 0x69, 0xc7, 0x66, 0x01, 0x68, 0x6a, 0xc8, 0x66, 0x03, 0x69, 0x66, 0x65, 0x65, 0xb0, 0x66,
+    0x00, 0x67, 0xa1, 0x88, 0x03, 0x69, 0x66, 0x66, 0x65, 0xd4, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00,
+    0x69, 0xc9, 0x66, 0x00, 0x6e, 0xbe, 0x66, 0x00, 0x67, 0x87, 0x66, 0x03, 0x70, 0x6e, 0x67, 0x65,
+    0x82, 0x66, 0x00, 0x67, 0xc0, 0x66, 0x08, 0x65, 0x71, 0x6e, 0x66, 0x65, 0x66, 0x65, 0x66, 0x65,
+    0xba, 0x66, 0x01, 0x65, 0x65, 0x83, 0x66, 0x01, 0x67, 0x70, 0xb5, 0x66, 0xa1, 0x88, 0x05, 0x66,
+    0x67, 0x65, 0x66, 0x66, 0x65, 0xd8, 0x66, 0x00, 0x67, 0xc9, 0x66, 0x00, 0x79, 0xc3, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x02, 0x79, 0x79, 0x67, 0x84, 0x66, 0x00, 0x65, 0xb9, 0x66, 0x00, 0x67, 0x85,
+    0x66, 0x01, 0x7a, 0x79, 0x83, 0x66, 0x00, 0x67, 0xbf, 0x66, 0x03, 0x65, 0x66, 0x66, 0x79, 0xb5,
+    0x66, 0xa1, 0x88, 0x01, 0x66, 0x65, 0xff, 0x66, 0xa7, 0x66, 0x01, 0x80, 0x75, 0xbc, 0x66, 0x00,
+    0x67, 0x82, 0x66, 0x08, 0x67, 0x66, 0x66, 0x67, 0x65, 0x74, 0x7f, 0x7f, 0x75, 0x84, 0x66, 0x00,
+    0x65, 0xb9, 0x66, 0x00, 0x65, 0x84, 0x66, 0x03, 0x74, 0x7f, 0x7f, 0x76, 0xc0, 0x66, 0x06, 0x67,
+    0x66, 0x67, 0x66, 0x66, 0x74, 0x7f, 0xb5, 0x66, 0xa1, 0x88, 0x03, 0x68, 0x66, 0x65, 0x67, 0xda,
+    0x66, 0x00, 0x65, 0xc9, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x67, 0xbf, 0x66, 0x09, 0x68, 0x6e,
+    0x7a, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0xbf, 0x66, 0x09, 0x69, 0x6c, 0x7b, 0x7f, 0x84,
+    0x84, 0x7f, 0x79, 0x6e, 0x67, 0xbf, 0x66, 0x04, 0x68, 0x6e, 0x7a, 0x7f, 0x86, 0xb5, 0x66, 0xa1,
+    0x88, 0x01, 0x66, 0x68, 0xdb, 0x66, 0x01, 0x67, 0x65, 0xc9, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x70,
+    0x68, 0xbf, 0x66, 0x09, 0x68, 0x70, 0x7a, 0x80, 0x84, 0x84, 0x7f, 0x79, 0x70, 0x68, 0xb7, 0x66,
+    0x00, 0x67, 0x84, 0x66, 0x0f, 0x65, 0x65, 0x68, 0x70, 0x79, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x70,
+    0x6b, 0x66, 0x65, 0x65, 0x67, 0xba, 0x66, 0x05, 0x64, 0x68, 0x70, 0x7a, 0x80, 0x84, 0xb5, 0x66,
+    0xa1, 0x88, 0xdc, 0x66, 0x01, 0x67, 0x67, 0xc8, 0x66, 0x04, 0x65, 0x65, 0x7e, 0x75, 0x67, 0xbd,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x06, 0x67, 0x66, 0x74, 0x7e, 0x7e, 0x74, 0x67, 0x83, 0x66, 0x00,
+    0x65, 0xb5, 0x66, 0x00, 0x65, 0x88, 0x66, 0x04, 0x75, 0x7f, 0x7f, 0x74, 0x65, 0xbf, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x01, 0x75, 0x80, 0xb5, 0x66, 0xa1, 0x88, 0x04, 0x66, 0x65, 0x66, 0x66, 0x65,
+    0xff, 0x66, 0xa4, 0x66, 0x00, 0x7a, 0xc3, 0x66, 0x00, 0x67, 0x82, 0x66, 0x01, 0x7a, 0x7a, 0x85,
+    0x66, 0x00, 0x65, 0xbc, 0x66, 0x05, 0x67, 0x65, 0x65, 0x66, 0x79, 0x7a, 0x83, 0x66, 0x03, 0x64,
+    0x66, 0x66, 0x67, 0xb8, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x7a, 0xb5, 0x66, 0xa1, 0x88, 0x02,
+    0x66, 0x66, 0x67, 0xda, 0x66, 0x00, 0x65, 0xca, 0x66, 0x00, 0x6e, 0xc7, 0x66, 0x01, 0x70, 0x6f,
+    0x84, 0x66, 0x00, 0x67, 0xbd, 0x66, 0x07, 0x65, 0x65, 0x66, 0x66, 0x70, 0x6f, 0x66, 0x65, 0x85,
+    0x66, 0x00, 0x65, 0xbb, 0x66, 0x03, 0x65, 0x66, 0x66, 0x70, 0xb5, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xa9, 0x66, 0x00, 0x69, 0x83, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x04, 0x68, 0x69, 0x66, 0x65, 0x67,
+    0xc4, 0x66, 0x01, 0x69, 0x69, 0xc4, 0x66, 0x03, 0x65, 0x65, 0x67, 0x68, 0xb5, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xa9, 0x66, 0x00, 0x67, 0xff, 0x66, 0x91, 0x66, 0x01, 0x67, 0x67, 0xc7, 0x66, 0x00,
+    0x67, 0xb5, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x65, 0xff, 0x66, 0x91, 0x66, 0x01,
+    0x65, 0x65, 0xc7, 0x66, 0x00, 0x65, 0xb5, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x65,
+    0x82, 0x66, 0x00, 0x65, 0xff, 0x66, 0xd7, 0x66, 0x00, 0x65, 0xb5, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xad, 0x66, 0x00, 0x65, 0xc0, 0x66, 0x06, 0x65, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65, 0xff, 0x66,
+    0x8f, 0x66, 0x00, 0x65, 0xb5, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xad, 0x66,
+    0x00, 0x65, 0xff, 0x66, 0xd0, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xb8, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x97, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x87, 0x66, 0x05,
+    0x5a, 0x4a, 0x53, 0x64, 0x66, 0x67, 0x93, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0x98, 0x66, 0x02, 0x4f, 0x46, 0x57, 0x84, 0x66, 0x02, 0x65, 0x39, 0x06, 0x82, 0x00, 0x03, 0x01,
+    0x17, 0x52, 0x67, 0x92, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02,
+    0x15, 0x00, 0x3d, 0x84, 0x66, 0x00, 0x1b, 0x82, 0x00, 0x00, 0x01, 0x82, 0x00, 0x01, 0x02, 0x3b,
+    0x92, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x1e, 0x00, 0x46,
+    0x83, 0x66, 0x0c, 0x3d, 0x01, 0x00, 0x26, 0x55, 0x64, 0x5f, 0x49, 0x12, 0x00, 0x03, 0x57, 0x65,
+    0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x03, 0x22, 0x00, 0x4a,
+    0x65, 0x82, 0x66, 0x02, 0x09, 0x00, 0x34, 0x82, 0x66, 0x05, 0x65, 0x66, 0x64, 0x17, 0x00, 0x20,
+    0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x22, 0x00, 0x4a,
+    0x82, 0x66, 0x0c, 0x5e, 0x00, 0x0a, 0x64, 0x66, 0x66, 0x65, 0x66, 0x67, 0x66, 0x56, 0x00, 0x08,
+    0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x22, 0x00, 0x4b,
+    0x82, 0x66, 0x04, 0x4c, 0x00, 0x1f, 0x66, 0x65, 0x85, 0x66, 0x02, 0x0b, 0x00, 0x5e, 0x90, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x22, 0x00, 0x4a, 0x82, 0x66,
+    0x02, 0x55, 0x00, 0x1f, 0x83, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x11, 0x00, 0x55, 0x90, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x97, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0xf8, 0x66,
+    0x0b, 0x65, 0x22, 0x00, 0x4a, 0x66, 0x67, 0x66, 0x64, 0x03, 0x0e, 0x66, 0x65, 0x83, 0x66, 0x04,
+    0x67, 0x64, 0x02, 0x01, 0x63, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xcf, 0x66, 0x00, 0x65, 0xba,
+    0x66, 0x00, 0x65, 0x8e, 0x66, 0x00, 0x65, 0xcc, 0x66, 0x00, 0x65, 0xac, 0x66, 0x03, 0x67, 0x22,
+    0x00, 0x4b, 0x83, 0x66, 0x02, 0x23, 0x00, 0x44, 0x85, 0x66, 0x02, 0x3b, 0x00, 0x0d, 0x91, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x8f, 0x66, 0x00, 0x65, 0x8a, 0x66, 0x00, 0x67, 0xfb, 0x66,
+    0x12, 0x21, 0x00, 0x0c, 0x19, 0x23, 0x2d, 0x36, 0x37, 0x01, 0x08, 0x50, 0x66, 0x66, 0x65, 0x66,
+    0x4e, 0x03, 0x01, 0x34, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xcf, 0x66, 0x00, 0x65, 0xc9, 0x66,
+    0x00, 0x67, 0xcc, 0x66, 0x05, 0x67, 0x66, 0x65, 0x66, 0x66, 0x67, 0xa9, 0x66, 0x00, 0x1b, 0x89,
+    0x00, 0x07, 0x65, 0x66, 0x66, 0x3a, 0x00, 0x00, 0x0e, 0x63, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xd3, 0x66, 0x00, 0x65, 0xb6, 0x66, 0x01, 0x65, 0x65, 0x89, 0x66, 0x05, 0x65, 0x66, 0x65, 0x66,
+    0x66, 0x67, 0xcf, 0x66, 0x00, 0x67, 0xa9, 0x66, 0x0a, 0x56, 0x4f, 0x49, 0x41, 0x37, 0x2d, 0x23,
+    0x19, 0x0f, 0x03, 0x06, 0x82, 0x66, 0x03, 0x49, 0x00, 0x10, 0x56, 0x92, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xd1, 0x66, 0x01, 0x65, 0x67, 0xb5, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0x85, 0x66, 0x01,
+    0x67, 0x67, 0xff, 0x66, 0x81, 0x66, 0x00, 0x67, 0x86, 0x66, 0x09, 0x67, 0x66, 0x65, 0x5a, 0x67,
+    0x68, 0x66, 0x63, 0x3a, 0x64, 0x93, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc9, 0x66, 0x09, 0x67, 0x65,
+    0x66, 0x66, 0x67, 0x66, 0x66, 0x47, 0x3f, 0x58, 0xb9, 0x66, 0x08, 0x67, 0x2d, 0x15, 0x1c, 0x1e,
+    0x1d, 0x1e, 0x1e, 0x1d, 0x83, 0x1e, 0x03, 0x23, 0x34, 0x45, 0x5f, 0xca, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x01, 0x65, 0x65, 0xb9, 0x66, 0x00, 0x67, 0x92, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xd0, 0x66,
+    0x02, 0x10, 0x00, 0x47, 0x82, 0x66, 0x00, 0x67, 0xb6, 0x66, 0x00, 0x21, 0x8d, 0x00, 0x01, 0x07,
+    0x40, 0xc7, 0x66, 0x04, 0x65, 0x5e, 0x3e, 0x3e, 0x65, 0xaf, 0x66, 0x00, 0x67, 0x83, 0x66, 0x01,
+    0x65, 0x65, 0x83, 0x66, 0x01, 0x67, 0x67, 0x93, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc6, 0x66, 0x00,
+    0x65, 0x84, 0x66, 0x0a, 0x68, 0x66, 0x66, 0x64, 0x18, 0x00, 0x4f, 0x66, 0x67, 0x66, 0x67, 0xaf,
+    0x66, 0x00, 0x67, 0x84, 0x66, 0x05, 0x67, 0x3e, 0x2f, 0x36, 0x38, 0x37, 0x86, 0x38, 0x05, 0x2f,
+    0x1f, 0x05, 0x00, 0x00, 0x2e, 0xc7, 0x66, 0x06, 0x4e, 0x00, 0x02, 0x66, 0x67, 0x66, 0x67, 0xa8,
+    0x66, 0x06, 0x2c, 0x1a, 0x42, 0x68, 0x66, 0x66, 0x67, 0x84, 0x66, 0x00, 0x67, 0x97, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xc4, 0x66, 0x02, 0x62, 0x60, 0x67, 0x88, 0x66, 0x06, 0x1b, 0x00, 0x52, 0x66,
+    0x66, 0x62, 0x5b, 0xb1, 0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x65, 0x86, 0x66, 0x09, 0x5e, 0x2b,
+    0x00, 0x01, 0x52, 0x66, 0x67, 0x66, 0x66, 0x67, 0xc1, 0x66, 0x02, 0x56, 0x00, 0x0c, 0xab, 0x66,
+    0x03, 0x67, 0x1b, 0x00, 0x3e, 0x84, 0x66, 0x03, 0x3e, 0x3a, 0x5b, 0x66, 0x82, 0x65, 0x95, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x04, 0x24, 0x00, 0x00, 0x02, 0x02, 0x85, 0x03, 0x07, 0x02,
+    0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0e, 0xb0, 0x66, 0x00, 0x65, 0x83, 0x66, 0x82, 0x65, 0x8a,
+    0x66, 0x07, 0x65, 0x66, 0x66, 0x1d, 0x00, 0x1d, 0x66, 0x67, 0xc4, 0x66, 0x02, 0x59, 0x00, 0x0e,
+    0xac, 0x66, 0x03, 0x20, 0x00, 0x43, 0x65, 0x82, 0x66, 0x03, 0x67, 0x0d, 0x00, 0x48, 0x86, 0x66,
+    0x00, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x01, 0x22, 0x01, 0x87, 0x00, 0x00,
+    0x01, 0x86, 0x00, 0x00, 0x0e, 0xbb, 0x66, 0x00, 0x67, 0x83, 0x66, 0x01, 0x65, 0x65, 0x83, 0x66,
+    0x02, 0x59, 0x00, 0x07, 0xc6, 0x66, 0x02, 0x59, 0x00, 0x0e, 0xac, 0x66, 0x03, 0x22, 0x00, 0x45,
+    0x65, 0x83, 0x66, 0x04, 0x16, 0x00, 0x50, 0x66, 0x65, 0x97, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc3,
+    0x66, 0x09, 0x67, 0x59, 0x18, 0x00, 0x04, 0x3c, 0x5f, 0x5e, 0x5f, 0x5d, 0x82, 0x5e, 0x06, 0x1b,
+    0x00, 0x49, 0x5b, 0x59, 0x54, 0x52, 0xc5, 0x66, 0x05, 0x67, 0x66, 0x08, 0x00, 0x60, 0x65, 0xc4,
+    0x66, 0x02, 0x59, 0x00, 0x0f, 0xac, 0x66, 0x0a, 0x22, 0x00, 0x47, 0x66, 0x66, 0x65, 0x66, 0x66,
+    0x17, 0x00, 0x52, 0x86, 0x66, 0x01, 0x67, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc5, 0x66,
+    0x0d, 0x65, 0x2f, 0x00, 0x00, 0x27, 0x62, 0x66, 0x66, 0x67, 0x66, 0x66, 0x1e, 0x00, 0x52, 0xb9,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x05, 0x65, 0x66, 0x67, 0x66, 0x65, 0x65, 0x87, 0x66, 0x02, 0x17,
+    0x00, 0x4f, 0xc5, 0x66, 0x02, 0x59, 0x00, 0x0e, 0x82, 0x66, 0x00, 0x65, 0xa8, 0x66, 0x02, 0x22,
+    0x00, 0x46, 0x84, 0x66, 0x03, 0x17, 0x00, 0x53, 0x67, 0x98, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc7,
+    0x66, 0x05, 0x44, 0x03, 0x00, 0x14, 0x5a, 0x67, 0x82, 0x66, 0x04, 0x1e, 0x00, 0x52, 0x66, 0x65,
+    0xb5, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0x8c, 0x66, 0x08, 0x65, 0x66, 0x66, 0x11, 0x00, 0x52,
+    0x66, 0x66, 0x67, 0xc2, 0x66, 0x06, 0x5a, 0x00, 0x0e, 0x67, 0x66, 0x66, 0x65, 0xa8, 0x66, 0x02,
+    0x22, 0x00, 0x46, 0x84, 0x66, 0x04, 0x18, 0x00, 0x52, 0x66, 0x65, 0x97, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xc3, 0x66, 0x00, 0x65, 0x83, 0x66, 0x04, 0x54, 0x0e, 0x00, 0x08, 0x4c, 0x82, 0x66, 0x02,
+    0x1f, 0x00, 0x52, 0x82, 0x66, 0x00, 0x67, 0xb7, 0x66, 0x03, 0x67, 0x65, 0x66, 0x67, 0x87, 0x66,
+    0x06, 0x65, 0x66, 0x65, 0x65, 0x03, 0x00, 0x5c, 0xc5, 0x66, 0x02, 0x59, 0x00, 0x0e, 0xac, 0x66,
+    0x02, 0x22, 0x00, 0x46, 0x82, 0x67, 0x04, 0x66, 0x66, 0x18, 0x00, 0x52, 0x82, 0x66, 0x00, 0x65,
+    0x95, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc9, 0x66, 0x0c, 0x5f, 0x1c, 0x00, 0x01, 0x38, 0x67, 0x66,
+    0x1e, 0x00, 0x53, 0x66, 0x66, 0x65, 0xc7, 0x66, 0x05, 0x38, 0x00, 0x11, 0x66, 0x65, 0x65, 0xc3,
+    0x66, 0x04, 0x59, 0x00, 0x0e, 0x66, 0x65, 0xa9, 0x66, 0x03, 0x65, 0x22, 0x00, 0x46, 0x82, 0x66,
+    0x07, 0x65, 0x66, 0x18, 0x00, 0x52, 0x66, 0x66, 0x65, 0x85, 0x66, 0x00, 0x65, 0x8f, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xca, 0x66, 0x0a, 0x65, 0x2f, 0x00, 0x00, 0x23, 0x62, 0x1e, 0x00, 0x52, 0x66,
+    0x65, 0xb1, 0x66, 0x00, 0x65, 0x8a, 0x66, 0x00, 0x67, 0x88, 0x66, 0x03, 0x50, 0x03, 0x00, 0x32,
+    0xb6, 0x66, 0x02, 0x5a, 0x58, 0x5f, 0x8c, 0x61, 0x03, 0x54, 0x00, 0x0e, 0x67, 0xab, 0x66, 0x02,
+    0x22, 0x00, 0x3e, 0x83, 0x5e, 0x04, 0x5f, 0x16, 0x00, 0x4d, 0x5d, 0x83, 0x5e, 0x02, 0x5d, 0x58,
+    0x51, 0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xcc, 0x66, 0x06, 0x43, 0x04,
+    0x00, 0x12, 0x0e, 0x00, 0x51, 0x82, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x00, 0x67, 0x82, 0x66, 0x04,
+    0x67, 0x5c, 0x5b, 0x62, 0x63, 0x85, 0x64, 0x09, 0x63, 0x65, 0x5a, 0x4b, 0x2a, 0x01, 0x00, 0x0e,
+    0x62, 0x65, 0xb5, 0x66, 0x00, 0x21, 0x83, 0x00, 0x00, 0x01, 0x89, 0x00, 0x06, 0x01, 0x00, 0x0d,
+    0x65, 0x66, 0x66, 0x65, 0xa8, 0x66, 0x00, 0x21, 0x90, 0x00, 0x00, 0x0d, 0x91, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xcb, 0x66, 0x03, 0x65, 0x67, 0x54, 0x0d, 0x82, 0x00, 0x00, 0x50, 0xba, 0x66, 0x00,
+    0x22, 0x87, 0x00, 0x00, 0x01, 0x85, 0x00, 0x01, 0x12, 0x54, 0x85, 0x66, 0x00, 0x65, 0xb0, 0x66,
+    0x00, 0x21, 0x90, 0x00, 0x00, 0x0a, 0x82, 0x66, 0x00, 0x65, 0xa8, 0x66, 0x00, 0x1d, 0x82, 0x00,
+    0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xcc, 0x66, 0x06, 0x65, 0x66, 0x5e, 0x18, 0x00, 0x00, 0x4c, 0xb3, 0x66, 0x02, 0x67, 0x66, 0x67,
+    0x82, 0x66, 0x01, 0x65, 0x22, 0x88, 0x00, 0x06, 0x01, 0x00, 0x00, 0x08, 0x17, 0x3a, 0x65, 0x82,
+    0x66, 0x00, 0x65, 0xb3, 0x66, 0x03, 0x67, 0x52, 0x53, 0x5a, 0x8c, 0x5c, 0x02, 0x5a, 0x55, 0x51,
+    0xac, 0x66, 0x04, 0x55, 0x4f, 0x56, 0x5c, 0x5b, 0x85, 0x5c, 0x07, 0x5d, 0x5c, 0x5b, 0x5c, 0x5c,
+    0x5a, 0x54, 0x53, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc9, 0x66, 0x0c, 0x65, 0x66, 0x66, 0x65,
+    0x66, 0x65, 0x64, 0x40, 0x3e, 0x5d, 0x67, 0x65, 0x65, 0xb4, 0x66, 0x06, 0x65, 0x66, 0x66, 0x52,
+    0x51, 0x57, 0x59, 0x87, 0x5a, 0x01, 0x5e, 0x67, 0x83, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67,
+    0xb4, 0x66, 0x00, 0x67, 0x8b, 0x66, 0x00, 0x65, 0xbe, 0x66, 0x00, 0x67, 0x94, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xd4, 0x66, 0x00, 0x67, 0xb5, 0x66, 0x00, 0x65, 0x86, 0x66, 0x00, 0x67, 0x86, 0x66,
+    0x07, 0x65, 0x66, 0x65, 0x66, 0x65, 0x66, 0x66, 0x65, 0xc3, 0x66, 0x00, 0x67, 0xaf, 0x66, 0x00,
+    0x67, 0x86, 0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0x99, 0x66, 0x00, 0x67, 0x87, 0x66, 0x00, 0x65, 0xb9, 0x66, 0x00, 0x67, 0xbb, 0x66, 0x00,
+    0x67, 0x89, 0x66, 0x00, 0x67, 0x96, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0x89, 0x66, 0x00, 0x68, 0xb1, 0x66, 0x00, 0x65, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0x8a, 0x66, 0x01, 0x65, 0x65, 0xaa, 0x66, 0x00, 0x67, 0x84, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66, 0x02, 0x69, 0x66, 0x65, 0xb1, 0x66, 0x00, 0x68,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66, 0x00, 0x6e, 0xb3, 0x66, 0x00, 0x70,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66, 0x00, 0x79, 0xb3, 0x66, 0x00, 0x79,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x87, 0x66, 0x03, 0x7f, 0x75, 0x67, 0x65, 0xaf,
+    0x66, 0x01, 0x74, 0x80, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65,
+    0xba, 0x66, 0x00, 0x67, 0x87, 0x66, 0x00, 0x65, 0xc7, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67,
+    0x83, 0x66, 0x00, 0x68, 0xb8, 0x66, 0x0c, 0x67, 0x65, 0x66, 0x65, 0x66, 0x65, 0x65, 0x66, 0x84,
+    0x7f, 0x7a, 0x6e, 0x69, 0xa9, 0x66, 0x06, 0x67, 0x66, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0xa1, 0x88,
+    0xff, 0x66, 0xab, 0x66, 0x03, 0x65, 0x67, 0x66, 0x65, 0xbc, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02,
+    0x67, 0x66, 0x67, 0xc7, 0x66, 0x00, 0x67, 0xc9, 0x66, 0x04, 0x85, 0x7f, 0x79, 0x70, 0x69, 0xa8,
+    0x66, 0x82, 0x65, 0x04, 0x67, 0x70, 0x7a, 0x7f, 0x84, 0xa1, 0x88, 0xff, 0x66, 0xa7, 0x66, 0x02,
+    0x65, 0x66, 0x69, 0xc2, 0x66, 0x01, 0x67, 0x65, 0x82, 0x66, 0x01, 0x68, 0x69, 0xc7, 0x66, 0x01,
+    0x68, 0x69, 0x85, 0x66, 0x00, 0x65, 0xba, 0x66, 0x08, 0x67, 0x66, 0x66, 0x65, 0x66, 0x67, 0x68,
+    0x7f, 0x73, 0xb1, 0x66, 0x01, 0x75, 0x7f, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x6e, 0xc7,
+    0x66, 0x06, 0x70, 0x6d, 0x66, 0x67, 0x66, 0x66, 0x67, 0xc2, 0x66, 0x02, 0x70, 0x6e, 0x67, 0x86,
+    0x66, 0x00, 0x65, 0xbe, 0x66, 0x01, 0x70, 0x7a, 0xab, 0x66, 0x01, 0x65, 0x67, 0x85, 0x66, 0x00,
+    0x7a, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x05, 0x79, 0x66, 0x67, 0x67, 0x66, 0x65, 0xbd, 0x66,
+    0x00, 0x67, 0x83, 0x66, 0x01, 0x79, 0x79, 0xc2, 0x66, 0x00, 0x67, 0x83, 0x66, 0x04, 0x79, 0x78,
+    0x67, 0x66, 0x67, 0x83, 0x66, 0x00, 0x68, 0xbf, 0x66, 0x01, 0x79, 0x6e, 0x82, 0x66, 0x02, 0x67,
+    0x66, 0x67, 0xa7, 0x66, 0x06, 0x65, 0x66, 0x65, 0x67, 0x65, 0x66, 0x70, 0xa1, 0x88, 0xff, 0x66,
+    0xa9, 0x66, 0x01, 0x7f, 0x75, 0xc1, 0x66, 0x0b, 0x67, 0x66, 0x67, 0x66, 0x74, 0x7f, 0x7f, 0x76,
+    0x65, 0x66, 0x66, 0x65, 0xc1, 0x66, 0x03, 0x75, 0x7f, 0x80, 0x75, 0xbf, 0x66, 0x08, 0x64, 0x66,
+    0x66, 0x67, 0x66, 0x66, 0x74, 0x7f, 0x69, 0x83, 0x66, 0x00, 0x65, 0xa9, 0x66, 0x00, 0x65, 0x83,
+    0x66, 0x00, 0x68, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0xbb,
+    0x66, 0x0d, 0x65, 0x66, 0x67, 0x66, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x84, 0x7f, 0x7a, 0x6e, 0x68,
+    0xbf, 0x66, 0x09, 0x68, 0x6e, 0x7a, 0x7f, 0x85, 0x85, 0x7f, 0x79, 0x6e, 0x67, 0xbf, 0x66, 0x04,
+    0x68, 0x6d, 0x7a, 0x7f, 0x84, 0xae, 0x66, 0x00, 0x67, 0x83, 0x66, 0x01, 0x67, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xa9, 0x66, 0x05, 0x84, 0x7f, 0x79, 0x70, 0x69, 0x65, 0xbe, 0x66, 0x0c, 0x69, 0x70,
+    0x7b, 0x7f, 0x85, 0x84, 0x7f, 0x7a, 0x71, 0x6a, 0x66, 0x66, 0x67, 0xbc, 0x66, 0x0a, 0x68, 0x70,
+    0x7a, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x70, 0x68, 0x67, 0xbe, 0x66, 0x05, 0x68, 0x71, 0x79, 0x7f,
+    0x84, 0x67, 0x84, 0x66, 0x01, 0x67, 0x65, 0xab, 0x66, 0x01, 0x65, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xa9, 0x66, 0x01, 0x7f, 0x74, 0xc5, 0x66, 0x03, 0x75, 0x7f, 0x7f, 0x75, 0xc5, 0x66, 0x03, 0x75,
+    0x7f, 0x7f, 0x74, 0xc5, 0x66, 0x01, 0x75, 0x7f, 0xb5, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66,
+    0x00, 0x7a, 0xc2, 0x66, 0x08, 0x65, 0x66, 0x67, 0x67, 0x66, 0x7a, 0x7a, 0x66, 0x65, 0xc4, 0x66,
+    0x03, 0x67, 0x7a, 0x7a, 0x65, 0xc3, 0x66, 0x03, 0x65, 0x66, 0x67, 0x7a, 0xb5, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xa9, 0x66, 0x00, 0x6f, 0x83, 0x66, 0x00, 0x65, 0xbf, 0x66, 0x04, 0x67, 0x66, 0x66,
+    0x70, 0x6f, 0xc7, 0x66, 0x01, 0x70, 0x70, 0xc0, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x71, 0xb5,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xa7, 0x66, 0x02, 0x65, 0x65, 0x69, 0x82, 0x66, 0x00, 0x65, 0xbc,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x04, 0x65, 0x66, 0x66, 0x68, 0x69, 0xc3, 0x66, 0x05, 0x65, 0x65,
+    0x67, 0x66, 0x68, 0x69, 0xc7, 0x66, 0x00, 0x68, 0xb5, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xaa, 0x66,
+    0x00, 0x67, 0xc1, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xc6, 0x66, 0x00, 0x67, 0xc7, 0x66, 0x00,
+    0x67, 0xba, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0x00, 0x67, 0xc0, 0x66, 0x00,
+    0x67, 0xbc, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xad, 0x66, 0x00, 0x65, 0xbf, 0x66, 0x00, 0x67, 0xcd,
+    0x66, 0x00, 0x67, 0xc6, 0x66, 0x00, 0x67, 0xb6, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xea, 0x66, 0x01,
+    0x65, 0x65, 0x83, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x67, 0xc0, 0x66, 0x06, 0x67, 0x66, 0x66,
+    0x65, 0x66, 0x67, 0x67, 0xc3, 0x66, 0x00, 0x67, 0xb8, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xff, 0x66, 0x9c, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x00, 0x67, 0x92, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xff, 0x66, 0x9f, 0x66, 0x00, 0x65, 0x88, 0x66, 0x02, 0x68, 0x66, 0x65, 0x90, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xa0, 0x66, 0x00, 0x67, 0x86, 0x66, 0x00, 0x67,
+    0x93, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x00, 0x67, 0x86, 0x66, 0x00, 0x65, 0x82, 0x66, 0x01, 0x65, 0x65, 0x91, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x67, 0x66, 0x67, 0x82, 0x66, 0x00, 0x65, 0x82,
+    0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xa2, 0x66, 0x01, 0x65, 0x65, 0x84, 0x66, 0x02, 0x67, 0x66, 0x67, 0x90, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x9a, 0x66, 0x03, 0x67, 0x66, 0x5a, 0x60, 0x89, 0x66, 0x02,
+    0x5e, 0x39, 0x39, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x97, 0x66, 0x08,
+    0x65, 0x66, 0x65, 0x2e, 0x0d, 0x00, 0x00, 0x10, 0x48, 0x83, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02,
+    0x4e, 0x00, 0x04, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x97, 0x66, 0x02,
+    0x65, 0x66, 0x27, 0x85, 0x00, 0x02, 0x2e, 0x66, 0x65, 0x84, 0x66, 0x04, 0x56, 0x00, 0x0b, 0x66,
+    0x67, 0x8f, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x97, 0x66, 0x13, 0x65, 0x43,
+    0x01, 0x00, 0x2f, 0x54, 0x4f, 0x1e, 0x00, 0x00, 0x38, 0x66, 0x67, 0x66, 0x65, 0x66, 0x66, 0x58,
+    0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x1e,
+    0x00, 0x2b, 0x82, 0x66, 0x04, 0x67, 0x27, 0x00, 0x02, 0x51, 0x84, 0x66, 0x05, 0x59, 0x00, 0x0e,
+    0x66, 0x66, 0x67, 0x8e, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x12,
+    0x0a, 0x00, 0x58, 0x66, 0x66, 0x65, 0x66, 0x64, 0x17, 0x00, 0x10, 0x63, 0x66, 0x65, 0x66, 0x66,
+    0x59, 0x00, 0x0e, 0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0x98, 0x66, 0x04, 0x01, 0x02, 0x65, 0x67, 0x65, 0x82, 0x66, 0x03, 0x5a, 0x06, 0x00, 0x2e,
+    0x83, 0x66, 0x02, 0x59, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0x98, 0x66, 0x02, 0x06, 0x00, 0x60, 0x82, 0x66, 0x06, 0x65, 0x66, 0x66, 0x40, 0x00, 0x01, 0x4c,
+    0x82, 0x66, 0x02, 0x59, 0x00, 0x0d, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0x98, 0x66, 0x15, 0x16, 0x00, 0x4d, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x20, 0x00, 0x08,
+    0x57, 0x66, 0x65, 0x59, 0x00, 0x0e, 0x66, 0x66, 0x65, 0x8e, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0x98, 0x66, 0x03, 0x27, 0x00, 0x13, 0x62, 0x82, 0x66, 0x0b, 0x65, 0x66, 0x66,
+    0x61, 0x0d, 0x00, 0x09, 0x54, 0x66, 0x59, 0x00, 0x0d, 0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xc5, 0x66, 0x04, 0x67, 0x67, 0x66, 0x66, 0x65, 0x86, 0x66, 0x05, 0x67, 0x66,
+    0x65, 0x66, 0x66, 0x65, 0xb6, 0x66, 0x00, 0x59, 0x8a, 0x66, 0x00, 0x65, 0xbd, 0x66, 0x00, 0x65,
+    0x83, 0x66, 0x00, 0x67, 0x89, 0x66, 0x02, 0x67, 0x66, 0x67, 0x99, 0x66, 0x00, 0x67, 0x90, 0x66,
+    0x06, 0x57, 0x04, 0x00, 0x18, 0x4d, 0x64, 0x67, 0x83, 0x66, 0x08, 0x5b, 0x0e, 0x01, 0x02, 0x33,
+    0x4f, 0x00, 0x0c, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc5, 0x66, 0x01, 0x65, 0x65, 0x85,
+    0x66, 0x06, 0x65, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xb9, 0x66, 0x02, 0x21, 0x21, 0x5e, 0x82,
+    0x66, 0x00, 0x67, 0xca, 0x66, 0x01, 0x67, 0x67, 0x86, 0x66, 0x04, 0x65, 0x38, 0x66, 0x66, 0x64,
+    0xa8, 0x66, 0x02, 0x67, 0x66, 0x3b, 0x82, 0x00, 0x08, 0x10, 0x66, 0x64, 0x66, 0x66, 0x65, 0x65,
+    0x5c, 0x12, 0x83, 0x00, 0x00, 0x0f, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc1, 0x66, 0x05, 0x65,
+    0x65, 0x66, 0x66, 0x67, 0x65, 0x82, 0x66, 0x00, 0x65, 0x84, 0x66, 0x03, 0x5d, 0x4b, 0x50, 0x63,
+    0xb2, 0x66, 0x00, 0x65, 0x84, 0x66, 0x04, 0x67, 0x22, 0x00, 0x08, 0x43, 0x84, 0x66, 0x00, 0x65,
+    0x86, 0x66, 0x00, 0x65, 0xb7, 0x66, 0x02, 0x3b, 0x5e, 0x65, 0x83, 0x66, 0x02, 0x65, 0x66, 0x65,
+    0x85, 0x66, 0x02, 0x62, 0x20, 0x0e, 0xae, 0x66, 0x03, 0x46, 0x0e, 0x00, 0x1e, 0x86, 0x66, 0x05,
+    0x64, 0x39, 0x07, 0x00, 0x00, 0x0b, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc2, 0x66, 0x00, 0x64,
+    0x82, 0x66, 0x09, 0x5b, 0x3f, 0x25, 0x26, 0x3d, 0x63, 0x66, 0x66, 0x59, 0x14, 0x82, 0x00, 0x05,
+    0x01, 0x2a, 0x64, 0x66, 0x65, 0x67, 0xb4, 0x66, 0x06, 0x35, 0x01, 0x01, 0x00, 0x1f, 0x5a, 0x67,
+    0x82, 0x66, 0x00, 0x65, 0xbe, 0x66, 0x02, 0x22, 0x12, 0x5e, 0x89, 0x66, 0x05, 0x65, 0x66, 0x58,
+    0x12, 0x00, 0x0f, 0x9a, 0x66, 0x00, 0x65, 0x8f, 0x66, 0x08, 0x65, 0x66, 0x66, 0x65, 0x66, 0x56,
+    0x50, 0x66, 0x67, 0x82, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x61, 0x44, 0x2e, 0x26, 0x91, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xc5, 0x66, 0x01, 0x4b, 0x02, 0x83, 0x00, 0x03, 0x0f, 0x5c, 0x5c, 0x07,
+    0x84, 0x00, 0x02, 0x01, 0x18, 0x65, 0xb1, 0x66, 0x0e, 0x65, 0x66, 0x66, 0x65, 0x67, 0x66, 0x58,
+    0x21, 0x00, 0x00, 0x05, 0x3d, 0x66, 0x66, 0x67, 0xbf, 0x66, 0x03, 0x22, 0x00, 0x11, 0x5d, 0x89,
+    0x66, 0x04, 0x48, 0x05, 0x00, 0x00, 0x2c, 0x9a, 0x66, 0x00, 0x65, 0x94, 0x66, 0x01, 0x67, 0x67,
+    0x82, 0x66, 0x02, 0x65, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x93, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xc4, 0x66, 0x16, 0x56, 0x05, 0x00, 0x0a, 0x24, 0x21, 0x06, 0x00, 0x1c, 0x2b, 0x00, 0x11, 0x4e,
+    0x62, 0x58, 0x2c, 0x00, 0x00, 0x42, 0x67, 0x65, 0x66, 0x67, 0xb1, 0x66, 0x09, 0x67, 0x66, 0x67,
+    0x66, 0x47, 0x0d, 0x00, 0x00, 0x18, 0x58, 0x86, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0xb3,
+    0x66, 0x04, 0x41, 0x04, 0x00, 0x11, 0x5c, 0x86, 0x66, 0x06, 0x65, 0x32, 0x00, 0x00, 0x09, 0x48,
+    0x67, 0xae, 0x66, 0x00, 0x67, 0x8a, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc0,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x14, 0x2e, 0x00, 0x17, 0x60, 0x67, 0x66, 0x5b, 0x11, 0x00, 0x06,
+    0x07, 0x60, 0x65, 0x66, 0x67, 0x66, 0x2d, 0x00, 0x13, 0x66, 0x65, 0xb8, 0x66, 0x08, 0x62, 0x2e,
+    0x02, 0x00, 0x03, 0x36, 0x64, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0xb8, 0x66, 0x04, 0x50, 0x07,
+    0x00, 0x11, 0x5d, 0x84, 0x66, 0x05, 0x5f, 0x1c, 0x00, 0x00, 0x17, 0x5d, 0x83, 0x66, 0x00, 0x65,
+    0xa9, 0x66, 0x02, 0x2b, 0x1a, 0x41, 0x8a, 0x66, 0x00, 0x68, 0x83, 0x66, 0x00, 0x67, 0x90, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x03, 0x1a, 0x00, 0x51, 0x65, 0x82, 0x66, 0x0d, 0x4d, 0x00,
+    0x00, 0x30, 0x65, 0x66, 0x66, 0x67, 0x66, 0x5e, 0x02, 0x02, 0x65, 0x67, 0xb0, 0x66, 0x00, 0x67,
+    0x88, 0x66, 0x05, 0x53, 0x16, 0x00, 0x00, 0x14, 0x41, 0x83, 0x42, 0x02, 0x40, 0x3b, 0x3a, 0xb7,
+    0x66, 0x05, 0x65, 0x52, 0x07, 0x00, 0x11, 0x5e, 0x82, 0x66, 0x0b, 0x53, 0x0e, 0x00, 0x00, 0x2d,
+    0x64, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x97, 0x66, 0x00, 0x67, 0x90, 0x66, 0x0d, 0x1a, 0x00,
+    0x3f, 0x66, 0x67, 0x66, 0x67, 0x66, 0x3d, 0x3a, 0x5a, 0x66, 0x67, 0x65, 0x84, 0x66, 0x00, 0x65,
+    0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x13, 0x06, 0x04, 0x66, 0x66, 0x67, 0x65, 0x66,
+    0x66, 0x06, 0x01, 0x45, 0x66, 0x65, 0x66, 0x66, 0x65, 0x65, 0x0f, 0x00, 0x5a, 0xb6, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x02, 0x67, 0x67, 0x35, 0x87, 0x00, 0x01, 0x01, 0x0e, 0xb9, 0x66, 0x0a, 0x54,
+    0x08, 0x00, 0x11, 0x5e, 0x66, 0x40, 0x04, 0x01, 0x05, 0x44, 0x84, 0x66, 0x00, 0x67, 0xab, 0x66,
+    0x04, 0x20, 0x00, 0x43, 0x66, 0x65, 0x82, 0x66, 0x04, 0x0d, 0x00, 0x48, 0x66, 0x67, 0x86, 0x66,
+    0x00, 0x67, 0x8f, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x01, 0x02, 0x08, 0x83, 0x66, 0x04,
+    0x67, 0x66, 0x13, 0x00, 0x50, 0x84, 0x66, 0x03, 0x67, 0x13, 0x00, 0x51, 0xae, 0x66, 0x00, 0x67,
+    0x8c, 0x66, 0x0c, 0x42, 0x08, 0x00, 0x00, 0x0e, 0x10, 0x11, 0x0f, 0x10, 0x0e, 0x09, 0x10, 0x65,
+    0xb9, 0x66, 0x09, 0x53, 0x08, 0x00, 0x12, 0x28, 0x00, 0x00, 0x0f, 0x56, 0x67, 0x84, 0x66, 0x00,
+    0x67, 0xab, 0x66, 0x02, 0x22, 0x00, 0x45, 0x84, 0x66, 0x02, 0x15, 0x00, 0x50, 0x85, 0x66, 0x00,
+    0x67, 0x92, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xbf, 0x66, 0x0f, 0x65, 0x66, 0x66, 0x67, 0x66, 0x0f,
+    0x00, 0x5f, 0x65, 0x66, 0x65, 0x66, 0x65, 0x14, 0x00, 0x4f, 0x85, 0x66, 0x02, 0x0b, 0x00, 0x60,
+    0xba, 0x66, 0x05, 0x58, 0x1c, 0x00, 0x00, 0x0b, 0x48, 0xc2, 0x66, 0x09, 0x65, 0x54, 0x08, 0x00,
+    0x00, 0x01, 0x22, 0x61, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xad, 0x66, 0x03, 0x22, 0x00, 0x46,
+    0x67, 0x83, 0x66, 0x02, 0x17, 0x00, 0x52, 0x86, 0x66, 0x00, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xbf, 0x66, 0x07, 0x65, 0x66, 0x65, 0x66, 0x66, 0x20, 0x00, 0x31, 0x84, 0x66, 0x02, 0x26,
+    0x18, 0x50, 0x84, 0x66, 0x02, 0x51, 0x00, 0x0a, 0xb1, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0x83,
+    0x66, 0x06, 0x64, 0x35, 0x03, 0x00, 0x00, 0x29, 0x61, 0x86, 0x66, 0x02, 0x67, 0x66, 0x65, 0x83,
+    0x66, 0x00, 0x67, 0xb4, 0x66, 0x06, 0x67, 0x66, 0x54, 0x08, 0x00, 0x09, 0x61, 0xb4, 0x66, 0x02,
+    0x22, 0x00, 0x46, 0x82, 0x66, 0x04, 0x67, 0x67, 0x18, 0x00, 0x52, 0x86, 0x66, 0x00, 0x67, 0x91,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x04, 0x47, 0x00, 0x01, 0x36, 0x5f, 0x84, 0x66, 0x0b,
+    0x65, 0x66, 0x65, 0x66, 0x66, 0x62, 0x18, 0x00, 0x1e, 0x65, 0x66, 0x67, 0xb0, 0x66, 0x00, 0x67,
+    0x83, 0x66, 0x07, 0x4d, 0x0f, 0x00, 0x00, 0x0e, 0x4b, 0x66, 0x65, 0x88, 0x66, 0x00, 0x65, 0xbb,
+    0x66, 0x05, 0x67, 0x54, 0x08, 0x00, 0x18, 0x62, 0xb3, 0x66, 0x02, 0x21, 0x00, 0x46, 0x84, 0x66,
+    0x02, 0x18, 0x00, 0x51, 0x82, 0x66, 0x02, 0x65, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0x8e, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xbf, 0x66, 0x02, 0x65, 0x66, 0x67, 0x82, 0x66, 0x03, 0x24, 0x00, 0x00,
+    0x16, 0x88, 0x66, 0x04, 0x41, 0x11, 0x00, 0x03, 0x55, 0x83, 0x66, 0x00, 0x67, 0xaa, 0x66, 0x00,
+    0x67, 0x85, 0x66, 0x01, 0x56, 0x24, 0x82, 0x00, 0x03, 0x2e, 0x61, 0x65, 0x67, 0xbf, 0x66, 0x0d,
+    0x65, 0x5c, 0x5c, 0x61, 0x62, 0x64, 0x64, 0x65, 0x64, 0x52, 0x07, 0x01, 0x1a, 0x60, 0x82, 0x64,
+    0x02, 0x62, 0x5d, 0x55, 0xab, 0x66, 0x03, 0x67, 0x22, 0x00, 0x46, 0x84, 0x66, 0x02, 0x18, 0x00,
+    0x52, 0x84, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4,
+    0x66, 0x04, 0x65, 0x62, 0x29, 0x01, 0x2c, 0x84, 0x66, 0x09, 0x67, 0x66, 0x66, 0x67, 0x19, 0x00,
+    0x00, 0x37, 0x66, 0x65, 0xb2, 0x66, 0x0c, 0x65, 0x66, 0x66, 0x21, 0x00, 0x00, 0x11, 0x51, 0x67,
+    0x65, 0x66, 0x66, 0x65, 0x84, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x65, 0xb2, 0x66, 0x00, 0x23,
+    0x85, 0x00, 0x00, 0x01, 0x89, 0x00, 0x02, 0x0d, 0x65, 0x65, 0xaa, 0x66, 0x02, 0x22, 0x00, 0x46,
+    0x84, 0x66, 0x02, 0x18, 0x00, 0x52, 0x99, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc3, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x01, 0x5b, 0x57, 0x82, 0x66, 0x0a, 0x67, 0x66, 0x65, 0x66, 0x67, 0x66, 0x34, 0x12,
+    0x44, 0x66, 0x67, 0x83, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x06, 0x20, 0x02, 0x34, 0x64, 0x66, 0x66,
+    0x67, 0x83, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x67, 0xb5, 0x66, 0x01, 0x67, 0x22, 0x90, 0x00,
+    0x00, 0x0e, 0xac, 0x66, 0x02, 0x22, 0x00, 0x3e, 0x84, 0x5e, 0x02, 0x16, 0x00, 0x4c, 0x83, 0x5e,
+    0x03, 0x5d, 0x5c, 0x58, 0x51, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x8c, 0x66, 0x03,
+    0x65, 0x66, 0x34, 0x53, 0x84, 0x66, 0x00, 0x65, 0xc1, 0x66, 0x02, 0x53, 0x53, 0x5b, 0x8c, 0x5c,
+    0x02, 0x5a, 0x55, 0x53, 0xac, 0x66, 0x00, 0x21, 0x90, 0x00, 0x02, 0x0e, 0x66, 0x67, 0x8f, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x94, 0x66, 0x00, 0x65, 0xc3, 0x66, 0x00, 0x67, 0x8e, 0x66,
+    0x02, 0x67, 0x66, 0x67, 0xaa, 0x66, 0x02, 0x67, 0x1d, 0x01, 0x8f, 0x00, 0x00, 0x0d, 0x91, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x8a, 0x66, 0x04, 0x65, 0x66, 0x66, 0x67, 0x67, 0x83, 0x66,
+    0x01, 0x65, 0x65, 0xc2, 0x66, 0x00, 0x67, 0xbe, 0x66, 0x02, 0x55, 0x4f, 0x56, 0x82, 0x5c, 0x00,
+    0x5d, 0x88, 0x5c, 0x02, 0x5a, 0x55, 0x53, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x87,
+    0x66, 0x00, 0x67, 0xff, 0x66, 0x92, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x02, 0x65, 0x66, 0x65, 0x91,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x90, 0x66, 0x01, 0x65, 0x67, 0xc4, 0x66, 0x00, 0x67,
+    0xd1, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0x8d, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0x88, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0xff, 0x66, 0x9d, 0x66, 0x00,
+    0x67, 0x8d, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x94, 0x66, 0x00, 0x67, 0xc5, 0x66, 0x00,
+    0x65, 0x8c, 0x66, 0x01, 0x65, 0x65, 0x82, 0x66, 0x00, 0x67, 0xb7, 0x66, 0x00, 0x67, 0x82, 0x66,
+    0x00, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0x88, 0x66, 0x02, 0x67, 0x66, 0x67,
+    0x82, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x67, 0xd8, 0x66, 0x00, 0x67, 0xa9, 0x66, 0x00, 0x65,
+    0x90, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x04,
+    0x65, 0x66, 0x65, 0x66, 0x67, 0xff, 0x66, 0x8d, 0x66, 0x00, 0x67, 0xc1, 0x66, 0x01, 0x65, 0x67,
+    0x82, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0xae, 0x66, 0x03, 0x67, 0x66, 0x65, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xf2, 0x66, 0x00, 0x67, 0xff, 0x66, 0x93, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65,
+    0xac, 0x66, 0x00, 0x67, 0x83, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x65, 0xc7, 0x66,
+    0x00, 0x65, 0xff, 0x66, 0x8f, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x69, 0x82, 0x66, 0x00, 0x65,
+    0xaf, 0x66, 0x00, 0x68, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xb8, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x01, 0x67, 0x67, 0xc2, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x6e, 0xb2, 0x66, 0x01, 0x67, 0x70,
+    0xa1, 0x88, 0xff, 0x66, 0xad, 0x66, 0x00, 0x67, 0xff, 0x66, 0x8e, 0x66, 0x01, 0x65, 0x65, 0xc2,
+    0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x79, 0xb0, 0x66, 0x03, 0x65, 0x66, 0x66, 0x79, 0xa1, 0x88,
+    0x87, 0x66, 0xcf, 0x82, 0xd1, 0x66, 0x00, 0x69, 0x83, 0x66, 0x00, 0x65, 0xc2, 0x66, 0x01, 0x68,
+    0x69, 0xc3, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x67, 0x69, 0x65, 0xc6, 0x66, 0x02, 0x69, 0x7f,
+    0x74, 0xb1, 0x66, 0x03, 0x75, 0x7f, 0x88, 0x87, 0x9f, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x6d,
+    0x82, 0x66, 0x00, 0x65, 0xc3, 0x66, 0x04, 0x6f, 0x6e, 0x66, 0x66, 0x67, 0xc4, 0x66, 0x01, 0x70,
+    0x6e, 0xc3, 0x66, 0x00, 0x67, 0x82, 0x66, 0x05, 0x70, 0x84, 0x7e, 0x79, 0x6e, 0x68, 0xab, 0x66,
+    0x04, 0x68, 0x6e, 0x7a, 0x7f, 0x85, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x79, 0xc7, 0x66,
+    0x01, 0x7a, 0x7a, 0xc6, 0x66, 0x02, 0x65, 0x7a, 0x79, 0xc3, 0x66, 0x00, 0x68, 0x82, 0x66, 0x07,
+    0x7a, 0x84, 0x7f, 0x79, 0x70, 0x69, 0x66, 0x67, 0xa9, 0x66, 0x04, 0x69, 0x70, 0x7a, 0x7f, 0x84,
+    0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x01, 0x7e, 0x75, 0x84, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00,
+    0x65, 0xb4, 0x66, 0x08, 0x65, 0x66, 0x67, 0x66, 0x66, 0x74, 0x7e, 0x7f, 0x75, 0xc3, 0x66, 0x05,
+    0x65, 0x66, 0x74, 0x7f, 0x7e, 0x74, 0xc0, 0x66, 0x08, 0x67, 0x66, 0x66, 0x67, 0x65, 0x74, 0x7f,
+    0x80, 0x74, 0x82, 0x66, 0x00, 0x65, 0xab, 0x66, 0x03, 0x65, 0x66, 0x76, 0x7f, 0xa1, 0x88, 0xff,
+    0x66, 0xa7, 0x66, 0x07, 0x65, 0x66, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x65, 0xba, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x0c, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e, 0x69, 0x66, 0x66, 0x67,
+    0xbc, 0x66, 0x0b, 0x6a, 0x6e, 0x7a, 0x7e, 0x85, 0x84, 0x7f, 0x79, 0x6e, 0x67, 0x66, 0x65, 0xba,
+    0x66, 0x09, 0x65, 0x66, 0x66, 0x68, 0x6e, 0x7a, 0x7f, 0x85, 0x7b, 0x65, 0x83, 0x66, 0x00, 0x65,
+    0xa8, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x7a, 0xa1, 0x88, 0xff, 0x66, 0xa8, 0x66, 0x05, 0x67,
+    0x84, 0x7f, 0x79, 0x70, 0x69, 0xbf, 0x66, 0x0f, 0x68, 0x70, 0x7a, 0x7f, 0x85, 0x84, 0x7e, 0x79,
+    0x70, 0x6a, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xb9, 0x66, 0x0b, 0x68, 0x70, 0x7b, 0x7f, 0x84,
+    0x84, 0x7f, 0x7a, 0x70, 0x68, 0x66, 0x65, 0xbd, 0x66, 0x05, 0x68, 0x70, 0x7a, 0x7f, 0x84, 0x6f,
+    0xb1, 0x66, 0x03, 0x65, 0x67, 0x70, 0x87, 0xa0, 0x88, 0xff, 0x66, 0xa8, 0x66, 0x04, 0x65, 0x7f,
+    0x74, 0x65, 0x65, 0x86, 0x66, 0x00, 0x65, 0xbb, 0x66, 0x06, 0x76, 0x7f, 0x7e, 0x74, 0x65, 0x66,
+    0x67, 0xbf, 0x66, 0x06, 0x67, 0x66, 0x66, 0x76, 0x7f, 0x7e, 0x74, 0xc2, 0x66, 0x05, 0x67, 0x66,
+    0x67, 0x74, 0x7e, 0x69, 0xb3, 0x66, 0x00, 0x68, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x7a,
+    0x89, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x04, 0x65, 0x66, 0x66, 0x65, 0x67, 0x82, 0x66, 0x08, 0x67,
+    0x66, 0x66, 0x7a, 0x7b, 0x66, 0x66, 0x65, 0x65, 0xc2, 0x66, 0x03, 0x67, 0x7a, 0x7a, 0x67, 0xc2,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x7a, 0x66, 0x65, 0xad, 0x66, 0x05, 0x65, 0x66, 0x66, 0x65,
+    0x67, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x09, 0x6f, 0x65, 0x66, 0x66, 0x65, 0x66, 0x65,
+    0x66, 0x66, 0x67, 0xb8, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x65, 0x66, 0x70, 0x6f, 0xc3, 0x66,
+    0x05, 0x65, 0x66, 0x67, 0x67, 0x70, 0x6f, 0xc7, 0x66, 0x00, 0x70, 0x83, 0x66, 0x03, 0x67, 0x66,
+    0x66, 0x65, 0xad, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x6a, 0x83, 0x66, 0x00, 0x65,
+    0xbc, 0x66, 0x01, 0x65, 0x65, 0x83, 0x66, 0x03, 0x69, 0x68, 0x66, 0x64, 0xc2, 0x66, 0x04, 0x67,
+    0x65, 0x66, 0x68, 0x69, 0x82, 0x66, 0x00, 0x65, 0xc3, 0x66, 0x00, 0x68, 0x82, 0x66, 0x00, 0x67,
+    0xac, 0x66, 0x00, 0x67, 0x83, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xaf, 0x66, 0x02, 0x67, 0x66, 0x65,
+    0xb4, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65,
+    0xc9, 0x66, 0x00, 0x67, 0xbc, 0x66, 0x02, 0x65, 0x66, 0x67, 0xb7, 0x66, 0x02, 0x65, 0x66, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xa0, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67,
+    0x95, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x9a, 0x66, 0x00, 0x67, 0x84, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x94, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0x99, 0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x65, 0x83, 0x66, 0x02, 0x65, 0x66,
+    0x65, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x9b, 0x66, 0x0d, 0x54, 0x25,
+    0x45, 0x66, 0x65, 0x66, 0x66, 0x65, 0x67, 0x67, 0x0d, 0x17, 0x42, 0x67, 0x93, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x99, 0x66, 0x04, 0x67, 0x39, 0x00, 0x00, 0x24, 0x85, 0x66,
+    0x00, 0x5b, 0x82, 0x00, 0x01, 0x24, 0x67, 0x82, 0x66, 0x00, 0x67, 0x8e, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0x99, 0x66, 0x04, 0x41, 0x00, 0x00, 0x0c, 0x3d, 0x85, 0x66, 0x07,
+    0x63, 0x42, 0x1a, 0x00, 0x00, 0x38, 0x66, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xff, 0x66, 0x97, 0x66, 0x06, 0x65, 0x5f, 0x08, 0x00, 0x1f, 0x62, 0x67, 0x87, 0x66, 0x04, 0x65,
+    0x31, 0x00, 0x01, 0x4d, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66,
+    0x03, 0x32, 0x00, 0x0c, 0x60, 0x8a, 0x66, 0x03, 0x65, 0x1d, 0x00, 0x27, 0x91, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x1f, 0x00, 0x3f, 0x8a, 0x66, 0x04, 0x65,
+    0x67, 0x50, 0x00, 0x13, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x97, 0x66,
+    0x04, 0x67, 0x0e, 0x00, 0x56, 0x67, 0x8b, 0x66, 0x03, 0x63, 0x02, 0x01, 0x63, 0x90, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x03, 0x01, 0x00, 0x62, 0x65, 0x8c, 0x66,
+    0x02, 0x0d, 0x00, 0x55, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66,
+    0x02, 0x0e, 0x00, 0x52, 0x83, 0x66, 0x02, 0x65, 0x66, 0x65, 0x83, 0x66, 0x05, 0x67, 0x66, 0x62,
+    0x01, 0x00, 0x60, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02,
+    0x20, 0x00, 0x3d, 0x86, 0x66, 0x00, 0x67, 0x82, 0x66, 0x04, 0x67, 0x66, 0x4d, 0x00, 0x0d, 0x91,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x03, 0x32, 0x00, 0x0f, 0x60,
+    0x8a, 0x66, 0x03, 0x65, 0x19, 0x02, 0x1e, 0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x03, 0x5e, 0x09, 0x00, 0x1f, 0x8a, 0x66, 0x03, 0x2e,
+    0x00, 0x00, 0x4e, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x99, 0x66, 0x04,
+    0x40, 0x00, 0x00, 0x14, 0x49, 0x83, 0x66, 0x07, 0x67, 0x66, 0x66, 0x50, 0x1b, 0x00, 0x01, 0x2a,
+    0x92, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc3, 0x66, 0x00, 0x65, 0x87, 0x66, 0x00, 0x67, 0x88, 0x66,
+    0x00, 0x65, 0xb6, 0x66, 0x00, 0x65, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xce, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x00, 0x67, 0xae, 0x66, 0x0f, 0x38, 0x04, 0x00, 0x00, 0x11, 0x24, 0x34, 0x3e,
+    0x35, 0x27, 0x16, 0x00, 0x01, 0x00, 0x23, 0x60, 0x92, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xbf, 0x66,
+    0x00, 0x67, 0x8a, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x67, 0xff, 0x66, 0x84, 0x66, 0x00, 0x65,
+    0x83, 0x66, 0x00, 0x65, 0xb8, 0x66, 0x08, 0x67, 0x67, 0x66, 0x67, 0x5a, 0x1d, 0x00, 0x00, 0x01,
+    0x85, 0x00, 0x01, 0x0f, 0x4b, 0x94, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc8, 0x66, 0x00, 0x67, 0x85,
+    0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x00, 0x67, 0x83, 0x66, 0x02, 0x65, 0x66,
+    0x67, 0xd5, 0x66, 0x02, 0x67, 0x66, 0x67, 0xb2, 0x66, 0x0a, 0x65, 0x51, 0x3e, 0x2c, 0x1a, 0x0c,
+    0x17, 0x27, 0x39, 0x48, 0x64, 0x82, 0x66, 0x00, 0x65, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xd4,
+    0x66, 0x01, 0x67, 0x67, 0xbe, 0x66, 0x00, 0x65, 0xd0, 0x66, 0x00, 0x67, 0xb2, 0x66, 0x00, 0x67,
+    0x89, 0x66, 0x00, 0x67, 0x95, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc3, 0x66, 0x00, 0x67, 0x8c, 0x66,
+    0x00, 0x67, 0xbb, 0x66, 0x02, 0x48, 0x3d, 0x51, 0xc6, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67,
+    0x8e, 0x66, 0x00, 0x67, 0xab, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0x83, 0x66, 0x02, 0x65,
+    0x66, 0x67, 0x83, 0x66, 0x02, 0x67, 0x66, 0x67, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc1, 0x66,
+    0x00, 0x67, 0x84, 0x66, 0x05, 0x65, 0x5a, 0x60, 0x67, 0x66, 0x67, 0x86, 0x66, 0x02, 0x5d, 0x39,
+    0x39, 0xb0, 0x66, 0x08, 0x65, 0x66, 0x65, 0x66, 0x66, 0x67, 0x18, 0x00, 0x3e, 0x82, 0x66, 0x02,
+    0x65, 0x66, 0x67, 0xbf, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0x8d, 0x66, 0x01, 0x65, 0x67,
+    0xab, 0x66, 0x05, 0x67, 0x66, 0x66, 0x55, 0x38, 0x61, 0x84, 0x66, 0x07, 0x42, 0x23, 0x14, 0x1d,
+    0x31, 0x56, 0x67, 0x65, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xbf, 0x66, 0x00, 0x65, 0x84, 0x66,
+    0x09, 0x65, 0x2e, 0x0d, 0x00, 0x00, 0x10, 0x48, 0x66, 0x66, 0x67, 0x84, 0x66, 0x02, 0x4e, 0x00,
+    0x05, 0xb4, 0x66, 0x04, 0x65, 0x66, 0x20, 0x00, 0x45, 0xc6, 0x66, 0x04, 0x47, 0x40, 0x46, 0x48,
+    0x49, 0x85, 0x48, 0x0a, 0x49, 0x48, 0x48, 0x4e, 0x59, 0x65, 0x66, 0x67, 0x66, 0x66, 0x67, 0xa8,
+    0x66, 0x06, 0x65, 0x66, 0x65, 0x26, 0x00, 0x00, 0x51, 0x83, 0x66, 0x00, 0x22, 0x84, 0x00, 0x01,
+    0x04, 0x43, 0x92, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc3, 0x66, 0x02, 0x65, 0x66, 0x26, 0x85, 0x00,
+    0x00, 0x2f, 0x86, 0x66, 0x02, 0x56, 0x00, 0x0b, 0xb2, 0x66, 0x08, 0x65, 0x66, 0x66, 0x67, 0x22,
+    0x00, 0x47, 0x66, 0x67, 0xc4, 0x66, 0x02, 0x22, 0x00, 0x01, 0x8c, 0x00, 0x01, 0x0f, 0x45, 0xae,
+    0x66, 0x04, 0x2b, 0x00, 0x00, 0x04, 0x4d, 0x82, 0x66, 0x0a, 0x3d, 0x00, 0x00, 0x18, 0x32, 0x2b,
+    0x09, 0x00, 0x02, 0x59, 0x67, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xbf, 0x66, 0x0e, 0x67, 0x66,
+    0x66, 0x65, 0x65, 0x43, 0x00, 0x00, 0x2f, 0x55, 0x50, 0x1d, 0x00, 0x01, 0x38, 0x84, 0x66, 0x03,
+    0x65, 0x58, 0x00, 0x0e, 0xb6, 0x66, 0x04, 0x22, 0x00, 0x48, 0x66, 0x67, 0x87, 0x66, 0x02, 0x67,
+    0x66, 0x65, 0xb9, 0x66, 0x02, 0x23, 0x06, 0x0c, 0x8a, 0x0e, 0x04, 0x05, 0x00, 0x00, 0x01, 0x4f,
+    0xab, 0x66, 0x13, 0x65, 0x4b, 0x00, 0x00, 0x2e, 0x62, 0x66, 0x67, 0x66, 0x66, 0x10, 0x00, 0x25,
+    0x65, 0x66, 0x66, 0x5a, 0x10, 0x00, 0x27, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc2, 0x66, 0x04,
+    0x67, 0x66, 0x1e, 0x00, 0x2c, 0x83, 0x66, 0x03, 0x28, 0x00, 0x02, 0x52, 0x84, 0x66, 0x02, 0x59,
+    0x00, 0x0e, 0xb6, 0x66, 0x05, 0x22, 0x00, 0x48, 0x66, 0x66, 0x67, 0x86, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x00, 0x65, 0xb7, 0x66, 0x03, 0x65, 0x65, 0x66, 0x67, 0x8a, 0x66, 0x03, 0x57, 0x19, 0x00,
+    0x16, 0xab, 0x66, 0x0c, 0x67, 0x2c, 0x01, 0x1d, 0x68, 0x67, 0x66, 0x65, 0x66, 0x52, 0x00, 0x04,
+    0x60, 0x83, 0x66, 0x02, 0x46, 0x00, 0x0a, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x02,
+    0x0a, 0x00, 0x58, 0x82, 0x66, 0x05, 0x65, 0x64, 0x17, 0x00, 0x11, 0x63, 0x83, 0x66, 0x02, 0x5a,
+    0x00, 0x0e, 0xb6, 0x66, 0x02, 0x22, 0x00, 0x49, 0x8e, 0x66, 0x00, 0x64, 0x82, 0x66, 0x00, 0x65,
+    0xb1, 0x66, 0x00, 0x67, 0x8f, 0x66, 0x03, 0x5d, 0x01, 0x03, 0x65, 0xab, 0x66, 0x02, 0x10, 0x00,
+    0x4d, 0x82, 0x66, 0x0d, 0x67, 0x66, 0x37, 0x00, 0x1f, 0x67, 0x66, 0x67, 0x66, 0x66, 0x65, 0x03,
+    0x00, 0x64, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x02, 0x01, 0x02, 0x65, 0x82, 0x66,
+    0x05, 0x67, 0x66, 0x5a, 0x05, 0x01, 0x2e, 0x83, 0x66, 0x02, 0x59, 0x01, 0x0e, 0xb6, 0x66, 0x02,
+    0x22, 0x00, 0x08, 0x84, 0x0f, 0x00, 0x10, 0x86, 0x0f, 0x03, 0x0d, 0x08, 0x0f, 0x65, 0x82, 0x66,
+    0x01, 0x65, 0x67, 0xb1, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0x87, 0x66, 0x82, 0x67, 0x03, 0x66,
+    0x0d, 0x00, 0x5a, 0xab, 0x66, 0x04, 0x04, 0x00, 0x5f, 0x66, 0x65, 0x82, 0x66, 0x04, 0x21, 0x00,
+    0x38, 0x65, 0x67, 0x83, 0x66, 0x02, 0x0e, 0x00, 0x58, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4,
+    0x66, 0x02, 0x07, 0x00, 0x60, 0x84, 0x66, 0x0a, 0x65, 0x40, 0x00, 0x01, 0x4b, 0x66, 0x67, 0x66,
+    0x59, 0x00, 0x0e, 0xb6, 0x66, 0x00, 0x22, 0x8d, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0c, 0x67, 0xc1,
+    0x66, 0x00, 0x67, 0x82, 0x66, 0x03, 0x65, 0x03, 0x00, 0x5e, 0xaa, 0x66, 0x03, 0x67, 0x08, 0x00,
+    0x61, 0x84, 0x66, 0x05, 0x09, 0x00, 0x4f, 0x66, 0x66, 0x65, 0x82, 0x66, 0x02, 0x06, 0x00, 0x59,
+    0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc0, 0x66, 0x00, 0x67, 0x82, 0x66, 0x02, 0x17, 0x00, 0x4d,
+    0x83, 0x66, 0x0b, 0x65, 0x66, 0x66, 0x20, 0x00, 0x09, 0x57, 0x66, 0x66, 0x59, 0x00, 0x0e, 0xb6,
+    0x66, 0x04, 0x22, 0x00, 0x32, 0x48, 0x49, 0x8a, 0x48, 0x02, 0x46, 0x41, 0x41, 0x82, 0x66, 0x01,
+    0x67, 0x65, 0xb1, 0x66, 0x02, 0x65, 0x66, 0x67, 0x8c, 0x66, 0x05, 0x39, 0x00, 0x0d, 0x66, 0x66,
+    0x65, 0xa9, 0x66, 0x0a, 0x16, 0x00, 0x50, 0x66, 0x65, 0x65, 0x66, 0x54, 0x00, 0x05, 0x64, 0x84,
+    0x66, 0x03, 0x5b, 0x00, 0x01, 0x61, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x03, 0x28,
+    0x00, 0x13, 0x62, 0x85, 0x66, 0x08, 0x60, 0x0e, 0x00, 0x09, 0x53, 0x67, 0x59, 0x00, 0x0e, 0xb6,
+    0x66, 0x02, 0x22, 0x00, 0x48, 0x84, 0x66, 0x00, 0x67, 0x86, 0x66, 0x01, 0x65, 0x67, 0xc4, 0x66,
+    0x05, 0x67, 0x62, 0x31, 0x02, 0x00, 0x2d, 0xac, 0x66, 0x02, 0x27, 0x00, 0x22, 0x83, 0x66, 0x02,
+    0x1e, 0x00, 0x1f, 0x85, 0x66, 0x05, 0x2f, 0x00, 0x18, 0x66, 0x66, 0x67, 0x8e, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xc0, 0x66, 0x00, 0x65, 0x82, 0x66, 0x12, 0x57, 0x04, 0x00, 0x18, 0x4d, 0x64, 0x66,
+    0x66, 0x65, 0x66, 0x66, 0x5a, 0x0f, 0x00, 0x02, 0x32, 0x4e, 0x00, 0x0e, 0xb6, 0x66, 0x05, 0x22,
+    0x00, 0x48, 0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0xbd, 0x66, 0x01,
+    0x65, 0x65, 0x85, 0x66, 0x07, 0x67, 0x66, 0x66, 0x60, 0x04, 0x00, 0x0f, 0x62, 0xac, 0x66, 0x09,
+    0x54, 0x00, 0x00, 0x2d, 0x5c, 0x5b, 0x2d, 0x00, 0x00, 0x48, 0x84, 0x66, 0x03, 0x43, 0x00, 0x01,
+    0x37, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc2, 0x66, 0x03, 0x67, 0x66, 0x66, 0x3b, 0x82, 0x00,
+    0x00, 0x0f, 0x85, 0x66, 0x01, 0x5c, 0x12, 0x83, 0x00, 0x01, 0x0e, 0x67, 0xaf, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x06, 0x67, 0x66, 0x23, 0x00, 0x48, 0x67, 0x67, 0xd3, 0x66, 0x05, 0x29, 0x23, 0x5e,
+    0x66, 0x66, 0x67, 0xaa, 0x66, 0x01, 0x67, 0x2a, 0x85, 0x00, 0x00, 0x28, 0x83, 0x66, 0x06, 0x33,
+    0x15, 0x00, 0x00, 0x11, 0x60, 0x67, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xbf, 0x66, 0x00, 0x65,
+    0x85, 0x66, 0x03, 0x46, 0x0e, 0x00, 0x1e, 0x82, 0x66, 0x09, 0x65, 0x66, 0x65, 0x66, 0x64, 0x39,
+    0x06, 0x00, 0x00, 0x0b, 0xb6, 0x66, 0x02, 0x20, 0x01, 0x46, 0xd6, 0x66, 0x02, 0x67, 0x66, 0x65,
+    0x82, 0x66, 0x00, 0x65, 0xaa, 0x66, 0x10, 0x38, 0x08, 0x00, 0x00, 0x06, 0x2b, 0x65, 0x66, 0x66,
+    0x65, 0x66, 0x1c, 0x00, 0x00, 0x0d, 0x5a, 0x67, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc2, 0x66,
+    0x00, 0x64, 0x83, 0x66, 0x02, 0x67, 0x55, 0x4f, 0x88, 0x66, 0x03, 0x61, 0x44, 0x2e, 0x25, 0xb5,
+    0x66, 0x03, 0x68, 0x1b, 0x00, 0x42, 0xdb, 0x66, 0x00, 0x65, 0xa8, 0x66, 0x00, 0x67, 0x83, 0x66,
+    0x01, 0x58, 0x54, 0x86, 0x66, 0x03, 0x34, 0x25, 0x3e, 0x63, 0x93, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xc6, 0x66, 0x00, 0x65, 0x83, 0x66, 0x01, 0x67, 0x67, 0x83, 0x66, 0x00, 0x65, 0x83, 0x66, 0x00,
+    0x67, 0xb6, 0x66, 0x03, 0x26, 0x14, 0x42, 0x67, 0xd8, 0x66, 0x02, 0x65, 0x67, 0x65, 0xa9, 0x66,
+    0x00, 0x67, 0x88, 0x66, 0x01, 0x65, 0x67, 0x82, 0x66, 0x00, 0x67, 0x82, 0x66, 0x00, 0x65, 0x90,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xca, 0x66, 0x00, 0x67, 0x89, 0x66, 0x01, 0x65, 0x65, 0xb4, 0x66,
+    0x01, 0x67, 0x65, 0xff, 0x66, 0x8d, 0x66, 0x00, 0x67, 0x9f, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc1,
+    0x66, 0x00, 0x67, 0x89, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x65, 0xb7, 0x66, 0x00, 0x65, 0xdd,
+    0x66, 0x00, 0x67, 0xaa, 0x66, 0x03, 0x65, 0x5c, 0x56, 0x5f, 0x82, 0x66, 0x00, 0x65, 0x84, 0x66,
+    0x06, 0x65, 0x66, 0x67, 0x66, 0x5d, 0x42, 0x44, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0x88, 0x66, 0x07, 0x67, 0x65, 0x66, 0x66, 0x67, 0x66, 0x66, 0x65, 0xff, 0x66, 0x86, 0x66, 0x03,
+    0x67, 0x13, 0x00, 0x3b, 0x84, 0x66, 0x02, 0x60, 0x5e, 0x65, 0x83, 0x66, 0x04, 0x65, 0x50, 0x00,
+    0x03, 0x67, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xc2, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x67,
+    0x8c, 0x66, 0x02, 0x67, 0x66, 0x67, 0xbc, 0x66, 0x00, 0x65, 0xff, 0x66, 0x80, 0x66, 0x02, 0x1a,
+    0x00, 0x44, 0x83, 0x66, 0x03, 0x67, 0x04, 0x00, 0x4c, 0x84, 0x66, 0x02, 0x58, 0x00, 0x0c, 0x91,
+    0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x97, 0x66, 0x0b, 0x67, 0x20, 0x00, 0x47,
+    0x66, 0x66, 0x65, 0x66, 0x66, 0x0c, 0x00, 0x56, 0x84, 0x66, 0x02, 0x5b, 0x00, 0x0e, 0x91, 0x66,
+    0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x22, 0x00, 0x48, 0x83, 0x66,
+    0x03, 0x67, 0x0f, 0x00, 0x59, 0x84, 0x66, 0x02, 0x5c, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x03, 0x21, 0x00, 0x48, 0x67, 0x83, 0x66, 0x0a, 0x10,
+    0x00, 0x5a, 0x66, 0x67, 0x66, 0x66, 0x65, 0x5c, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x02, 0x22, 0x00, 0x48, 0x84, 0x66, 0x02, 0x10, 0x00, 0x5a,
+    0x82, 0x66, 0x04, 0x67, 0x66, 0x5c, 0x00, 0x0d, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0xff, 0x66, 0x98, 0x66, 0x02, 0x22, 0x00, 0x48, 0x84, 0x66, 0x0a, 0x10, 0x00, 0x5a, 0x67, 0x66,
+    0x67, 0x67, 0x66, 0x5c, 0x00, 0x0f, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0x98, 0x66, 0x02, 0x22, 0x00, 0x48, 0x84, 0x66, 0x02, 0x11, 0x00, 0x59, 0x84, 0x66, 0x02, 0x5d,
+    0x00, 0x10, 0x82, 0x66, 0x00, 0x67, 0x8d, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0x98, 0x66, 0x02, 0x22, 0x00, 0x48, 0x84, 0x66, 0x02, 0x10, 0x00, 0x5a, 0x83, 0x66, 0x04, 0x67,
+    0x5c, 0x00, 0x0e, 0x65, 0x90, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x97, 0x66,
+    0x03, 0x67, 0x23, 0x00, 0x40, 0x84, 0x5e, 0x0a, 0x0f, 0x00, 0x52, 0x5e, 0x5e, 0x5d, 0x5e, 0x5d,
+    0x54, 0x00, 0x0e, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbc, 0x66, 0x00, 0x65, 0xda,
+    0x66, 0x00, 0x21, 0x8d, 0x00, 0x03, 0x01, 0x00, 0x00, 0x0d, 0x91, 0x66, 0xa1, 0x88, 0xff, 0x66,
+    0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x00, 0x1d, 0x90, 0x00, 0x00, 0x09, 0x91, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xbc, 0x66, 0x00, 0x65, 0xd9, 0x66, 0x05, 0x67, 0x55, 0x53, 0x5a, 0x5c,
+    0x5d, 0x89, 0x5c, 0x07, 0x5b, 0x5a, 0x55, 0x51, 0x66, 0x67, 0x66, 0x65, 0x8d, 0x66, 0xa1, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xa8, 0x66, 0x01, 0x65, 0x65, 0x92, 0x66, 0xa1, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0x98, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x65, 0x9e, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xbc, 0x66, 0x00, 0x67, 0xdb, 0x66, 0x01, 0x67, 0x65, 0x8c, 0x66,
+    0x04, 0x65, 0x66, 0x66, 0x67, 0x65, 0x8f, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66,
+    0x9c, 0x66, 0x00, 0x65, 0x89, 0x66, 0x01, 0x67, 0x65, 0x93, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xbc, 0x66, 0x00, 0x67, 0xda, 0x66, 0x04, 0x65, 0x65, 0x66, 0x66, 0x65, 0x9f, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xc5,
+    0x66, 0x00, 0x65, 0xf6, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbf,
+    0x66, 0x06, 0x65, 0x66, 0x66, 0x65, 0x66, 0x66, 0x65, 0xf6, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xbd, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xc1, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x00, 0x67, 0xf6, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbf, 0x66, 0x06, 0x65, 0x66,
+    0x66, 0x65, 0x66, 0x66, 0x65, 0xf6, 0x66, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x69, 0x82,
+    0x66, 0x00, 0x67, 0xbe, 0x66, 0x00, 0x65, 0x83, 0x66, 0x01, 0x68, 0x69, 0xc6, 0x66, 0x02, 0x67,
+    0x68, 0x69, 0x82, 0x66, 0x03, 0x67, 0x66, 0x66, 0x67, 0xbc, 0x66, 0x00, 0x65, 0x82, 0x66, 0x01,
+    0x68, 0x69, 0x82, 0x66, 0x00, 0x67, 0xaf, 0x66, 0x00, 0x68, 0x8e, 0x88, 0x00, 0x87, 0x91, 0x88,
+    0xff, 0x66, 0xa9, 0x66, 0x00, 0x6e, 0x82, 0x66, 0x00, 0x67, 0xc2, 0x66, 0x08, 0x65, 0x71, 0x6e,
+    0x65, 0x65, 0x66, 0x64, 0x66, 0x65, 0xc0, 0x66, 0x04, 0x67, 0x70, 0x6e, 0x66, 0x67, 0xc5, 0x66,
+    0x04, 0x70, 0x6e, 0x66, 0x66, 0x65, 0xb0, 0x66, 0x00, 0x71, 0x95, 0x88, 0x00, 0x87, 0x8a, 0x88,
+    0xff, 0x66, 0xa9, 0x66, 0x03, 0x79, 0x67, 0x66, 0x65, 0xbd, 0x66, 0x00, 0x67, 0x83, 0x66, 0x03,
+    0x67, 0x66, 0x79, 0x79, 0x86, 0x66, 0x03, 0x67, 0x65, 0x66, 0x67, 0xb9, 0x66, 0x09, 0x65, 0x66,
+    0x66, 0x79, 0x79, 0x66, 0x67, 0x66, 0x66, 0x65, 0xc2, 0x66, 0x01, 0x79, 0x79, 0xb3, 0x66, 0x00,
+    0x79, 0x96, 0x88, 0x00, 0x87, 0x89, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x04, 0x7f, 0x75, 0x66, 0x66,
+    0x67, 0xbc, 0x66, 0x09, 0x65, 0x66, 0x66, 0x65, 0x67, 0x66, 0x74, 0x7f, 0x7f, 0x76, 0xc1, 0x66,
+    0x07, 0x65, 0x68, 0x66, 0x67, 0x74, 0x7f, 0x80, 0x75, 0x83, 0x66, 0x00, 0x67, 0xbe, 0x66, 0x07,
+    0x67, 0x66, 0x74, 0x7f, 0x7e, 0x75, 0x66, 0x65, 0xab, 0x66, 0x05, 0x67, 0x66, 0x65, 0x66, 0x73,
+    0x7f, 0xa1, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x04, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0xba, 0x66, 0x00,
+    0x65, 0x83, 0x66, 0x09, 0x69, 0x6d, 0x7b, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0xbf, 0x66,
+    0x09, 0x68, 0x6d, 0x7a, 0x7f, 0x86, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0xbd, 0x66, 0x0e, 0x67, 0x66,
+    0x68, 0x6e, 0x7b, 0x7f, 0x84, 0x84, 0x7f, 0x79, 0x6e, 0x68, 0x66, 0x66, 0x65, 0xa7, 0x66, 0x05,
+    0x65, 0x69, 0x6e, 0x7a, 0x7f, 0x84, 0x91, 0x88, 0x00, 0x87, 0x8e, 0x88, 0xff, 0x66, 0xa9, 0x66,
+    0x04, 0x84, 0x7f, 0x79, 0x71, 0x68, 0xb9, 0x66, 0x00, 0x65, 0x82, 0x66, 0x0e, 0x64, 0x66, 0x68,
+    0x70, 0x79, 0x7e, 0x85, 0x84, 0x80, 0x79, 0x70, 0x6b, 0x66, 0x66, 0x65, 0xbb, 0x66, 0x0b, 0x65,
+    0x68, 0x6f, 0x7a, 0x80, 0x84, 0x84, 0x7f, 0x7a, 0x70, 0x69, 0x65, 0xbe, 0x66, 0x09, 0x69, 0x70,
+    0x7b, 0x7f, 0x84, 0x84, 0x7e, 0x79, 0x6f, 0x68, 0xbd, 0x66, 0x06, 0x65, 0x67, 0x68, 0x70, 0x7b,
+    0x7f, 0x84, 0x8d, 0x88, 0xff, 0x66, 0xa7, 0x66, 0x03, 0x65, 0x66, 0x7f, 0x74, 0xbb, 0x66, 0x03,
+    0x65, 0x66, 0x66, 0x65, 0x85, 0x66, 0x04, 0x75, 0x7f, 0x7f, 0x74, 0x65, 0x84, 0x66, 0x01, 0x65,
+    0x65, 0xbc, 0x66, 0x04, 0x67, 0x75, 0x80, 0x7f, 0x74, 0x82, 0x66, 0x00, 0x67, 0xc1, 0x66, 0x03,
+    0x75, 0x7f, 0x7d, 0x74, 0xbe, 0x66, 0x03, 0x64, 0x66, 0x66, 0x65, 0x82, 0x66, 0x01, 0x74, 0x7e,
+    0x82, 0x88, 0x00, 0x87, 0x89, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x7a, 0x82, 0x66, 0x00, 0x67,
+    0xc0, 0x66, 0x04, 0x65, 0x66, 0x66, 0x78, 0x7a, 0x83, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xbc,
+    0x66, 0x06, 0x65, 0x66, 0x66, 0x7a, 0x7a, 0x66, 0x67, 0xc0, 0x66, 0x06, 0x65, 0x66, 0x66, 0x67,
+    0x66, 0x7a, 0x7a, 0xae, 0x66, 0x05, 0x65, 0x66, 0x66, 0x67, 0x66, 0x65, 0x8b, 0x66, 0x00, 0x67,
+    0x85, 0x66, 0x01, 0x7a, 0x87, 0x8c, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x6f, 0xc6, 0x66, 0x05,
+    0x65, 0x70, 0x6f, 0x66, 0x65, 0x67, 0xc4, 0x66, 0x01, 0x70, 0x6f, 0xc3, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x01, 0x71, 0x6f, 0x83, 0x66, 0x00, 0x65, 0xc2, 0x66, 0x02, 0x71, 0x88, 0x87, 0x8b, 0x88,
+    0xff, 0x66, 0xa9, 0x66, 0x02, 0x69, 0x66, 0x65, 0xc5, 0x66, 0x01, 0x68, 0x69, 0xc6, 0x66, 0x02,
+    0x67, 0x68, 0x69, 0xc0, 0x66, 0x00, 0x67, 0x85, 0x66, 0x01, 0x68, 0x69, 0x83, 0x66, 0x00, 0x65,
+    0xc2, 0x66, 0x00, 0x68, 0x8d, 0x88, 0xff, 0x66, 0xa7, 0x66, 0x00, 0x67, 0xca, 0x66, 0x00, 0x67,
+    0xc7, 0x66, 0x02, 0x67, 0x66, 0x67, 0xc1, 0x66, 0x05, 0x65, 0x66, 0x66, 0x65, 0x66, 0x67, 0xc9,
+    0x66, 0x00, 0x87, 0x83, 0x88, 0x00, 0x87, 0x87, 0x88, 0xff, 0x66, 0xa9, 0x66, 0x00, 0x67, 0x82,
+    0x66, 0x00, 0x65, 0xc2, 0x66, 0x02, 0x65, 0x66, 0x65, 0xc7, 0x66, 0x00, 0x65, 0xc9, 0x66, 0x00,
+    0x67, 0xc8, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0x81, 0x66, 0x01, 0x65, 0x67,
+    0xcd, 0x66, 0x82, 0x88, 0x00, 0x87, 0x89, 0x88, 0xff, 0x66, 0xad, 0x66, 0x00, 0x67, 0xff, 0x66,
+    0x8e, 0x66, 0x00, 0x65, 0xc5, 0x66, 0x00, 0x65, 0xca, 0x66, 0x00, 0x65, 0x8d, 0x88, 0xff, 0x66,
+    0xae, 0x66, 0x00, 0x65, 0xff, 0x66, 0xd0, 0x66, 0x00, 0x65, 0x86, 0x66, 0x02, 0x65, 0x66, 0x67,
+    0xc5, 0x66, 0x83, 0x88, 0x00, 0x87, 0x88, 0x88, 0xff, 0x66, 0xff, 0x66, 0xbb, 0x66, 0x00, 0x65,
+    0xc4, 0x66, 0x00, 0x67, 0x87, 0x66, 0x01, 0x65, 0x65, 0xc4, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1,
+    0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1,
+    0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0x94, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0x8a, 0x66, 0x00, 0x65, 0xff, 0x66, 0xab,
+    0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0x8f, 0x66, 0x00, 0x67, 0xd9, 0x66, 0x00, 0x67, 0xe5,
+    0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0x90, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x67, 0x85,
+    0x66, 0x03, 0x67, 0x66, 0x65, 0x67, 0xff, 0x66, 0xb1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66,
+    0x94, 0x66, 0x00, 0x65, 0x89, 0x66, 0x00, 0x65, 0xff, 0x66, 0xb0, 0x66, 0x8d, 0x88, 0xff, 0x66,
+    0xd0, 0x66, 0x04, 0x67, 0x66, 0x66, 0x65, 0x67, 0xb9, 0x66, 0x01, 0x67, 0x67, 0x84, 0x66, 0x00,
+    0x65, 0xc5, 0x66, 0x00, 0x65, 0x8f, 0x66, 0x00, 0x67, 0xe1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0x91, 0x66, 0x00, 0x67, 0x85, 0x66, 0x00, 0x67, 0x84, 0x66, 0x00, 0x65, 0xff, 0x66, 0xb1,
+    0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0x90, 0x66, 0x03, 0x67, 0x66, 0x65, 0x65, 0x8c, 0x66,
+    0x82, 0x67, 0xff, 0x66, 0xac, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xd1, 0x66, 0x04, 0x65, 0x67, 0x66,
+    0x67, 0x65, 0xc7, 0x66, 0x02, 0x67, 0x56, 0x34, 0xb6, 0x66, 0x05, 0x29, 0x0d, 0x15, 0x17, 0x17,
+    0x18, 0x89, 0x17, 0x02, 0x15, 0x10, 0x14, 0xe5, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x00,
+    0x65, 0x8c, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x00, 0x65, 0x82, 0x66, 0x08, 0x5e, 0x4e, 0x4a, 0x5c,
+    0x66, 0x66, 0x65, 0x67, 0x65, 0x82, 0x66, 0x03, 0x51, 0x22, 0x01, 0x0d, 0xb5, 0x66, 0x01, 0x67,
+    0x22, 0x87, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x0e, 0xba, 0x66, 0x01, 0x67, 0x64, 0xa8, 0x66,
+    0x8d, 0x88, 0xff, 0x66, 0xbf, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xc7, 0x66, 0x06, 0x67, 0x66,
+    0x66, 0x65, 0x62, 0x27, 0x01, 0x82, 0x00, 0x01, 0x19, 0x5a, 0x83, 0x66, 0x01, 0x4a, 0x19, 0x82,
+    0x00, 0x00, 0x0e, 0x82, 0x66, 0x00, 0x65, 0xb1, 0x66, 0x03, 0x67, 0x42, 0x37, 0x3d, 0x82, 0x3f,
+    0x04, 0x3e, 0x40, 0x07, 0x00, 0x3a, 0x84, 0x3f, 0x05, 0x3e, 0x37, 0x3a, 0x66, 0x65, 0x67, 0xb1,
+    0x66, 0x83, 0x67, 0x8d, 0x66, 0x00, 0x65, 0x9d, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xc6, 0x66, 0x00,
+    0x65, 0x82, 0x66, 0x00, 0x67, 0xc1, 0x66, 0x02, 0x65, 0x66, 0x1e, 0x85, 0x00, 0x04, 0x0a, 0x5e,
+    0x66, 0x52, 0x16, 0x82, 0x00, 0x06, 0x10, 0x33, 0x50, 0x67, 0x67, 0x66, 0x65, 0xb2, 0x66, 0x0b,
+    0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x0c, 0x00, 0x5c, 0x65, 0x84, 0x66, 0x02, 0x67,
+    0x66, 0x65, 0xb3, 0x66, 0x06, 0x24, 0x20, 0x48, 0x65, 0x66, 0x66, 0x65, 0x84, 0x66, 0x02, 0x67,
+    0x66, 0x67, 0x85, 0x66, 0x00, 0x67, 0x9a, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xc1, 0x66, 0x0a, 0x67,
+    0x66, 0x66, 0x43, 0x39, 0x3e, 0x44, 0x47, 0x4a, 0x49, 0x48, 0x87, 0x49, 0x02, 0x47, 0x42, 0x3e,
+    0xb4, 0x66, 0x11, 0x65, 0x66, 0x51, 0x00, 0x00, 0x2e, 0x5d, 0x64, 0x50, 0x14, 0x00, 0x2e, 0x38,
+    0x01, 0x00, 0x00, 0x20, 0x4c, 0xb8, 0x66, 0x01, 0x67, 0x65, 0x84, 0x66, 0x04, 0x65, 0x66, 0x0b,
+    0x00, 0x5d, 0x86, 0x66, 0x00, 0x67, 0xb4, 0x66, 0x07, 0x22, 0x00, 0x00, 0x0b, 0x32, 0x5a, 0x67,
+    0x65, 0x83, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x67, 0x9d, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xc4,
+    0x66, 0x00, 0x1d, 0x8f, 0x00, 0x01, 0x01, 0x0e, 0xb2, 0x66, 0x00, 0x67, 0x82, 0x66, 0x10, 0x36,
+    0x00, 0x1e, 0x67, 0x66, 0x67, 0x66, 0x5d, 0x06, 0x04, 0x01, 0x00, 0x1d, 0x57, 0x66, 0x66, 0x67,
+    0x84, 0x66, 0x00, 0x65, 0xba, 0x66, 0x02, 0x0d, 0x00, 0x5c, 0x87, 0x66, 0x00, 0x67, 0xb3, 0x66,
+    0x08, 0x5c, 0x35, 0x0e, 0x00, 0x00, 0x01, 0x1c, 0x46, 0x64, 0x8c, 0x66, 0x00, 0x67, 0x99, 0x66,
+    0x8d, 0x88, 0xff, 0x66, 0xc2, 0x66, 0x04, 0x67, 0x66, 0x22, 0x00, 0x08, 0x8c, 0x0b, 0x02, 0x09,
+    0x04, 0x10, 0xb1, 0x66, 0x00, 0x65, 0x83, 0x66, 0x02, 0x2a, 0x00, 0x3f, 0x84, 0x66, 0x03, 0x29,
+    0x00, 0x00, 0x35, 0x82, 0x66, 0x00, 0x65, 0x84, 0x66, 0x00, 0x65, 0xbb, 0x66, 0x04, 0x0c, 0x00,
+    0x5c, 0x66, 0x67, 0x87, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x0a, 0x67, 0x66, 0x66, 0x4b, 0x22, 0x02,
+    0x00, 0x00, 0x09, 0x30, 0x57, 0xa5, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x02, 0x22, 0x00,
+    0x4e, 0x8b, 0x66, 0x03, 0x67, 0x66, 0x66, 0x63, 0xb2, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x22,
+    0x00, 0x49, 0x84, 0x66, 0x05, 0x3a, 0x00, 0x14, 0x66, 0x66, 0x65, 0xbe, 0x66, 0x00, 0x67, 0x83,
+    0x66, 0x02, 0x0b, 0x00, 0x5c, 0x88, 0x66, 0x01, 0x67, 0x67, 0xb6, 0x66, 0x02, 0x5e, 0x37, 0x10,
+    0x82, 0x00, 0x02, 0x19, 0x41, 0x63, 0xa2, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xbf, 0x66, 0x00, 0x67,
+    0x82, 0x66, 0x04, 0x67, 0x21, 0x00, 0x49, 0x65, 0x86, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xba,
+    0x66, 0x02, 0x20, 0x01, 0x4a, 0x84, 0x66, 0x02, 0x3c, 0x00, 0x2b, 0x84, 0x66, 0x00, 0x67, 0xb9,
+    0x66, 0x0c, 0x65, 0x66, 0x65, 0x66, 0x67, 0x66, 0x66, 0x0c, 0x00, 0x5d, 0x66, 0x66, 0x65, 0x86,
+    0x66, 0x00, 0x67, 0xb9, 0x66, 0x08, 0x4e, 0x25, 0x04, 0x00, 0x00, 0x08, 0x2c, 0x53, 0x67, 0x9f,
+    0x66, 0x8d, 0x88, 0xff, 0x66, 0xc4, 0x66, 0x02, 0x1c, 0x00, 0x42, 0xc6, 0x66, 0x02, 0x22, 0x00,
+    0x4a, 0x84, 0x66, 0x02, 0x3d, 0x00, 0x30, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xbf, 0x66,
+    0x04, 0x0c, 0x00, 0x5d, 0x66, 0x67, 0x82, 0x66, 0x00, 0x65, 0xc0, 0x66, 0x02, 0x60, 0x3b, 0x12,
+    0x82, 0x00, 0x03, 0x16, 0x3e, 0x61, 0x65, 0x9c, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xbf, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x02, 0x52, 0x4a, 0x5d, 0xc2, 0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x22, 0x00,
+    0x4a, 0x84, 0x66, 0x02, 0x3b, 0x00, 0x2f, 0x85, 0x66, 0x00, 0x67, 0xb9, 0x66, 0x0b, 0x67, 0x66,
+    0x66, 0x67, 0x66, 0x66, 0x0c, 0x01, 0x5c, 0x66, 0x66, 0x67, 0x84, 0x66, 0x00, 0x65, 0xbc, 0x66,
+    0x00, 0x67, 0x82, 0x66, 0x07, 0x51, 0x28, 0x05, 0x00, 0x00, 0x05, 0x28, 0x50, 0x9b, 0x66, 0x8d,
+    0x88, 0xff, 0x66, 0xc5, 0x66, 0x00, 0x65, 0xc0, 0x66, 0x00, 0x65, 0x82, 0x66, 0x0d, 0x65, 0x66,
+    0x66, 0x22, 0x00, 0x4b, 0x66, 0x65, 0x67, 0x66, 0x66, 0x3c, 0x00, 0x30, 0x85, 0x66, 0x00, 0x64,
+    0xb9, 0x66, 0x08, 0x65, 0x66, 0x66, 0x65, 0x66, 0x67, 0x0c, 0x00, 0x5c, 0xc5, 0x66, 0x01, 0x65,
+    0x65, 0x83, 0x66, 0x02, 0x62, 0x3d, 0x15, 0x82, 0x00, 0x01, 0x12, 0x48, 0x99, 0x66, 0x8d, 0x88,
+    0xff, 0x66, 0xc0, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xc4, 0x66, 0x00, 0x67, 0x82, 0x66,
+    0x03, 0x22, 0x00, 0x48, 0x63, 0x83, 0x64, 0x02, 0x3b, 0x00, 0x2e, 0x83, 0x64, 0x08, 0x63, 0x62,
+    0x5d, 0x55, 0x66, 0x65, 0x66, 0x65, 0x65, 0xb1, 0x66, 0x02, 0x5a, 0x58, 0x5f, 0x84, 0x61, 0x03,
+    0x0b, 0x00, 0x58, 0x62, 0x83, 0x61, 0x02, 0x5f, 0x5a, 0x53, 0xbc, 0x66, 0x00, 0x65, 0x86, 0x66,
+    0x06, 0x65, 0x66, 0x53, 0x2b, 0x06, 0x00, 0x2b, 0x99, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xc1, 0x66,
+    0x05, 0x65, 0x66, 0x67, 0x66, 0x66, 0x65, 0xc6, 0x66, 0x00, 0x21, 0x82, 0x00, 0x03, 0x01, 0x00,
+    0x00, 0x01, 0x89, 0x00, 0x00, 0x0e, 0x83, 0x66, 0x00, 0x67, 0xb1, 0x66, 0x00, 0x21, 0x87, 0x00,
+    0x00, 0x01, 0x85, 0x00, 0x05, 0x01, 0x00, 0x0e, 0x66, 0x66, 0x65, 0xba, 0x66, 0x00, 0x65, 0x83,
+    0x66, 0x01, 0x65, 0x67, 0x83, 0x66, 0x02, 0x62, 0x3f, 0x41, 0x99, 0x66, 0x8d, 0x88, 0xff, 0x66,
+    0xbf, 0x66, 0x00, 0x65, 0xcd, 0x66, 0x00, 0x1d, 0x8c, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x0e,
+    0xb5, 0x66, 0x01, 0x67, 0x22, 0x8c, 0x00, 0x05, 0x01, 0x01, 0x00, 0x00, 0x0e, 0x67, 0xbc, 0x66,
+    0x00, 0x65, 0x88, 0x66, 0x00, 0x65, 0x9c, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0x8e, 0x66,
+    0x04, 0x56, 0x4e, 0x57, 0x5c, 0x5b, 0x88, 0x5c, 0x04, 0x5b, 0x5c, 0x5a, 0x55, 0x52, 0x84, 0x66,
+    0x00, 0x65, 0xb0, 0x66, 0x06, 0x53, 0x53, 0x5a, 0x5c, 0x5b, 0x5d, 0x5b, 0x88, 0x5c, 0x05, 0x5a,
+    0x56, 0x52, 0x66, 0x66, 0x65, 0xba, 0x66, 0x04, 0x67, 0x66, 0x67, 0x66, 0x65, 0x84, 0x66, 0x02,
+    0x65, 0x66, 0x67, 0x9a, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0x95, 0x66, 0x00, 0x65, 0x85,
+    0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0x85, 0x66, 0x00, 0x67, 0xb6, 0x66, 0x01, 0x65, 0x65, 0x86,
+    0x66, 0x02, 0x65, 0x66, 0x67, 0xc4, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0x9d, 0x66, 0x8d, 0x88,
+    0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xe8, 0x66,
+    0x00, 0x65, 0x83, 0x66, 0x00, 0x65, 0xe2, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdb, 0x66,
+    0x00, 0x65, 0xf4, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xda, 0x66, 0x00, 0x67, 0xf5, 0x66,
+    0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xdc, 0x66, 0x00, 0x65, 0x8b, 0x66, 0x03, 0x67, 0x66, 0x66,
+    0x67, 0xe3, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xd9, 0x66, 0x00, 0x67, 0xf6, 0x66, 0x8d,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xdc, 0x66, 0x00, 0x67, 0xf3, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xd9, 0x66, 0x00, 0x65, 0xf6, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1,
+    0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1,
+    0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff,
+    0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d,
+    0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff,
+    0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff, 0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0xff,
+    0x66, 0xff, 0x66, 0xff, 0x66, 0xd1, 0x66, 0x8d, 0x88, 0x83, 0x66, 0x00, 0x67, 0xd8, 0x66, 0x01,
+    0x65, 0x65, 0xc1, 0x66, 0x00, 0x65, 0xc7, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x65, 0xca, 0x66,
+    0x00, 0x65, 0xc5, 0x66, 0x00, 0x67, 0x88, 0x66, 0x00, 0x67, 0xc4, 0x66, 0x8d, 0x88, 0x03, 0x66,
+    0x66, 0x65, 0x67, 0xe1, 0x66, 0x00, 0x67, 0xb8, 0x66, 0x03, 0x65, 0x66, 0x66, 0x67, 0xca, 0x66,
+    0x04, 0x65, 0x67, 0x66, 0x66, 0x65, 0x82, 0x66, 0x00, 0x67, 0x83, 0x66, 0x00, 0x67, 0xc1, 0x66,
+    0x00, 0x65, 0x83, 0x66, 0x03, 0x67, 0x66, 0x66, 0x65, 0xba, 0x66, 0x00, 0x67, 0xc4, 0x66, 0x00,
+    0x67, 0x83, 0x66, 0x06, 0x65, 0x66, 0x65, 0x66, 0x88, 0x88, 0x87, 0x8a, 0x88, 0x00, 0x65, 0xd8,
+    0x66, 0x02, 0x67, 0x66, 0x67, 0x82, 0x66, 0x00, 0x65, 0x85, 0x66, 0x00, 0x67, 0xb8, 0x66, 0x02,
+    0x67, 0x66, 0x65, 0x82, 0x66, 0x00, 0x65, 0xc6, 0x66, 0x04, 0x65, 0x66, 0x66, 0x65, 0x67, 0xff,
+    0x66, 0x8b, 0x66, 0x00, 0x67, 0x88, 0x66, 0x03, 0x65, 0x66, 0x66, 0x65, 0xba, 0x66, 0x08, 0x65,
+    0x65, 0x66, 0x65, 0x66, 0x65, 0x66, 0x67, 0x66, 0x8d, 0x88, 0x00, 0x69, 0xdd, 0x66, 0x03, 0x68,
+    0x69, 0x66, 0x65, 0xbe, 0x66, 0x00, 0x65, 0x85, 0x66, 0x01, 0x68, 0x69, 0xc4, 0x66, 0x04, 0x67,
+    0x66, 0x66, 0x68, 0x69, 0x82, 0x66, 0x03, 0x65, 0x66, 0x66, 0x64, 0xbd, 0x66, 0x07, 0x65, 0x66,
+    0x66, 0x68, 0x69, 0x66, 0x66, 0x65, 0x84, 0x66, 0x00, 0x67, 0xbe, 0x66, 0x08, 0x68, 0x69, 0x66,
+    0x66, 0x65, 0x66, 0x66, 0x65, 0x67, 0xbc, 0x66, 0x00, 0x65, 0x82, 0x66, 0x00, 0x68, 0x8d, 0x88,
+    0x03, 0x6e, 0x66, 0x65, 0x65, 0xda, 0x66, 0x04, 0x70, 0x6e, 0x66, 0x66, 0x67, 0x82, 0x66, 0x00,
+    0x67, 0xb9, 0x66, 0x02, 0x67, 0x66, 0x67, 0x83, 0x66, 0x06, 0x70, 0x6e, 0x66, 0x67, 0x66, 0x66,
+    0x67, 0xbe, 0x66, 0x06, 0x67, 0x67, 0x66, 0x66, 0x70, 0x6e, 0x67, 0xc6, 0x66, 0x01, 0x70, 0x6f,
+    0x84, 0x66, 0x00, 0x67, 0xc1, 0x66, 0x07, 0x6e, 0x6d, 0x66, 0x66, 0x67, 0x66, 0x66, 0x65, 0xbb,
+    0x66, 0x00, 0x65, 0x82, 0x66, 0x02, 0x65, 0x66, 0x70, 0x82, 0x88, 0x00, 0x87, 0x89, 0x88, 0x00,
+    0x79, 0xdd, 0x66, 0x04, 0x79, 0x79, 0x66, 0x66, 0x65, 0xc4, 0x66, 0x04, 0x79, 0x7a, 0x66, 0x66,
+    0x67, 0xc4, 0x66, 0x04, 0x79, 0x78, 0x67, 0x66, 0x67, 0x82, 0x66, 0x01, 0x65, 0x67, 0xbf, 0x66,
+    0x01, 0x79, 0x79, 0x82, 0x66, 0x02, 0x65, 0x66, 0x67, 0xbe, 0x66, 0x0b, 0x65, 0x66, 0x66, 0x79,
+    0x79, 0x66, 0x67, 0x66, 0x67, 0x65, 0x66, 0x65, 0xc0, 0x66, 0x00, 0x79, 0x83, 0x88, 0x00, 0x87,
+    0x88, 0x88, 0x03, 0x7f, 0x75, 0x66, 0x65, 0xd6, 0x66, 0x09, 0x65, 0x66, 0x66, 0x74, 0x7e, 0x7f,
+    0x74, 0x66, 0x66, 0x67, 0xc0, 0x66, 0x05, 0x64, 0x65, 0x74, 0x7f, 0x80, 0x76, 0x82, 0x66, 0x00,
+    0x65, 0xba, 0x66, 0x01, 0x67, 0x67, 0x84, 0x66, 0x03, 0x74, 0x7f, 0x7f, 0x75, 0x88, 0x66, 0x00,
+    0x65, 0xb8, 0x66, 0x06, 0x67, 0x66, 0x66, 0x74, 0x7f, 0x7e, 0x75, 0x84, 0x66, 0x00, 0x67, 0xbc,
+    0x66, 0x06, 0x65, 0x66, 0x66, 0x74, 0x7e, 0x80, 0x74, 0x82, 0x66, 0x00, 0x65, 0xbc, 0x66, 0x01,
+    0x65, 0x68, 0x82, 0x66, 0x01, 0x74, 0x7e, 0x8d, 0x88, 0x05, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0x65,
+    0xd2, 0x66, 0x0b, 0x67, 0x66, 0x68, 0x6e, 0x7a, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0xbc,
+    0x66, 0x0d, 0x65, 0x66, 0x66, 0x69, 0x6e, 0x7b, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0x65,
+    0xbe, 0x66, 0x09, 0x67, 0x6e, 0x7a, 0x7f, 0x84, 0x85, 0x7f, 0x79, 0x6e, 0x68, 0x83, 0x66, 0x00,
+    0x65, 0xba, 0x66, 0x09, 0x67, 0x6d, 0x7a, 0x7f, 0x84, 0x84, 0x7e, 0x7a, 0x6e, 0x68, 0xbf, 0x66,
+    0x0b, 0x68, 0x6e, 0x7a, 0x80, 0x84, 0x84, 0x7f, 0x7a, 0x6d, 0x68, 0x66, 0x67, 0xb9, 0x66, 0x09,
+    0x65, 0x66, 0x67, 0x66, 0x68, 0x6e, 0x7b, 0x7f, 0x84, 0x87, 0x8c, 0x88,
+};
+
+const layout_image_t layout_us_active_atlas = {
+    .data = data,
+    .size = sizeof(data),
+    .width = 1280,
+    .height = 480,
+    .format = LAYOUT_IMAGE_FORMAT_RLE,
+};
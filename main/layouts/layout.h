@@ -6,11 +6,19 @@
 #pragma once
 #include "esp_lvgl_port.h"
 #include "hid_device_mouse.h"
+#include "keycap/keycap_renderer.h"
 #include <string.h>
 
+typedef enum {
+    LAYOUT_IMAGE_FORMAT_JPEG,  // Hardware decoded
+    LAYOUT_IMAGE_FORMAT_RLE,   // Palette RLE decoded by the CPU, see layout_rle.h
+} layout_image_format_t;
+
 typedef struct {
     const uint8_t *data;
     size_t size;
+    uint16_t width, height;  // Layout orientation, the image is stored rotated for the panel
+    layout_image_format_t format;
 } layout_image_t;
 
 typedef enum {
@@ -26,16 +34,30 @@ typedef struct {
     struct {
         uint16_t x, y, width, height;
     } region;
+    struct {
+        uint16_t x, y, width, height;  // Part of the region that changes when pressed, empty if nothing does
+        uint16_t atlas_x, atlas_y;     // Its pressed image in the active atlas
+    } sprite;
     union {
         uint32_t key;
         hid_device_mouse_button_t mouse_button;
     };
+    const char *label;  // UTF-8, NULL if none
 } layout_input_t;
 
+// Pressed inputs tinted over the base image instead of drawn from an atlas
+typedef struct {
+    uint32_t color;       // 0xRRGGBB
+    uint8_t alpha;
+    uint8_t fade_frames;  // Frames to reach alpha, 0 draws it right away
+} layout_highlight_t;
+
 typedef struct {
     const char *title;
     const layout_image_t *base_image;
-    const layout_image_t *active_image;
+    const layout_image_t *active_atlas;  // NULL with a highlight
+    const keycap_style_t *style;  // Drawn by keycap_renderer instead, both images NULL
+    const layout_highlight_t *highlight;
     const layout_input_t *inputs;
     size_t count;
 } layout_config_t;
@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "layout_dirty.h"
+#include <string.h>
+
+bool layout_dirty_merge(layout_dirty_t *a, const layout_dirty_t *b) {
+    if (a->image != b->image || a->alpha != b->alpha) return false;
+    bsp_point_t offset = { a->source.x - a->rect.origin.x, a->source.y - a->rect.origin.y };
+    if (b->source.x - b->rect.origin.x != offset.x || b->source.y - b->rect.origin.y != offset.y) return false;
+
+    bsp_rect_t overlap = bsp_rect_intersection(a->rect, b->rect);
+    if (overlap.size.width < 0 || overlap.size.height < 0) return false;  // Neither overlapping nor adjacent
+
+    bsp_rect_t merged = bsp_rect_union(a->rect, b->rect);
+    if (bsp_rect_area(merged) != bsp_rect_area(a->rect) + bsp_rect_area(b->rect) - bsp_rect_area(overlap)) return false;
+
+    a->rect = merged;
+    a->source = (bsp_point_t){ merged.origin.x + offset.x, merged.origin.y + offset.y };
+    return true;
+}
+
+int layout_dirty_compact(layout_dirty_t *dirty, int dirty_num) {
+    bool merged;
+    do {
+        merged = false;
+        for (int i = 0; i < dirty_num; i++) {
+            for (int j = i + 1; j < dirty_num; j++) {
+                if (!layout_dirty_merge(&dirty[i], &dirty[j])) continue;
+                memmove(&dirty[j], &dirty[j + 1], (dirty_num - j - 1) * sizeof(*dirty));  // Keep drawing order
+                dirty_num--;
+                j--;
+                merged = true;
+            }
+        }
+    } while (merged);
+    return dirty_num;
+}
@@ -0,0 +1,38 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include "misc/bsp_display.h"
+
+// Dirty rect list of a layout frame and the mapping of layout rects onto the
+// panel. Only the geometry lives here, the display mux draws the list with
+// the PPA. Has no dependencies besides bsp_display.h so it also builds on a
+// host.
+struct display_mux_layout_bitmap;
+
+typedef struct {
+    const struct display_mux_layout_bitmap *image;  // Never dereferenced here, rects only merge within one image
+    bsp_point_t source;
+    bsp_rect_t rect;
+    uint8_t alpha;  // Tints the image with the layout's highlight when non zero
+} layout_dirty_t;
+
+// Merges b into a when both come from the same image with the same offset and
+// alpha, and their union is exactly a rectangle, so the merged blit never
+// touches pixels outside them.
+bool layout_dirty_merge(layout_dirty_t *a, const layout_dirty_t *b);
+// Merges until no pair can be, keeping the drawing order, returns the new count
+int layout_dirty_compact(layout_dirty_t *dirty, int dirty_num);
+
+// Layout images and rects are in landscape layout space, the panel and the
+// decoded images are portrait. image_width is the landscape width.
+static inline bsp_rect_t layout_dirty_panel_rect(bsp_rect_t rect, int image_width) {
+    return (bsp_rect_t){
+        .origin = { rect.origin.y, image_width - bsp_rect_max_x(rect) },
+        .size = { rect.size.height, rect.size.width },
+    };
+}
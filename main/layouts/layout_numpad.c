@@ -0,0 +1,47 @@
+#pragma once
+#include "hid_device_key.h"
+#include "layout.h"
+
+static const layout_input_t layout_inputs[] = {
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 0, 160, 144 }, .sprite = { 2, 2, 156, 140, 2, 2 }, .key = HID_DEVICE_KEY_NUM_LOCK, .label = "Num" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 160, 0, 160, 144 }, .sprite = { 162, 2, 156, 140, 162, 2 }, .key = HID_DEVICE_KEY_KP_SLASH, .label = "/" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 320, 0, 160, 144 }, .sprite = { 322, 2, 156, 140, 322, 2 }, .key = HID_DEVICE_KEY_KP_ASTERISK, .label = "*" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 480, 0, 160, 144 }, .sprite = { 482, 2, 156, 140, 482, 2 }, .key = HID_DEVICE_KEY_KP_MINUS, .label = "-" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 144, 160, 144 }, .sprite = { 2, 146, 156, 140, 2, 146 }, .key = HID_DEVICE_KEY_KP_7, .label = "7" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 160, 144, 160, 144 }, .sprite = { 162, 146, 156, 140, 162, 146 }, .key = HID_DEVICE_KEY_KP_8, .label = "8" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 320, 144, 160, 144 }, .sprite = { 322, 146, 156, 140, 322, 146 }, .key = HID_DEVICE_KEY_KP_9, .label = "9" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 480, 144, 160, 288 }, .sprite = { 482, 146, 156, 284, 482, 146 }, .key = HID_DEVICE_KEY_KP_PLUS, .label = "+" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 288, 160, 144 }, .sprite = { 2, 290, 156, 140, 2, 290 }, .key = HID_DEVICE_KEY_KP_4, .label = "4" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 160, 288, 160, 144 }, .sprite = { 162, 290, 156, 140, 162, 290 }, .key = HID_DEVICE_KEY_KP_5, .label = "5" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 320, 288, 160, 144 }, .sprite = { 322, 290, 156, 140, 322, 290 }, .key = HID_DEVICE_KEY_KP_6, .label = "6" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 432, 160, 144 }, .sprite = { 2, 434, 156, 140, 2, 434 }, .key = HID_DEVICE_KEY_KP_1, .label = "1" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 160, 432, 160, 144 }, .sprite = { 162, 434, 156, 140, 162, 434 }, .key = HID_DEVICE_KEY_KP_2, .label = "2" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 320, 432, 160, 144 }, .sprite = { 322, 434, 156, 140, 322, 434 }, .key = HID_DEVICE_KEY_KP_3, .label = "3" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 480, 432, 160, 288 }, .sprite = { 482, 434, 156, 284, 482, 434 }, .key = HID_DEVICE_KEY_KP_ENTER, .label = "Enter" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 576, 320, 144 }, .sprite = { 2, 578, 316, 140, 2, 578 }, .key = HID_DEVICE_KEY_KP_0, .label = "0" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 320, 576, 160, 144 }, .sprite = { 322, 578, 156, 140, 322, 578 }, .key = HID_DEVICE_KEY_KP_DOT, .label = "." },
+    { .type = LAYOUT_INPUT_TYPE_TRACKPAD, .region = { 680, 20, 580, 540 } },
+    { .type = LAYOUT_INPUT_TYPE_MOUSE_BUTTON, .region = { 680, 580, 290, 120 }, .sprite = { 682, 582, 286, 116, 682, 582 }, .mouse_button = HID_DEVICE_MOUSE_BUTTON_LEFT },
+    { .type = LAYOUT_INPUT_TYPE_MOUSE_BUTTON, .region = { 970, 580, 290, 120 }, .sprite = { 972, 582, 286, 116, 972, 582 }, .mouse_button = HID_DEVICE_MOUSE_BUTTON_RIGHT },
+};
+static const keycap_style_t layout_style = {
+    .background = 0x000000,
+    .key = 0x333333,
+    .key_pressed = 0x999999,
+    .border = 0x666666,
+    .text = 0xffffff,
+    .inset = 2,
+};
+static const layout_highlight_t layout_highlight = {
+    .color = 0xffffff,
+    .alpha = 102,
+    .fade_frames = 3,
+};
+static const layout_config_t layout_config = {
+    .title = "2. Numpad",
+    .style = &layout_style,
+    .highlight = &layout_highlight,
+    .inputs = layout_inputs,
+    .count = 20,
+};
+LAYOUT_REGISTER(layout_config)
@@ -0,0 +1,37 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "layout_rle.h"
+
+size_t layout_rle_decode(const uint8_t *data, size_t size, uint16_t *out, size_t out_pixels) {
+    if (size < 2) return 0;
+    size_t color_num = data[0] | data[1] << 8;
+    if (color_num == 0 || color_num > 256 || size < 2 + color_num * 2) return 0;
+
+    // Unused entries stay black, so indices never need a range check
+    uint16_t palette[256] = {};
+    for (size_t i = 0; i < color_num; i++) {
+        palette[i] = data[2 + i * 2] | data[3 + i * 2] << 8;
+    }
+
+    const uint8_t *p = data + 2 + color_num * 2, *end = data + size;
+    uint16_t *dst = out, *dst_end = out + out_pixels;
+    while (p < end) {
+        uint8_t control = *p++;
+        size_t n = (control & 0x7f) + 1;
+        if ((size_t)(dst_end - dst) < n) return 0;
+        if (control & 0x80) {
+            if (p == end) return 0;
+            uint16_t color = palette[*p++];
+            for (size_t i = 0; i < n; i++) dst[i] = color;
+        } else {
+            if ((size_t)(end - p) < n) return 0;
+            for (size_t i = 0; i < n; i++) dst[i] = palette[p[i]];
+            p += n;
+        }
+        dst += n;
+    }
+    return dst - out;
+}
@@ -0,0 +1,22 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Palette RLE layout images, for flat colored artwork. Little endian:
+//
+//   uint16_t color_num;              // 1 to 256
+//   uint16_t palette[color_num];     // RGB565
+//   uint8_t  stream[];               // PackBits of palette indices, rows back to back
+//
+// A stream control byte n is followed by n + 1 literal indices (0x00-0x7f),
+// or by one index repeated (n & 0x7f) + 1 times (0x80-0xff). Pixels are in the
+// stored (panel) orientation, like the JPEG images.
+//
+// Decodes to RGB565 and returns the number of pixels written, 0 if the data
+// is corrupt or does not fit. Has no dependencies so it also builds on a host.
+size_t layout_rle_decode(const uint8_t *data, size_t size, uint16_t *out, size_t out_pixels);
@@ -3,95 +3,95 @@
 #include "layout.h"
 
 extern const layout_image_t layout_us_normal;
-extern const layout_image_t layout_us_active;
+extern const layout_image_t layout_us_active_atlas;
 
 static const layout_input_t layout_inputs[] = {
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 0, 92, 60 }, .key = HID_DEVICE_KEY_ESCAPE },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 92, 0, 91, 60 }, .key = HID_DEVICE_KEY_F1 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 183, 0, 92, 60 }, .key = HID_DEVICE_KEY_F2 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 275, 0, 91, 60 }, .key = HID_DEVICE_KEY_F3 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 366, 0, 91, 60 }, .key = HID_DEVICE_KEY_F4 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 457, 0, 92, 60 }, .key = HID_DEVICE_KEY_F5 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 549, 0, 91, 60 }, .key = HID_DEVICE_KEY_F6 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 640, 0, 91, 60 }, .key = HID_DEVICE_KEY_F7 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 731, 0, 92, 60 }, .key = HID_DEVICE_KEY_F8 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 823, 0, 91, 60 }, .key = HID_DEVICE_KEY_F9 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 914, 0, 91, 60 }, .key = HID_DEVICE_KEY_F10 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1005, 0, 92, 60 }, .key = HID_DEVICE_KEY_F11 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1097, 0, 91, 60 }, .key = HID_DEVICE_KEY_F12 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1188, 0, 92, 60 }, .key = HID_DEVICE_KEY_DELETE },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 60, 89, 80 }, .key = HID_DEVICE_KEY_GRAVE },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 89, 60, 89, 80 }, .key = HID_DEVICE_KEY_1 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 178, 60, 89, 80 }, .key = HID_DEVICE_KEY_2 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 267, 60, 89, 80 }, .key = HID_DEVICE_KEY_3 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 356, 60, 89, 80 }, .key = HID_DEVICE_KEY_4 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 445, 60, 89, 80 }, .key = HID_DEVICE_KEY_5 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 534, 60, 89, 80 }, .key = HID_DEVICE_KEY_6 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 623, 60, 89, 80 }, .key = HID_DEVICE_KEY_7 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 712, 60, 89, 80 }, .key = HID_DEVICE_KEY_8 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 801, 60, 89, 80 }, .key = HID_DEVICE_KEY_9 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 890, 60, 89, 80 }, .key = HID_DEVICE_KEY_0 },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 979, 60, 89, 80 }, .key = HID_DEVICE_KEY_MINUS },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1068, 60, 89, 80 }, .key = HID_DEVICE_KEY_EQUAL },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1157, 60, 123, 80 }, .key = HID_DEVICE_KEY_BACKSPACE },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 140, 123, 80 }, .key = HID_DEVICE_KEY_TAB },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 123, 140, 89, 80 }, .key = HID_DEVICE_KEY_Q },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 212, 140, 89, 80 }, .key = HID_DEVICE_KEY_W },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 301, 140, 89, 80 }, .key = HID_DEVICE_KEY_E },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 390, 140, 89, 80 }, .key = HID_DEVICE_KEY_R },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 479, 140, 89, 80 }, .key = HID_DEVICE_KEY_T },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 568, 140, 89, 80 }, .key = HID_DEVICE_KEY_Y },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 657, 140, 89, 80 }, .key = HID_DEVICE_KEY_U },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 746, 140, 89, 80 }, .key = HID_DEVICE_KEY_I },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 835, 140, 89, 80 }, .key = HID_DEVICE_KEY_O },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 924, 140, 89, 80 }, .key = HID_DEVICE_KEY_P },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1013, 140, 89, 80 }, .key = HID_DEVICE_KEY_LEFT_BRACKET },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1102, 140, 89, 80 }, .key = HID_DEVICE_KEY_RIGHT_BRACKET },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1191, 140, 89, 80 }, .key = HID_DEVICE_KEY_BACKSLASH },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 220, 150, 80 }, .key = HID_DEVICE_KEY_CAPS_LOCK },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 150, 220, 89, 80 }, .key = HID_DEVICE_KEY_A },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 239, 220, 89, 80 }, .key = HID_DEVICE_KEY_S },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 328, 220, 89, 80 }, .key = HID_DEVICE_KEY_D },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 417, 220, 89, 80 }, .key = HID_DEVICE_KEY_F },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 506, 220, 89, 80 }, .key = HID_DEVICE_KEY_G },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 595, 220, 89, 80 }, .key = HID_DEVICE_KEY_H },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 684, 220, 89, 80 }, .key = HID_DEVICE_KEY_J },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 773, 220, 89, 80 }, .key = HID_DEVICE_KEY_K },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 862, 220, 89, 80 }, .key = HID_DEVICE_KEY_L },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 951, 220, 89, 80 }, .key = HID_DEVICE_KEY_SEMICOLON },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1040, 220, 89, 80 }, .key = HID_DEVICE_KEY_QUOTE },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1129, 220, 151, 80 }, .key = HID_DEVICE_KEY_ENTER },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 300, 195, 80 }, .key = HID_DEVICE_KEY_LEFT_SHIFT },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 195, 300, 89, 80 }, .key = HID_DEVICE_KEY_Z },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 284, 300, 89, 80 }, .key = HID_DEVICE_KEY_X },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 373, 300, 89, 80 }, .key = HID_DEVICE_KEY_C },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 462, 300, 89, 80 }, .key = HID_DEVICE_KEY_V },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 551, 300, 89, 80 }, .key = HID_DEVICE_KEY_B },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 640, 300, 89, 80 }, .key = HID_DEVICE_KEY_N },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 729, 300, 89, 80 }, .key = HID_DEVICE_KEY_M },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 818, 300, 89, 80 }, .key = HID_DEVICE_KEY_COMMA },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 907, 300, 89, 80 }, .key = HID_DEVICE_KEY_DOT },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 996, 300, 89, 80 }, .key = HID_DEVICE_KEY_SLASH },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1085, 300, 195, 80 }, .key = HID_DEVICE_KEY_RIGHT_SHIFT },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 380, 112, 80 }, .key = HID_DEVICE_KEY_LEFT_CTRL },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 112, 380, 112, 80 }, .key = HID_DEVICE_KEY_LEFT_GUI },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 224, 380, 112, 80 }, .key = HID_DEVICE_KEY_LEFT_ALT },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 336, 380, 608, 80 }, .key = HID_DEVICE_KEY_SPACE },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 944, 380, 112, 80 }, .key = HID_DEVICE_KEY_RIGHT_ALT },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1056, 380, 112, 80 }, .key = HID_DEVICE_KEY_RIGHT_GUI },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1168, 380, 112, 80 }, .key = HID_DEVICE_KEY_RIGHT_CTRL },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 916, 619, 114, 81 }, .key = HID_DEVICE_KEY_LEFT },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1146, 619, 114, 81 }, .key = HID_DEVICE_KEY_RIGHT },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1030, 539, 116, 80 }, .key = HID_DEVICE_KEY_UP },
-    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1030, 620, 116, 80 }, .key = HID_DEVICE_KEY_DOWN },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 0, 92, 60 }, .sprite = { 3, 3, 86, 54, 83, 392 }, .key = HID_DEVICE_KEY_ESCAPE, .label = "ESC" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 92, 0, 91, 60 }, .sprite = { 95, 3, 85, 54, 599, 392 }, .key = HID_DEVICE_KEY_F1, .label = "F1" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 183, 0, 92, 60 }, .sprite = { 186, 3, 86, 54, 169, 392 }, .key = HID_DEVICE_KEY_F2, .label = "F2" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 275, 0, 91, 60 }, .sprite = { 278, 3, 85, 54, 684, 392 }, .key = HID_DEVICE_KEY_F3, .label = "F3" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 366, 0, 91, 60 }, .sprite = { 369, 3, 85, 54, 769, 392 }, .key = HID_DEVICE_KEY_F4, .label = "F4" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 457, 0, 92, 60 }, .sprite = { 460, 3, 86, 54, 255, 392 }, .key = HID_DEVICE_KEY_F5, .label = "F5" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 549, 0, 91, 60 }, .sprite = { 552, 3, 85, 54, 854, 392 }, .key = HID_DEVICE_KEY_F6, .label = "F6" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 640, 0, 91, 60 }, .sprite = { 643, 3, 85, 54, 939, 392 }, .key = HID_DEVICE_KEY_F7, .label = "F7" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 731, 0, 92, 60 }, .sprite = { 734, 3, 86, 54, 341, 392 }, .key = HID_DEVICE_KEY_F8, .label = "F8" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 823, 0, 91, 60 }, .sprite = { 826, 3, 85, 54, 1024, 392 }, .key = HID_DEVICE_KEY_F9, .label = "F9" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 914, 0, 91, 60 }, .sprite = { 917, 3, 85, 54, 1109, 392 }, .key = HID_DEVICE_KEY_F10, .label = "F10" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1005, 0, 92, 60 }, .sprite = { 1008, 3, 86, 54, 427, 392 }, .key = HID_DEVICE_KEY_F11, .label = "F11" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1097, 0, 91, 60 }, .sprite = { 1100, 3, 85, 54, 1194, 392 }, .key = HID_DEVICE_KEY_F12, .label = "F12" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1188, 0, 92, 60 }, .sprite = { 1191, 3, 86, 54, 513, 392 }, .key = HID_DEVICE_KEY_DELETE, .label = "DEL" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 60, 89, 80 }, .sprite = { 3, 63, 83, 74, 1154, 96 }, .key = HID_DEVICE_KEY_GRAVE, .label = "`" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 89, 60, 89, 80 }, .sprite = { 92, 63, 83, 74, 0, 170 }, .key = HID_DEVICE_KEY_1, .label = "1" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 178, 60, 89, 80 }, .sprite = { 181, 63, 83, 74, 83, 170 }, .key = HID_DEVICE_KEY_2, .label = "2" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 267, 60, 89, 80 }, .sprite = { 270, 63, 83, 74, 166, 170 }, .key = HID_DEVICE_KEY_3, .label = "3" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 356, 60, 89, 80 }, .sprite = { 359, 63, 83, 74, 249, 170 }, .key = HID_DEVICE_KEY_4, .label = "4" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 445, 60, 89, 80 }, .sprite = { 448, 63, 83, 74, 332, 170 }, .key = HID_DEVICE_KEY_5, .label = "5" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 534, 60, 89, 80 }, .sprite = { 537, 63, 83, 74, 415, 170 }, .key = HID_DEVICE_KEY_6, .label = "6" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 623, 60, 89, 80 }, .sprite = { 626, 63, 83, 74, 498, 170 }, .key = HID_DEVICE_KEY_7, .label = "7" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 712, 60, 89, 80 }, .sprite = { 715, 63, 83, 74, 581, 170 }, .key = HID_DEVICE_KEY_8, .label = "8" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 801, 60, 89, 80 }, .sprite = { 804, 63, 83, 74, 664, 170 }, .key = HID_DEVICE_KEY_9, .label = "9" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 890, 60, 89, 80 }, .sprite = { 893, 63, 83, 74, 747, 170 }, .key = HID_DEVICE_KEY_0, .label = "0" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 979, 60, 89, 80 }, .sprite = { 982, 63, 83, 74, 830, 170 }, .key = HID_DEVICE_KEY_MINUS, .label = "-" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1068, 60, 89, 80 }, .sprite = { 1071, 63, 83, 74, 913, 170 }, .key = HID_DEVICE_KEY_EQUAL, .label = "=" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1157, 60, 123, 80 }, .sprite = { 1160, 63, 117, 74, 602, 96 }, .key = HID_DEVICE_KEY_BACKSPACE, .label = "Back" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 140, 123, 80 }, .sprite = { 3, 143, 117, 74, 719, 96 }, .key = HID_DEVICE_KEY_TAB, .label = "Tab" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 123, 140, 89, 80 }, .sprite = { 126, 143, 83, 74, 996, 170 }, .key = HID_DEVICE_KEY_Q, .label = "Q" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 212, 140, 89, 80 }, .sprite = { 215, 143, 83, 74, 1079, 170 }, .key = HID_DEVICE_KEY_W, .label = "W" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 301, 140, 89, 80 }, .sprite = { 304, 143, 83, 74, 1162, 170 }, .key = HID_DEVICE_KEY_E, .label = "E" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 390, 140, 89, 80 }, .sprite = { 393, 143, 83, 74, 0, 244 }, .key = HID_DEVICE_KEY_R, .label = "R" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 479, 140, 89, 80 }, .sprite = { 482, 143, 83, 74, 83, 244 }, .key = HID_DEVICE_KEY_T, .label = "T" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 568, 140, 89, 80 }, .sprite = { 571, 143, 83, 74, 166, 244 }, .key = HID_DEVICE_KEY_Y, .label = "Y" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 657, 140, 89, 80 }, .sprite = { 660, 143, 83, 74, 249, 244 }, .key = HID_DEVICE_KEY_U, .label = "U" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 746, 140, 89, 80 }, .sprite = { 749, 143, 83, 74, 332, 244 }, .key = HID_DEVICE_KEY_I, .label = "I" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 835, 140, 89, 80 }, .sprite = { 838, 143, 83, 74, 415, 244 }, .key = HID_DEVICE_KEY_O, .label = "O" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 924, 140, 89, 80 }, .sprite = { 927, 143, 83, 74, 498, 244 }, .key = HID_DEVICE_KEY_P, .label = "P" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1013, 140, 89, 80 }, .sprite = { 1016, 143, 83, 74, 581, 244 }, .key = HID_DEVICE_KEY_LEFT_BRACKET, .label = "[" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1102, 140, 89, 80 }, .sprite = { 1105, 143, 83, 74, 664, 244 }, .key = HID_DEVICE_KEY_RIGHT_BRACKET, .label = "]" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1191, 140, 89, 80 }, .sprite = { 1194, 143, 83, 74, 747, 244 }, .key = HID_DEVICE_KEY_BACKSLASH, .label = "\\" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 220, 150, 80 }, .sprite = { 3, 223, 144, 74, 1114, 0 }, .key = HID_DEVICE_KEY_CAPS_LOCK, .label = "Caps" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 150, 220, 89, 80 }, .sprite = { 153, 223, 83, 74, 830, 244 }, .key = HID_DEVICE_KEY_A, .label = "A" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 239, 220, 89, 80 }, .sprite = { 242, 223, 83, 74, 913, 244 }, .key = HID_DEVICE_KEY_S, .label = "S" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 328, 220, 89, 80 }, .sprite = { 331, 223, 83, 74, 996, 244 }, .key = HID_DEVICE_KEY_D, .label = "D" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 417, 220, 89, 80 }, .sprite = { 420, 223, 83, 74, 1079, 244 }, .key = HID_DEVICE_KEY_F, .label = "F" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 506, 220, 89, 80 }, .sprite = { 509, 223, 83, 74, 1162, 244 }, .key = HID_DEVICE_KEY_G, .label = "G" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 595, 220, 89, 80 }, .sprite = { 598, 223, 83, 74, 0, 318 }, .key = HID_DEVICE_KEY_H, .label = "H" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 684, 220, 89, 80 }, .sprite = { 687, 223, 83, 74, 83, 318 }, .key = HID_DEVICE_KEY_J, .label = "J" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 773, 220, 89, 80 }, .sprite = { 776, 223, 83, 74, 166, 318 }, .key = HID_DEVICE_KEY_K, .label = "K" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 862, 220, 89, 80 }, .sprite = { 865, 223, 83, 74, 249, 318 }, .key = HID_DEVICE_KEY_L, .label = "L" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 951, 220, 89, 80 }, .sprite = { 954, 223, 83, 74, 332, 318 }, .key = HID_DEVICE_KEY_SEMICOLON, .label = ";" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1040, 220, 89, 80 }, .sprite = { 1043, 223, 83, 74, 415, 318 }, .key = HID_DEVICE_KEY_QUOTE, .label = "'" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1129, 220, 151, 80 }, .sprite = { 1132, 223, 145, 74, 969, 0 }, .key = HID_DEVICE_KEY_ENTER, .label = "Enter" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 300, 195, 80 }, .sprite = { 3, 303, 189, 74, 780, 0 }, .key = HID_DEVICE_KEY_LEFT_SHIFT, .label = "Shift" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 195, 300, 89, 80 }, .sprite = { 198, 303, 83, 74, 498, 318 }, .key = HID_DEVICE_KEY_Z, .label = "Z" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 284, 300, 89, 80 }, .sprite = { 287, 303, 83, 74, 581, 318 }, .key = HID_DEVICE_KEY_X, .label = "X" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 373, 300, 89, 80 }, .sprite = { 376, 303, 83, 74, 664, 318 }, .key = HID_DEVICE_KEY_C, .label = "C" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 462, 300, 89, 80 }, .sprite = { 465, 303, 83, 74, 747, 318 }, .key = HID_DEVICE_KEY_V, .label = "V" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 551, 300, 89, 80 }, .sprite = { 554, 303, 83, 74, 830, 318 }, .key = HID_DEVICE_KEY_B, .label = "B" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 640, 300, 89, 80 }, .sprite = { 643, 303, 83, 74, 913, 318 }, .key = HID_DEVICE_KEY_N, .label = "N" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 729, 300, 89, 80 }, .sprite = { 732, 303, 83, 74, 996, 318 }, .key = HID_DEVICE_KEY_M, .label = "M" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 818, 300, 89, 80 }, .sprite = { 821, 303, 83, 74, 1079, 318 }, .key = HID_DEVICE_KEY_COMMA, .label = "," },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 907, 300, 89, 80 }, .sprite = { 910, 303, 83, 74, 1162, 318 }, .key = HID_DEVICE_KEY_DOT, .label = "." },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 996, 300, 89, 80 }, .sprite = { 999, 303, 83, 74, 0, 392 }, .key = HID_DEVICE_KEY_SLASH, .label = "/" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1085, 300, 195, 80 }, .sprite = { 1088, 303, 189, 74, 780, 0 }, .key = HID_DEVICE_KEY_RIGHT_SHIFT, .label = "Shift" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 0, 380, 112, 80 }, .sprite = { 3, 383, 106, 74, 836, 96 }, .key = HID_DEVICE_KEY_LEFT_CTRL, .label = "Ctrl" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 112, 380, 112, 80 }, .sprite = { 115, 383, 106, 74, 942, 96 }, .key = HID_DEVICE_KEY_LEFT_GUI, .label = "Win" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 224, 380, 112, 80 }, .sprite = { 227, 383, 106, 74, 1048, 96 }, .key = HID_DEVICE_KEY_LEFT_ALT, .label = "Alt" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 336, 380, 608, 80 }, .sprite = { 339, 383, 602, 74, 0, 96 }, .key = HID_DEVICE_KEY_SPACE },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 944, 380, 112, 80 }, .sprite = { 947, 383, 106, 74, 1048, 96 }, .key = HID_DEVICE_KEY_RIGHT_ALT, .label = "Alt" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1056, 380, 112, 80 }, .sprite = { 1059, 383, 106, 74, 942, 96 }, .key = HID_DEVICE_KEY_RIGHT_GUI, .label = "Win" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1168, 380, 112, 80 }, .sprite = { 1171, 383, 106, 74, 836, 96 }, .key = HID_DEVICE_KEY_RIGHT_CTRL, .label = "Ctrl" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 916, 619, 114, 81 }, .sprite = { 917, 620, 110, 79, 340, 0 }, .key = HID_DEVICE_KEY_LEFT, .label = "◀" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1146, 619, 114, 81 }, .sprite = { 1149, 620, 110, 79, 450, 0 }, .key = HID_DEVICE_KEY_RIGHT, .label = "▶" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1030, 539, 116, 80 }, .sprite = { 1033, 540, 110, 79, 560, 0 }, .key = HID_DEVICE_KEY_UP, .label = "▲" },
+    { .type = LAYOUT_INPUT_TYPE_KEY, .region = { 1030, 620, 116, 80 }, .sprite = { 1033, 620, 110, 79, 670, 0 }, .key = HID_DEVICE_KEY_DOWN, .label = "▼" },
     { .type = LAYOUT_INPUT_TYPE_TRACKPAD, .region = { 384, 460, 512, 260 } },
-    { .type = LAYOUT_INPUT_TYPE_MOUSE_BUTTON, .region = { 20, 600, 172, 100 }, .mouse_button = HID_DEVICE_MOUSE_BUTTON_LEFT },
-    { .type = LAYOUT_INPUT_TYPE_MOUSE_BUTTON, .region = { 192, 600, 172, 100 }, .mouse_button = HID_DEVICE_MOUSE_BUTTON_RIGHT },
+    { .type = LAYOUT_INPUT_TYPE_MOUSE_BUTTON, .region = { 20, 600, 172, 100 }, .sprite = { 22, 602, 170, 96, 0, 0 }, .mouse_button = HID_DEVICE_MOUSE_BUTTON_LEFT },
+    { .type = LAYOUT_INPUT_TYPE_MOUSE_BUTTON, .region = { 192, 600, 172, 100 }, .sprite = { 192, 602, 170, 96, 170, 0 }, .mouse_button = HID_DEVICE_MOUSE_BUTTON_RIGHT },
 };
 static const layout_config_t layout_config = {
     .title = "1. US",
     .base_image = &layout_us_normal,
-    .active_image = &layout_us_active,
+    .active_atlas = &layout_us_active_atlas,
     .inputs = layout_inputs,
     .count = 81,
 };
@@ -0,0 +1,80 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "lvgl_heap.h"
+#include "memory_plan.h"
+#include "esp_log.h"
+#include "lvgl.h"
+#include <assert.h>
+
+static const char *TAG = "LVGLHeap";
+#define LVGL_HEAP_CAPS (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+// LVGL calls these with the port lock held, from one task at a time
+static size_t used, used_max;
+
+static void lvgl_heap_check(size_t size) {
+    if (used + size > MEMORY_PLAN_SIZE_LVGL_HEAP) {
+        ESP_LOGE(TAG, "LVGL heap over its plan: %zu + %zu bytes", used, size);
+        assert(0);
+    }
+}
+
+static void lvgl_heap_count(void *p) {
+    used += heap_caps_get_allocated_size(p);
+    if (used > used_max) used_max = used;
+}
+
+// MARK: LVGL Custom Malloc
+void lv_mem_init(void) {}
+void lv_mem_deinit(void) {}
+
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes) {
+    return NULL;  // One heap, no pools
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {}
+
+void lv_free_core(void *p) {
+    if (!p) return;
+    used -= heap_caps_get_allocated_size(p);
+    heap_caps_free(p);
+}
+
+void *lv_malloc_core(size_t size) {
+    lvgl_heap_check(size);
+    void *p = heap_caps_malloc(size, LVGL_HEAP_CAPS);
+    if (p) lvgl_heap_count(p);
+    return p;
+}
+
+void *lv_realloc_core(void *p, size_t new_size) {
+    if (!new_size) {
+        lv_free_core(p);
+        return NULL;
+    }
+    size_t old_size = p ? heap_caps_get_allocated_size(p) : 0;
+    if (new_size > old_size) lvgl_heap_check(new_size - old_size);
+    void *new_p = heap_caps_realloc(p, new_size, LVGL_HEAP_CAPS);
+    if (!new_p) return NULL;  // p is still allocated
+    used -= old_size;
+    lvgl_heap_count(new_p);
+    return new_p;
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p) {
+    mon_p->total_size = MEMORY_PLAN_SIZE_LVGL_HEAP;
+    mon_p->free_size = MEMORY_PLAN_SIZE_LVGL_HEAP - used;
+    mon_p->max_used = used_max;
+    mon_p->used_pct = used * 100 / MEMORY_PLAN_SIZE_LVGL_HEAP;
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return LV_RESULT_OK;
+}
+
+size_t lvgl_heap_get_used(void) {
+    return used;
+}
@@ -0,0 +1,11 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stddef.h>
+
+// LVGL allocates through CONFIG_LV_USE_CUSTOM_MALLOC from PSRAM, counted
+// against MEMORY_PLAN_SIZE_LVGL_HEAP
+size_t lvgl_heap_get_used(void);  // Bytes LVGL holds now
@@ -8,6 +8,8 @@
 #include "screens/connect_screen.h"
 #include "screens/layout_screen.h"
 #include "display_mux.h"
+#include "memory_plan.h"
+#include "power_manager.h"
 
 static const char *TAG = "main";
 
@@ -40,11 +42,19 @@ void app_main() {
     bsp_tab5_init(&(bsp_tab5_config_t){
         .display.fb_num = GUI_FB_NUM,
         .touch.interrupt = true,
+        .touch.report_rate_hz = POWER_TOUCH_RATE_ACTIVE_HZ,
         .bluetooth.enable = true,
+        .task.io_stack_size = MEMORY_PLAN_SIZE_STACK_BSP_IO,
+        .task.radio_stack_size = MEMORY_PLAN_SIZE_STACK_BSP_RADIO,
     });
+    memory_plan_setup();
     display_mux_setup();
+    // Decoded while the connect screen shows, so ACTIVE only has to draw it
+    display_mux_layout_prefetch(_layout_head->config);
+    power_manager_setup();
 
     // Initialize HID keyboard
     hid_device_add_notify_callback(hid_device_notify_callback, NULL);
-    ESP_ERROR_CHECK(hid_device_init(&hid_device_profile_keyboard));
+    ESP_ERROR_CHECK(hid_device_init(&hid_device_profile_keyboard, MEMORY_PLAN_SIZE_STACK_HID));
+    memory_plan_report();
 }
@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "memory_plan.h"
+#include "display_mux.h"
+#include "lvgl_heap.h"
+#include "esp_cache.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const char *TAG = "MemoryPlan";
+
+static const struct {
+    const char *subsystem;
+    const char *name;
+    memory_plan_kind_t kind;
+    uint32_t caps;
+    size_t size;
+} entries[] = {
+#define MEMORY_PLAN_ENTRY(id, subsystem, name, kind, caps, size) [MEMORY_PLAN_##id] = { subsystem, name, MEMORY_PLAN_KIND_##kind, caps, size },
+    MEMORY_PLAN_ENTRIES(MEMORY_PLAN_ENTRY)
+};
+
+#define MEMORY_PLAN_PSRAM_SIZE(id, subsystem, name, kind, caps, size) + (((caps) & MALLOC_CAP_SPIRAM) ? (size) : 0)
+#define MEMORY_PLAN_INTERNAL_SIZE(id, subsystem, name, kind, caps, size) + (((caps) & MALLOC_CAP_SPIRAM) ? 0 : (size))
+#define MEMORY_PLAN_PSRAM_PLANNED (0 MEMORY_PLAN_ENTRIES(MEMORY_PLAN_PSRAM_SIZE))
+#define MEMORY_PLAN_INTERNAL_PLANNED (0 MEMORY_PLAN_ENTRIES(MEMORY_PLAN_INTERNAL_SIZE))
+static_assert(MEMORY_PLAN_PSRAM_PLANNED <= MEMORY_PLAN_PSRAM_BUDGET, "Memory plan exceeds MEMORY_PLAN_PSRAM_BUDGET");
+static_assert(MEMORY_PLAN_INTERNAL_PLANNED <= MEMORY_PLAN_INTERNAL_BUDGET, "Memory plan exceeds MEMORY_PLAN_INTERNAL_BUDGET");
+
+static void *buffers[MEMORY_PLAN_NUM];
+
+void memory_plan_setup(void) {
+    for (int i = 0; i < MEMORY_PLAN_NUM; i++) {
+        if (entries[i].kind != MEMORY_PLAN_KIND_BUFFER) continue;
+        // Cache line aligned, so the PPA and the JPEG decoder can use any of them
+        size_t alignment;
+        if (esp_cache_get_alignment(entries[i].caps, &alignment) != ESP_OK || alignment == 0) alignment = 4;
+        size_t size = (entries[i].size + alignment - 1) & ~(alignment - 1);
+        buffers[i] = heap_caps_aligned_calloc(alignment, 1, size, entries[i].caps);
+        if (!buffers[i]) {
+            ESP_LOGE(TAG, "Failed to allocate %s (%zu bytes)", entries[i].name, size);
+            assert(0);
+        }
+    }
+}
+
+void *memory_plan_buffer(memory_plan_id_t id) {
+    assert(buffers[id]);
+    return buffers[id];
+}
+
+void memory_plan_get_stats(memory_plan_stats_t *stats) {
+    *stats = (memory_plan_stats_t){
+        .psram_planned = MEMORY_PLAN_PSRAM_PLANNED,
+        .internal_planned = MEMORY_PLAN_INTERNAL_PLANNED,
+        .psram_total = heap_caps_get_total_size(MALLOC_CAP_SPIRAM),
+        .psram_free_min = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM),
+        .internal_total = heap_caps_get_total_size(MALLOC_CAP_INTERNAL),
+        .internal_free_min = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+    };
+}
+
+// MARK: Report
+// Bytes in use now, stacks report their high-water mark
+static size_t memory_plan_entry_used(memory_plan_id_t id) {
+    switch (entries[id].kind) {
+    case MEMORY_PLAN_KIND_BUFFER:
+        return buffers[id] ? entries[id].size : 0;
+    case MEMORY_PLAN_KIND_STACK: {
+        TaskHandle_t task = xTaskGetHandle(entries[id].name);
+        return task ? entries[id].size - uxTaskGetStackHighWaterMark(task) : 0;  // Not running
+    }
+    case MEMORY_PLAN_KIND_RESERVED:
+        break;
+    }
+
+    // Reserved memory is counted by its owner
+    if (id == MEMORY_PLAN_LVGL_HEAP) return lvgl_heap_get_used();
+    display_mux_stats_t stats;
+    display_mux_get_stats(&stats);
+    switch (id) {
+    case MEMORY_PLAN_KEYCAP_ATLAS: return stats.keycap_atlas_bytes;
+    case MEMORY_PLAN_LAYOUT_CACHE: return stats.layout_cache_bytes;
+    case MEMORY_PLAN_LAYOUT_RESTORE: return stats.layout_restore_bytes;
+    default: return entries[id].size;  // Frame buffers, allocated in full by the panel driver
+    }
+}
+
+void memory_plan_report(void) {
+    size_t used[MEMORY_PLAN_NUM];
+    for (int i = 0; i < MEMORY_PLAN_NUM; i++) {
+        used[i] = memory_plan_entry_used(i);
+        ESP_LOGI(TAG, "%-8s %-15s %-8s %8zu / %8zu", entries[i].subsystem, entries[i].name,
+                 entries[i].caps & MALLOC_CAP_SPIRAM ? "PSRAM" : "Internal", used[i], entries[i].size);
+    }
+
+    // Per subsystem in the order they first appear
+    for (int i = 0; i < MEMORY_PLAN_NUM; i++) {
+        bool first = true;
+        for (int k = 0; k < i && first; k++) first = strcmp(entries[k].subsystem, entries[i].subsystem) != 0;
+        if (!first) continue;
+        size_t psram_used = 0, psram_planned = 0, internal_used = 0, internal_planned = 0;
+        for (int k = i; k < MEMORY_PLAN_NUM; k++) {
+            if (strcmp(entries[k].subsystem, entries[i].subsystem) != 0) continue;
+            if (entries[k].caps & MALLOC_CAP_SPIRAM) {
+                psram_used += used[k];
+                psram_planned += entries[k].size;
+            } else {
+                internal_used += used[k];
+                internal_planned += entries[k].size;
+            }
+        }
+        ESP_LOGI(TAG, "%-8s PSRAM %8zu / %8zu, internal %6zu / %6zu", entries[i].subsystem, psram_used, psram_planned, internal_used, internal_planned);
+    }
+
+    memory_plan_stats_t stats;
+    memory_plan_get_stats(&stats);
+    ESP_LOGI(TAG, "PSRAM planned %zu of %zu budget, heap %zu, low-water free %zu",
+             stats.psram_planned, (size_t)MEMORY_PLAN_PSRAM_BUDGET, stats.psram_total, stats.psram_free_min);
+    ESP_LOGI(TAG, "Internal planned %zu of %zu budget, heap %zu, low-water free %zu",
+             stats.internal_planned, (size_t)MEMORY_PLAN_INTERNAL_BUDGET, stats.internal_total, stats.internal_free_min);
+}
@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stddef.h>
+#include "esp_heap_caps.h"
+#include "display_config.h"
+
+// Long lived memory of the app in one table: buffers allocated once by
+// memory_plan_setup, memory their owners allocate up to a planned size, and
+// task stacks. The planned totals per region are checked against the budgets
+// at build time.
+#ifndef MEMORY_PLAN_PSRAM_BUDGET
+#define MEMORY_PLAN_PSRAM_BUDGET (24 * 1024 * 1024)  // Of 32 MB, the rest is for the radio and transient buffers
+#endif
+#ifndef MEMORY_PLAN_INTERNAL_BUDGET
+#define MEMORY_PLAN_INTERNAL_BUDGET (64 * 1024)
+#endif
+
+typedef enum {
+    MEMORY_PLAN_KIND_BUFFER,    // Allocated by memory_plan_setup, see memory_plan_buffer
+    MEMORY_PLAN_KIND_RESERVED,  // Allocated by its owner, at most the planned size
+    MEMORY_PLAN_KIND_STACK,     // Task stack, the name is the task name
+} memory_plan_kind_t;
+
+// X(id, subsystem, name, kind, caps, size)
+#define MEMORY_PLAN_ENTRIES(X) \
+    X(FRAME_BUFFERS,         "Display", "Frame buffers",  RESERVED, MALLOC_CAP_SPIRAM, 720 * 1280 * 2 * GUI_FB_NUM) /* DPI panel driver */ \
+    X(GUI_BUFFER,            "GUI",     "GUI buffer",     BUFFER,   MALLOC_CAP_SPIRAM, GUI_BUFFER_SIZE) \
+    X(LVGL_HEAP,             "GUI",     "LVGL heap",      RESERVED, MALLOC_CAP_SPIRAM, GUI_LVGL_HEAP_SIZE) \
+    X(KEYCAP_ATLAS,          "Layout",  "Keycap atlas",   RESERVED, MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, KEYCAP_ATLAS_SIZE_MAX) \
+    X(LAYOUT_CACHE,          "Layout",  "Layout cache",   RESERVED, MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, LAYOUT_CACHE_BUDGET) \
+    X(LAYOUT_RESTORE,        "Layout",  "Restore slots",  RESERVED, MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, LAYOUT_RESTORE_BUDGET) \
+    X(LAYOUT_TINT_TILE,      "Layout",  "Tint tile",      BUFFER,   MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, LAYOUT_TINT_TILE * LAYOUT_TINT_TILE) \
+    X(STACK_BSP_IO,          "BSP",     "BSPIO",          STACK,    MALLOC_CAP_INTERNAL, 3072) /* Passed in bsp_tab5_config_t */ \
+    X(STACK_BSP_RADIO,       "BSP",     "BSPRadio",       STACK,    MALLOC_CAP_INTERNAL, 6144) /* Only during bsp_tab5_init */ \
+    X(STACK_PPA_DONE,        "Display", "PPADone",        STACK,    MALLOC_CAP_INTERNAL, 3072) \
+    X(STACK_TOUCH,           "Display", "Touch",          STACK,    MALLOC_CAP_INTERNAL, 8192) \
+    X(STACK_LVGL,            "GUI",     "taskLVGL",       STACK,    MALLOC_CAP_INTERNAL, 7168) \
+    X(STACK_LAYOUT_PREFETCH, "Layout",  "LayoutPrefetch", STACK,    MALLOC_CAP_INTERNAL, 4096) \
+    X(STACK_LAYOUT_RENDER,   "Layout",  "LayoutRender",   STACK,    MALLOC_CAP_INTERNAL, 4096) \
+    X(STACK_INPUT_TICK,      "Input",   "InputTick",      STACK,    MALLOC_CAP_INTERNAL, 4096) \
+    X(STACK_HID,             "HID",     "hid_device",     STACK,    MALLOC_CAP_INTERNAL, 8192) /* Passed to hid_device_init */ \
+    X(STACK_POWER,           "Power",   "Power",          STACK,    MALLOC_CAP_INTERNAL, 3072)
+
+#define MEMORY_PLAN_ENUM_ID(id, subsystem, name, kind, caps, size) MEMORY_PLAN_##id,
+#define MEMORY_PLAN_ENUM_SIZE(id, subsystem, name, kind, caps, size) MEMORY_PLAN_SIZE_##id = (size),
+typedef enum {
+    MEMORY_PLAN_ENTRIES(MEMORY_PLAN_ENUM_ID)
+    MEMORY_PLAN_NUM,
+} memory_plan_id_t;
+enum { MEMORY_PLAN_ENTRIES(MEMORY_PLAN_ENUM_SIZE) };  // MEMORY_PLAN_SIZE_<id>, for stack sizes at task creation
+
+typedef struct {
+    size_t psram_planned;
+    size_t internal_planned;
+    size_t psram_total;
+    size_t psram_free_min;     // Heap low-water mark since boot
+    size_t internal_total;
+    size_t internal_free_min;
+} memory_plan_stats_t;
+
+void memory_plan_setup(void);  // Before any owner of a planned buffer starts
+void *memory_plan_buffer(memory_plan_id_t id);
+void memory_plan_get_stats(memory_plan_stats_t *stats);
+void memory_plan_report(void);  // Logs usage per entry and subsystem, stack and heap high-water marks
@@ -0,0 +1,203 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "power_manager.h"
+#include "bsp_tab5.h"
+#include "hid_device.h"
+#include "memory_plan.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <inttypes.h>
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+static const char *TAG = "PowerManager";
+#define POWER_IO_POLL_PERIOD_MS (1000)  // Headphone and charge detection outside the sleep stage
+
+static const struct {
+    int brightness;
+    bsp_display_profile_t display_profile;
+    uint16_t touch_rate_hz;
+    hid_device_link_t link;
+} stage_settings[] = {
+    [POWER_MANAGER_STAGE_ACTIVE] = { 80, BSP_DISPLAY_PROFILE_ACTIVE, POWER_TOUCH_RATE_ACTIVE_HZ, HID_DEVICE_LINK_FAST },
+    [POWER_MANAGER_STAGE_DIM] = { 20, BSP_DISPLAY_PROFILE_IDLE, POWER_TOUCH_RATE_ACTIVE_HZ / 2, HID_DEVICE_LINK_IDLE },
+    [POWER_MANAGER_STAGE_SLEEP] = { 0, BSP_DISPLAY_PROFILE_IDLE, POWER_TOUCH_RATE_ACTIVE_HZ / 4, HID_DEVICE_LINK_SLEEP },
+};
+
+static TaskHandle_t power_task;
+static portMUX_TYPE input_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t last_input_time;    // Guarded by input_lock, 64 bit stores are not atomic here
+static int64_t suspend_time = -1;  // Host suspend in effect since, -1 when not suspended
+static volatile power_manager_stage_t stage;
+static power_manager_stats_t stats;
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t no_sleep_lock;  // Held outside the sleep stage
+#endif
+static bool light_sleeping;  // The lock is released
+
+// MARK: Stages
+#if CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+// Called by the idle task with interrupts off around each light sleep
+static esp_err_t IRAM_ATTR power_manager_light_sleep_enter(int64_t sleep_time_us, void *arg) {
+    bsp_tab5_touch_sleep_enter();
+    return ESP_OK;
+}
+
+static esp_err_t IRAM_ATTR power_manager_light_sleep_exit(int64_t sleep_time_us, void *arg) {
+    bsp_tab5_touch_sleep_exit();
+    stats.light_sleep_entries++;
+    stats.light_sleep_time_us += sleep_time_us;
+    return ESP_OK;
+}
+#endif
+
+// The LVGL tick timer would wake the chip every few milliseconds and the IO
+// expander poll every second, both are paused while the screen is dark. The
+// input tick timer stops by itself when idle.
+static void power_manager_set_light_sleep(bool enable) {
+#if CONFIG_PM_ENABLE
+    if (enable) {
+        if (bsp_tab5_touch_set_wakeup(true) != ESP_OK) return;
+        lvgl_port_stop();
+        bsp_tab5_input_set_poll_period(0);
+        light_sleeping = esp_pm_lock_release(no_sleep_lock) == ESP_OK;
+        if (!light_sleeping) {
+            bsp_tab5_input_set_poll_period(POWER_IO_POLL_PERIOD_MS);
+            lvgl_port_resume();
+        }
+    } else {
+        esp_pm_lock_acquire(no_sleep_lock);
+        bsp_tab5_touch_set_wakeup(false);
+        bsp_tab5_input_set_poll_period(POWER_IO_POLL_PERIOD_MS);
+        lvgl_port_resume();
+        light_sleeping = false;
+        ESP_LOGI(TAG, "Light sleep %" PRIu32 " times, %" PRIu64 " ms in total", stats.light_sleep_entries, stats.light_sleep_time_us / 1000);
+    }
+#endif
+}
+
+static void power_manager_apply(power_manager_stage_t next) {
+    power_manager_stage_t prev = stage;
+    if (light_sleeping) power_manager_set_light_sleep(false);
+
+    bsp_tab5_display_set_brightness(stage_settings[next].brightness);
+    bsp_tab5_display_set_profile(stage_settings[next].display_profile);  // Panels without profiles keep refreshing
+    bsp_tab5_touch_set_report_rate(stage_settings[next].touch_rate_hz);
+    if (hid_device_is_connected()) hid_device_set_link(stage_settings[next].link);
+
+    stage = next;
+    if (next == POWER_MANAGER_STAGE_SLEEP && stats.light_sleep) power_manager_set_light_sleep(true);
+    ESP_LOGI(TAG, "Stage %d->%d", prev, next);
+}
+
+static void power_manager_task(void *param) {
+    while (true) {
+        portENTER_CRITICAL(&input_lock);
+        int64_t input = last_input_time, suspend = suspend_time;
+        portEXIT_CRITICAL(&input_lock);
+
+        int64_t idle_ms = (esp_timer_get_time() - input) / 1000;
+        power_manager_stage_t next = POWER_MANAGER_STAGE_ACTIVE;
+        TickType_t wait = pdMS_TO_TICKS(POWER_DIM_TIMEOUT_MS - idle_ms);
+        if ((suspend >= 0 && suspend >= input) || idle_ms >= POWER_SLEEP_TIMEOUT_MS) {
+            next = POWER_MANAGER_STAGE_SLEEP;
+            wait = portMAX_DELAY;
+        } else if (idle_ms >= POWER_DIM_TIMEOUT_MS) {
+            next = POWER_MANAGER_STAGE_DIM;
+            wait = pdMS_TO_TICKS(POWER_SLEEP_TIMEOUT_MS - idle_ms);
+        }
+        if (next != stage) power_manager_apply(next);
+        ulTaskNotifyTake(pdTRUE, wait == portMAX_DELAY ? wait : wait + 1);  // Past the threshold, not on it
+    }
+}
+
+// MARK: Inputs
+void power_manager_on_input(int64_t irq_time) {
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&input_lock);
+    last_input_time = now;
+    portEXIT_CRITICAL(&input_lock);
+
+    // The first report after a step down went out with the lowered rates, out
+    // of the sleep stage the input only woke the device
+    power_manager_stage_t from = stage;
+    if (from == POWER_MANAGER_STAGE_ACTIVE) return;
+    uint32_t latency = now - irq_time;
+    stats.wakes++;
+    stats.wake_latency_last_us = latency;
+    if (latency > stats.wake_latency_max_us) stats.wake_latency_max_us = latency;
+    if (latency > POWER_WAKE_BUDGET_US) {
+        stats.wake_budget_misses++;
+        if (from == POWER_MANAGER_STAGE_SLEEP && stats.light_sleep) {
+            stats.light_sleep = false;
+            ESP_LOGW(TAG, "Wake took %" PRIu32 " us over the %d us budget, light sleep disabled", latency, POWER_WAKE_BUDGET_US);
+        } else {
+            ESP_LOGW(TAG, "Wake took %" PRIu32 " us over the %d us budget", latency, POWER_WAKE_BUDGET_US);
+        }
+    }
+    if (power_task) xTaskNotifyGive(power_task);
+}
+
+bool power_manager_is_awake(void) {
+    return stage != POWER_MANAGER_STAGE_SLEEP;
+}
+
+static void hid_device_notify_callback(hid_device_notify_t *notify, void *user_data) {
+    if (notify->type == HID_DEVICE_NOTIFY_SUSPEND) {
+        portENTER_CRITICAL(&input_lock);
+        suspend_time = notify->suspend.suspended ? esp_timer_get_time() : -1;
+        portEXIT_CRITICAL(&input_lock);
+    } else if (notify->type == HID_DEVICE_NOTIFY_STATE_CHANGED && notify->state.current == HID_DEVICE_STATE_ACTIVE) {
+        // A new connection counts as activity
+        portENTER_CRITICAL(&input_lock);
+        last_input_time = esp_timer_get_time();
+        portEXIT_CRITICAL(&input_lock);
+    } else {
+        return;
+    }
+    if (power_task) xTaskNotifyGive(power_task);
+}
+
+// MARK: Common
+void power_manager_get_stats(power_manager_stats_t *out) {
+    *out = stats;
+    out->stage = stage;
+}
+
+void power_manager_setup(void) {
+    last_input_time = esp_timer_get_time();
+    stage = POWER_MANAGER_STAGE_ACTIVE;
+#if CONFIG_PM_ENABLE
+    esp_err_t err = esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "power_manager", &no_sleep_lock);
+    if (err == ESP_OK) err = esp_pm_lock_acquire(no_sleep_lock);
+    if (err == ESP_OK) {
+        err = esp_pm_configure(&(esp_pm_config_t){
+            .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+            .min_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+            .light_sleep_enable = true,
+        });
+    }
+#if CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+    if (err == ESP_OK) {
+        err = esp_pm_light_sleep_register_cbs(&(esp_pm_sleep_cbs_register_config_t){
+            .enter_cb = power_manager_light_sleep_enter,
+            .exit_cb = power_manager_light_sleep_exit,
+        });
+    }
+#endif
+    stats.light_sleep = err == ESP_OK;
+    if (err != ESP_OK) ESP_LOGW(TAG, "Light sleep unavailable: %s", esp_err_to_name(err));
+#endif
+
+    // Starts in the active stage the BSP and the display mux set up
+    xTaskCreate(power_manager_task, "Power", MEMORY_PLAN_SIZE_STACK_POWER, NULL, 3, &power_task);
+    hid_device_add_notify_callback(hid_device_notify_callback, NULL);
+}
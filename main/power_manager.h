@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+// Steps the device down while there is no input: the backlight, panel refresh,
+// touch report rate and BLE connection interval, then light sleep until the
+// touch interrupt. A host suspend skips to the sleep stage.
+#ifndef POWER_DIM_TIMEOUT_MS
+#define POWER_DIM_TIMEOUT_MS (30 * 1000)
+#endif
+#ifndef POWER_SLEEP_TIMEOUT_MS
+#define POWER_SLEEP_TIMEOUT_MS (5 * 60 * 1000)
+#endif
+#ifndef POWER_WAKE_BUDGET_US
+#define POWER_WAKE_BUDGET_US (50 * 1000)  // Touch interrupt to the first report after a step down
+#endif
+#ifndef POWER_TOUCH_RATE_ACTIVE_HZ
+#define POWER_TOUCH_RATE_ACTIVE_HZ (200)
+#endif
+
+typedef enum {
+    POWER_MANAGER_STAGE_ACTIVE,
+    POWER_MANAGER_STAGE_DIM,
+    POWER_MANAGER_STAGE_SLEEP,
+} power_manager_stage_t;
+
+typedef struct {
+    power_manager_stage_t stage;
+    uint32_t wakes;                   // Inputs that brought the device back to active
+    uint32_t wake_latency_last_us;
+    uint32_t wake_latency_max_us;
+    uint32_t wake_budget_misses;
+    bool light_sleep;                 // Cleared for good once waking from it misses the budget
+    uint32_t light_sleep_entries;     // Times the chip actually entered light sleep, needs CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+    uint64_t light_sleep_time_us;
+} power_manager_stats_t;
+
+void power_manager_setup(void);
+void power_manager_on_input(int64_t irq_time);  // After the input was handled, irq_time is its esp_timer time
+bool power_manager_is_awake(void);  // False in the sleep stage, the screen is dark and a touch only wakes the device
+void power_manager_get_stats(power_manager_stats_t *stats);
@@ -5,10 +5,20 @@
 
 #include "layout_screen.h"
 #include "display_mux.h"
+#include "memory_plan.h"
 #include "hid_device_keyboard.h"
 #include "hid_device_mouse.h"
+#include "hid_device.h"
+#include "trackpad/trackpad_filter.h"
+#include "trackpad/trackpad_gesture.h"
+#include <stdlib.h>
 #include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
 #include "driver/gptimer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 
 [[maybe_unused]] static const char *TAG = "LayoutScreen";
 #define TOUCH_POINT_MAX (5)
@@ -18,55 +28,314 @@ typedef struct {
     uint8_t touched;
     union {
         struct {
-            bool moved;
-            uint32_t start;
+            bool filter_stale;
+            trackpad_filter_t filter;
         } trackpad;
     };
 } active_input_state_t;
 
-static gptimer_handle_t gptimer;
 static uint32_t timestamp(void) {
-    uint64_t value;
-    ESP_ERROR_CHECK(gptimer_get_raw_count(gptimer, &value));
-    return (value & 0xffffffff);
+    return (uint32_t)esp_timer_get_time();  // Keeps counting while the input tick timer is stopped
+}
+static uint32_t touch_time;  // Interrupt of the touch frame being handled, on the timestamp() clock
+
+// MARK: Input Tick
+// The gptimer alarm fires once per BLE connection interval while there is
+// periodic work (scroll output, momentum, timed button release), so reports
+// are batched at the rate the host can actually receive them. The timer only
+// runs while work is pending: an enabled gptimer holds a power management lock
+// that keeps the chip out of light sleep.
+#define INPUT_TICK_INTERVAL_DEFAULT (15 * 1000)
+#define INPUT_TICK_INTERVAL_MIN     (7500)
+#define INPUT_TICK_INTERVAL_MAX     (50 * 1000)
+
+static gptimer_handle_t gptimer;
+static TaskHandle_t input_tick_task_handle;
+static SemaphoreHandle_t input_tick_mutex;  // Guards starting and stopping the timer
+static bool input_tick_running;
+static volatile uint32_t input_tick_interval = INPUT_TICK_INTERVAL_DEFAULT;
+static volatile bool input_tick_active;
+
+static bool IRAM_ATTR input_tick_alarm_callback(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_ctx) {
+    gptimer_set_alarm_action(timer, &(gptimer_alarm_config_t){
+        .alarm_count = edata->alarm_value + input_tick_interval,
+    });
+    BaseType_t task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(input_tick_task_handle, &task_woken);
+    return task_woken == pdTRUE;
+}
+
+static void input_tick_update_interval(void) {
+    uint32_t interval = hid_device_connection_interval_us();
+    if (interval == 0) interval = INPUT_TICK_INTERVAL_DEFAULT;
+    if (interval < INPUT_TICK_INTERVAL_MIN) interval = INPUT_TICK_INTERVAL_MIN;
+    if (interval > INPUT_TICK_INTERVAL_MAX) interval = INPUT_TICK_INTERVAL_MAX;
+    input_tick_interval = interval;
+}
+
+// Marks periodic work pending and starts the timer if it is stopped. The flag is
+// set first, so the tick task either sees it or stops before the start here.
+static void input_tick_request(void) {
+    input_tick_active = true;
+    xSemaphoreTake(input_tick_mutex, portMAX_DELAY);
+    if (!input_tick_running) {
+        ESP_ERROR_CHECK(gptimer_set_raw_count(gptimer, 0));
+        ESP_ERROR_CHECK(gptimer_set_alarm_action(gptimer, &(gptimer_alarm_config_t){
+            .alarm_count = input_tick_interval,
+        }));
+        ESP_ERROR_CHECK(gptimer_enable(gptimer));
+        ESP_ERROR_CHECK(gptimer_start(gptimer));
+        input_tick_running = true;
+    }
+    xSemaphoreGive(input_tick_mutex);
+}
+
+static void input_tick_stop_if_idle(void) {
+    xSemaphoreTake(input_tick_mutex, portMAX_DELAY);
+    if (input_tick_running && !input_tick_active) {
+        ESP_ERROR_CHECK(gptimer_stop(gptimer));
+        ESP_ERROR_CHECK(gptimer_disable(gptimer));
+        input_tick_running = false;
+    }
+    xSemaphoreGive(input_tick_mutex);
+}
+
+// MARK: Scroll
+// Two-finger scroll. Finger motion is accumulated in Q8 fixed point by the touch
+// task and converted to wheel/pan steps once per input tick. After lift-off the
+// last velocity keeps scrolling and decays exponentially (momentum).
+#define SCROLL_Q                 (8)
+#define SCROLL_PIXELS_PER_STEP   (24)
+#define SCROLL_MOMENTUM_DECAY    (243)           // velocity *= 243/256 per tick
+#define SCROLL_MOMENTUM_MIN      (1 << SCROLL_Q) // stop below 1px per tick
+
+static portMUX_TYPE scroll_lock = portMUX_INITIALIZER_UNLOCKED;
+static struct {
+    bool tracking;
+    bool momentum;
+    int32_t pending[2];    // [x, y] motion since the last tick (Q8 pixels)
+    int32_t velocity[2];   // [x, y] smoothed motion per tick (Q8 pixels)
+    int32_t remainder[2];  // [x, y] motion not yet emitted as steps (Q8 pixels)
+} scroll;
+
+static void scroll_add(int16_t dx, int16_t dy, int finger_num) {
+    portENTER_CRITICAL(&scroll_lock);
+    if (!scroll.tracking) {
+        scroll.tracking = true;
+        scroll.momentum = false;
+        for (int i = 0; i < 2; i++) {
+            scroll.pending[i] = scroll.velocity[i] = scroll.remainder[i] = 0;
+        }
+    }
+    scroll.pending[0] += dx * (1 << SCROLL_Q) / finger_num;
+    scroll.pending[1] += dy * (1 << SCROLL_Q) / finger_num;
+    portEXIT_CRITICAL(&scroll_lock);
+    input_tick_request();
+}
+static void scroll_end(void) {
+    portENTER_CRITICAL(&scroll_lock);
+    if (scroll.tracking) {
+        scroll.tracking = false;
+        scroll.momentum = true;
+    }
+    portEXIT_CRITICAL(&scroll_lock);
+}
+static void scroll_stop(void) {
+    portENTER_CRITICAL(&scroll_lock);
+    scroll.momentum = false;
+    portEXIT_CRITICAL(&scroll_lock);
+}
+
+static int8_t scroll_take_steps(int32_t *remainder) {
+    const int32_t step = SCROLL_PIXELS_PER_STEP << SCROLL_Q;
+    int32_t steps = *remainder / step;
+    if (steps > 127) steps = 127;
+    if (steps < -127) steps = -127;
+    *remainder -= steps * step;
+    return steps;
+}
+
+// Returns false when there is nothing left to do until the next gesture
+static bool scroll_tick(void) {
+    int8_t steps[2];
+    bool active;
+
+    portENTER_CRITICAL(&scroll_lock);
+    for (int i = 0; i < 2; i++) {
+        int32_t delta = scroll.pending[i];
+        scroll.pending[i] = 0;
+        if (scroll.tracking) {
+            scroll.velocity[i] = (scroll.velocity[i] + delta) / 2;
+        } else if (scroll.momentum) {
+            delta = scroll.velocity[i];
+            scroll.velocity[i] = scroll.velocity[i] * SCROLL_MOMENTUM_DECAY / (1 << SCROLL_Q);
+        }
+        scroll.remainder[i] += delta;
+        steps[i] = scroll_take_steps(&scroll.remainder[i]);
+    }
+    if (scroll.momentum &&
+        abs(scroll.velocity[0]) < SCROLL_MOMENTUM_MIN && abs(scroll.velocity[1]) < SCROLL_MOMENTUM_MIN) {
+        scroll.momentum = false;
+    }
+    active = scroll.tracking || scroll.momentum;
+    portEXIT_CRITICAL(&scroll_lock);
+
+    // Natural scrolling: content follows the fingers
+    if (steps[0] || steps[1]) {
+        hid_device_mouse_scroll(steps[1], -steps[0]);
+    }
+    return active;
 }
 
 // MARK: Key
 static void key_touch_press(active_input_state_t *state, uint8_t track_id, uint16_t x, uint16_t y) {
     hid_device_keyboard_press_key(state->input->key);
-    display_mux_layout_draw_region(display_mux_layout_active_image,
-        state->input->region.x, state->input->region.y, state->input->region.width, state->input->region.height);
+    display_mux_layout_highlight(state->input, true);
 }
 static void key_touch_release(active_input_state_t *state, uint8_t track_id) {
     hid_device_keyboard_release_key(state->input->key);
-    display_mux_layout_draw_region(display_mux_layout_base_image,
-        state->input->region.x, state->input->region.y, state->input->region.width, state->input->region.height);
+    display_mux_layout_highlight(state->input, false);
 }
 
 // MARK: Mouse Button
 static void mouse_button_touch_press(active_input_state_t *state, uint8_t track_id, uint16_t x, uint16_t y) {
     hid_device_mouse_press_button(state->input->mouse_button);
-    display_mux_layout_draw_region(display_mux_layout_active_image,
-        state->input->region.x, state->input->region.y, state->input->region.width, state->input->region.height);
+    display_mux_layout_highlight(state->input, true);
 }
 static void mouse_button_touch_release(active_input_state_t *state, uint8_t track_id) {
     hid_device_mouse_release_button(state->input->mouse_button);
-    display_mux_layout_draw_region(display_mux_layout_base_image,
-        state->input->region.x, state->input->region.y, state->input->region.width, state->input->region.height);
+    display_mux_layout_highlight(state->input, false);
+}
+
+// MARK: Layout Switch
+// A three finger swipe on the trackpad moves through the registered layouts.
+// The switch happens after the touch frame is handled, and the layout beyond
+// the new one in the same direction is decoded in the background.
+static int layout_switch_direction;  // Requested by the trackpad, 0 if none
+
+static const layout_config_t *layout_neighbor(const layout_config_t *config, int direction) {
+    _layout_context_t *prev = NULL, *last = NULL;
+    for (_layout_context_t *ctx = _layout_head; ctx; ctx = ctx->next) {
+        if (ctx->next && ctx->next->config == config) prev = ctx;
+        last = ctx;
+    }
+    for (_layout_context_t *ctx = _layout_head; ctx; ctx = ctx->next) {
+        if (ctx->config != config) continue;
+        if (direction > 0) return (ctx->next ? ctx->next : _layout_head)->config;
+        return (prev ? prev : last)->config;
+    }
+    return _layout_head->config;
 }
 
 // MARK: Trackpad
+// Touch callbacks translate finger events for the trackpad region into
+// recognizer input; the recognizer is shared by the touch and tick tasks.
+static const trackpad_filter_config_t trackpad_filter_config = TRACKPAD_FILTER_CONFIG_DEFAULT();
+static SemaphoreHandle_t trackpad_mutex;
+static trackpad_gesture_t trackpad_gesture;
+
+static void trackpad_on_button(hid_device_mouse_button_t button, bool pressed, void *user_data) {
+    if (pressed) {
+        hid_device_mouse_press_button(button);
+    } else {
+        hid_device_mouse_release_button(button);
+    }
+}
+static void trackpad_on_move(int16_t dx, int16_t dy, void *user_data) {
+    hid_device_mouse_move(dx + dx / 2, dy + dy / 2);
+}
+static void trackpad_on_scroll(int16_t dx, int16_t dy, int finger_num, void *user_data) {
+    scroll_add(dx, dy, finger_num);
+}
+static void trackpad_on_scroll_end(void *user_data) {
+    scroll_end();
+}
+static void trackpad_on_schedule(uint32_t time_us, void *user_data) {
+    input_tick_request();
+}
+static void trackpad_on_swipe(int direction, void *user_data) {
+    layout_switch_direction = direction;
+}
+
+static void trackpad_fingers_changed(active_input_state_t *state) {
+    xSemaphoreTake(trackpad_mutex, portMAX_DELAY);
+    trackpad_gesture_fingers(&trackpad_gesture, __builtin_popcount(state->touched), touch_time);
+    xSemaphoreGive(trackpad_mutex);
+    state->trackpad.filter_stale = true;
+}
+
 static void trackpad_touch_press(active_input_state_t *state, uint8_t track_id, uint16_t x, uint16_t y) {
-    state->trackpad.moved = false;
-    state->trackpad.start = timestamp();
+    scroll_stop();
+    trackpad_fingers_changed(state);
+    trackpad_filter_init(&state->trackpad.filter, &trackpad_filter_config);
+    trackpad_filter_reset(&state->trackpad.filter, x, y, touch_time);
+    state->trackpad.filter_stale = false;
+}
+static void trackpad_touch_add(active_input_state_t *state, uint8_t track_id, uint16_t x, uint16_t y) {
+    trackpad_fingers_changed(state);
 }
 static void trackpad_touch_move(active_input_state_t *state, uint8_t track_id, uint16_t x, uint16_t y, int16_t dx, int16_t dy) {
-    state->trackpad.moved = true;
-    hid_device_mouse_move(dx + dx / 2, dy + dy / 2);
+    uint32_t now = touch_time;
+    if (__builtin_popcount(state->touched) == 1) {
+        // Only a single finger is filtered; restart the filter whenever the finger set changes
+        if (state->trackpad.filter_stale) {
+            state->trackpad.filter_stale = false;
+            trackpad_filter_reset(&state->trackpad.filter, x, y, now);
+            return;
+        }
+        // Jitter that the filter absorbs is not motion, so it can't turn a tap into a move
+        if (!trackpad_filter_update(&state->trackpad.filter, x, y, now, &dx, &dy)) return;
+    }
+    xSemaphoreTake(trackpad_mutex, portMAX_DELAY);
+    trackpad_gesture_motion(&trackpad_gesture, dx, dy, now);
+    xSemaphoreGive(trackpad_mutex);
+}
+
+static void trackpad_touch_remove(active_input_state_t *state, uint8_t track_id) {
+    trackpad_fingers_changed(state);
 }
 static void trackpad_touch_release(active_input_state_t *state, uint8_t track_id) {
-    if (!state->trackpad.moved && (timestamp() - state->trackpad.start) < 200 * 1000) {
-        hid_device_mouse_click(HID_DEVICE_MOUSE_BUTTON_LEFT);
+    trackpad_fingers_changed(state);
+}
+
+static void trackpad_setup(void) {
+    trackpad_mutex = xSemaphoreCreateMutex();
+    assert(trackpad_mutex);
+    trackpad_gesture_init(&trackpad_gesture, &(trackpad_gesture_config_t)TRACKPAD_GESTURE_CONFIG_DEFAULT(), &(trackpad_gesture_callbacks_t){
+        .button = trackpad_on_button,
+        .move = trackpad_on_move,
+        .scroll = trackpad_on_scroll,
+        .scroll_end = trackpad_on_scroll_end,
+        .schedule = trackpad_on_schedule,
+        .swipe = trackpad_on_swipe,
+    });
+}
+
+// Returns false when the recognizer has no deadline pending
+static bool trackpad_tick(void) {
+    xSemaphoreTake(trackpad_mutex, portMAX_DELAY);
+    // A tap holds its button for one connection interval so press and release
+    // never land in the same connection event
+    trackpad_gesture.config.click_time = input_tick_interval;
+    trackpad_gesture_timeout(&trackpad_gesture, timestamp());
+    bool pending = trackpad_gesture_pending(&trackpad_gesture);
+    xSemaphoreGive(trackpad_mutex);
+    return pending;
+}
+
+// MARK: Input Tick Task
+static void input_tick_task(void *param) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        input_tick_update_interval();
+        // Cleared first so a concurrent request from the touch task is never lost
+        input_tick_active = false;
+        bool active = trackpad_tick();
+        active |= scroll_tick();
+        if (active) {
+            input_tick_active = true;
+        }
+        input_tick_stop_if_idle();
     }
 }
 
@@ -95,7 +364,9 @@ static const struct {
     },
     [LAYOUT_INPUT_TYPE_TRACKPAD] = {
         .press = trackpad_touch_press,
+        .add = trackpad_touch_add,
         .move = trackpad_touch_move,
+        .remove = trackpad_touch_remove,
         .release = trackpad_touch_release,
     },
 };
@@ -145,6 +416,27 @@ static const layout_input_t *find_input(uint16_t x, uint16_t y) {
     }
     return NULL;
 }
+// Fingers still down stay ignored until they lift, so nothing of the new
+// layout is pressed by them. The layout decodes in the background, the touch
+// task never waits for it.
+static void layout_screen_switch(const layout_config_t *config, int direction) {
+    for (int i = 0; i < TOUCH_POINT_MAX; i++) {
+        active_input_state_t *state = &active_input_states[i];
+        if (!state->input) continue;
+        uint8_t track_id = __builtin_ctz(state->touched);
+        state->touched = 0;
+        invoke_callback_release(state, track_id);
+        state->input = NULL;
+    }
+
+    current_layout_config = config;
+    display_mux_layout_load(config);
+    display_mux_switch_mode(DISPLAY_MUX_MODE_LAYOUT);
+
+    const layout_config_t *next = layout_neighbor(config, direction);
+    if (next != config) display_mux_layout_prefetch(next);
+}
+
 static active_input_state_t *active_input_state_get(const layout_input_t* input) {
     for (int i = 0; i < ARRAY_SIZE(active_input_states); i++) {
         if (active_input_states[i].input == input) return &active_input_states[i];
@@ -159,7 +451,10 @@ static active_input_state_t *active_input_state_find(uint8_t track_id) {
     return NULL;
 }
 
-void layout_screen_on_touch(int touch_num, esp_lcd_touch_point_data_t touches[5]) {
+void layout_screen_on_touch(int touch_num, esp_lcd_touch_point_data_t touches[5], int64_t irq_time) {
+    // Motion is timed by the touch interrupt, not by when the frame got here
+    touch_time = (uint32_t)irq_time;
+    bool ready = display_mux_layout_ready();  // Fingers landing on a layout still decoding stay ignored
     bool track_id_is_active[TOUCH_POINT_MAX] = {};
     for (int i = 0; i < touch_num; i++) {
         track_id_is_active[touches[i].track_id] = true;
@@ -168,7 +463,7 @@ void layout_screen_on_touch(int touch_num, esp_lcd_touch_point_data_t touches[5]
             invoke_callback_move(state, &touches[i]);
             continue;
         }
-        if (last_touch_points[touches[i].track_id].touched) continue;
+        if (last_touch_points[touches[i].track_id].touched || !ready) continue;
 
         const layout_input_t *input = find_input(touches[i].x, touches[i].y);
         if (!input) continue;
@@ -211,6 +506,12 @@ void layout_screen_on_touch(int touch_num, esp_lcd_touch_point_data_t touches[5]
             }
         }
     }
+
+    if (layout_switch_direction) {
+        int direction = layout_switch_direction;
+        layout_switch_direction = 0;
+        layout_screen_switch(layout_neighbor(current_layout_config, direction), direction);
+    }
 }
 
 void layout_screen_open(const layout_config_t *config) {
@@ -220,12 +521,17 @@ void layout_screen_open(const layout_config_t *config) {
             .direction = GPTIMER_COUNT_UP,
             .resolution_hz = 1000 * 1000,
         }, &gptimer));
-        ESP_ERROR_CHECK(gptimer_enable(gptimer));
-        ESP_ERROR_CHECK(gptimer_start(gptimer));
+        // The interval follows the connection interval, so the alarm is re-armed
+        // relative to itself instead of using auto-reload
+        ESP_ERROR_CHECK(gptimer_register_event_callbacks(gptimer, &(gptimer_event_callbacks_t){
+            .on_alarm = input_tick_alarm_callback,
+        }, NULL));
+        input_tick_mutex = xSemaphoreCreateMutex();
+        assert(input_tick_mutex);
+        trackpad_setup();
+        xTaskCreatePinnedToCore(input_tick_task, "InputTick", MEMORY_PLAN_SIZE_STACK_INPUT_TICK, NULL, 19, &input_tick_task_handle, 0);
     }
 
-    current_layout_config = config;
-    display_mux_layout_load_images(config->base_image, config->active_image);
-    display_mux_switch_mode(DISPLAY_MUX_MODE_LAYOUT);
+    layout_screen_switch(config, 1);
     display_mux_gui_screen_load(lv_obj_create(NULL));
 }
@@ -6,4 +6,4 @@
 #include "layouts/layout.h"
 
 void layout_screen_open(const layout_config_t *config);
-void layout_screen_on_touch(int touch_num, esp_lcd_touch_point_data_t touches[5]);
+void layout_screen_on_touch(int touch_num, esp_lcd_touch_point_data_t touches[5], int64_t irq_time);  // irq_time: esp_timer time of the touch interrupt
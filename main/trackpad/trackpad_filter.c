@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "trackpad_filter.h"
+#include <math.h>
+
+#define DEFAULT_SAMPLE_PERIOD (1.0f / 100)
+
+static float smoothing_factor(float cutoff, float period) {
+    float tau = 1.0f / (2.0f * (float)M_PI * cutoff);
+    return 1.0f / (1.0f + tau / period);
+}
+
+static int32_t backlash(int32_t output, float position, float dead_zone) {
+    if (position - output > dead_zone) return floorf(position - dead_zone);
+    if (output - position > dead_zone) return ceilf(position + dead_zone);
+    return output;
+}
+
+void trackpad_filter_init(trackpad_filter_t *filter, const trackpad_filter_config_t *config) {
+    *filter = (trackpad_filter_t){ .config = *config };
+}
+
+void trackpad_filter_reset(trackpad_filter_t *filter, uint16_t x, uint16_t y, uint32_t time_us) {
+    filter->last_time = time_us;
+    filter->position[0] = filter->output[0] = x;
+    filter->position[1] = filter->output[1] = y;
+    filter->speed[0] = filter->speed[1] = 0;
+}
+
+bool trackpad_filter_update(trackpad_filter_t *filter, uint16_t x, uint16_t y, uint32_t time_us, int16_t *dx, int16_t *dy) {
+    const trackpad_filter_config_t *config = &filter->config;
+    float period = (time_us - filter->last_time) / 1000000.0f;
+    if (period <= 0 || period > 0.1f) period = DEFAULT_SAMPLE_PERIOD;
+    filter->last_time = time_us;
+
+    // Speed estimate, low-passed at a fixed cutoff
+    float raw[2] = { x, y };
+    float alpha_d = smoothing_factor(config->d_cutoff, period);
+    for (int i = 0; i < 2; i++) {
+        float raw_speed = (raw[i] - filter->position[i]) / period;
+        filter->speed[i] += alpha_d * (raw_speed - filter->speed[i]);
+    }
+
+    // Position, low-passed at a speed dependent cutoff
+    float cutoff = config->min_cutoff + config->beta * hypotf(filter->speed[0], filter->speed[1]);
+    float alpha = smoothing_factor(cutoff, period);
+    int32_t delta[2];
+    for (int i = 0; i < 2; i++) {
+        filter->position[i] += alpha * (raw[i] - filter->position[i]);
+        int32_t output = backlash(filter->output[i], filter->position[i], config->dead_zone);
+        delta[i] = output - filter->output[i];
+        filter->output[i] = output;
+    }
+
+    *dx = delta[0];
+    *dy = delta[1];
+    return delta[0] != 0 || delta[1] != 0;
+}
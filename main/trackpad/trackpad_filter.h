@@ -0,0 +1,37 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// One-Euro filter (Casiez et al.) on trackpad coordinates followed by a
+// backlash dead-zone: slow/resting fingers are smoothed heavily, fast moves
+// raise the cutoff so they pass through without lag.
+typedef struct {
+    float min_cutoff;    // Cutoff frequency at rest (Hz)
+    float beta;          // Cutoff increase per px/s of speed
+    float d_cutoff;      // Cutoff frequency of the speed estimate (Hz)
+    uint16_t dead_zone;  // Direction changes smaller than this are dropped (px)
+} trackpad_filter_config_t;
+
+#define TRACKPAD_FILTER_CONFIG_DEFAULT() { \
+    .min_cutoff = 1.5f,                    \
+    .beta = 0.1f,                          \
+    .d_cutoff = 1.0f,                      \
+    .dead_zone = 1,                        \
+}
+
+typedef struct {
+    trackpad_filter_config_t config;
+    uint32_t last_time;
+    float position[2];
+    float speed[2];
+    int32_t output[2];
+} trackpad_filter_t;
+
+void trackpad_filter_init(trackpad_filter_t *filter, const trackpad_filter_config_t *config);
+void trackpad_filter_reset(trackpad_filter_t *filter, uint16_t x, uint16_t y, uint32_t time_us);
+bool trackpad_filter_update(trackpad_filter_t *filter, uint16_t x, uint16_t y, uint32_t time_us, int16_t *dx, int16_t *dy);
@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "trackpad_gesture.h"
+#include <stdlib.h>
+
+#define CALL(g, name, ...) do { if ((g)->callbacks.name) (g)->callbacks.name(__VA_ARGS__, (g)->callbacks.user_data); } while (0)
+
+// MARK: Button
+static void release_button(trackpad_gesture_t *g) {
+    if (!g->release.pending) return;
+    g->release.pending = false;
+    CALL(g, button, g->release.button, false);
+}
+
+static void click(trackpad_gesture_t *g, hid_device_mouse_button_t button, uint32_t time) {
+    release_button(g);
+    CALL(g, button, button, true);
+    g->release.pending = true;
+    g->release.button = button;
+    g->release.deadline = time + g->config.click_time;
+    CALL(g, schedule, g->release.deadline);
+}
+
+// MARK: State
+static void begin_touch(trackpad_gesture_t *g, trackpad_gesture_state_t state, uint32_t time) {
+    g->state = state;
+    g->finger_max = g->finger_num;
+    g->start = time;
+    g->travel = 0;
+}
+
+static bool is_tap(const trackpad_gesture_t *g, uint32_t time) {
+    return (time - g->start) < g->config.tap_time && g->travel < g->config.tap_slop;
+}
+
+static void tap(trackpad_gesture_t *g, uint32_t time) {
+    if (g->state == TRACKPAD_GESTURE_STATE_DRAG_PENDING) {
+        // Second tap of a double tap
+        click(g, HID_DEVICE_MOUSE_BUTTON_LEFT, time);
+        g->state = TRACKPAD_GESTURE_STATE_IDLE;
+        return;
+    }
+    if (g->finger_max == 1) {
+        click(g, HID_DEVICE_MOUSE_BUTTON_LEFT, time);
+        g->state = TRACKPAD_GESTURE_STATE_TAPPED;
+        g->tap_end = time;
+    } else {
+        click(g, g->finger_max == 2 ? HID_DEVICE_MOUSE_BUTTON_RIGHT : HID_DEVICE_MOUSE_BUTTON_MIDDLE, time);
+        g->state = TRACKPAD_GESTURE_STATE_IDLE;
+    }
+}
+
+// MARK: Public
+void trackpad_gesture_init(trackpad_gesture_t *gesture, const trackpad_gesture_config_t *config, const trackpad_gesture_callbacks_t *callbacks) {
+    *gesture = (trackpad_gesture_t){
+        .config = *config,
+        .callbacks = *callbacks,
+        .state = TRACKPAD_GESTURE_STATE_IDLE,
+    };
+}
+
+void trackpad_gesture_fingers(trackpad_gesture_t *g, uint8_t finger_num, uint32_t time) {
+    uint8_t prev = g->finger_num;
+    if (finger_num == prev) return;
+    g->finger_num = finger_num;
+
+    switch (g->state) {
+    case TRACKPAD_GESTURE_STATE_IDLE:
+        if (finger_num > 0) begin_touch(g, TRACKPAD_GESTURE_STATE_TOUCH, time);
+        break;
+
+    case TRACKPAD_GESTURE_STATE_TAPPED:
+        if (finger_num == 1 && (time - g->tap_end) < g->config.double_tap_time) {
+            begin_touch(g, TRACKPAD_GESTURE_STATE_DRAG_PENDING, time);
+        } else if (finger_num > 0) {
+            begin_touch(g, TRACKPAD_GESTURE_STATE_TOUCH, time);
+        }
+        break;
+
+    case TRACKPAD_GESTURE_STATE_TOUCH:
+    case TRACKPAD_GESTURE_STATE_DRAG_PENDING:
+        if (finger_num > g->finger_max) {
+            g->finger_max = finger_num;
+            g->state = TRACKPAD_GESTURE_STATE_TOUCH;
+        }
+        // Fingers of a multi-finger tap lift over several frames; decide on the last one
+        if (finger_num == 0) {
+            if (is_tap(g, time)) {
+                tap(g, time);
+            } else {
+                g->state = TRACKPAD_GESTURE_STATE_IDLE;
+            }
+        }
+        break;
+
+    case TRACKPAD_GESTURE_STATE_POINTER:
+        if (finger_num == 0) {
+            g->state = TRACKPAD_GESTURE_STATE_IDLE;
+        } else if (finger_num == 2) {
+            g->state = TRACKPAD_GESTURE_STATE_SCROLL;
+        } else if (finger_num > 2) {
+            g->state = TRACKPAD_GESTURE_STATE_WAIT_RELEASE;
+        }
+        break;
+
+    case TRACKPAD_GESTURE_STATE_SCROLL:
+        if (finger_num != 2) {
+            if (g->callbacks.scroll_end) g->callbacks.scroll_end(g->callbacks.user_data);
+            g->state = finger_num ? TRACKPAD_GESTURE_STATE_WAIT_RELEASE : TRACKPAD_GESTURE_STATE_IDLE;
+        }
+        break;
+
+    case TRACKPAD_GESTURE_STATE_SWIPE:
+        // Decided as soon as the first finger lifts
+        if (finger_num < prev) {
+            if (abs(g->swipe_dx) > abs(g->swipe_dy) && (uint32_t)abs(g->swipe_dx) >= g->config.swipe_distance * g->finger_max) {
+                CALL(g, swipe, g->swipe_dx > 0 ? 1 : -1);
+            }
+            g->state = finger_num ? TRACKPAD_GESTURE_STATE_WAIT_RELEASE : TRACKPAD_GESTURE_STATE_IDLE;
+        }
+        break;
+
+    case TRACKPAD_GESTURE_STATE_DRAG:
+        if (finger_num == 0) {
+            CALL(g, button, HID_DEVICE_MOUSE_BUTTON_LEFT, false);
+            g->state = TRACKPAD_GESTURE_STATE_IDLE;
+        }
+        break;
+
+    case TRACKPAD_GESTURE_STATE_WAIT_RELEASE:
+        if (finger_num == 0) g->state = TRACKPAD_GESTURE_STATE_IDLE;
+        break;
+    }
+}
+
+void trackpad_gesture_motion(trackpad_gesture_t *g, int16_t dx, int16_t dy, uint32_t time) {
+    switch (g->state) {
+    case TRACKPAD_GESTURE_STATE_TOUCH:
+        g->travel += abs(dx) + abs(dy);
+        if (g->finger_num == 1) {
+            CALL(g, move, dx, dy);
+            if (!is_tap(g, time)) g->state = TRACKPAD_GESTURE_STATE_POINTER;
+        } else if (g->travel >= g->config.tap_slop) {
+            if (g->finger_num == 2) {
+                g->state = TRACKPAD_GESTURE_STATE_SCROLL;
+                CALL(g, scroll, dx, dy, g->finger_num);
+            } else {
+                g->state = TRACKPAD_GESTURE_STATE_SWIPE;
+                g->swipe_dx = dx;
+                g->swipe_dy = dy;
+            }
+        }
+        break;
+
+    case TRACKPAD_GESTURE_STATE_SWIPE:
+        g->swipe_dx += dx;
+        g->swipe_dy += dy;
+        break;
+
+    case TRACKPAD_GESTURE_STATE_DRAG_PENDING:
+        g->travel += abs(dx) + abs(dy);
+        if (g->travel >= g->config.tap_slop) {
+            release_button(g);
+            CALL(g, button, HID_DEVICE_MOUSE_BUTTON_LEFT, true);
+            CALL(g, move, dx, dy);
+            g->state = TRACKPAD_GESTURE_STATE_DRAG;
+        }
+        break;
+
+    case TRACKPAD_GESTURE_STATE_POINTER:
+    case TRACKPAD_GESTURE_STATE_DRAG:
+        CALL(g, move, dx, dy);
+        break;
+
+    case TRACKPAD_GESTURE_STATE_SCROLL:
+        CALL(g, scroll, dx, dy, g->finger_num);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void trackpad_gesture_timeout(trackpad_gesture_t *g, uint32_t time) {
+    if (g->release.pending && (int32_t)(time - g->release.deadline) >= 0) {
+        release_button(g);
+    }
+}
+
+bool trackpad_gesture_pending(const trackpad_gesture_t *g) {
+    return g->release.pending;
+}
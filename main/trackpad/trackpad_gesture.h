@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "hid_device_mouse.h"
+
+// Trackpad gesture recognizer. It is fed finger count changes and per-frame
+// motion with explicit timestamps, and reports buttons, cursor motion and
+// scroll through callbacks. Every call is O(1).
+//
+//   1 finger tap             -> left click
+//   2 finger tap             -> right click
+//   3 finger tap             -> middle click
+//   tap, tap                 -> two left clicks (double click)
+//   tap, touch and move      -> left button held while moving (drag)
+//   2 finger move            -> scroll
+//   3+ finger swipe          -> swipe, left or right
+//
+// Clicks are pressed immediately and released at a deadline reported through
+// `schedule`; the owner calls trackpad_gesture_timeout() once it has passed.
+
+typedef enum {
+    TRACKPAD_GESTURE_STATE_IDLE,
+    TRACKPAD_GESTURE_STATE_TOUCH,         // Fingers down, may still become a tap
+    TRACKPAD_GESTURE_STATE_POINTER,       // One finger moving the cursor
+    TRACKPAD_GESTURE_STATE_SCROLL,        // Two fingers scrolling
+    TRACKPAD_GESTURE_STATE_SWIPE,         // Three or more fingers moving
+    TRACKPAD_GESTURE_STATE_TAPPED,        // Tap emitted, waiting for a second touch
+    TRACKPAD_GESTURE_STATE_DRAG_PENDING,  // Second touch after a tap: double tap or drag
+    TRACKPAD_GESTURE_STATE_DRAG,          // Left button held while moving
+    TRACKPAD_GESTURE_STATE_WAIT_RELEASE,  // Gesture done, ignore input until all fingers lift
+} trackpad_gesture_state_t;
+
+typedef struct {
+    uint32_t tap_time;         // Max touch duration of a tap (us)
+    uint32_t tap_slop;         // Max travel of a tap (px, L1 distance)
+    uint32_t double_tap_time;  // Max gap between a tap and the next touch (us)
+    uint32_t click_time;       // How long a tap holds the button down (us)
+    uint32_t swipe_distance;   // Min horizontal travel of a swipe (px, per finger)
+} trackpad_gesture_config_t;
+
+#define TRACKPAD_GESTURE_CONFIG_DEFAULT() { \
+    .tap_time = 200 * 1000,                 \
+    .tap_slop = 8,                          \
+    .double_tap_time = 250 * 1000,          \
+    .click_time = 15 * 1000,                \
+    .swipe_distance = 120,                  \
+}
+
+typedef struct {
+    void (*button)(hid_device_mouse_button_t button, bool pressed, void *user_data);
+    void (*move)(int16_t dx, int16_t dy, void *user_data);
+    void (*scroll)(int16_t dx, int16_t dy, int finger_num, void *user_data);
+    void (*scroll_end)(void *user_data);
+    void (*schedule)(uint32_t time_us, void *user_data);
+    void (*swipe)(int direction, void *user_data);  // 1 to the right, -1 to the left
+    void *user_data;
+} trackpad_gesture_callbacks_t;
+
+typedef struct {
+    trackpad_gesture_config_t config;
+    trackpad_gesture_callbacks_t callbacks;
+    trackpad_gesture_state_t state;
+    uint8_t finger_num;
+    uint8_t finger_max;
+    uint32_t start;
+    uint32_t travel;
+    uint32_t tap_end;
+    int32_t swipe_dx, swipe_dy;  // Summed over fingers
+    struct {
+        bool pending;
+        hid_device_mouse_button_t button;
+        uint32_t deadline;
+    } release;
+} trackpad_gesture_t;
+
+void trackpad_gesture_init(trackpad_gesture_t *gesture, const trackpad_gesture_config_t *config, const trackpad_gesture_callbacks_t *callbacks);
+void trackpad_gesture_fingers(trackpad_gesture_t *gesture, uint8_t finger_num, uint32_t time_us);
+void trackpad_gesture_motion(trackpad_gesture_t *gesture, int16_t dx, int16_t dy, uint32_t time_us);
+void trackpad_gesture_timeout(trackpad_gesture_t *gesture, uint32_t time_us);
+bool trackpad_gesture_pending(const trackpad_gesture_t *gesture);
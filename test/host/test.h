@@ -0,0 +1,23 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#pragma once
+#include <stdio.h>
+#include <stdlib.h>
+
+// Minimal checks for the host tests: failures are printed and counted, the
+// test returns TEST_RESULT() from main for ctest.
+static int test_failures;
+
+#define TEST_CHECK(cond, ...) do {                                       \
+    if (!(cond)) {                                                       \
+        fprintf(stderr, "%s:%d: check failed: %s: ", __FILE__, __LINE__, #cond); \
+        fprintf(stderr, __VA_ARGS__);                                    \
+        fputc('\n', stderr);                                             \
+        test_failures++;                                                 \
+    }                                                                    \
+} while (0)
+
+#define TEST_RESULT() (test_failures ? EXIT_FAILURE : EXIT_SUCCESS)
@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "test.h"
+#include "misc/bsp_touch.h"
+
+#define PANEL ((bsp_size_t){ 720, 1280 })
+
+static const struct {
+    bsp_touch_rotation_t rotation;
+    uint32_t scale;
+    bsp_point_t in, out;
+} cases[] = {
+    // Corners of the portrait panel in each rotation
+    { BSP_TOUCH_ROTATION_0, 0, { 0, 0 }, { 0, 0 } },
+    { BSP_TOUCH_ROTATION_0, 0, { 720, 0 }, { 720, 0 } },
+    { BSP_TOUCH_ROTATION_0, 0, { 0, 1280 }, { 0, 1280 } },
+    { BSP_TOUCH_ROTATION_0, 0, { 720, 1280 }, { 720, 1280 } },
+    { BSP_TOUCH_ROTATION_90, 0, { 0, 0 }, { 1280, 0 } },
+    { BSP_TOUCH_ROTATION_90, 0, { 720, 0 }, { 1280, 720 } },
+    { BSP_TOUCH_ROTATION_90, 0, { 0, 1280 }, { 0, 0 } },
+    { BSP_TOUCH_ROTATION_90, 0, { 720, 1280 }, { 0, 720 } },
+    { BSP_TOUCH_ROTATION_180, 0, { 0, 0 }, { 720, 1280 } },
+    { BSP_TOUCH_ROTATION_180, 0, { 720, 0 }, { 0, 1280 } },
+    { BSP_TOUCH_ROTATION_180, 0, { 0, 1280 }, { 720, 0 } },
+    { BSP_TOUCH_ROTATION_180, 0, { 720, 1280 }, { 0, 0 } },
+    { BSP_TOUCH_ROTATION_270, 0, { 0, 0 }, { 0, 720 } },
+    { BSP_TOUCH_ROTATION_270, 0, { 720, 0 }, { 0, 0 } },
+    { BSP_TOUCH_ROTATION_270, 0, { 0, 1280 }, { 1280, 720 } },
+    { BSP_TOUCH_ROTATION_270, 0, { 720, 1280 }, { 1280, 0 } },
+    { BSP_TOUCH_ROTATION_90, 0, { 100, 200 }, { 1080, 100 } },
+    { BSP_TOUCH_ROTATION_270, 0, { 100, 200 }, { 200, 620 } },
+
+    // Scaling after the rotation, the GUI mode maps 1280x720 onto 640x360
+    { BSP_TOUCH_ROTATION_0, BSP_TOUCH_SCALE_ONE, { 719, 1279 }, { 719, 1279 } },
+    { BSP_TOUCH_ROTATION_90, BSP_TOUCH_SCALE(640, 1280), { 0, 0 }, { 640, 0 } },
+    { BSP_TOUCH_ROTATION_90, BSP_TOUCH_SCALE(640, 1280), { 720, 1280 }, { 0, 360 } },
+    { BSP_TOUCH_ROTATION_90, BSP_TOUCH_SCALE(640, 1280), { 101, 201 }, { 539, 50 } },
+    { BSP_TOUCH_ROTATION_180, BSP_TOUCH_SCALE(2, 1), { 0, 0 }, { 1440, 2560 } },
+    { BSP_TOUCH_ROTATION_0, BSP_TOUCH_SCALE(2, 3), { 720, 1280 }, { 480, 853 } },
+    { BSP_TOUCH_ROTATION_0, BSP_TOUCH_SCALE(2, 3), { 3, 6 }, { 2, 4 } },
+};
+
+int main(void) {
+    TEST_CHECK(BSP_TOUCH_SCALE(640, 1280) == BSP_TOUCH_SCALE_ONE / 2, "0x%x", BSP_TOUCH_SCALE(640, 1280));
+    TEST_CHECK(BSP_TOUCH_SCALE(1, 1) == BSP_TOUCH_SCALE_ONE, "0x%x", BSP_TOUCH_SCALE(1, 1));
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bsp_touch_transform_t transform = { cases[i].rotation, cases[i].scale };
+        bsp_point_t out = bsp_touch_transform_point(transform, PANEL, cases[i].in);
+        TEST_CHECK(out.x == cases[i].out.x && out.y == cases[i].out.y, "case %zu: (%d, %d) -> (%d, %d), expected (%d, %d)",
+                   i, cases[i].in.x, cases[i].in.y, out.x, out.y, cases[i].out.x, cases[i].out.y);
+    }
+
+    // 90 then 270 on the rotated size, and 180 twice, give the point back
+    for (int x = 0; x <= 720; x += 45) {
+        for (int y = 0; y <= 1280; y += 80) {
+            bsp_point_t point = { x, y };
+            bsp_point_t landscape = bsp_touch_transform_point((bsp_touch_transform_t){ .rotation = BSP_TOUCH_ROTATION_90 }, PANEL, point);
+            bsp_point_t back = bsp_touch_transform_point((bsp_touch_transform_t){ .rotation = BSP_TOUCH_ROTATION_270 }, (bsp_size_t){ 1280, 720 }, landscape);
+            TEST_CHECK(back.x == x && back.y == y, "90/270 (%d, %d) -> (%d, %d)", x, y, back.x, back.y);
+            bsp_point_t flipped = bsp_touch_transform_point((bsp_touch_transform_t){ .rotation = BSP_TOUCH_ROTATION_180 }, PANEL, point);
+            back = bsp_touch_transform_point((bsp_touch_transform_t){ .rotation = BSP_TOUCH_ROTATION_180 }, PANEL, flipped);
+            TEST_CHECK(back.x == x && back.y == y, "180/180 (%d, %d) -> (%d, %d)", x, y, back.x, back.y);
+        }
+    }
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "test.h"
+#include "layout_dirty.h"
+
+// Only compared by address
+#define IMAGE_A ((const struct display_mux_layout_bitmap *)0x1000)
+#define IMAGE_B ((const struct display_mux_layout_bitmap *)0x2000)
+
+#define RECT(x, y, w, h) ((bsp_rect_t){ { x, y }, { w, h } })
+#define DIRTY(image, sx, sy, x, y, w, h, alpha) { image, { sx, sy }, { { x, y }, { w, h } }, alpha }
+
+static bool rect_equal(bsp_rect_t a, bsp_rect_t b) {
+    return a.origin.x == b.origin.x && a.origin.y == b.origin.y && a.size.width == b.size.width && a.size.height == b.size.height;
+}
+
+static const struct {
+    const char *name;
+    layout_dirty_t a, b;
+    bool merged;
+    layout_dirty_t result;
+} merge_cases[] = {
+    { "side by side", DIRTY(IMAGE_A, 10, 20, 100, 0, 50, 40, 0), DIRTY(IMAGE_A, 60, 20, 150, 0, 30, 40, 0),
+      true, DIRTY(IMAGE_A, 10, 20, 100, 0, 80, 40, 0) },
+    { "stacked", DIRTY(IMAGE_A, 0, 40, 0, 40, 50, 40, 0), DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 0),
+      true, DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 80, 0) },
+    { "overlapping", DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 0), DIRTY(IMAGE_A, 20, 0, 20, 0, 50, 40, 0),
+      true, DIRTY(IMAGE_A, 0, 0, 0, 0, 70, 40, 0) },
+    { "same tint", DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 128), DIRTY(IMAGE_A, 50, 0, 50, 0, 50, 40, 128),
+      true, DIRTY(IMAGE_A, 0, 0, 0, 0, 100, 40, 128) },
+    { "other image", DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 0), DIRTY(IMAGE_B, 50, 0, 50, 0, 50, 40, 0), false, {} },
+    { "other alpha", DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 0), DIRTY(IMAGE_A, 50, 0, 50, 0, 50, 40, 64), false, {} },
+    { "other offset", DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 0), DIRTY(IMAGE_A, 0, 0, 50, 0, 50, 40, 0), false, {} },
+    { "apart", DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 0), DIRTY(IMAGE_A, 51, 0, 51, 0, 50, 40, 0), false, {} },
+    { "L shape", DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 0), DIRTY(IMAGE_A, 50, 0, 50, 0, 50, 80, 0), false, {} },
+    { "corner only", DIRTY(IMAGE_A, 0, 0, 0, 0, 50, 40, 0), DIRTY(IMAGE_A, 50, 40, 50, 40, 50, 40, 0), false, {} },
+};
+
+int main(void) {
+    for (size_t i = 0; i < sizeof(merge_cases) / sizeof(merge_cases[0]); i++) {
+        layout_dirty_t a = merge_cases[i].a;
+        bool merged = layout_dirty_merge(&a, &merge_cases[i].b);
+        TEST_CHECK(merged == merge_cases[i].merged, "%s", merge_cases[i].name);
+        const layout_dirty_t *expected = merged ? &merge_cases[i].result : &merge_cases[i].a;
+        TEST_CHECK(rect_equal(a.rect, expected->rect) && a.source.x == expected->source.x && a.source.y == expected->source.y,
+                   "%s: (%d, %d %dx%d) from (%d, %d)", merge_cases[i].name,
+                   a.rect.origin.x, a.rect.origin.y, a.rect.size.width, a.rect.size.height, a.source.x, a.source.y);
+    }
+
+    // A row whose middle arrives last merges in a second pass, other images keep their place
+    layout_dirty_t dirty[] = {
+        DIRTY(IMAGE_A, 0, 0, 0, 0, 40, 40, 0),
+        DIRTY(IMAGE_B, 0, 0, 0, 100, 40, 40, 0),
+        DIRTY(IMAGE_A, 80, 0, 80, 0, 40, 40, 0),
+        DIRTY(IMAGE_A, 40, 0, 40, 0, 40, 40, 0),
+    };
+    int dirty_num = layout_dirty_compact(dirty, 4);
+    TEST_CHECK(dirty_num == 2, "%d", dirty_num);
+    TEST_CHECK(dirty[0].image == IMAGE_A && rect_equal(dirty[0].rect, RECT(0, 0, 120, 40)), "%dx%d", dirty[0].rect.size.width, dirty[0].rect.size.height);
+    TEST_CHECK(dirty[1].image == IMAGE_B && rect_equal(dirty[1].rect, RECT(0, 100, 40, 40)), "second entry moved");
+
+    // Landscape 1280x720 layout space onto the portrait panel
+    bsp_rect_t panel = layout_dirty_panel_rect(RECT(0, 0, 100, 50), 1280);
+    TEST_CHECK(rect_equal(panel, RECT(0, 1180, 50, 100)), "(%d, %d %dx%d)", panel.origin.x, panel.origin.y, panel.size.width, panel.size.height);
+    panel = layout_dirty_panel_rect(RECT(1180, 620, 100, 100), 1280);
+    TEST_CHECK(rect_equal(panel, RECT(620, 0, 100, 100)), "(%d, %d %dx%d)", panel.origin.x, panel.origin.y, panel.size.width, panel.size.height);
+    panel = layout_dirty_panel_rect(RECT(0, 0, 1280, 720), 1280);
+    TEST_CHECK(rect_equal(panel, RECT(0, 0, 720, 1280)), "(%d, %d %dx%d)", panel.origin.x, panel.origin.y, panel.size.width, panel.size.height);
+
+    return TEST_RESULT();
+}
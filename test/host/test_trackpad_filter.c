@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "test.h"
+#include "trackpad_filter.h"
+#include <stdint.h>
+#include <string.h>
+
+#define TRACE_SAMPLE_MAX (1024)
+
+typedef struct {
+    uint32_t time;
+    uint16_t x, y;
+} trace_sample_t;
+
+typedef struct {
+    int raw_reports;       // Frames with a nonzero delta, what the touch path sent before the filter
+    int filtered_reports;  // Frames the filter reported motion for
+    int lag_max;           // Of the output behind the raw x, from moving_from on
+    int final_error;       // Output minus raw position after the last frame, L1
+} replay_result_t;
+
+static int load_trace(const char *name, trace_sample_t *samples) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", TRACE_DIR, name);
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    int count = 0;
+    char line[128];
+    while (fgets(line, sizeof(line), file) && count < TRACE_SAMPLE_MAX) {
+        unsigned time, x, y;
+        if (line[0] == '#' || sscanf(line, "%u,%u,%u", &time, &x, &y) != 3) continue;
+        samples[count++] = (trace_sample_t){ time, x, y };
+    }
+    fclose(file);
+    return count;
+}
+
+static replay_result_t replay(const char *name, int moving_from) {
+    static trace_sample_t samples[TRACE_SAMPLE_MAX];
+    int count = load_trace(name, samples);
+    TEST_CHECK(count > 1, "%s has no samples", name);
+
+    trackpad_filter_t filter;
+    trackpad_filter_init(&filter, &(trackpad_filter_config_t)TRACKPAD_FILTER_CONFIG_DEFAULT());
+    trackpad_filter_reset(&filter, samples[0].x, samples[0].y, samples[0].time);
+
+    replay_result_t result = {};
+    int32_t output[2] = { samples[0].x, samples[0].y };
+    for (int i = 1; i < count; i++) {
+        if (samples[i].x != samples[i - 1].x || samples[i].y != samples[i - 1].y) result.raw_reports++;
+        int16_t dx, dy;
+        if (trackpad_filter_update(&filter, samples[i].x, samples[i].y, samples[i].time, &dx, &dy)) result.filtered_reports++;
+        output[0] += dx;
+        output[1] += dy;
+        if (moving_from >= 0 && i >= moving_from) {
+            int lag = samples[i].x - output[0];
+            if (lag > result.lag_max) result.lag_max = lag;
+        }
+    }
+    result.final_error = abs(output[0] - samples[count - 1].x) + abs(output[1] - samples[count - 1].y);
+    printf("%-10s raw %3d -> filtered %3d reports, lag max %d px, final error %d px\n",
+           name, result.raw_reports, result.filtered_reports, result.lag_max, result.final_error);
+    return result;
+}
+
+int main(void) {
+    // A resting finger stops producing reports
+    replay_result_t rest = replay("rest.csv", -1);
+    TEST_CHECK(rest.raw_reports >= 100, "%d", rest.raw_reports);
+    TEST_CHECK(rest.filtered_reports == 0, "%d", rest.filtered_reports);
+    TEST_CHECK(rest.final_error <= 2, "%d", rest.final_error);
+
+    // Slow drift keeps moving the cursor with a fraction of the reports
+    replay_result_t drift = replay("drift.csv", -1);
+    TEST_CHECK(drift.filtered_reports * 3 <= drift.raw_reports, "%d of %d", drift.filtered_reports, drift.raw_reports);
+    TEST_CHECK(drift.filtered_reports >= 20, "%d", drift.filtered_reports);
+    TEST_CHECK(drift.final_error <= 3, "%d", drift.final_error);
+
+    // A fast swipe, 15 px per frame at 100 Hz, lags less than one frame of motion
+    replay_result_t swipe = replay("swipe.csv", 15);
+    TEST_CHECK(swipe.lag_max <= 8, "%d", swipe.lag_max);
+    TEST_CHECK(swipe.final_error <= 5, "%d", swipe.final_error);
+
+    return TEST_RESULT();
+}
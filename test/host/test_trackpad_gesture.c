@@ -0,0 +1,115 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2026 Hiroki Kawakami
+ */
+
+#include "test.h"
+#include "trackpad_gesture.h"
+#include <stdarg.h>
+#include <string.h>
+
+// Each case feeds a timeline of finger counts, motion and timeouts, and
+// compares the callbacks it produced, logged as text, with the expected ones
+typedef enum { END, FINGERS, MOTION, TIMEOUT } step_type_t;
+
+typedef struct {
+    step_type_t type;
+    uint32_t time_ms;
+    int a, b;  // Finger count, or dx and dy
+} step_t;
+
+#define F(time, n) { FINGERS, time, n, 0 }
+#define M(time, dx, dy) { MOTION, time, dx, dy }
+#define T(time) { TIMEOUT, time, 0, 0 }
+
+static const struct {
+    const char *name;
+    step_t steps[16];
+    const char *events;
+} cases[] = {
+    { "tap", { F(0, 1), F(100, 0), T(110), T(115) }, "L+ @115 L-" },
+    { "tap expires", { F(0, 1), F(250, 0) }, "" },
+    { "tap slop", { F(0, 1), M(20, 5, 5), F(100, 0) }, "m5,5" },
+    { "right click", { F(0, 1), F(10, 2), F(90, 1), F(100, 0), T(115) }, "R+ @115 R-" },
+    { "middle click", { F(0, 2), F(10, 3), F(100, 0), T(115) }, "M+ @115 M-" },
+    { "double tap", { F(0, 1), F(100, 0), T(115), F(200, 1), F(260, 0), T(275) }, "L+ @115 L- L+ @275 L-" },
+    { "taps apart", { F(0, 1), F(100, 0), T(115), F(400, 1), F(450, 0), T(465) }, "L+ @115 L- L+ @465 L-" },
+    { "tap and drag", { F(0, 1), F(100, 0), T(115), F(200, 1), M(220, 10, 0), M(230, 5, 0), F(300, 0) },
+      "L+ @115 L- L+ m10,0 m5,0 L-" },
+    { "drag before release", { F(0, 1), F(100, 0), F(110, 1), M(120, 10, 0), F(200, 0) }, "L+ @115 L- L+ m10,0 L-" },
+    { "scroll", { F(0, 2), M(10, 0, 4), M(20, 0, 6), M(30, 0, 10), F(40, 0) }, "s0,6,2 s0,10,2 se" },
+    { "scroll lift one", { F(0, 2), M(10, 0, 10), F(20, 1), M(30, 0, 10), F(40, 0) }, "s0,10,2 se" },
+    { "swipe right", { F(0, 3), M(10, 60, 0), M(20, 300, 0), M(30, 30, 0), F(40, 2), F(50, 0) }, "sw1" },
+    { "swipe left", { F(0, 3), M(10, -60, 0), M(20, -300, 0), M(30, -30, 0), F(40, 0) }, "sw-1" },
+    { "swipe short", { F(0, 3), M(10, 60, 0), M(20, 240, 0), F(40, 0) }, "" },
+    { "swipe vertical", { F(0, 3), M(10, 100, 400), F(40, 0) }, "" },
+};
+
+static char events[256];
+
+static void log_event(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static void log_event(const char *format, ...) {
+    size_t len = strlen(events);
+    if (len) events[len++] = ' ';
+    va_list args;
+    va_start(args, format);
+    vsnprintf(events + len, sizeof(events) - len, format, args);
+    va_end(args);
+}
+
+static void on_button(hid_device_mouse_button_t button, bool pressed, void *user_data) {
+    log_event("%c%c", "LRM"[button], pressed ? '+' : '-');
+}
+
+static void on_move(int16_t dx, int16_t dy, void *user_data) {
+    log_event("m%d,%d", dx, dy);
+}
+
+static void on_scroll(int16_t dx, int16_t dy, int finger_num, void *user_data) {
+    log_event("s%d,%d,%d", dx, dy, finger_num);
+}
+
+static void on_scroll_end(void *user_data) {
+    log_event("se");
+}
+
+static void on_schedule(uint32_t time_us, void *user_data) {
+    log_event("@%u", (unsigned)(time_us / 1000));
+}
+
+static void on_swipe(int direction, void *user_data) {
+    log_event("sw%d", direction);
+}
+
+int main(void) {
+    trackpad_gesture_config_t config = TRACKPAD_GESTURE_CONFIG_DEFAULT();
+    trackpad_gesture_callbacks_t callbacks = {
+        .button = on_button,
+        .move = on_move,
+        .scroll = on_scroll,
+        .scroll_end = on_scroll_end,
+        .schedule = on_schedule,
+        .swipe = on_swipe,
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        trackpad_gesture_t gesture;
+        trackpad_gesture_init(&gesture, &config, &callbacks);
+        events[0] = '\0';
+        for (const step_t *step = cases[i].steps; step->type != END; step++) {
+            uint32_t time = step->time_ms * 1000;
+            switch (step->type) {
+            case FINGERS: trackpad_gesture_fingers(&gesture, step->a, time); break;
+            case MOTION: trackpad_gesture_motion(&gesture, step->a, step->b, time); break;
+            case TIMEOUT: trackpad_gesture_timeout(&gesture, time); break;
+            default: break;
+            }
+        }
+        TEST_CHECK(strcmp(events, cases[i].events) == 0, "%s: \"%s\", expected \"%s\"", cases[i].name, events, cases[i].events);
+        TEST_CHECK(!trackpad_gesture_pending(&gesture), "%s: release still pending", cases[i].name);
+        TEST_CHECK(gesture.state == TRACKPAD_GESTURE_STATE_IDLE || gesture.state == TRACKPAD_GESTURE_STATE_TAPPED,
+                   "%s: ended in state %d", cases[i].name, gesture.state);
+    }
+
+    return TEST_RESULT();
+}